@@ -175,6 +175,12 @@ rapp_bmark_exec_bin_bin_ip(int (*func)(), const int *args);
 static void
 rapp_bmark_exec_bin_bin_iip(int (*func)(), const int *args);
 
+static void
+rapp_bmark_exec_u8_u8_iip(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_bin_u8_iip(int (*func)(), const int *args);
+
 static void
 rapp_bmark_exec_u8_bin(int (*func)(), const int *args);
 
@@ -196,6 +202,24 @@ rapp_bmark_exec_u8_u8_p(int (*func)(), const int *args);
 static void
 rapp_bmark_exec_thresh_pixel(int (*func)(), const int *args);
 
+static void
+rapp_bmark_exec_thresh_auto(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_thresh_adaptive(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_thresh_absdiff(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_bgmodel(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_motion(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_match(int (*func)(), const int *args);
+
 static void
 rapp_bmark_exec_expand(int (*func)(), const int *args);
 
@@ -229,6 +253,84 @@ rapp_bmark_exec_scatter(int (*func)(), const int *args);
 static void
 rapp_bmark_exec_scatter_bin(int (*func)(), const int *args);
 
+static void
+rapp_bmark_exec_conv(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_sep(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_gauss(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_rank(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_sobel_dir(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_sobel_grad(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u8_s16(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u8_u32(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_census_cost(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_census_cost_u32(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_feature(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_resize(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u16(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u16_p(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u16_u16(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u16_bin(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u16_u8_p(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u8_hist(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u8_hist_bins(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u8_mask(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_bin_loc(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u8_loc(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u8_max_k(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u8_tiles(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_u8_ssim(int (*func)(), const int *args);
+
+static void
+rapp_bmark_exec_clahe(int (*func)(), const int *args);
+
 
 /*
  * -------------------------------------------------------------
@@ -240,6 +342,11 @@ static volatile int rapp_bmark_done = 0;
 
 static rapp_bmark_data_t rapp_bmark_data;
 
+/**
+ *  Box filter kernel for the user-kernel convolutions.
+ */
+static int8_t rapp_bmark_kernel[15*15];
+
 static const rapp_bmark_table_t rapp_bmark_suite[] = {
     /* rapp_bitblt_bin functions */
     RAPP_BMARK_ENTRY(bitblt_copy_bin, "aligned",      bin_bin_off, 0, 0),
@@ -270,6 +377,13 @@ static const rapp_bmark_table_t rapp_bmark_suite[] = {
     RAPP_BMARK_ENTRY(pixop_lerpn_u8,  NULL,  u8_u8, 7, 0),
     RAPP_BMARK_ENTRY(pixop_lerpi_u8,  NULL,  u8_u8, 7, 0),
     RAPP_BMARK_ENTRY(pixop_norm_u8,   NULL,  u8_u8, 0, 0),
+    RAPP_BMARK_ENTRY(pixop_add_u16,    NULL, u16_u16,  0, 0),
+    RAPP_BMARK_ENTRY(pixop_sub_u16,    NULL, u16_u16,  0, 0),
+    RAPP_BMARK_ENTRY(pixop_suba_u16,   NULL, u16_u16,  0, 0),
+    RAPP_BMARK_ENTRY(pixop_lut_u16_u8, NULL, u16_u8_p, 8, 0),
+    RAPP_BMARK_ENTRY(pixop_equalize_u8, NULL,  u8,    0,  0),
+    RAPP_BMARK_ENTRY(pixop_clahe_u8,    "2x2", clahe, 2,  64),
+    RAPP_BMARK_ENTRY(pixop_clahe_u8,    "8x8", clahe, 8,  64),
 
     /* rapp_type functions */
     RAPP_BMARK_ENTRY(type_u8_to_bin,  NULL,  u8_bin, 0, 0),
@@ -283,10 +397,32 @@ static const rapp_bmark_table_t rapp_bmark_suite[] = {
     RAPP_BMARK_ENTRY(thresh_lt_pixel_u8,   NULL, thresh_pixel, 1, 0),
     RAPP_BMARK_ENTRY(thresh_gtlt_pixel_u8, NULL, thresh_pixel, 2, 0),
     RAPP_BMARK_ENTRY(thresh_ltgt_pixel_u8, NULL, thresh_pixel, 2, 0),
+    RAPP_BMARK_ENTRY(thresh_gt_u16,  NULL, u16_bin, 0x8000, 0),
+    RAPP_BMARK_ENTRY(thresh_lt_u16,  NULL, u16_bin, 0x8000, 0),
+    RAPP_BMARK_ENTRY(thresh_auto_u8, "otsu",      thresh_auto, 0, 0),
+    RAPP_BMARK_ENTRY(thresh_auto_u8, "otsu-prev", thresh_auto, 0, 1),
+    RAPP_BMARK_ENTRY(thresh_adaptive_u8, "r=2",  thresh_adaptive, 2,  0),
+    RAPP_BMARK_ENTRY(thresh_adaptive_u8, "r=8",  thresh_adaptive, 8,  0),
+    RAPP_BMARK_ENTRY(thresh_adaptive_u8, "r=15", thresh_adaptive, 15, 0),
+    RAPP_BMARK_ENTRY(thresh_absdiff_gt_u8,   NULL, thresh_absdiff, 20, 0),
+    RAPP_BMARK_ENTRY(thresh_absdiff_hyst_u8, NULL, thresh_absdiff, 20, 40),
+    /* rapp_bgmodel functions */
+    RAPP_BMARK_ENTRY(bgmodel_update_u8, "mean",     bgmodel, 8, 0),
+    RAPP_BMARK_ENTRY(bgmodel_update_u8, "mean+dev", bgmodel, 8, 1),
+    /* rapp_motion functions */
+    RAPP_BMARK_ENTRY(motion_blockmatch_u8, "16x16", motion, 16, 0),
+    RAPP_BMARK_ENTRY(motion_blockmatch_u8, "16x16 pyramid", motion, 16, 2),
+    /* rapp_match functions */
+    RAPP_BMARK_ENTRY(match_template_u8, "SAD", match, RAPP_MATCH_SAD, 0),
+    RAPP_BMARK_ENTRY(match_template_u8, "SSD", match, RAPP_MATCH_SSD, 0),
+    RAPP_BMARK_ENTRY(match_template_u8, "NCC", match, RAPP_MATCH_NCC, 0),
+    RAPP_BMARK_ENTRY(match_template_u8, "NCC pyramid",
+                     match, RAPP_MATCH_NCC, 2),
     /* rapp_reduce functions */
     RAPP_BMARK_ENTRY(reduce_1x2_u8, NULL, u8_u8, 0, 0),
     RAPP_BMARK_ENTRY(reduce_2x1_u8, NULL, u8_u8, 0, 0),
     RAPP_BMARK_ENTRY(reduce_2x2_u8, NULL, u8_u8, 0, 0),
+    RAPP_BMARK_ENTRY(reduce_2x2_u16, NULL, u16_u16, 0, 0),
     /* rapp_reduce_bin functions */
     RAPP_BMARK_ENTRY(reduce_1x2_rk1_bin, NULL, bin_bin, 0, 0),
     RAPP_BMARK_ENTRY(reduce_1x2_rk2_bin, NULL, bin_bin, 0, 0),
@@ -296,6 +432,11 @@ static const rapp_bmark_table_t rapp_bmark_suite[] = {
     RAPP_BMARK_ENTRY(reduce_2x2_rk2_bin, NULL, bin_bin, 0, 0),
     RAPP_BMARK_ENTRY(reduce_2x2_rk3_bin, NULL, bin_bin, 0, 0),
     RAPP_BMARK_ENTRY(reduce_2x2_rk4_bin, NULL, bin_bin, 0, 0),
+    /* rapp_resize functions */
+    RAPP_BMARK_ENTRY(resize_u8, "nearest",  resize, RAPP_RESIZE_NEAREST,  0),
+    RAPP_BMARK_ENTRY(resize_u8, "bilinear", resize, RAPP_RESIZE_BILINEAR, 0),
+    RAPP_BMARK_ENTRY(resize_u8, "area",     resize, RAPP_RESIZE_AREA,     0),
+    RAPP_BMARK_ENTRY(resize_u8, "upscale",  resize, RAPP_RESIZE_BILINEAR, 1),
     /* rapp_expand_bin functions */
     RAPP_BMARK_ENTRY(expand_1x2_bin, NULL, expand, 0, 0),
     RAPP_BMARK_ENTRY(expand_2x2_bin, NULL, expand, 0, 0),
@@ -317,6 +458,36 @@ static const rapp_bmark_table_t rapp_bmark_suite[] = {
     RAPP_BMARK_ENTRY(stat_max_bin, NULL, bin,     0, 0),
     RAPP_BMARK_ENTRY(stat_min_u8,  NULL, u8,      0, 0),
     RAPP_BMARK_ENTRY(stat_max_u8,  NULL, u8,      0, 0),
+    RAPP_BMARK_ENTRY(stat_sum_u16, NULL, u16_p,   0, 0),
+    RAPP_BMARK_ENTRY(stat_min_u16, NULL, u16,     0, 0),
+    RAPP_BMARK_ENTRY(stat_max_u16, NULL, u16,     0, 0),
+    RAPP_BMARK_ENTRY(stat_hist_u8, "nomask", u8_hist, 0, 0),
+    RAPP_BMARK_ENTRY(stat_hist_u8, "mask",   u8_hist, 1, 0),
+    RAPP_BMARK_ENTRY(stat_hist_bins_u8, "16", u8_hist_bins, 0, 16),
+    RAPP_BMARK_ENTRY(stat_sum_mask_u8,  "empty",   u8_mask, 2, 0),
+    RAPP_BMARK_ENTRY(stat_sum_mask_u8,  "full",    u8_mask, 0, 0),
+    RAPP_BMARK_ENTRY(stat_sum_mask_u8,  "checker", u8_mask, 3, 0),
+    RAPP_BMARK_ENTRY(stat_sum2_mask_u8, "empty",   u8_mask, 2, 0),
+    RAPP_BMARK_ENTRY(stat_sum2_mask_u8, "full",    u8_mask, 0, 0),
+    RAPP_BMARK_ENTRY(stat_sum2_mask_u8, "checker", u8_mask, 3, 0),
+    RAPP_BMARK_ENTRY(stat_min_mask_u8,  "empty",   u8_mask, 2, 0),
+    RAPP_BMARK_ENTRY(stat_min_mask_u8,  "full",    u8_mask, 0, 0),
+    RAPP_BMARK_ENTRY(stat_min_mask_u8,  "checker", u8_mask, 3, 0),
+    RAPP_BMARK_ENTRY(stat_max_mask_u8,  "empty",   u8_mask, 2, 0),
+    RAPP_BMARK_ENTRY(stat_max_mask_u8,  "full",    u8_mask, 0, 0),
+    RAPP_BMARK_ENTRY(stat_max_mask_u8,  "checker", u8_mask, 3, 0),
+    RAPP_BMARK_ENTRY(stat_minmax_loc_bin, "empty",   bin_loc, 2, 0),
+    RAPP_BMARK_ENTRY(stat_minmax_loc_bin, "full",    bin_loc, 0, 0),
+    RAPP_BMARK_ENTRY(stat_minmax_loc_bin, "checker", bin_loc, 3, 0),
+    RAPP_BMARK_ENTRY(stat_minmax_loc_u8,  NULL,      u8_loc,  0, 0),
+    RAPP_BMARK_ENTRY(stat_max_k_u8,       "1",       u8_max_k, 1, 0),
+    RAPP_BMARK_ENTRY(stat_max_k_u8,       "16",      u8_max_k, 16, 0),
+    RAPP_BMARK_ENTRY(stat_tiles_u8,       "16x16",   u8_tiles, 16, 16),
+    RAPP_BMARK_ENTRY(stat_tiles_u8,       "32x32",   u8_tiles, 32, 32),
+    RAPP_BMARK_ENTRY(stat_tiles_u8,       "20x20",   u8_tiles, 20, 20),
+    RAPP_BMARK_ENTRY(stat_sad_u8,         NULL,      u8_u8_p,  0, 0),
+    RAPP_BMARK_ENTRY(stat_ssd_u8,         NULL,      u8_u8_p,  0, 0),
+    RAPP_BMARK_ENTRY(stat_ssim_u8,        NULL,      u8_ssim,  0, 0),
     /* rapp_moment_bin functions */
     RAPP_BMARK_ENTRY(moment_order1_bin, "empty",   bin_p, 2, 0),
     RAPP_BMARK_ENTRY(moment_order1_bin, "full",    bin_p, 0, 0),
@@ -335,11 +506,64 @@ static const rapp_bmark_table_t rapp_bmark_suite[] = {
     RAPP_BMARK_ENTRY(filter_sobel_3x3_vert_u8,     NULL, u8_u8, 0, 0),
     RAPP_BMARK_ENTRY(filter_sobel_3x3_vert_abs_u8, NULL, u8_u8, 0, 0),
     RAPP_BMARK_ENTRY(filter_sobel_3x3_magn_u8,     NULL, u8_u8, 0, 0),
+    RAPP_BMARK_ENTRY(filter_sobel_3x3_magn_dir_u8, "4 bins", sobel_dir, 4, 0),
+    RAPP_BMARK_ENTRY(filter_sobel_3x3_magn_dir_u8, "8 bins", sobel_dir, 8, 0),
+    RAPP_BMARK_ENTRY(filter_sobel_3x3_grad_u8_s16, NULL, sobel_grad, 0, 0),
+    RAPP_BMARK_ENTRY(filter_diff_1x2_horz_u8_s16,  NULL, u8_s16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_diff_2x1_vert_u8_s16,  NULL, u8_s16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_sobel_3x3_horz_u8_s16, NULL, u8_s16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_sobel_3x3_vert_u8_s16, NULL, u8_s16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_laplace_3x3_u8_s16,    NULL, u8_s16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_highpass_3x3_u8_s16,   NULL, u8_s16, 0, 0),
     RAPP_BMARK_ENTRY(filter_gauss_3x3_u8,          NULL, u8_u8, 0, 0),
     RAPP_BMARK_ENTRY(filter_laplace_3x3_u8,        NULL, u8_u8, 0, 0),
     RAPP_BMARK_ENTRY(filter_laplace_3x3_abs_u8,    NULL, u8_u8, 0, 0),
     RAPP_BMARK_ENTRY(filter_highpass_3x3_u8,       NULL, u8_u8, 0, 0),
     RAPP_BMARK_ENTRY(filter_highpass_3x3_abs_u8,   NULL, u8_u8, 0, 0),
+    RAPP_BMARK_ENTRY(filter_conv_u8,  "3x3",   conv,   3,  3),
+    RAPP_BMARK_ENTRY(filter_conv_u8,  "5x5",   conv,   5,  5),
+    RAPP_BMARK_ENTRY(filter_conv_u8,  "7x7",   conv,   7,  7),
+    RAPP_BMARK_ENTRY(filter_sep_u8,   "3x3",   sep,    3,  3),
+    RAPP_BMARK_ENTRY(filter_sep_u8,   "7x7",   sep,    7,  7),
+    RAPP_BMARK_ENTRY(filter_sep_u8,   "15x15", sep,   15, 15),
+    RAPP_BMARK_ENTRY(filter_gauss_u8, "2.0",   gauss, 32,  0),
+    RAPP_BMARK_ENTRY(filter_gauss_u8, "3.0",   gauss, 48,  0),
+    RAPP_BMARK_ENTRY(filter_gauss_u8, "5.0",   gauss, 80,  0),
+    RAPP_BMARK_ENTRY(filter_median_3x3_u8,         NULL, u8_u8, 0, 0),
+    RAPP_BMARK_ENTRY(filter_median_5x5_u8,         NULL, u8_u8, 0, 0),
+    RAPP_BMARK_ENTRY(filter_rank_u8,  "r=2",   rank,   2,  0),
+    RAPP_BMARK_ENTRY(filter_rank_u8,  "r=8",   rank,   8,  0),
+    RAPP_BMARK_ENTRY(filter_rank_u8,  "r=15",  rank,  15,  0),
+    RAPP_BMARK_ENTRY(filter_gauss_3x3_u16,         NULL, u16_u16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_median_3x3_u16,        NULL, u16_u16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_sobel_3x3_horz_u16,    NULL, u16_u16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_sobel_3x3_horz_abs_u16,NULL, u16_u16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_sobel_3x3_vert_u16,    NULL, u16_u16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_sobel_3x3_vert_abs_u16,NULL, u16_u16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_laplace_3x3_u16,       NULL, u16_u16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_laplace_3x3_abs_u16,   NULL, u16_u16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_highpass_3x3_u16,      NULL, u16_u16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_highpass_3x3_abs_u16,  NULL, u16_u16, 0, 0),
+    RAPP_BMARK_ENTRY(filter_census_3x3_u8,         NULL, u8_u8, 0, 0),
+    RAPP_BMARK_ENTRY(filter_census_5x5_u8_u32,     NULL, u8_u32, 0, 0),
+    RAPP_BMARK_ENTRY(filter_lbp_3x3_u8,            NULL, u8_u8, 0, 0),
+    RAPP_BMARK_ENTRY(filter_census_cost_u8,  "4 disp", census_cost, 4, 0),
+    RAPP_BMARK_ENTRY(filter_census_cost_u32_u8, "4 disp",
+                     census_cost_u32, 4, 0),
+    /* rapp_edge functions */
+    RAPP_BMARK_ENTRY(edge_canny_u8,   NULL,  bin_u8_iip, 20, 40),
+    /* rapp_feature functions */
+    RAPP_BMARK_ENTRY(feature_fast_u8,   NULL,    feature, 20, 0),
+    RAPP_BMARK_ENTRY(feature_fast_u8,   "nms",   feature, 20, 1),
+    RAPP_BMARK_ENTRY(feature_harris_u8, NULL,    feature, 1 << 16, 0),
+    RAPP_BMARK_ENTRY(feature_harris_u8, "nms",   feature, 1 << 16, 1),
+    /* rapp_morph functions */
+    RAPP_BMARK_ENTRY(morph_erode_rect_u8,  "3x3",   u8_u8_iip,    3,  3),
+    RAPP_BMARK_ENTRY(morph_erode_rect_u8,  "15x15", u8_u8_iip,   15, 15),
+    RAPP_BMARK_ENTRY(morph_erode_rect_u8,  "31x31", u8_u8_iip,   31, 31),
+    RAPP_BMARK_ENTRY(morph_dilate_rect_u8, "3x3",   u8_u8_iip,    3,  3),
+    RAPP_BMARK_ENTRY(morph_dilate_rect_u8, "15x15", u8_u8_iip,   15, 15),
+    RAPP_BMARK_ENTRY(morph_dilate_rect_u8, "31x31", u8_u8_iip,   31, 31),
     /* rapp_morph_bin functions */
     RAPP_BMARK_ENTRY(morph_erode_rect_bin, "2x2",   bin_bin_iip,  2,  2),
     RAPP_BMARK_ENTRY(morph_erode_rect_bin, "3x3",   bin_bin_iip,  3,  3),
@@ -565,6 +789,24 @@ rapp_bmark_setup(int width, int height)
            RAPP_BMARK_ROWS*MAX(dim_u8*height + 2*RAPP_BMARK_HPAD,
                                rot_u8*width  + 2*RAPP_BMARK_HPAD);
 
+    /* The rank filter, edge, morphology and motion buffers may be larger */
+    size = MAX(size, rapp_filter_rank_worksize_u8(width, RAPP_BMARK_HPAD - 1));
+    size = MAX(size, rapp_edge_canny_worksize_u8(width, height));
+    size = MAX(size, rapp_feature_worksize_u8(width, height));
+    size = MAX(size, rapp_resize_worksize_u8(2*width / 3, 2*height / 3,
+                                             width, height,
+                                             RAPP_RESIZE_AREA));
+    size = MAX(size, rapp_resize_worksize_u8(width, height,
+                                             2*width / 3, 2*height / 3,
+                                             RAPP_RESIZE_BILINEAR));
+    size = MAX(size, rapp_morph_worksize_u8(width, height,
+                                            2*RAPP_BMARK_HPAD - 1,
+                                            2*RAPP_BMARK_HPAD - 1));
+    size = MAX(size, rapp_motion_blockmatch_worksize_u8(width, height,
+                                                        16, 2));
+    size = MAX(size, rapp_match_template_worksize_u8(width, height, 16, 16,
+                                                     RAPP_MATCH_NCC, 2));
+
     rapp_bmark_data.dst     = rapp_malloc(size, 0);
     rapp_bmark_data.set     = rapp_malloc(size, 0);
     rapp_bmark_data.pad     = rapp_malloc(size, 0);
@@ -590,6 +832,7 @@ rapp_bmark_setup(int width, int height)
     memset(rapp_bmark_data.checker, 0x55, size);
     memset(rapp_bmark_data.aux,     0xff, size);
     memset(rapp_bmark_data.aux2,    0xff, size);
+    memset(rapp_bmark_kernel,       1,    sizeof rapp_bmark_kernel);
 
     rapp_bmark_data.dst     += offset;
     rapp_bmark_data.set     += offset;
@@ -716,6 +959,26 @@ rapp_bmark_exec_bin_bin_iip(int (*func)(), const int *args)
             args[0], args[1], data->aux);
 }
 
+static void
+rapp_bmark_exec_u8_u8_iip(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst, data->dim_u8,
+            data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height,
+            args[0], args[1], data->aux);
+}
+
+static void
+rapp_bmark_exec_bin_u8_iip(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst, data->dim_bin,
+            data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height,
+            args[0], args[1], data->aux);
+}
+
 static void
 rapp_bmark_exec_bin_u8(int (*func)(), const int *args)
 {
@@ -794,6 +1057,80 @@ rapp_bmark_exec_thresh_pixel(int (*func)(), const int *args)
     }
 }
 
+static void
+rapp_bmark_exec_thresh_auto(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst,   data->dim_bin,
+            data->set,   data->dim_u8,
+            data->width, data->height,
+            args[0], 50, args[1] ? data->aux : NULL);
+}
+
+static void
+rapp_bmark_exec_thresh_adaptive(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst,   data->dim_bin,
+            data->set,   data->dim_u8 + data->pad_u8,
+            data->width, data->height,
+            args[0], 0, data->aux);
+}
+
+static void
+rapp_bmark_exec_thresh_absdiff(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    if (args[1] > 0) {
+        (*func)(data->dst,   data->dim_bin,
+                data->set,   data->dim_u8,
+                data->pad,   data->dim_u8,
+                data->width, data->height,
+                args[0], args[1], data->aux);
+    }
+    else {
+        (*func)(data->dst,   data->dim_bin,
+                data->set,   data->dim_u8,
+                data->pad,   data->dim_u8,
+                data->width, data->height, args[0]);
+    }
+}
+
+static void
+rapp_bmark_exec_bgmodel(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst,   data->dim_bin,
+            data->aux,   data->dim_u8,
+            args[1] ? data->aux2 : NULL, data->dim_u8,
+            data->set,   data->dim_u8,
+            data->width, data->height, args[0], 20);
+}
+
+static void
+rapp_bmark_exec_motion(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    uint8_t *cost = &data->dst[data->dim_u8*(data->height / 2)];
+    (*func)(data->dst,     (uint32_t*)cost,
+            data->checker, data->dim_u8,
+            data->aux2,    data->dim_u8,
+            data->width,   data->height,
+            args[0], 16, args[1], data->aux);
+}
+
+static void
+rapp_bmark_exec_match(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    int     pos[2];
+    int32_t score;
+    (*func)(data->checker, data->dim_u8,
+            data->width,   data->height,
+            data->set,     data->dim_u8, 16, 16,
+            args[0], args[1], pos, &score, data->aux);
+}
+
 static void
 rapp_bmark_exec_expand(int (*func)(), const int *args)
 {
@@ -904,3 +1241,269 @@ rapp_bmark_exec_scatter_bin(int (*func)(), const int *args)
             data->src[args[0]], data->dim_bin,
             data->clear, data->width, data->height);
 }
+
+static void
+rapp_bmark_exec_conv(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst, data->dim_u8,
+            data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height,
+            rapp_bmark_kernel, args[0], args[1], 8);
+}
+
+static void
+rapp_bmark_exec_sep(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst, data->dim_u8,
+            data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height,
+            rapp_bmark_kernel, args[0], 4,
+            rapp_bmark_kernel, args[1], 4,
+            data->aux);
+}
+
+static void
+rapp_bmark_exec_gauss(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst, data->dim_u8,
+            data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height,
+            args[0], data->aux);
+}
+
+static void
+rapp_bmark_exec_rank(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst, data->dim_u8,
+            data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height,
+            args[0], 2*args[0]*(args[0] + 1), data->aux);
+}
+
+static void
+rapp_bmark_exec_sobel_dir(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst, data->dim_u8,
+            data->aux, data->dim_u8,
+            data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height, args[0]);
+}
+
+static void
+rapp_bmark_exec_sobel_grad(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (void)args;
+    (*func)(data->dst, 2*data->dim_u8,
+            data->aux, 2*data->dim_u8,
+            data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height);
+}
+
+static void
+rapp_bmark_exec_u8_s16(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (void)args;
+    (*func)(data->dst, 2*data->dim_u8,
+            data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height);
+}
+
+static void
+rapp_bmark_exec_u8_u32(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (void)args;
+    (*func)(data->dst, 4*data->dim_u8,
+            data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height);
+}
+
+static void
+rapp_bmark_exec_census_cost(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst,     data->dim_u8,
+            data->checker, data->dim_u8,
+            data->set,     data->dim_u8,
+            data->width,   data->height, args[0]);
+}
+
+static void
+rapp_bmark_exec_census_cost_u32(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst,  data->dim_u8,
+            data->aux,  4*data->dim_u8,
+            data->aux2, 4*data->dim_u8,
+            data->width, data->height, args[0]);
+}
+
+static void
+rapp_bmark_exec_feature(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->set, data->dim_u8 + data->pad_u8,
+            data->width, data->height, args[0], args[1],
+            data->dst, data->width, data->aux);
+}
+
+static void
+rapp_bmark_exec_resize(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    int width  = 2*data->width  / 3;
+    int height = 2*data->height / 3;
+
+    if (args[1]) {
+        /* Upscale from two thirds of the size */
+        (*func)(data->dst, data->dim_u8, data->width, data->height,
+                data->set, data->dim_u8 + data->pad_u8, width, height,
+                args[0], data->aux);
+    }
+    else {
+        /* Downscale to two thirds of the size */
+        (*func)(data->dst, data->dim_u8, width, height,
+                data->set, data->dim_u8 + data->pad_u8,
+                data->width, data->height, args[0], data->aux);
+    }
+}
+
+static void
+rapp_bmark_exec_u16(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (void)args;
+    (*func)(data->dst, 2*data->dim_u8, data->width, data->height);
+}
+
+static void
+rapp_bmark_exec_u16_p(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (void)args;
+    (*func)(data->dst, 2*data->dim_u8, data->width, data->height, data->aux);
+}
+
+static void
+rapp_bmark_exec_u16_u16(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (void)args;
+    (*func)(data->dst, 2*data->dim_u8,
+            data->set, 2*data->dim_u8 + data->pad_u8,
+            data->width, data->height);
+}
+
+static void
+rapp_bmark_exec_u16_bin(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst,   data->dim_bin,
+            data->set,   2*data->dim_u8,
+            data->width, data->height, args[0]);
+}
+
+static void
+rapp_bmark_exec_u16_u8_p(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst, data->dim_u8,
+            data->set, 2*data->dim_u8,
+            data->width, data->height,
+            data->aux, args[0]);
+}
+
+static void
+rapp_bmark_exec_u8_hist(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->set, data->dim_u8,
+            args[0] ? data->checker : NULL, data->dim_bin,
+            data->width, data->height, data->aux);
+}
+
+static void
+rapp_bmark_exec_u8_hist_bins(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->set, data->dim_u8,
+            args[0] ? data->checker : NULL, data->dim_bin,
+            data->width, data->height, data->aux, args[1]);
+}
+
+static void
+rapp_bmark_exec_u8_mask(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    int                      idx  = args[0];
+    (*func)(data->set,      data->dim_u8,
+            data->src[idx], data->dim_bin,
+            data->width,    data->height, data->aux);
+}
+
+static void
+rapp_bmark_exec_bin_loc(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    int                      idx  = args[0];
+    int                      minmax[2];
+    unsigned                 pos[4];
+    (*func)(data->src[idx], data->dim_bin,
+            data->width,    data->height, minmax, pos);
+}
+
+static void
+rapp_bmark_exec_u8_loc(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    int                      minmax[2];
+    unsigned                 pos[4];
+    (void)args;
+    (*func)(data->checker, data->dim_u8,
+            data->width,   data->height, minmax, pos);
+}
+
+static void
+rapp_bmark_exec_u8_max_k(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->checker, data->dim_u8,
+            data->width,   data->height, data->aux, args[0]);
+}
+
+static void
+rapp_bmark_exec_u8_tiles(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->checker, data->dim_u8,
+            data->width,   data->height,
+            args[0], args[1], (uint32_t*)data->aux,
+            data->aux2,    data->dst);
+}
+
+static void
+rapp_bmark_exec_u8_ssim(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (void)args;
+    (*func)(data->dst,   data->dim_u8,
+            data->set,   data->dim_u8,
+            data->width, data->height,
+            (int32_t*)data->aux, data->aux2);
+}
+
+static void
+rapp_bmark_exec_clahe(int (*func)(), const int *args)
+{
+    const rapp_bmark_data_t *data = &rapp_bmark_data;
+    (*func)(data->dst,   data->dim_u8,
+            data->width, data->height,
+            args[0], args[1], data->aux);
+}
@@ -135,6 +135,12 @@ do {                                                                     \
                        RC_ALTIVEC_INIT( 0,  2,  4,  6,  8, 10, 12, 14,  \
                                        16, 18, 20, 22, 24, 26, 28, 30)))
 
+#define RC_VEC_ZIPLO(dstv, srcv1, srcv2) \
+    ((dstv) = vec_mergeh(srcv1, srcv2))
+
+#define RC_VEC_ZIPHI(dstv, srcv1, srcv2) \
+    ((dstv) = vec_mergel(srcv1, srcv2))
+
 #define RC_VEC_ZERO(vec) \
     ((vec) = RC_ALTIVEC_INIT16(0))
 
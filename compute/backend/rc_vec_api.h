@@ -408,6 +408,41 @@ typedef arch_vector_t rc_vec_t;
  */
 #define RC_VEC_PACK(dstv, srcv1, srcv2)
 
+/**
+ *  Interleave the low fields of srcv1 and srcv2.
+ *  Sets field 2i of dstv to field i of srcv1 and field 2i + 1
+ *  to field i of srcv2, for i = 0, ..., #RC_VEC_SIZE/2 - 1.
+ *
+ *  @param  dstv   Interleaved output vector.
+ *  @param  srcv1  First source vector.
+ *  @param  srcv2  Second source vector.
+ */
+#define RC_VEC_ZIPLO(dstv, srcv1, srcv2)
+
+/**
+ *  Interleave the high fields of srcv1 and srcv2.
+ *  Sets field 2i of dstv to field #RC_VEC_SIZE/2 + i of srcv1 and
+ *  field 2i + 1 to field #RC_VEC_SIZE/2 + i of srcv2,
+ *  for i = 0, ..., #RC_VEC_SIZE/2 - 1.
+ *
+ *  @param  dstv   Interleaved output vector.
+ *  @param  srcv1  First source vector.
+ *  @param  srcv2  Second source vector.
+ */
+#define RC_VEC_ZIPHI(dstv, srcv1, srcv2)
+
+/**
+ *  Table lookup.
+ *  Sets field i of dstv to field idxv[i] mod #RC_VEC_SIZE of tabv,
+ *  or to zero if the most significant bit of idxv[i] is set.
+ *  The remaining index bits are ignored.
+ *
+ *  @param  dstv   Output vector.
+ *  @param  tabv   Table vector.
+ *  @param  idxv   Index vector.
+ */
+#define RC_VEC_SHUFFLE(dstv, tabv, idxv)
+
 /* @} */
 
 
@@ -721,6 +756,174 @@ typedef arch_vector_t rc_vec_t;
 /* @} */
 
 
+/*
+ * -------------------------------------------------------------
+ *  Widening multiply-accumulate
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  @name Widening Multiply-Accumulate
+ *  @{
+ */
+
+/**
+ *  Generate the coefficient vector needed by RC_VEC_MACW().
+ *
+ *  @param coefv  The output coefficient vector.
+ *  @param coef   The signed integer coefficient in the range [-0x80,0x80].
+ */
+#define RC_VEC_COEF(coefv, coef)
+
+/**
+ *  Widening multiply-accumulate.
+ *  Computes accv = accv + srcv*coef for each 8-bit field. The accumulator
+ *  is a pair of vectors holding one signed 16-bit field for each 8-bit
+ *  source field. The layout of the accumulator fields is
+ *  implementation-specific, but an accumulator pair cleared with
+ *  RC_VEC_ZERO() holds zero in all fields. The accumulated values must
+ *  be within [-0x8000,0x7fff] at all times.
+ *
+ *  @param accv1   The first input/output accumulator vector.
+ *  @param accv2   The second input/output accumulator vector.
+ *  @param srcv    The input vector.
+ *  @param coefv   The coefficient vector obtained from RC_VEC_COEF().
+ */
+#define RC_VEC_MACW(accv1, accv2, srcv, coefv)
+
+/**
+ *  Pack a widened accumulator to 8-bit fields.
+ *  Computes dstv = (accv + ((1 << shift) >> 1)) >> shift for each 16-bit
+ *  accumulator field, with the result saturated to [0,0xff]. The shift
+ *  value must be in the range [0,15].
+ *
+ *  @param dstv    The output vector.
+ *  @param accv1   The first accumulator vector from RC_VEC_MACW().
+ *  @param accv2   The second accumulator vector from RC_VEC_MACW().
+ *  @param shift   The right-shift value as an int.
+ */
+#define RC_VEC_PACKW(dstv, accv1, accv2, shift)
+
+/**
+ *  Get the 16-bit fields of a widened accumulator in source field order.
+ *  Computes dstv1 and dstv2 such that the signed 16-bit fields for the
+ *  first RC_VEC_SIZE/2 source fields are held in dstv1, and the fields
+ *  for the remaining source fields in dstv2, in native byte order.
+ *  The output vectors can be stored directly to a 16-bit image.
+ *
+ *  @param dstv1   The first output vector.
+ *  @param dstv2   The second output vector.
+ *  @param accv1   The first accumulator vector from RC_VEC_MACW().
+ *  @param accv2   The second accumulator vector from RC_VEC_MACW().
+ */
+#define RC_VEC_GETW(dstv1, dstv2, accv1, accv2)
+
+/* @} */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Arithmetic operations on 16-bit fields
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  @name 16-bit Arithmetic Operations
+ *  These operations treat the vector as RC_VEC_SIZE/2 unsigned 16-bit
+ *  fields in native byte order, i.e. as a vector loaded directly from
+ *  a 16-bit image. They are implemented for SSE2, and RC_VEC_MULHR16()
+ *  also for MMX.
+ *  @{
+ */
+
+/**
+ *  Splat a scalar variable.
+ *  Sets the scalar value 'scal' in each 16-bit field.
+ *
+ *  @param  vec  The output vector.
+ *  @param  scal The 16-bit scalar variable to set, any scalar data type.
+ */
+#define RC_VEC_SPLAT16(vec, scal)
+
+/**
+ *  Saturating addition.
+ *  Computes dstv = min(srcv1 + srcv2, 0xffff) for each 16-bit field.
+ *
+ *  @param dstv   The output vector.
+ *  @param srcv1  The first input vector.
+ *  @param srcv2  The second input vector.
+ */
+#define RC_VEC_ADDS16(dstv, srcv1, srcv2)
+
+/**
+ *  Saturating subtraction.
+ *  Computes dstv = max(srcv1 - srcv2, 0) for each 16-bit field.
+ *
+ *  @param dstv   The output vector.
+ *  @param srcv1  The first input vector.
+ *  @param srcv2  The second input vector.
+ */
+#define RC_VEC_SUBS16(dstv, srcv1, srcv2)
+
+/**
+ *  Comparison greater-than.
+ *  Computes dst = srcv1 > srcv2 ? 0xffff : 0 for each 16-bit field.
+ *  Unlike RC_VEC_CMPGT(), all bits in each field are set.
+ *
+ *  @param dstv   The output vector.
+ *  @param srcv1  The first input vector.
+ *  @param srcv2  The second input vector.
+ */
+#define RC_VEC_CMPGT16(dstv, srcv1, srcv2)
+
+/**
+ *  Minimum value.
+ *  Computes dstv = min(srcv1, srcv2) for each 16-bit field.
+ *
+ *  @param dstv   The output vector.
+ *  @param srcv1  The first input vector.
+ *  @param srcv2  The second input vector.
+ */
+#define RC_VEC_MIN16(dstv, srcv1, srcv2)
+
+/**
+ *  Maximum value.
+ *  Computes dstv = max(srcv1, srcv2) for each 16-bit field.
+ *
+ *  @param dstv   The output vector.
+ *  @param srcv1  The first input vector.
+ *  @param srcv2  The second input vector.
+ */
+#define RC_VEC_MAX16(dstv, srcv1, srcv2)
+
+/**
+ *  Rounded high multiplication.
+ *  Computes dstv = (srcv1*srcv2 + 0x8000) >> 16 for each unsigned
+ *  16-bit field.
+ *
+ *  @param dstv   The output vector.
+ *  @param srcv1  The first input vector.
+ *  @param srcv2  The second input vector.
+ */
+#define RC_VEC_MULHR16(dstv, srcv1, srcv2)
+
+/**
+ *  Pack two 16-bit mask vectors to one 8-bit mask vector.
+ *  The 16-bit input fields must be either 0 or 0xffff, as obtained from
+ *  RC_VEC_CMPGT16(). The output holds the fields of srcv1 followed by the
+ *  fields of srcv2, in field order, with each 8-bit field set to 0 or 0xff.
+ *  The output can be used directly with RC_VEC_GETMASKW() and
+ *  RC_VEC_GETMASKV().
+ *
+ *  @param dstv   The output vector.
+ *  @param srcv1  The first input mask vector.
+ *  @param srcv2  The second input mask vector.
+ */
+#define RC_VEC_PACKM16(dstv, srcv1, srcv2)
+
+/* @} */
+
+
 /*
  * -------------------------------------------------------------
  *  Binary mask operations
@@ -833,6 +1036,19 @@ typedef arch_vector_t rc_vec_t;
  */
 #define RC_VEC_SUMR(sum, accv)
 
+/**
+ *  Sum the absolute differences of all 8-bit vector fields,
+ *  accumulation step. The accumulator vector has the same format as
+ *  for RC_VEC_SUMV(), and is reduced with RC_VEC_SUMR(). The two
+ *  accumulation steps can be mixed, and can together be iterated at
+ *  most #RC_VEC_SUMN times before the reduction step.
+ *
+ *  @param  accv   The input/output accumulator vector.
+ *  @param  srcv1  The first source vector.
+ *  @param  srcv2  The second source vector.
+ */
+#define RC_VEC_SADV(accv, srcv1, srcv2)
+
 /**
  *  Multiply and accumulate all 8-bit fields, iteration count.
  *  The format of the accumulator vector is implementation-specific,
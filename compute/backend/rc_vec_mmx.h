@@ -110,6 +110,12 @@ do {                                                  \
     (dstv) = _mm_or_si64(sv1__, sv2__);               \
 } while (0)
 
+#define RC_VEC_ZIPLO(dstv, srcv1, srcv2) \
+    ((dstv) = _mm_unpacklo_pi8(srcv1, srcv2))
+
+#define RC_VEC_ZIPHI(dstv, srcv1, srcv2) \
+    ((dstv) = _mm_unpackhi_pi8(srcv1, srcv2))
+
 #define RC_VEC_ZERO(vec) \
     ((vec) = _mm_setzero_si64())
 
@@ -195,6 +201,61 @@ do {                                                         \
 #define RC_VEC_SUBHR(dstv, srcv1, srcv2) \
     RC_VEC_AVGR(dstv, srcv1, _mm_sub_pi8(_mm_set1_pi8(0xff), srcv2))
 
+#define RC_VEC_COEF(coefv, coef) \
+    ((coefv) = _mm_set1_pi16(coef))
+
+#define RC_VEC_MACW(accv1, accv2, srcv, coefv)                 \
+do {                                                           \
+    rc_vec_t sv__ = (srcv);                                    \
+    rc_vec_t cv__ = (coefv);                                   \
+    rc_vec_t zv__ = _mm_setzero_si64();                        \
+    rc_vec_t lo__ = _mm_unpacklo_pi8(sv__, zv__);              \
+    rc_vec_t hi__ = _mm_unpackhi_pi8(sv__, zv__);              \
+    (accv1) = _mm_add_pi16(accv1, _mm_mullo_pi16(lo__, cv__)); \
+    (accv2) = _mm_add_pi16(accv2, _mm_mullo_pi16(hi__, cv__)); \
+} while (0)
+
+/**
+ *  The rounding term is added as ((acc >> (shift - 1)) + 1) >> 1
+ *  to avoid overflowing the 16-bit fields.
+ */
+#define RC_VEC_PACKW(dstv, accv1, accv2, shift)                \
+do {                                                           \
+    int      sh__ = (shift);                                   \
+    rc_vec_t c1__ = _mm_cvtsi32_si64(sh__ > 0 ? sh__ - 1 : 0); \
+    rc_vec_t c2__ = _mm_cvtsi32_si64(sh__ > 0);                \
+    rc_vec_t rv__ = _mm_set1_pi16(sh__ > 0);                   \
+    rc_vec_t lo__ = _mm_sra_pi16(accv1, c1__);                 \
+    rc_vec_t hi__ = _mm_sra_pi16(accv2, c1__);                 \
+    lo__   = _mm_sra_pi16(_mm_add_pi16(lo__, rv__), c2__);     \
+    hi__   = _mm_sra_pi16(_mm_add_pi16(hi__, rv__), c2__);     \
+    (dstv) = _mm_packs_pu16(lo__, hi__);                       \
+} while (0)
+
+#define RC_VEC_GETW(dstv1, dstv2, accv1, accv2) \
+do {                                            \
+    (dstv1) = (accv1);                          \
+    (dstv2) = (accv2);                          \
+} while (0)
+
+/**
+ *  MMX only has a signed high multiplication. The unsigned high product
+ *  is obtained by adding the other operand for each negative operand.
+ *  The rounding bit is the most significant bit of the low product.
+ */
+#define RC_VEC_MULHR16(dstv, srcv1, srcv2)                    \
+do {                                                          \
+    rc_vec_t sv1__ = (srcv1);                                 \
+    rc_vec_t sv2__ = (srcv2);                                 \
+    rc_vec_t hi__  = _mm_mulhi_pi16(sv1__, sv2__);            \
+    rc_vec_t lo__  = _mm_mullo_pi16(sv1__, sv2__);            \
+    rc_vec_t sg1__ = _mm_srai_pi16(sv1__, 15);                \
+    rc_vec_t sg2__ = _mm_srai_pi16(sv2__, 15);                \
+    hi__   = _mm_add_pi16(hi__, _mm_and_si64(sg1__, sv2__));  \
+    hi__   = _mm_add_pi16(hi__, _mm_and_si64(sg2__, sv1__));  \
+    (dstv) = _mm_add_pi16(hi__, _mm_srli_pi16(lo__, 15));     \
+} while (0)
+
 #define RC_VEC_GETMASKV(maskv, vec)                                          \
 do {                                                                         \
     rc_vec_t vec__ = (vec);                                                  \
@@ -139,6 +139,21 @@ do {                                            \
     RC_NEON_UNZIP(dstv, dummy_, srcv1, srcv2);  \
 } while (0)
 
+#define RC_VEC_ZIPLO(dstv, srcv1, srcv2)        \
+do {                                            \
+    rc_vec_t dummy_;                            \
+    RC_NEON_ZIP(dstv, dummy_, srcv1, srcv2);    \
+} while (0)
+
+#define RC_VEC_ZIPHI(dstv, srcv1, srcv2)        \
+do {                                            \
+    rc_vec_t dummy_;                            \
+    RC_NEON_ZIP(dummy_, dstv, srcv1, srcv2);    \
+} while (0)
+
+#define RC_VEC_SHUFFLE(dstv, tabv, idxv) \
+    ((dstv) = vtbl1_u8(tabv, vand_u8(idxv, vdup_n_u8(0x80 | 7))))
+
 #define RC_VEC_ZERO(vec) \
     ((vec) = vdup_n_u8(0))
 
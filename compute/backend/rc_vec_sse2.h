@@ -99,6 +99,12 @@ do {                                              \
     (dstv) = _mm_packus_epi16(sv1__, sv2__);      \
 } while (0)
 
+#define RC_VEC_ZIPLO(dstv, srcv1, srcv2) \
+    ((dstv) = _mm_unpacklo_epi8(srcv1, srcv2))
+
+#define RC_VEC_ZIPHI(dstv, srcv1, srcv2) \
+    ((dstv) = _mm_unpackhi_epi8(srcv1, srcv2))
+
 #define RC_VEC_ZERO(vec) \
     ((vec) = _mm_setzero_si128())
 
@@ -241,6 +247,90 @@ do {                                                                      \
     RC_VEC_LERP__(dstv, srcv1__, srcv2__, blend__, blo__, bhi__, zero__); \
 } while (0)
 
+#define RC_VEC_COEF(coefv, coef) \
+    ((coefv) = _mm_set1_epi16(coef))
+
+#define RC_VEC_MACW(accv1, accv2, srcv, coefv)                   \
+do {                                                             \
+    rc_vec_t sv__ = (srcv);                                      \
+    rc_vec_t cv__ = (coefv);                                     \
+    rc_vec_t zv__ = _mm_setzero_si128();                         \
+    rc_vec_t lo__ = _mm_unpacklo_epi8(sv__, zv__);               \
+    rc_vec_t hi__ = _mm_unpackhi_epi8(sv__, zv__);               \
+    (accv1) = _mm_add_epi16(accv1, _mm_mullo_epi16(lo__, cv__)); \
+    (accv2) = _mm_add_epi16(accv2, _mm_mullo_epi16(hi__, cv__)); \
+} while (0)
+
+/**
+ *  The rounding term is added as ((acc >> (shift - 1)) + 1) >> 1
+ *  to avoid overflowing the 16-bit fields.
+ */
+#define RC_VEC_PACKW(dstv, accv1, accv2, shift)                 \
+do {                                                            \
+    int      sh__ = (shift);                                    \
+    rc_vec_t c1__ = _mm_cvtsi32_si128(sh__ > 0 ? sh__ - 1 : 0); \
+    rc_vec_t c2__ = _mm_cvtsi32_si128(sh__ > 0);                \
+    rc_vec_t rv__ = _mm_set1_epi16(sh__ > 0);                   \
+    rc_vec_t lo__ = _mm_sra_epi16(accv1, c1__);                 \
+    rc_vec_t hi__ = _mm_sra_epi16(accv2, c1__);                 \
+    lo__   = _mm_sra_epi16(_mm_add_epi16(lo__, rv__), c2__);    \
+    hi__   = _mm_sra_epi16(_mm_add_epi16(hi__, rv__), c2__);    \
+    (dstv) = _mm_packus_epi16(lo__, hi__);                      \
+} while (0)
+
+#define RC_VEC_GETW(dstv1, dstv2, accv1, accv2) \
+do {                                            \
+    (dstv1) = (accv1);                          \
+    (dstv2) = (accv2);                          \
+} while (0)
+
+#define RC_VEC_SPLAT16(vec, scal) \
+    ((vec) = _mm_set1_epi16(scal))
+
+#define RC_VEC_ADDS16(dstv, srcv1, srcv2) \
+    ((dstv) = _mm_adds_epu16(srcv1, srcv2))
+
+#define RC_VEC_SUBS16(dstv, srcv1, srcv2) \
+    ((dstv) = _mm_subs_epu16(srcv1, srcv2))
+
+/**
+ *  There is no unsigned 16-bit compare, so we flip the sign bits
+ *  and use the signed one.
+ */
+#define RC_VEC_CMPGT16(dstv, srcv1, srcv2)                  \
+do {                                                        \
+    rc_vec_t bias__ = _mm_set1_epi16(0x8000);               \
+    (dstv) = _mm_cmpgt_epi16(_mm_xor_si128(srcv1, bias__),  \
+                             _mm_xor_si128(srcv2, bias__)); \
+} while (0)
+
+#define RC_VEC_MIN16(dstv, srcv1, srcv2)                         \
+do {                                                             \
+    rc_vec_t sv1__ = (srcv1);                                    \
+    (dstv) = _mm_sub_epi16(sv1__, _mm_subs_epu16(sv1__, srcv2)); \
+} while (0)
+
+#define RC_VEC_MAX16(dstv, srcv1, srcv2)                         \
+do {                                                             \
+    rc_vec_t sv2__ = (srcv2);                                    \
+    (dstv) = _mm_add_epi16(sv2__, _mm_subs_epu16(srcv1, sv2__)); \
+} while (0)
+
+/**
+ *  The rounding bit is the most significant bit of the low product.
+ */
+#define RC_VEC_MULHR16(dstv, srcv1, srcv2)                  \
+do {                                                        \
+    rc_vec_t sv1__ = (srcv1);                               \
+    rc_vec_t sv2__ = (srcv2);                               \
+    rc_vec_t hi__  = _mm_mulhi_epu16(sv1__, sv2__);         \
+    rc_vec_t lo__  = _mm_mullo_epi16(sv1__, sv2__);         \
+    (dstv) = _mm_add_epi16(hi__, _mm_srli_epi16(lo__, 15)); \
+} while (0)
+
+#define RC_VEC_PACKM16(dstv, srcv1, srcv2) \
+    ((dstv) = _mm_packs_epi16(srcv1, srcv2))
+
 #define RC_VEC_GETMASKW(maskw, vec) \
     ((maskw) = _mm_movemask_epi8(vec))
 
@@ -286,20 +376,7 @@ do {                                                             \
     (accv) = _mm_add_epi32(accv, acc__);                         \
 } while (0)
 
-#define RC_VEC_CNTR(cnt, accv) \
-    RC_VEC_SUMR(cnt, accv)
-
-#define RC_VEC_SUMN 128
-
-#define RC_VEC_SUMV(accv, srcv)                                  \
-do {                                                             \
-    rc_vec_t sv__ = (srcv);                                      \
-    rc_vec_t zv__ = _mm_setzero_si128();                         \
-    (accv) = _mm_add_epi16(accv, _mm_unpacklo_epi8(sv__, zv__)); \
-    (accv) = _mm_add_epi16(accv, _mm_unpackhi_epi8(sv__, zv__)); \
-} while (0)
-
-#define RC_VEC_SUMR(sum, accv)                             \
+#define RC_VEC_CNTR(cnt, accv)                             \
 do {                                                       \
     rc_vec_t av__ = (accv);                                \
     rc_vec_t zv__ = _mm_setzero_si128();                   \
@@ -308,9 +385,25 @@ do {                                                       \
                           _mm_unpackhi_epi16(av__, zv__)); \
     rv__  = _mm_add_epi32(rv__, _mm_srli_si128(rv__, 4));  \
     rv__  = _mm_add_epi32(rv__, _mm_srli_si128(rv__, 8));  \
-    (sum) = _mm_cvtsi128_si32(rv__);                       \
+    (cnt) = _mm_cvtsi128_si32(rv__);                       \
 } while (0)
 
+/* The sums are accumulated in the two 64-bit halves with PSADBW */
+#define RC_VEC_SUMN 1024
+
+#define RC_VEC_SUMV(accv, srcv) \
+    ((accv) = _mm_add_epi32(accv, _mm_sad_epu8(srcv, _mm_setzero_si128())))
+
+#define RC_VEC_SUMR(sum, accv)                            \
+do {                                                      \
+    rc_vec_t av__ = (accv);                               \
+    av__  = _mm_add_epi32(av__, _mm_srli_si128(av__, 8)); \
+    (sum) = _mm_cvtsi128_si32(av__);                      \
+} while (0)
+
+#define RC_VEC_SADV(accv, srcv1, srcv2) \
+    ((accv) = _mm_add_epi32(accv, _mm_sad_epu8(srcv1, srcv2)))
+
 #define RC_VEC_MACN 1024 /* 16512 untestable */
 
 #define RC_VEC_MACV(accv, srcv1, srcv2)              \
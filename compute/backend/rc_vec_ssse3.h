@@ -58,6 +58,9 @@
 #define RC_VEC_ALIGNC(dstv, srcv1, srcv2, bytes) \
     ((dstv) = _mm_alignr_epi8(srcv2, srcv1, bytes))
 
+#define RC_VEC_SHUFFLE(dstv, tabv, idxv) \
+    ((dstv) = _mm_shuffle_epi8(tabv, idxv))
+
 #undef  RC_VEC_ABS
 #define RC_VEC_ABS(dstv, srcv)                   \
 do {                                             \
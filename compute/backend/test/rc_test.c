@@ -153,6 +153,9 @@ static const struct rc_test_entry_st {
     RC_TEST_ENTRY(shrc,     false, false, 0, RC_VEC_SIZE - 1),
     RC_TEST_ENTRY(alignc,   false, true,  1, RC_VEC_SIZE - 1),
     RC_TEST_ENTRY(pack,     false, true,  0, 0),
+    RC_TEST_ENTRY(ziplo,    false, true,  0, 0),
+    RC_TEST_ENTRY(ziphi,    false, true,  0, 0),
+    RC_TEST_ENTRY(shuffle,  true,  true,  0, 0),
     RC_TEST_ENTRY(splat,    true,  false, 0, 255),
     RC_TEST_ENTRY(abs,      true,  false, 0, 0),
     RC_TEST_ENTRY(adds,     true,  true,  0, 0),
@@ -170,8 +173,19 @@ static const struct rc_test_entry_st {
     RC_TEST_ENTRY(lerp,     true,  true,  1, 127),
     RC_TEST_ENTRY(lerpz,    true,  true,  1, 127),
     RC_TEST_ENTRY(lerpn,    true,  true,  1, 127),
+    RC_TEST_ENTRY(macw,     true,  true,  0, 255),
+    RC_TEST_ENTRY(getw,     true,  true,  0, 255),
+    RC_TEST_ENTRY(splat16,  false, false, 0, 0xffff),
+    RC_TEST_ENTRY(adds16,   true,  true,  0, 0),
+    RC_TEST_ENTRY(subs16,   true,  true,  0, 0),
+    RC_TEST_ENTRY(cmpgt16,  true,  true,  0, 0),
+    RC_TEST_ENTRY(min16,    true,  true,  0, 0),
+    RC_TEST_ENTRY(max16,    true,  true,  0, 0),
+    RC_TEST_ENTRY(mulhr16,  true,  true,  0, 0),
+    RC_TEST_ENTRY(packm16,  true,  true,  0, 0),
     RC_TEST_ENTRY(cnt,      true,  false, 0, 0),
     RC_TEST_ENTRY(sum,      true,  false, 0, 0),
+    RC_TEST_ENTRY(sad,      true,  true,  0, 0),
     RC_TEST_ENTRY(mac,      true,  true,  0, 0),
     RC_TEST_ENTRY(getmaskw, true,  false, 0, 0),
     RC_TEST_ENTRY(getmaskv, true,  false, 0, 0),
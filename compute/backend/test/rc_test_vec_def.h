@@ -384,6 +384,24 @@ RC_TEST_BINOP_FUNCTION(PACK, pack)
 #define rc_test_vec_pack NULL
 #endif
 
+#ifdef RC_VEC_ZIPLO
+RC_TEST_BINOP_FUNCTION(ZIPLO, ziplo)
+#else
+#define rc_test_vec_ziplo NULL
+#endif
+
+#ifdef RC_VEC_ZIPHI
+RC_TEST_BINOP_FUNCTION(ZIPHI, ziphi)
+#else
+#define rc_test_vec_ziphi NULL
+#endif
+
+#ifdef RC_VEC_SHUFFLE
+RC_TEST_BINOP_FUNCTION(SHUFFLE, shuffle)
+#else
+#define rc_test_vec_shuffle NULL
+#endif
+
 
 /*
  * -------------------------------------------------------------
@@ -579,6 +597,162 @@ RC_TEST_VEC_FUNC(lerpn)(uint8_t *dst, const uint8_t *src1,
 #endif
 
 
+/*
+ * -------------------------------------------------------------
+ *  Widening multiply-accumulate
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The argument holds the shift value in the four least significant
+ *  bits, and a coefficient selector in the four most significant bits.
+ *  The two source vectors are weighted with one positive and one
+ *  negative coefficient, keeping the accumulator within 16 bits.
+ */
+#if defined RC_VEC_COEF && defined RC_VEC_MACW && defined RC_VEC_PACKW
+static int
+RC_TEST_VEC_FUNC(macw)(uint8_t *dst, const uint8_t *src1,
+                       const uint8_t *src2, int arg)
+{
+    rc_vec_t dstv, srcv1, srcv2;
+    rc_vec_t accv1, accv2;
+    rc_vec_t coefv1, coefv2;
+    int      coef = 8*(arg >> 4);
+    RC_VEC_DECLARE();
+    RC_VEC_LOAD(srcv1, src1);
+    RC_VEC_LOAD(srcv2, src2);
+    RC_VEC_COEF(coefv1, coef);
+    RC_VEC_COEF(coefv2, coef - 0x80);
+    RC_VEC_ZERO(accv1);
+    RC_VEC_ZERO(accv2);
+    RC_VEC_MACW(accv1, accv2, srcv1, coefv1);
+    RC_VEC_MACW(accv1, accv2, srcv2, coefv2);
+    RC_VEC_PACKW(dstv, accv1, accv2, arg & 15);
+    RC_VEC_STORE(dst, dstv);
+    RC_VEC_CLEANUP();
+    return 0;
+}
+#else
+#define rc_test_vec_macw NULL
+#endif
+
+/**
+ *  The argument is the same as for the macw test, except that the
+ *  least significant bit selects the output vector of RC_VEC_GETW().
+ */
+#if defined RC_VEC_COEF && defined RC_VEC_MACW && defined RC_VEC_GETW
+static int
+RC_TEST_VEC_FUNC(getw)(uint8_t *dst, const uint8_t *src1,
+                       const uint8_t *src2, int arg)
+{
+    rc_vec_t dstv1, dstv2, srcv1, srcv2;
+    rc_vec_t accv1, accv2;
+    rc_vec_t coefv1, coefv2;
+    int      coef = 8*(arg >> 4);
+    RC_VEC_DECLARE();
+    RC_VEC_LOAD(srcv1, src1);
+    RC_VEC_LOAD(srcv2, src2);
+    RC_VEC_COEF(coefv1, coef);
+    RC_VEC_COEF(coefv2, coef - 0x80);
+    RC_VEC_ZERO(accv1);
+    RC_VEC_ZERO(accv2);
+    RC_VEC_MACW(accv1, accv2, srcv1, coefv1);
+    RC_VEC_MACW(accv1, accv2, srcv2, coefv2);
+    RC_VEC_GETW(dstv1, dstv2, accv1, accv2);
+    RC_VEC_STORE(dst, (arg & 1) ? dstv2 : dstv1);
+    RC_VEC_CLEANUP();
+    return 0;
+}
+#else
+#define rc_test_vec_getw NULL
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Arithmetic operations on 16-bit fields
+ * -------------------------------------------------------------
+ */
+
+#ifdef RC_VEC_SPLAT16
+static int
+RC_TEST_VEC_FUNC(splat16)(uint8_t *dst, const uint8_t *src1,
+                          const uint8_t *src2, int val)
+{
+    rc_vec_t vec;
+    RC_VEC_DECLARE();
+    (void)src1;
+    (void)src2;
+    RC_VEC_SPLAT16(vec, val);
+    RC_VEC_STORE(dst, vec);
+    RC_VEC_CLEANUP();
+    return 0;
+}
+#else
+#define rc_test_vec_splat16 NULL
+#endif
+
+#ifdef RC_VEC_ADDS16
+RC_TEST_BINOP_FUNCTION(ADDS16, adds16)
+#else
+#define rc_test_vec_adds16 NULL
+#endif
+
+#ifdef RC_VEC_SUBS16
+RC_TEST_BINOP_FUNCTION(SUBS16, subs16)
+#else
+#define rc_test_vec_subs16 NULL
+#endif
+
+#ifdef RC_VEC_CMPGT16
+RC_TEST_BINOP_FUNCTION(CMPGT16, cmpgt16)
+#else
+#define rc_test_vec_cmpgt16 NULL
+#endif
+
+#ifdef RC_VEC_MIN16
+RC_TEST_BINOP_FUNCTION(MIN16, min16)
+#else
+#define rc_test_vec_min16 NULL
+#endif
+
+#ifdef RC_VEC_MAX16
+RC_TEST_BINOP_FUNCTION(MAX16, max16)
+#else
+#define rc_test_vec_max16 NULL
+#endif
+
+#ifdef RC_VEC_MULHR16
+RC_TEST_BINOP_FUNCTION(MULHR16, mulhr16)
+#else
+#define rc_test_vec_mulhr16 NULL
+#endif
+
+/**
+ *  The first mask is srcv1 > srcv2 and the second mask is srcv2 > srcv1.
+ */
+#if defined RC_VEC_CMPGT16 && defined RC_VEC_PACKM16
+static int
+RC_TEST_VEC_FUNC(packm16)(uint8_t *dst, const uint8_t *src1,
+                          const uint8_t *src2, int val)
+{
+    rc_vec_t dstv, srcv1, srcv2, mask1, mask2;
+    RC_VEC_DECLARE();
+    (void)val;
+    RC_VEC_LOAD(srcv1, src1);
+    RC_VEC_LOAD(srcv2, src2);
+    RC_VEC_CMPGT16(mask1, srcv1, srcv2);
+    RC_VEC_CMPGT16(mask2, srcv2, srcv1);
+    RC_VEC_PACKM16(dstv, mask1, mask2);
+    RC_VEC_STORE(dst, dstv);
+    RC_VEC_CLEANUP();
+    return 0;
+}
+#else
+#define rc_test_vec_packm16 NULL
+#endif
+
+
 /*
  * -------------------------------------------------------------
  *  Binary mask operations
@@ -688,6 +862,30 @@ RC_TEST_VEC_FUNC(sum)(uint8_t *dst, const uint8_t *src1,
 #define rc_test_vec_sum NULL
 #endif
 
+#if defined RC_VEC_SUMN && defined RC_VEC_SADV && defined RC_VEC_SUMR
+static int
+RC_TEST_VEC_FUNC(sad)(uint8_t *dst, const uint8_t *src1,
+                      const uint8_t *src2, int val)
+{
+    rc_vec_t srcv1, srcv2, accv;
+    int      sum, k;
+    RC_VEC_DECLARE();
+    (void)dst;
+    (void)val;
+    RC_VEC_LOAD(srcv1, src1);
+    RC_VEC_LOAD(srcv2, src2);
+    RC_VEC_ZERO(accv);
+    for (k = 0; k < RC_VEC_SUMN; k++) {
+        RC_VEC_SADV(accv, srcv1, srcv2);
+    }
+    RC_VEC_SUMR(sum, accv);
+    RC_VEC_CLEANUP();
+    return sum;
+}
+#else
+#define rc_test_vec_sad NULL
+#endif
+
 #if defined RC_VEC_MACN && defined RC_VEC_MACV && defined RC_VEC_MACR
 static int
 RC_TEST_VEC_FUNC(mac)(uint8_t *dst, const uint8_t *src1,
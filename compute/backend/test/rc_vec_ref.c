@@ -105,6 +105,42 @@ rc_vec_pack_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
     return dstv;
 }
 
+rc_vec_ref_t
+rc_vec_ziplo_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE/2; k++) {
+        dstv.byte[2*k    ] = srcv1.byte[k];
+        dstv.byte[2*k + 1] = srcv2.byte[k];
+    }
+    return dstv;
+}
+
+rc_vec_ref_t
+rc_vec_ziphi_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE/2; k++) {
+        dstv.byte[2*k    ] = srcv1.byte[RC_VEC_SIZE/2 + k];
+        dstv.byte[2*k + 1] = srcv2.byte[RC_VEC_SIZE/2 + k];
+    }
+    return dstv;
+}
+
+rc_vec_ref_t
+rc_vec_shuffle_ref(rc_vec_ref_t tabv, rc_vec_ref_t idxv)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE; k++) {
+        int idx = idxv.byte[k];
+        dstv.byte[k] = idx & 0x80 ? 0 : tabv.byte[idx % RC_VEC_SIZE];
+    }
+    return dstv;
+}
+
 
 /*
  * -------------------------------------------------------------
@@ -324,6 +360,165 @@ rc_vec_lerpz_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2, int blend8)
 }
 
 
+/*
+ * -------------------------------------------------------------
+ *  Widening multiply-accumulate
+ * -------------------------------------------------------------
+ */
+
+rc_vec_ref_t
+rc_vec_macw_ref(rc_vec_ref_t accv, rc_vec_ref_t srcv, int coef, int pos)
+{
+    int k;
+    for (k = 0; k < RC_VEC_SIZE/2; k++) {
+        int16_t acc;
+        memcpy(&acc, &accv.byte[2*k], sizeof acc);
+        acc += srcv.byte[pos + k]*coef;
+        memcpy(&accv.byte[2*k], &acc, sizeof acc);
+    }
+    return accv;
+}
+
+rc_vec_ref_t
+rc_vec_packw_ref(rc_vec_ref_t accv1, rc_vec_ref_t accv2, int shift)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE; k++) {
+        const rc_vec_ref_t *accv = k < RC_VEC_SIZE/2 ? &accv1 : &accv2;
+        int16_t             acc;
+        int                 val;
+        memcpy(&acc, &accv->byte[2*(k % (RC_VEC_SIZE/2))], sizeof acc);
+        val = acc + ((1 << shift) >> 1);
+        dstv.byte[k] = val < 0 ? 0 : MIN(val >> shift, 0xff);
+    }
+    return dstv;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Arithmetic operations on 16-bit fields
+ * -------------------------------------------------------------
+ */
+
+rc_vec_ref_t
+rc_vec_splat16_ref(unsigned scal)
+{
+    rc_vec_ref_t dstv;
+    uint16_t     val = scal;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE/2; k++) {
+        memcpy(&dstv.byte[2*k], &val, sizeof val);
+    }
+    return dstv;
+}
+
+rc_vec_ref_t
+rc_vec_adds16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE/2; k++) {
+        uint16_t op1, op2, val;
+        memcpy(&op1, &srcv1.byte[2*k], sizeof op1);
+        memcpy(&op2, &srcv2.byte[2*k], sizeof op2);
+        val = MIN(op1 + op2, 0xffff);
+        memcpy(&dstv.byte[2*k], &val, sizeof val);
+    }
+    return dstv;
+}
+
+rc_vec_ref_t
+rc_vec_subs16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE/2; k++) {
+        uint16_t op1, op2, val;
+        memcpy(&op1, &srcv1.byte[2*k], sizeof op1);
+        memcpy(&op2, &srcv2.byte[2*k], sizeof op2);
+        val = MAX(op1 - op2, 0);
+        memcpy(&dstv.byte[2*k], &val, sizeof val);
+    }
+    return dstv;
+}
+
+rc_vec_ref_t
+rc_vec_cmpgt16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE/2; k++) {
+        uint16_t op1, op2, val;
+        memcpy(&op1, &srcv1.byte[2*k], sizeof op1);
+        memcpy(&op2, &srcv2.byte[2*k], sizeof op2);
+        val = op1 > op2 ? 0xffff : 0;
+        memcpy(&dstv.byte[2*k], &val, sizeof val);
+    }
+    return dstv;
+}
+
+rc_vec_ref_t
+rc_vec_min16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE/2; k++) {
+        uint16_t op1, op2, val;
+        memcpy(&op1, &srcv1.byte[2*k], sizeof op1);
+        memcpy(&op2, &srcv2.byte[2*k], sizeof op2);
+        val = MIN(op1, op2);
+        memcpy(&dstv.byte[2*k], &val, sizeof val);
+    }
+    return dstv;
+}
+
+rc_vec_ref_t
+rc_vec_max16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE/2; k++) {
+        uint16_t op1, op2, val;
+        memcpy(&op1, &srcv1.byte[2*k], sizeof op1);
+        memcpy(&op2, &srcv2.byte[2*k], sizeof op2);
+        val = MAX(op1, op2);
+        memcpy(&dstv.byte[2*k], &val, sizeof val);
+    }
+    return dstv;
+}
+
+rc_vec_ref_t
+rc_vec_mulhr16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE/2; k++) {
+        uint16_t op1, op2, val;
+        memcpy(&op1, &srcv1.byte[2*k], sizeof op1);
+        memcpy(&op2, &srcv2.byte[2*k], sizeof op2);
+        val = ((uint32_t)op1*op2 + 0x8000) >> 16;
+        memcpy(&dstv.byte[2*k], &val, sizeof val);
+    }
+    return dstv;
+}
+
+rc_vec_ref_t
+rc_vec_packm16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
+{
+    rc_vec_ref_t dstv;
+    int          k;
+    for (k = 0; k < RC_VEC_SIZE; k++) {
+        const rc_vec_ref_t *srcv = k < RC_VEC_SIZE/2 ? &srcv1 : &srcv2;
+        uint16_t            val;
+        memcpy(&val, &srcv->byte[2*(k % (RC_VEC_SIZE/2))], sizeof val);
+        dstv.byte[k] = val ? 0xff : 0;
+    }
+    return dstv;
+}
+
+
 /*
  * -------------------------------------------------------------
  *  Binary mask operations
@@ -405,6 +600,16 @@ rc_vec_sumv_ref(rc_vec_ref_t accv, rc_vec_ref_t srcv)
     return accv;
 }
 
+rc_vec_ref_t
+rc_vec_sadv_ref(rc_vec_ref_t accv, rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
+{
+    int k;
+    for (k = 0; k < RC_VEC_SIZE; k++) {
+        accv.word += abs(srcv1.byte[k] - srcv2.byte[k]);
+    }
+    return accv;
+}
+
 rc_vec_ref_t
 rc_vec_macv_ref(rc_vec_ref_t accv, rc_vec_ref_t srcv1, rc_vec_ref_t srcv2)
 {
@@ -191,6 +191,27 @@ do {                                               \
 #define RC_VEC_PACK(dstv, srcv1, srcv2) \
     ((dstv) = rc_vec_pack_ref(srcv1, srcv2))
 
+/**
+ *  Interleave the low fields.
+ */
+#undef  RC_VEC_ZIPLO
+#define RC_VEC_ZIPLO(dstv, srcv1, srcv2) \
+    ((dstv) = rc_vec_ziplo_ref(srcv1, srcv2))
+
+/**
+ *  Interleave the high fields.
+ */
+#undef  RC_VEC_ZIPHI
+#define RC_VEC_ZIPHI(dstv, srcv1, srcv2) \
+    ((dstv) = rc_vec_ziphi_ref(srcv1, srcv2))
+
+/**
+ *  Table lookup.
+ */
+#undef  RC_VEC_SHUFFLE
+#define RC_VEC_SHUFFLE(dstv, tabv, idxv) \
+    ((dstv) = rc_vec_shuffle_ref(tabv, idxv))
+
 
 /*
  * -------------------------------------------------------------
@@ -402,6 +423,113 @@ do {                                               \
     ((dstv) = rc_vec_lerpz_ref(srcv2, srcv1, 0x100 - blend8))
 
 
+/*
+ * -------------------------------------------------------------
+ *  Widening multiply-accumulate
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Generate the coefficient vector needed by RC_VEC_MACW().
+ */
+#undef  RC_VEC_COEF
+#define RC_VEC_COEF(coefv, coef) \
+    ((coefv).word = (uint16_t)(coef))
+
+/**
+ *  Widening multiply-accumulate. The first RC_VEC_SIZE/2 16-bit
+ *  fields are kept in accv1 and the remaining ones in accv2.
+ */
+#undef  RC_VEC_MACW
+#define RC_VEC_MACW(accv1, accv2, srcv, coefv)                       \
+do {                                                                 \
+    int coef__ = (int16_t)(coefv).word;                              \
+    (accv1) = rc_vec_macw_ref(accv1, srcv, coef__, 0);               \
+    (accv2) = rc_vec_macw_ref(accv2, srcv, coef__, RC_VEC_SIZE / 2); \
+} while (0)
+
+/**
+ *  Pack a widened accumulator to 8-bit fields.
+ */
+#undef  RC_VEC_PACKW
+#define RC_VEC_PACKW(dstv, accv1, accv2, shift) \
+    ((dstv) = rc_vec_packw_ref(accv1, accv2, shift))
+
+/**
+ *  Get the fields of a widened accumulator. The reference layout
+ *  is already in source field order.
+ */
+#undef  RC_VEC_GETW
+#define RC_VEC_GETW(dstv1, dstv2, accv1, accv2) \
+do {                                            \
+    (dstv1) = (accv1);                          \
+    (dstv2) = (accv2);                          \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Arithmetic operations on 16-bit fields
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Set a value to all 16-bit fields.
+ */
+#undef  RC_VEC_SPLAT16
+#define RC_VEC_SPLAT16(vec, scal) \
+    ((vec) = rc_vec_splat16_ref(scal))
+
+/**
+ *  Saturating addition.
+ */
+#undef  RC_VEC_ADDS16
+#define RC_VEC_ADDS16(dstv, srcv1, srcv2) \
+    ((dstv) = rc_vec_adds16_ref(srcv1, srcv2))
+
+/**
+ *  Saturating subtraction.
+ */
+#undef  RC_VEC_SUBS16
+#define RC_VEC_SUBS16(dstv, srcv1, srcv2) \
+    ((dstv) = rc_vec_subs16_ref(srcv1, srcv2))
+
+/**
+ *  Comparison greater-than.
+ */
+#undef  RC_VEC_CMPGT16
+#define RC_VEC_CMPGT16(dstv, srcv1, srcv2) \
+    ((dstv) = rc_vec_cmpgt16_ref(srcv1, srcv2))
+
+/**
+ *  Minimum value.
+ */
+#undef  RC_VEC_MIN16
+#define RC_VEC_MIN16(dstv, srcv1, srcv2) \
+    ((dstv) = rc_vec_min16_ref(srcv1, srcv2))
+
+/**
+ *  Maximum value.
+ */
+#undef  RC_VEC_MAX16
+#define RC_VEC_MAX16(dstv, srcv1, srcv2) \
+    ((dstv) = rc_vec_max16_ref(srcv1, srcv2))
+
+/**
+ *  Rounded high multiplication.
+ */
+#undef  RC_VEC_MULHR16
+#define RC_VEC_MULHR16(dstv, srcv1, srcv2) \
+    ((dstv) = rc_vec_mulhr16_ref(srcv1, srcv2))
+
+/**
+ *  Pack two 16-bit mask vectors.
+ */
+#undef  RC_VEC_PACKM16
+#define RC_VEC_PACKM16(dstv, srcv1, srcv2) \
+    ((dstv) = rc_vec_packm16_ref(srcv1, srcv2))
+
+
 /*
  * -------------------------------------------------------------
  *  Binary mask operations
@@ -472,6 +600,13 @@ do {                                               \
 #define RC_VEC_SUMR(sum, accv) \
     ((sum) = (accv).word)
 
+/**
+ *  Sum of absolute differences across all fields, accumulation step.
+ */
+#undef  RC_VEC_SADV
+#define RC_VEC_SADV(accv, srcv1, srcv2) \
+    ((accv) = rc_vec_sadv_ref(accv, srcv1, srcv2))
+
 #ifndef RC_VEC_MACN
 #define RC_VEC_MACN 0
 #endif
@@ -521,6 +656,15 @@ rc_vec_align_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2, int bytes);
 rc_vec_ref_t
 rc_vec_pack_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
 
+rc_vec_ref_t
+rc_vec_ziplo_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
+
+rc_vec_ref_t
+rc_vec_ziphi_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
+
+rc_vec_ref_t
+rc_vec_shuffle_ref(rc_vec_ref_t tabv, rc_vec_ref_t idxv);
+
 rc_vec_ref_t
 rc_vec_adds_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
 
@@ -563,6 +707,36 @@ rc_vec_lerp_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2, int blend8);
 rc_vec_ref_t
 rc_vec_lerpz_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2, int blend8);
 
+rc_vec_ref_t
+rc_vec_macw_ref(rc_vec_ref_t accv, rc_vec_ref_t srcv, int coef, int pos);
+
+rc_vec_ref_t
+rc_vec_packw_ref(rc_vec_ref_t accv1, rc_vec_ref_t accv2, int shift);
+
+rc_vec_ref_t
+rc_vec_splat16_ref(unsigned scal);
+
+rc_vec_ref_t
+rc_vec_adds16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
+
+rc_vec_ref_t
+rc_vec_subs16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
+
+rc_vec_ref_t
+rc_vec_cmpgt16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
+
+rc_vec_ref_t
+rc_vec_min16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
+
+rc_vec_ref_t
+rc_vec_max16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
+
+rc_vec_ref_t
+rc_vec_mulhr16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
+
+rc_vec_ref_t
+rc_vec_packm16_ref(rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
+
 unsigned
 rc_vec_getmaskw_ref(rc_vec_ref_t srcv);
 
@@ -578,6 +752,9 @@ rc_vec_cntv_ref(rc_vec_ref_t accv, rc_vec_ref_t srcv);
 rc_vec_ref_t
 rc_vec_sumv_ref(rc_vec_ref_t accv, rc_vec_ref_t srcv);
 
+rc_vec_ref_t
+rc_vec_sadv_ref(rc_vec_ref_t accv, rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
+
 rc_vec_ref_t
 rc_vec_macv_ref(rc_vec_ref_t accv, rc_vec_ref_t srcv1, rc_vec_ref_t srcv2);
 
@@ -0,0 +1,176 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_bgmodel.c
+ *  @brief  RAPP Compute layer background modelling.
+ *
+ *  ALGORITHM
+ *  ---------
+ *  Each binary word of the foreground mask is loaded as the update
+ *  condition before the new mask word replacing it is computed. The
+ *  mean and deviation updates use the same rounding as
+ *  rc_pixop_lerpn_u8(), so that the model always reaches the source
+ *  value when the source is stationary.
+ */
+
+#include <stdlib.h>      /* abs()              */
+#include "rc_impl_cfg.h" /* Implementation cfg */
+#include "rc_word.h"     /* Word operations    */
+#include "rc_bgmodel.h"  /* Background API     */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Linear interpolation with update rounded away from zero.
+ */
+#define RC_BGMODEL_LERPN(op1, op2, blend8)       \
+do {                                             \
+    int32_t upd = (blend8)*((op2) - (op1));      \
+    (op1) += (upd + (~(upd >> 31) & 0xff)) >> 8; \
+} while (0)
+
+/**
+ *  Mean update iteration.
+ */
+#define RC_BGMODEL_MEAN(acc, map, pos, src, i, mean, m, dev, n, \
+                        alpha8, thresh)                         \
+do {                                                            \
+    int pix = (src)[i];                                         \
+    int avg = (mean)[m];                                        \
+    if ((unsigned)abs(pix - avg) > (thresh)) {                  \
+        (acc) |= RC_WORD_BIT(pos);                              \
+    }                                                           \
+    if (!((map) & RC_WORD_BIT(pos))) {                          \
+        RC_BGMODEL_LERPN(avg, pix, alpha8);                     \
+        (mean)[m] = avg;                                        \
+    }                                                           \
+    (void)(dev);                                                \
+} while (0)
+
+/**
+ *  Mean and deviation update iteration.
+ */
+#define RC_BGMODEL_DEV(acc, map, pos, src, i, mean, m, dev, n, \
+                       alpha8, thresh)                         \
+do {                                                           \
+    int pix  = (src)[i];                                       \
+    int avg  = (mean)[m];                                      \
+    int var  = (dev)[n];                                       \
+    int diff = abs(pix - avg);                                 \
+    int lev  = (thresh) + 2*var;                               \
+    if (diff > lev) {                                          \
+        (acc) |= RC_WORD_BIT(pos);                             \
+    }                                                          \
+    if (!((map) & RC_WORD_BIT(pos))) {                         \
+        RC_BGMODEL_LERPN(avg, pix, alpha8);                    \
+        RC_BGMODEL_LERPN(var, diff, alpha8);                   \
+        (mean)[m] = avg;                                       \
+        (dev)[n]  = var;                                       \
+    }                                                          \
+} while (0)
+
+/**
+ *  Background update template.
+ *  The foreground mask is processed one word at a time.
+ */
+#define RC_BGMODEL_TEMPLATE(fg, fg_dim, mean, mean_dim, dev, dev_dim,  \
+                            src, src_dim, width, height,               \
+                            alpha8, thresh, iter)                      \
+do {                                                                   \
+    int y_;                                                            \
+    for (y_ = 0; y_ < (height); y_++) {                                \
+        int i_ = y_*(src_dim);                                         \
+        int j_ = y_*(fg_dim);                                          \
+        int m_ = y_*(mean_dim);                                        \
+        int n_ = y_*(dev_dim);                                         \
+        int x_;                                                        \
+        for (x_ = 0; x_ < (width); x_ += 8*RC_WORD_SIZE) {             \
+            rc_word_t map_ = RC_WORD_LOAD(&(fg)[j_]);                  \
+            rc_word_t acc_ = RC_WORD_ZERO;                             \
+            int       len_ = (width) - x_;                             \
+            int       k_;                                              \
+            if (len_ > 8*RC_WORD_SIZE) {                               \
+                len_ = 8*RC_WORD_SIZE;                                 \
+            }                                                          \
+            for (k_ = 0; k_ < len_; k_++, i_++, m_++, n_++) {          \
+                iter(acc_, map_, k_, src, i_, mean, m_, dev, n_,       \
+                     alpha8, thresh);                                  \
+            }                                                          \
+            RC_WORD_STORE(&(fg)[j_], acc_);                            \
+            j_ += RC_WORD_SIZE;                                        \
+        }                                                              \
+    }                                                                  \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Background mean update.
+ */
+#if RC_IMPL(rc_bgmodel_update_u8, 0)
+void
+rc_bgmodel_update_u8(uint8_t *restrict fg, int fg_dim,
+                     uint8_t *restrict mean, int mean_dim,
+                     const uint8_t *restrict src, int src_dim,
+                     int width, int height, unsigned alpha8,
+                     unsigned thresh)
+{
+    uint8_t *dev = NULL;
+    RC_BGMODEL_TEMPLATE(fg, fg_dim, mean, mean_dim, dev, 0,
+                        src, src_dim, width, height,
+                        alpha8, thresh, RC_BGMODEL_MEAN);
+}
+#endif
+
+/**
+ *  Background mean and deviation update.
+ */
+#if RC_IMPL(rc_bgmodel_update_dev_u8, 0)
+void
+rc_bgmodel_update_dev_u8(uint8_t *restrict fg, int fg_dim,
+                         uint8_t *restrict mean, int mean_dim,
+                         uint8_t *restrict dev, int dev_dim,
+                         const uint8_t *restrict src, int src_dim,
+                         int width, int height, unsigned alpha8,
+                         unsigned thresh)
+{
+    RC_BGMODEL_TEMPLATE(fg, fg_dim, mean, mean_dim, dev, dev_dim,
+                        src, src_dim, width, height,
+                        alpha8, (int)thresh, RC_BGMODEL_DEV);
+}
+#endif
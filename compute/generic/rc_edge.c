@@ -0,0 +1,81 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_edge.c
+ *  @brief  RAPP Compute layer edge detection primitives.
+ *
+ *  ALGORITHM
+ *  ---------
+ *  The non-maximum suppression compares each magnitude pixel with its
+ *  two neighbours along the gradient orientation. The orientation codes
+ *  0, 1, 2 and 3 correspond to the horizontal, the down-right diagonal,
+ *  the vertical and the down-left diagonal directions. The comparison
+ *  is strict against the neighbour before the pixel and non-strict
+ *  against the one after it, so that exactly one pixel of a flat ridge
+ *  two pixels wide is kept.
+ */
+
+#include "rc_impl_cfg.h" /* Implementation cfg */
+#include "rc_edge.h"     /* Edge detection API */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Non-maximum suppression.
+ */
+#if RC_IMPL(rc_edge_nms_u8, 0)
+void
+rc_edge_nms_u8(uint8_t *restrict dst, int dst_dim,
+               const uint8_t *restrict mag, int mag_dim,
+               const uint8_t *restrict dir, int dir_dim,
+               int width, int height)
+{
+    /* The neighbour offset for each orientation code */
+    int off[4] = {1, mag_dim + 1, mag_dim, mag_dim - 1};
+    int y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *mp = &mag[y*mag_dim];
+        const uint8_t *dp = &dir[y*dir_dim];
+        uint8_t       *op = &dst[y*dst_dim];
+        int            x;
+
+        for (x = 0; x < width; x++) {
+            int m = mp[x];
+            int k = off[dp[x] & 3];
+
+            op[x] = m > mp[x - k] && m >= mp[x + k] ? m : 0;
+        }
+    }
+}
+#endif
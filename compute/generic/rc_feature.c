@@ -0,0 +1,254 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_feature.c
+ *  @brief  RAPP Compute layer feature detection primitives.
+ *
+ *  ALGORITHM
+ *  ---------
+ *  The FAST segment test is computed from the saturated differences
+ *  between the sixteen circle pixels and the center, one set for the
+ *  brighter and one for the darker pixels. The minimum difference over
+ *  an arc is the largest threshold for which the arc passes the test,
+ *  so the maximum of the arc minima over all arcs and both polarities
+ *  gives the score directly. Any arc of nine pixels contains two
+ *  adjacent compass pixels 0, 4, 8 and 12, so the pixels that fail
+ *  the test on all compass pairs are rejected before the full test.
+ *
+ *  The Harris response sums the gradient products over three columns
+ *  at a time. Each column sum is computed once and reused by the next
+ *  two pixels. The products and sums fit in 32 bits, but the
+ *  determinant and the squared trace need 64-bit arithmetic.
+ */
+
+#include "rc_impl_cfg.h" /* Implementation cfg */
+#include "rc_util.h"     /* MIN(), MAX()       */
+#include "rc_feature.h"  /* Feature API        */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Global data
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The x and y offsets of the Bresenham circle of radius three,
+ *  clockwise from the top.
+ */
+#if RC_IMPL(rc_feature_fast_u8, 0)
+static const int rc_feature_circle[16][2] = {
+    { 0, -3}, { 1, -3}, { 2, -2}, { 3, -1},
+    { 3,  0}, { 3,  1}, { 2,  2}, { 1,  3},
+    { 0,  3}, {-1,  3}, {-2,  2}, {-3,  1},
+    {-3,  0}, {-3, -1}, {-2, -2}, {-1, -3}
+};
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+#if RC_IMPL(rc_feature_fast_u8, 0)
+static int
+rc_feature_fast_arc(const int *diff, int len);
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  FAST corner score.
+ */
+#if RC_IMPL(rc_feature_fast_u8, 0)
+void
+rc_feature_fast_u8(uint8_t *restrict dst, int dst_dim,
+                   const uint8_t *restrict src, int src_dim,
+                   int width, int height, int thresh)
+{
+    int off[16];
+    int k, y;
+
+    for (k = 0; k < 16; k++) {
+        off[k] = rc_feature_circle[k][1]*src_dim + rc_feature_circle[k][0];
+    }
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *sp = &src[y*src_dim];
+        uint8_t       *dp = &dst[y*dst_dim];
+        int            x;
+
+        for (x = 0; x < width; x++) {
+            int bright[16], dark[16];
+            int c = sp[x];
+            int s = 0;
+
+            for (k = 0; k < 16; k++) {
+                int v = sp[x + off[k]];
+                bright[k] = MAX(v - c, 0);
+                dark[k]   = MAX(c - v, 0);
+            }
+
+            /* Test the adjacent compass pairs */
+            for (k = 0; k < 16; k += 4) {
+                int j = (k + 4) & 15;
+                s = MAX(s, MIN(bright[k], bright[j]));
+                s = MAX(s, MIN(dark[k],   dark[j]));
+            }
+
+            /* Compute the score if the pixel may be a corner */
+            if (s > thresh) {
+                s = MAX(rc_feature_fast_arc(bright, 9),
+                        rc_feature_fast_arc(dark,   9));
+            }
+
+            dp[x] = s > thresh ? s - thresh : 0;
+        }
+    }
+}
+#endif
+
+/**
+ *  Non-maximum suppression of a score image.
+ */
+#if RC_IMPL(rc_feature_nms_u8, 0)
+void
+rc_feature_nms_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height)
+{
+    int y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *sp = &src[y*src_dim];
+        uint8_t       *dp = &dst[y*dst_dim];
+        int            x;
+
+        for (x = 0; x < width; x++) {
+            int v = sp[x];
+            int prev, next;
+
+            prev = MAX(MAX(sp[x - 1], sp[x - src_dim - 1]),
+                       MAX(sp[x - src_dim], sp[x - src_dim + 1]));
+            next = MAX(MAX(sp[x + 1], sp[x + src_dim - 1]),
+                       MAX(sp[x + src_dim], sp[x + src_dim + 1]));
+
+            dp[x] = v > prev && v >= next ? v : 0;
+        }
+    }
+}
+#endif
+
+/**
+ *  Harris corner response.
+ */
+#if RC_IMPL(rc_feature_harris_s16_s32, 0)
+void
+rc_feature_harris_s16_s32(int32_t *restrict dst, int dst_dim,
+                          const int16_t *restrict gx, int gx_dim,
+                          const int16_t *restrict gy, int gy_dim,
+                          int width, int height)
+{
+    int ddim = dst_dim / (int)sizeof *dst;
+    int xdim = gx_dim  / (int)sizeof *gx;
+    int ydim = gy_dim  / (int)sizeof *gy;
+    int y;
+
+    for (y = 0; y < height; y++) {
+        const int16_t *xp = &gx[y*xdim];
+        const int16_t *yp = &gy[y*ydim];
+        int32_t        sxx[3] = {0, 0, 0};
+        int32_t        syy[3] = {0, 0, 0};
+        int32_t        sxy[3] = {0, 0, 0};
+        int            x;
+
+        for (x = -1; x <= width; x++) {
+            int k = (x + 1) % 3;
+            int dy;
+
+            /* Sum the products of column x */
+            sxx[k] = syy[k] = sxy[k] = 0;
+            for (dy = -1; dy <= 1; dy++) {
+                int32_t vx = xp[dy*xdim + x];
+                int32_t vy = yp[dy*ydim + x];
+                sxx[k] += vx*vx;
+                syy[k] += vy*vy;
+                sxy[k] += vx*vy;
+            }
+
+            /* Compute the response of pixel x - 1 */
+            if (x > 0) {
+                int64_t a = sxx[0] + sxx[1] + sxx[2];
+                int64_t b = syy[0] + syy[1] + syy[2];
+                int64_t c = sxy[0] + sxy[1] + sxy[2];
+                int64_t r = a*b - c*c - 3*(a + b)*(a + b) / 64;
+
+                dst[y*ddim + x - 1] = (int32_t)(r / 65536);
+            }
+        }
+    }
+}
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the maximum over all circular arcs of the minimum
+ *  difference in the arc.
+ */
+#if RC_IMPL(rc_feature_fast_u8, 0)
+static int
+rc_feature_fast_arc(const int *diff, int len)
+{
+    int max = 0;
+    int k;
+
+    for (k = 0; k < 16; k++) {
+        int min = diff[k];
+        int j;
+        for (j = 1; j < len && min > max; j++) {
+            min = MIN(min, diff[(k + j) & 15]);
+        }
+        max = MAX(max, min);
+    }
+
+    return max;
+}
+#endif
@@ -332,3 +332,98 @@ rc_fill_8conn_rev_bin(uint8_t *restrict dst, int dst_dim,
 
     return change ? height - y - 1 : 0;
 }
+
+
+/**
+ *  8-connectivity forward fill iteration for multiple seeds.
+ */
+int
+rc_fill_8conn_seed_fwd_bin(uint8_t *restrict dst, int dst_dim,
+                           const uint8_t *restrict map, int map_dim,
+                           int width, int height)
+{
+    int len    = RC_DIV_CEIL(width, 8*RC_WORD_SIZE);
+    int change = 0;
+    int y;
+
+    for (y = 0; y < height; y++) {
+        int       x;
+        int       i      = y*map_dim;
+        int       j1     = y*dst_dim;
+        int       j2     = MAX(y - 1, 0)*dst_dim;
+        rc_word_t left   = 0;                      /* Sliding left word    */
+        rc_word_t up     = RC_WORD_LOAD(&dst[j2]); /* Sliding upper word   */
+        rc_word_t upleft = 0;                      /* Sliding up-left word */
+
+        for (x = 0, j2 += RC_WORD_SIZE;
+             x < len;
+             x++, i += RC_WORD_SIZE, j1 += RC_WORD_SIZE, j2 += RC_WORD_SIZE)
+        {
+            rc_word_t word, upright, mask;
+
+            /* Load new words */
+            mask    = RC_WORD_LOAD(&map[i ]);
+            word    = RC_WORD_LOAD(&dst[j1]);
+            upright = (x < len - 1) ? RC_WORD_LOAD(&dst[j2]) : 0;
+
+            /* Fill word and store */
+            RC_FILL_8CONN(word, left, 0, up, upleft, upright, mask, change);
+            RC_WORD_STORE(&dst[j1], word);
+
+            /* Update sliding variables */
+            upleft = up;
+            up     = upright;
+            left   = word;
+        }
+    }
+
+    return change;
+}
+
+
+/**
+ *  8-connectivity reversed fill iteration for multiple seeds.
+ */
+int
+rc_fill_8conn_seed_rev_bin(uint8_t *restrict dst, int dst_dim,
+                           const uint8_t *restrict map, int map_dim,
+                           int width, int height)
+{
+    int len    = RC_DIV_CEIL(width, 8*RC_WORD_SIZE);
+    int end    = (len - 1)*RC_WORD_SIZE;
+    int change = 0;
+    int y;
+
+    for (y = height - 1; y >= 0; y--) {
+        int       x;
+        int       i       = y*map_dim + end;
+        int       j1      = y*dst_dim + end;
+        int       j2      = MIN(y + 1, height - 1)*dst_dim + end;
+        rc_word_t right   = 0;                      /* Sliding right word     */
+        rc_word_t down    = RC_WORD_LOAD(&dst[j2]); /* Sliding lower word     */
+        rc_word_t dnright = 0;                      /* Sliding dn-right word  */
+
+        for (x = len - 1, j2 -= RC_WORD_SIZE;
+             x >= 0;
+             x--, i -= RC_WORD_SIZE, j1 -= RC_WORD_SIZE, j2 -= RC_WORD_SIZE)
+        {
+            rc_word_t word, dnleft, mask;
+
+            /* Load words */
+            mask   = RC_WORD_LOAD(&map[i ]);
+            word   = RC_WORD_LOAD(&dst[j1]);
+            dnleft = (x > 0) ? RC_WORD_LOAD(&dst[j2]) : 0;
+
+            /* Fill word and store */
+            RC_FILL_8CONN(word, 0, right, down, dnleft, dnright, mask, change);
+            RC_WORD_STORE(&dst[j1], word);
+
+            /* Update sliding variables */
+            dnright = down;
+            down    = dnleft;
+            right   = word;
+        }
+    }
+
+    return change;
+}
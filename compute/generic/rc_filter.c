@@ -40,11 +40,49 @@
  *  be further unrolled up to four times.
  *
  *  The final filter output is correctly rounded.
+ *
+ *  The user-kernel convolutions accumulate the full-precision sum for
+ *  each pixel before rounding and saturating it to 8 bits. The separable
+ *  variant applies the vertical kernel to a row buffer, including the
+ *  horizontal border, followed by the horizontal kernel.
+ *
+ *  The median filters sort the columns of the neighbourhood with
+ *  compare-exchange networks, and then select the median from the
+ *  subset of the row-sorted values that may contain it. The vector
+ *  implementation uses the same networks.
+ *
+ *  The rank filter uses the constant-time median filter algorithm of
+ *  Perreault and Hebert. A two-level histogram with 16 coarse and 256
+ *  fine bins is kept for each column, and slides down one row at a time.
+ *  The neighbourhood coarse histogram slides to the right by adding and
+ *  subtracting column histograms. Each 16-bin segment of the neighbourhood
+ *  fine histogram is only updated when the rank is found in that coarse
+ *  bin, and is recomputed from scratch if it is too far behind. The fine
+ *  column segments are stored with all columns of one coarse bin next to
+ *  each other, so that the segment updates access contiguous memory.
+ *  All histogram arithmetic is done on fixed-length 16-bin segments.
+ *
+ *  The Sobel gradient components are computed in full precision from
+ *  a single read of the source. The magnitude and orientation function
+ *  maps blocks of gradient components computed by
+ *  rc_filter_sobel_3x3_grad_u8_s16(), which also has a single-pass
+ *  vector implementation. The orientation is quantized exactly using
+ *  integer comparisons of squared 1-norms.
+ *
+ *  The signed 16-bit variants of the fixed filters use the same templates
+ *  as the 8-bit versions, with the output mapping set to unity.
+ *
+ *  The census transforms and the local binary patterns compare each
+ *  neighbour to the center pixel and pack the results into a code.
+ *  The census costs are the bitcounts of the XOR of the codes,
+ *  looked up one byte at a time.
  */
 
 #include <stdlib.h>      /* abs()              */
+#include <string.h>      /* memset()           */
 #include "rc_impl_cfg.h" /* Implementation cfg */
 #include "rc_util.h"     /* MAX()              */
+#include "rc_table.h"    /* Bitcount table     */
 #include "rc_filter.h"   /* Fixed-filter API   */
 
 /*
@@ -90,6 +128,12 @@
 #define RC_FILTER_OP_DIFF_ABS(dst, src1, src2) \
     ((dst) = abs((src2) - (src1)))
 
+/**
+ *  Full-precision difference operation.
+ */
+#define RC_FILTER_OP_SUB(dst, src1, src2) \
+    ((dst) = (src2) - (src1))
+
 
 /*
  * -------------------------------------------------------------
@@ -426,6 +470,333 @@ do {                                                                        \
 } while (0)
 
 
+/*
+ * -------------------------------------------------------------
+ *  User-kernel convolution macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Round, shift and saturate a convolution sum.
+ */
+#define RC_FILTER_CONV_MAP(sum, shift)                      \
+    ((sum) + ((1 << (shift)) >> 1) < 0 ? 0 :                \
+     MIN(((sum) + ((1 << (shift)) >> 1)) >> (shift), 0xff))
+
+
+/*
+ * -------------------------------------------------------------
+ *  Box filter macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Map a box sum to the rounded mean value.
+ */
+#define RC_FILTER_BOX_MAP(sum, recip) \
+    (((sum)*(recip) + 0x8000) >> 16)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Median filter macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compare-exchange, leaving the minimum in a and the maximum in b.
+ */
+#define RC_FILTER_MEDIAN_CE(a, b) \
+do {                              \
+    int min_ = MIN(a, b);         \
+    (b) = MAX(a, b);              \
+    (a) = min_;                   \
+} while (0)
+
+/**
+ *  Sort three values.
+ */
+#define RC_FILTER_MEDIAN_SORT3(v0, v1, v2) \
+do {                                       \
+    RC_FILTER_MEDIAN_CE(v0, v1);           \
+    RC_FILTER_MEDIAN_CE(v1, v2);           \
+    RC_FILTER_MEDIAN_CE(v0, v1);           \
+} while (0)
+
+/**
+ *  Sort five values with the optimal nine-comparator network.
+ */
+#define RC_FILTER_MEDIAN_SORT5(v0, v1, v2, v3, v4) \
+do {                                               \
+    RC_FILTER_MEDIAN_CE(v0, v1);                   \
+    RC_FILTER_MEDIAN_CE(v3, v4);                   \
+    RC_FILTER_MEDIAN_CE(v2, v4);                   \
+    RC_FILTER_MEDIAN_CE(v2, v3);                   \
+    RC_FILTER_MEDIAN_CE(v1, v4);                   \
+    RC_FILTER_MEDIAN_CE(v0, v3);                   \
+    RC_FILTER_MEDIAN_CE(v0, v2);                   \
+    RC_FILTER_MEDIAN_CE(v1, v3);                   \
+    RC_FILTER_MEDIAN_CE(v1, v2);                   \
+} while (0)
+
+/**
+ *  Median of three values.
+ */
+#define RC_FILTER_MEDIAN_MED3(v0, v1, v2) \
+    MAX(MIN(v0, v1), MIN(MAX(v0, v1), v2))
+
+/**
+ *  Move the minimum of the values m[lo], ..., m[hi] to m[lo]
+ *  and the maximum to m[hi].
+ */
+#define RC_FILTER_MEDIAN_EXTREMES(m, lo, hi)   \
+do {                                           \
+    int k_;                                    \
+    for (k_ = (lo) + 1; k_ <= (hi); k_++) {    \
+        RC_FILTER_MEDIAN_CE((m)[lo], (m)[k_]); \
+    }                                          \
+    for (k_ = (lo) + 1; k_ < (hi); k_++) {     \
+        RC_FILTER_MEDIAN_CE((m)[k_], (m)[hi]); \
+    }                                          \
+} while (0)
+
+/**
+ *  The 5x5 median of a neighbourhood v[row][col] with sorted columns.
+ *  The rows are sorted as well, which keeps the columns sorted. The
+ *  element v[i][j] is then greater than or equal to (i + 1)*(j + 1) - 1
+ *  other elements, and less than or equal to (5 - i)*(5 - j) - 1 others.
+ *  This rules out six elements on each side of the median, leaving
+ *  13 candidates. The median of those is found with forgetful selection:
+ *  the minimum and maximum of eight candidates are discarded, the next
+ *  candidate is added and so on until a single candidate remains.
+ */
+#define RC_FILTER_MEDIAN_5X5(med, v)                                   \
+do {                                                                   \
+    int m_[13];                                                        \
+    int r_;                                                            \
+    for (r_ = 0; r_ < 5; r_++) {                                       \
+        RC_FILTER_MEDIAN_SORT5((v)[r_][0], (v)[r_][1], (v)[r_][2],     \
+                               (v)[r_][3], (v)[r_][4]);                \
+    }                                                                  \
+    m_[0]  = (v)[0][3]; m_[1]  = (v)[0][4]; m_[2]  = (v)[1][2];        \
+    m_[3]  = (v)[1][3]; m_[4]  = (v)[1][4]; m_[5]  = (v)[2][1];        \
+    m_[6]  = (v)[2][2]; m_[7]  = (v)[2][3]; m_[8]  = (v)[3][0];        \
+    m_[9]  = (v)[3][1]; m_[10] = (v)[3][2]; m_[11] = (v)[4][0];        \
+    m_[12] = (v)[4][1];                                                \
+    for (r_ = 0; r_ < 5; r_++) {                                       \
+        RC_FILTER_MEDIAN_EXTREMES(m_, r_, 7);                          \
+        m_[7] = m_[r_ + 8];                                            \
+    }                                                                  \
+    RC_FILTER_MEDIAN_EXTREMES(m_, 5, 7);                               \
+    (med) = m_[6];                                                     \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Rank filter macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The number of bins in a histogram segment.
+ */
+#define RC_FILTER_RANK_SEG 16
+
+/**
+ *  Add a row of pixels to, or subtract it from, the column histograms.
+ */
+#define RC_FILTER_RANK_COLUMNS(coarse, fine, row, cols, op)                 \
+do {                                                                        \
+    int k_;                                                                 \
+    for (k_ = 0; k_ < (cols); k_++) {                                       \
+        int c_ = (row)[k_] / RC_FILTER_RANK_SEG;                            \
+        int f_ = (row)[k_] % RC_FILTER_RANK_SEG;                            \
+        (coarse)[k_*RC_FILTER_RANK_SEG + c_] op 1;                          \
+        (fine)[(c_*(cols) + k_)*RC_FILTER_RANK_SEG + f_] op 1;              \
+    }                                                                       \
+} while (0)
+
+/**
+ *  Update a histogram segment: seg += add - sub.
+ */
+#define RC_FILTER_RANK_SLIDE(seg, add, sub)       \
+do {                                              \
+    int k_;                                       \
+    for (k_ = 0; k_ < RC_FILTER_RANK_SEG; k_++) { \
+        (seg)[k_] += (add)[k_] - (sub)[k_];       \
+    }                                             \
+} while (0)
+
+/**
+ *  Find the bin in a histogram segment where the cumulative count,
+ *  starting at cnt, exceeds the rank. The count of the preceding
+ *  bins is added to cnt.
+ */
+#define RC_FILTER_RANK_FIND(bin, seg, cnt, rank) \
+do {                                             \
+    (bin) = 0;                                   \
+    while ((cnt) + (seg)[bin] <= (rank)) {       \
+        (cnt) += (seg)[bin];                     \
+        (bin)++;                                 \
+    }                                            \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Sobel gradient macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The full-precision 3x3 Sobel gradient template. The vertically
+ *  smoothed and differentiated columns slide to the right, so each
+ *  source pixel is read once per row. The operation maps the gradient
+ *  components gx and gy to one pixel in each of the two destinations.
+ */
+#define RC_FILTER_SOBEL_3X3_GRAD(dst1, dst1_dim, dst2, dst2_dim,           \
+                                 src, src_dim, width, height, op, arg)     \
+do {                                                                       \
+    int dim1_ = (dst1_dim) / (int)sizeof *(dst1);                          \
+    int dim2_ = (dst2_dim) / (int)sizeof *(dst2);                          \
+    int y_;                                                                \
+    for (y_ = 0; y_ < (height); y_++) {                                    \
+        const uint8_t *s1_ = &(src)[(y_ - 1)*(src_dim)];                   \
+        const uint8_t *s2_ = &s1_[src_dim];                                \
+        const uint8_t *s3_ = &s2_[src_dim];                                \
+        int g1_ = s1_[-1] + 2*s2_[-1] + s3_[-1]; /* Smoothed columns */    \
+        int g2_ = s1_[ 0] + 2*s2_[ 0] + s3_[ 0];                           \
+        int d1_ = s3_[-1] - s1_[-1];             /* Diff columns     */    \
+        int d2_ = s3_[ 0] - s1_[ 0];                                       \
+        int x_;                                                            \
+        for (x_ = 0; x_ < (width); x_++) {                                 \
+            int g3_ = s1_[x_ + 1] + 2*s2_[x_ + 1] + s3_[x_ + 1];           \
+            int d3_ = s3_[x_ + 1] - s1_[x_ + 1];                           \
+            int gx_ = g3_ - g1_;                                           \
+            int gy_ = d1_ + 2*d2_ + d3_;                                   \
+            op((dst1)[y_*dim1_ + x_], (dst2)[y_*dim2_ + x_],               \
+               gx_, gy_, arg);                                             \
+            g1_ = g2_, g2_ = g3_;                                          \
+            d1_ = d2_, d2_ = d3_;                                          \
+        }                                                                  \
+    }                                                                      \
+} while (0)
+
+/**
+ *  The number of columns mapped at a time by the Sobel magnitude and
+ *  orientation function. It is a multiple of the alignment, so that
+ *  each column block starts at an aligned source address.
+ */
+#define RC_FILTER_SOBEL_COLS 256
+
+/**
+ *  Quantize a gradient direction to the nearest multiple of 45 degrees,
+ *  counted from the positive x axis towards the positive y axis. With
+ *  a = |gx| and b = |gy|, the direction is closer to the x axis than
+ *  22.5 degrees if b < (sqrt(2) - 1)*a, i.e. if (a + b)^2 < 2*a^2. The
+ *  bounds are irrational and never hit, except for a zero gradient.
+ *  The code is looked up from the axis tests and the signs, to avoid
+ *  unpredictable branches.
+ */
+#define RC_FILTER_SOBEL_DIR(dir, gx, gy)                  \
+do {                                                      \
+    int a_ = abs(gx);                                     \
+    int b_ = abs(gy);                                     \
+    int s_ = (a_ + b_)*(a_ + b_);                         \
+    int i_ = (s_ <= 2*a_*a_) | (s_ < 2*b_*b_) << 1 |      \
+             ((gx) < 0) << 2 | ((gy) < 0) << 3;           \
+    (dir) = rc_filter_sobel_dir_lut[i_];                  \
+} while (0)
+
+/**
+ *  Gradient magnitude and orientation code operation.
+ *  The magnitude is the rounded 1-norm scaled by 1/8.
+ */
+#define RC_FILTER_SOBEL_OP_MAGN_DIR(mag, dir, gx, gy, mask) \
+do {                                                        \
+    int code_;                                              \
+    RC_FILTER_SOBEL_DIR(code_, gx, gy);                     \
+    (mag) = (abs(gx) + abs(gy) + 4) >> 3;                   \
+    (dir) = code_ & (mask);                                 \
+} while (0)
+
+/**
+ *  Gradient components operation.
+ */
+#define RC_FILTER_SOBEL_OP_GRAD(hgrad, vgrad, gx, gy, arg) \
+do {                                                       \
+    (hgrad) = (gx);                                        \
+    (vgrad) = (gy);                                        \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Census transform macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The census code of the neighbourhood of radius rad centered at ptr.
+ *  Bit k is set if neighbour k in raster order, skipping the center,
+ *  is less than the center pixel.
+ */
+#define RC_FILTER_CENSUS(code, ptr, dim, rad)               \
+do {                                                        \
+    int c_ = (ptr)[0];                                      \
+    int k_ = 0;                                             \
+    int i_, j_;                                             \
+    (code) = 0;                                             \
+    for (i_ = -(rad); i_ <= (rad); i_++) {                  \
+        for (j_ = -(rad); j_ <= (rad); j_++) {              \
+            if (i_ != 0 || j_ != 0) {                       \
+                int n_ = (ptr)[i_*(dim) + j_];              \
+                (code) |= (uint32_t)(n_ < c_) << k_;        \
+                k_++;                                       \
+            }                                               \
+        }                                                   \
+    }                                                       \
+} while (0)
+
+/**
+ *  The local binary pattern of the 3x3 neighbourhood centered at ptr.
+ *  The neighbours are visited clockwise from the top-left corner, and
+ *  bit k is set if neighbour k is greater than or equal to the center.
+ */
+#define RC_FILTER_LBP(code, ptr, dim)                       \
+do {                                                        \
+    int c_ = (ptr)[0];                                      \
+    (code) = ((ptr)[-(dim) - 1] >= c_)      |               \
+             ((ptr)[-(dim)    ] >= c_) << 1 |               \
+             ((ptr)[-(dim) + 1] >= c_) << 2 |               \
+             ((ptr)[         1] >= c_) << 3 |               \
+             ((ptr)[ (dim) + 1] >= c_) << 4 |               \
+             ((ptr)[ (dim)    ] >= c_) << 5 |               \
+             ((ptr)[ (dim) - 1] >= c_) << 6 |               \
+             ((ptr)[        -1] >= c_) << 7;                \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Global variables
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Orientation codes indexed by the horizontal and vertical axis tests
+ *  in bits 0 and 1, and the signs of gx and gy in bits 2 and 3.
+ *  The diagonal is used when neither axis test is true.
+ */
+static const uint8_t rc_filter_sobel_dir_lut[16] = {
+    1, 0, 2, 0, /* gx >= 0, gy >= 0 */
+    3, 4, 2, 0, /* gx <  0, gy >= 0 */
+    7, 0, 6, 0, /* gx >= 0, gy <  0 */
+    5, 4, 6, 0  /* gx <  0, gy <  0 */
+};
+
+
 /*
  * -------------------------------------------------------------
  *  Exported functions
@@ -612,6 +983,151 @@ rc_filter_sobel_3x3_magn_u8(uint8_t *restrict dst, int dst_dim,
 }
 #endif
 
+/**
+ *  3x3 Sobel gradient magnitude and orientation.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_magn_dir_u8, 0)
+void
+rc_filter_sobel_3x3_magn_dir_u8(uint8_t *restrict mag, int mag_dim,
+                                uint8_t *restrict dir, int dir_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height, int bins)
+{
+    int16_t  buf[2*RC_FILTER_SOBEL_COLS + RC_ALIGNMENT / 2];
+    int16_t *gx = (int16_t*)RC_ALIGN((uintptr_t)buf);
+    int16_t *gy = &gx[RC_FILTER_SOBEL_COLS];
+    int      dim = RC_FILTER_SOBEL_COLS*sizeof *gx;
+    int      x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x += RC_FILTER_SOBEL_COLS) {
+            int len = MIN(width - x, RC_FILTER_SOBEL_COLS);
+            int i;
+
+            /* Compute the gradient components of the column block */
+            rc_filter_sobel_3x3_grad_u8_s16(gx, dim, gy, dim,
+                                            &src[y*src_dim + x], src_dim,
+                                            len, 1);
+
+            /* Map them to magnitude and orientation */
+            for (i = 0; i < len; i++) {
+                RC_FILTER_SOBEL_OP_MAGN_DIR(mag[y*mag_dim + x + i],
+                                            dir[y*dir_dim + x + i],
+                                            gx[i], gy[i], bins - 1);
+            }
+        }
+    }
+}
+#endif
+
+/**
+ *  3x3 Sobel gradient components.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_grad_u8_s16, 0)
+void
+rc_filter_sobel_3x3_grad_u8_s16(int16_t *restrict gx, int gx_dim,
+                                int16_t *restrict gy, int gy_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height)
+{
+    RC_FILTER_SOBEL_3X3_GRAD(gx, gx_dim, gy, gy_dim,
+                             src, src_dim, width, height,
+                             RC_FILTER_SOBEL_OP_GRAD, 0);
+}
+#endif
+
+/**
+ *  1x2 horizontal difference, full precision.
+ */
+#if RC_IMPL(rc_filter_diff_1x2_horz_u8_s16, 1)
+void
+rc_filter_diff_1x2_horz_u8_s16(int16_t *restrict dst, int dst_dim,
+                               const uint8_t *restrict src, int src_dim,
+                               int width, int height)
+{
+    RC_FILTER_1X2(dst, dst_dim / (int)sizeof *dst, src, src_dim,
+                  width, height, RC_FILTER_OP_SUB,
+                  RC_UNROLL(rc_filter_diff_1x2_horz_u8_s16));
+}
+#endif
+
+/**
+ *  2x1 vertical difference, full precision.
+ */
+#if RC_IMPL(rc_filter_diff_2x1_vert_u8_s16, 1)
+void
+rc_filter_diff_2x1_vert_u8_s16(int16_t *restrict dst, int dst_dim,
+                               const uint8_t *restrict src, int src_dim,
+                               int width, int height)
+{
+    RC_FILTER_2X1(dst, dst_dim / (int)sizeof *dst, src, src_dim,
+                  width, height, RC_FILTER_OP_SUB,
+                  RC_UNROLL(rc_filter_diff_2x1_vert_u8_s16));
+}
+#endif
+
+/**
+ *  3x3 horizontal Sobel gradient, full precision.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_horz_u8_s16, 0)
+void
+rc_filter_sobel_3x3_horz_u8_s16(int16_t *restrict dst, int dst_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height)
+{
+    RC_FILTER_3X3_SEP(dst, dst_dim / (int)sizeof *dst, src, src_dim,
+                      width, height,
+                      RC_FILTER_SEP_DIFF, RC_FILTER_SEP_GAUSS,
+                      RC_FILTER_MOD_NONE, 0, 1, 0);
+}
+#endif
+
+/**
+ *  3x3 vertical Sobel gradient, full precision.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_vert_u8_s16, 0)
+void
+rc_filter_sobel_3x3_vert_u8_s16(int16_t *restrict dst, int dst_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height)
+{
+    RC_FILTER_3X3_SEP(dst, dst_dim / (int)sizeof *dst, src, src_dim,
+                      width, height,
+                      RC_FILTER_SEP_GAUSS, RC_FILTER_SEP_DIFF,
+                      RC_FILTER_MOD_NONE, 0, 1, 0);
+}
+#endif
+
+/**
+ *  3x3 laplacian, full precision.
+ */
+#if RC_IMPL(rc_filter_laplace_3x3_u8_s16, 0)
+void
+rc_filter_laplace_3x3_u8_s16(int16_t *restrict dst, int dst_dim,
+                             const uint8_t *restrict src, int src_dim,
+                             int width, int height)
+{
+    RC_FILTER_3X3_GEN(dst, dst_dim / (int)sizeof *dst, src, src_dim,
+                      width, height, RC_FILTER_GEN_LAPLACE,
+                      RC_FILTER_MOD_NONE, 0, 1, 0);
+}
+#endif
+
+/**
+ *  3x3 highpass filter, full precision.
+ */
+#if RC_IMPL(rc_filter_highpass_3x3_u8_s16, 0)
+void
+rc_filter_highpass_3x3_u8_s16(int16_t *restrict dst, int dst_dim,
+                              const uint8_t *restrict src, int src_dim,
+                              int width, int height)
+{
+    RC_FILTER_3X3_GEN(dst, dst_dim / (int)sizeof *dst, src, src_dim,
+                      width, height, RC_FILTER_GEN_HIGHPASS,
+                      RC_FILTER_MOD_NONE, 0, 1, 0);
+}
+#endif
+
 /**
  *  3x3 gaussian.
  */
@@ -684,3 +1200,612 @@ rc_filter_highpass_3x3_abs_u8(uint8_t *restrict dst, int dst_dim,
                       RC_FILTER_GEN_HIGHPASS, RC_FILTER_MOD_ABS, 4, 1, 3);
 }
 #endif
+
+/**
+ *  General 2D convolution.
+ */
+#if RC_IMPL(rc_filter_conv_u8, 0)
+void
+rc_filter_conv_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height,
+                  const int8_t *kern, int kern_width, int kern_height,
+                  int shift)
+{
+    int xrad = kern_width  / 2;
+    int yrad = kern_height / 2;
+    int y;
+
+    for (y = 0; y < height; y++) {
+        int x;
+        for (x = 0; x < width; x++) {
+            const uint8_t *ptr = &src[(y - yrad)*src_dim + x - xrad];
+            int            sum = 0;
+            int            i, j, k;
+
+            for (i = 0, k = 0; i < kern_height; i++, ptr += src_dim) {
+                for (j = 0; j < kern_width; j++, k++) {
+                    sum += kern[k]*ptr[j];
+                }
+            }
+            dst[y*dst_dim + x] = RC_FILTER_CONV_MAP(sum, shift);
+        }
+    }
+}
+#endif
+
+/**
+ *  Separable convolution.
+ */
+#if RC_IMPL(rc_filter_sep_u8, 0)
+void
+rc_filter_sep_u8(uint8_t *restrict dst, int dst_dim,
+                 const uint8_t *restrict src, int src_dim,
+                 int width, int height,
+                 const int8_t *xkern, int xlen, int xshift,
+                 const int8_t *ykern, int ylen, int yshift,
+                 uint8_t *restrict row)
+{
+    int xrad = xlen / 2;
+    int yrad = ylen / 2;
+    int y;
+
+    for (y = 0; y < height; y++) {
+        int x;
+
+        /* Vertical pass to the row buffer, including the border */
+        for (x = -xrad; x < width + xrad; x++) {
+            const uint8_t *ptr = &src[(y - yrad)*src_dim + x];
+            int            sum = 0;
+            int            k;
+            for (k = 0; k < ylen; k++, ptr += src_dim) {
+                sum += ykern[k]*ptr[0];
+            }
+            row[x] = RC_FILTER_CONV_MAP(sum, yshift);
+        }
+
+        /* Horizontal pass to the destination row */
+        for (x = 0; x < width; x++) {
+            int sum = 0;
+            int k;
+            for (k = 0; k < xlen; k++) {
+                sum += xkern[k]*row[x - xrad + k];
+            }
+            dst[y*dst_dim + x] = RC_FILTER_CONV_MAP(sum, xshift);
+        }
+    }
+}
+#endif
+
+/**
+ *  3x3 median filter.
+ */
+#if RC_IMPL(rc_filter_median_3x3_u8, 0)
+void
+rc_filter_median_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height)
+{
+    int y;
+    for (y = 0; y < height; y++) {
+        int x;
+        for (x = 0; x < width; x++) {
+            const uint8_t *ptr = &src[(y - 1)*src_dim + x - 1];
+            int            v[3][3];
+            int            lo, mid, hi, k;
+
+            /* Sort the columns */
+            for (k = 0; k < 3; k++) {
+                v[0][k] = ptr[k];
+                v[1][k] = ptr[src_dim + k];
+                v[2][k] = ptr[2*src_dim + k];
+                RC_FILTER_MEDIAN_SORT3(v[0][k], v[1][k], v[2][k]);
+            }
+
+            /* Select the median from the row maximum, median and minimum */
+            lo  = MAX(MAX(v[0][0], v[0][1]), v[0][2]);
+            mid = RC_FILTER_MEDIAN_MED3(v[1][0], v[1][1], v[1][2]);
+            hi  = MIN(MIN(v[2][0], v[2][1]), v[2][2]);
+            dst[y*dst_dim + x] = RC_FILTER_MEDIAN_MED3(lo, mid, hi);
+        }
+    }
+}
+#endif
+
+/**
+ *  5x5 median filter.
+ */
+#if RC_IMPL(rc_filter_median_5x5_u8, 0)
+void
+rc_filter_median_5x5_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height)
+{
+    int y;
+    for (y = 0; y < height; y++) {
+        int x;
+        for (x = 0; x < width; x++) {
+            const uint8_t *ptr = &src[(y - 2)*src_dim + x - 2];
+            int            v[5][5];
+            int            med, i, k;
+
+            /* Sort the columns */
+            for (k = 0; k < 5; k++) {
+                for (i = 0; i < 5; i++) {
+                    v[i][k] = ptr[i*src_dim + k];
+                }
+                RC_FILTER_MEDIAN_SORT5(v[0][k], v[1][k], v[2][k],
+                                       v[3][k], v[4][k]);
+            }
+
+            RC_FILTER_MEDIAN_5X5(med, v);
+            dst[y*dst_dim + x] = med;
+        }
+    }
+}
+#endif
+
+/**
+ *  Horizontal box filter.
+ */
+#if RC_IMPL(rc_filter_box_horz_u8, 0)
+void
+rc_filter_box_horz_u8(uint8_t *restrict dst, int dst_dim,
+                      const uint8_t *restrict src, int src_dim,
+                      int width, int height, int size)
+{
+    int rad = size / 2;
+    int rcp = RC_FILTER_BOX_RECIP(size);
+    int y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row = &src[y*src_dim];
+        uint8_t       *out = &dst[y*dst_dim];
+        unsigned       sum = 0;
+        int            x;
+
+        /* Sum all but the rightmost pixel of the first box */
+        for (x = -rad; x < rad; x++) {
+            sum += row[x];
+        }
+
+        /* Slide the box over the row */
+        for (x = 0; x < width; x++) {
+            sum   += row[x + rad];
+            out[x] = RC_FILTER_BOX_MAP(sum, rcp);
+            sum   -= row[x - rad];
+        }
+    }
+}
+#endif
+
+/**
+ *  Vertical box filter.
+ */
+#if RC_IMPL(rc_filter_box_vert_u8, 0)
+void
+rc_filter_box_vert_u8(uint8_t *restrict dst, int dst_dim,
+                      const uint8_t *restrict src, int src_dim,
+                      int width, int height, int size,
+                      uint16_t *restrict sum)
+{
+    int rad = size / 2;
+    int rcp = RC_FILTER_BOX_RECIP(size);
+    int x, y;
+
+    /* Sum all but the bottom row of the first box */
+    for (x = 0; x < width; x++) {
+        sum[x] = 0;
+    }
+    for (y = -rad; y < rad; y++) {
+        const uint8_t *row = &src[y*src_dim];
+        for (x = 0; x < width; x++) {
+            sum[x] += row[x];
+        }
+    }
+
+    /* Slide the box over the columns */
+    for (y = 0; y < height; y++) {
+        const uint8_t *add = &src[(y + rad)*src_dim];
+        const uint8_t *sub = &src[(y - rad)*src_dim];
+        uint8_t       *out = &dst[y*dst_dim];
+
+        for (x = 0; x < width; x++) {
+            unsigned val = sum[x] + add[x];
+            out[x] = RC_FILTER_BOX_MAP(val, rcp);
+            sum[x] = val - sub[x];
+        }
+    }
+}
+#endif
+
+/**
+ *  Rank filter.
+ */
+void
+rc_filter_rank_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height, int radius, int rank,
+                  uint16_t *restrict hist)
+{
+    int       size   = 2*radius + 1;
+    int       cols   = width + 2*radius;
+    uint16_t *coarse = hist;
+    uint16_t *fine   = &hist[RC_FILTER_RANK_SEG*cols];
+    int       y;
+
+    /* Add all but the bottom row of the first neighbourhood */
+    memset(hist, 0, RC_FILTER_RANK_BINS*cols*sizeof *hist);
+    for (y = -radius; y < radius; y++) {
+        RC_FILTER_RANK_COLUMNS(coarse, fine, &src[y*src_dim - radius],
+                               cols, +=);
+    }
+
+    for (y = 0; y < height; y++) {
+        uint16_t kcoarse[RC_FILTER_RANK_SEG];
+        uint16_t kfine[RC_FILTER_RANK_SEG*RC_FILTER_RANK_SEG];
+        int      start[RC_FILTER_RANK_SEG];
+        int      x, k;
+
+        /* Slide the column histograms down */
+        RC_FILTER_RANK_COLUMNS(coarse, fine,
+                               &src[(y + radius)*src_dim - radius],
+                               cols, +=);
+
+        /* Sum all but the rightmost column of the first neighbourhood */
+        memset(kcoarse, 0, sizeof kcoarse);
+        for (x = 0; x < size - 1; x++) {
+            for (k = 0; k < RC_FILTER_RANK_SEG; k++) {
+                kcoarse[k] += coarse[x*RC_FILTER_RANK_SEG + k];
+            }
+        }
+
+        /* Invalidate all fine segments */
+        for (k = 0; k < RC_FILTER_RANK_SEG; k++) {
+            start[k] = -size;
+        }
+
+        for (x = 0; x < width; x++) {
+            uint16_t *seg;
+            int       cnt = 0;
+            int       c, f;
+
+            /* Add the rightmost column to the coarse histogram */
+            for (k = 0; k < RC_FILTER_RANK_SEG; k++) {
+                kcoarse[k] += coarse[(x + size - 1)*RC_FILTER_RANK_SEG + k];
+            }
+
+            /* Find the coarse bin */
+            RC_FILTER_RANK_FIND(c, kcoarse, cnt, rank);
+
+            /* Bring the fine segment of the coarse bin up to date */
+            seg = &kfine[c*RC_FILTER_RANK_SEG];
+            if (2*(x - start[c]) > size) {
+                const uint16_t *col = &fine[(c*cols + x)*RC_FILTER_RANK_SEG];
+                memset(seg, 0, RC_FILTER_RANK_SEG*sizeof *seg);
+                for (k = 0; k < size; k++, col += RC_FILTER_RANK_SEG) {
+                    int j;
+                    for (j = 0; j < RC_FILTER_RANK_SEG; j++) {
+                        seg[j] += col[j];
+                    }
+                }
+            }
+            else {
+                const uint16_t *col = &fine[c*cols*RC_FILTER_RANK_SEG];
+                for (k = start[c]; k < x; k++) {
+                    RC_FILTER_RANK_SLIDE(seg,
+                                         &col[(k + size)*RC_FILTER_RANK_SEG],
+                                         &col[k*RC_FILTER_RANK_SEG]);
+                }
+            }
+            start[c] = x;
+
+            /* Find the fine bin */
+            RC_FILTER_RANK_FIND(f, seg, cnt, rank);
+            dst[y*dst_dim + x] = c*RC_FILTER_RANK_SEG + f;
+
+            /* Subtract the leftmost column from the coarse histogram */
+            for (k = 0; k < RC_FILTER_RANK_SEG; k++) {
+                kcoarse[k] -= coarse[x*RC_FILTER_RANK_SEG + k];
+            }
+        }
+
+        /* Remove the top row from the column histograms */
+        RC_FILTER_RANK_COLUMNS(coarse, fine,
+                               &src[(y - radius)*src_dim - radius],
+                               cols, -=);
+    }
+}
+
+
+/**
+ *  3x3 gaussian on 16-bit pixels.
+ */
+#if RC_IMPL(rc_filter_gauss_3x3_u16, 0)
+void
+rc_filter_gauss_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                        const uint16_t *restrict src, int src_dim,
+                        int width, int height)
+{
+    RC_FILTER_3X3_SEP(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                      RC_FILTER_SEP_GAUSS, RC_FILTER_SEP_GAUSS,
+                      RC_FILTER_MOD_NONE, 8, 1, 4);
+}
+#endif
+
+/**
+ *  3x3 median filter on 16-bit pixels.
+ */
+#if RC_IMPL(rc_filter_median_3x3_u16, 0)
+void
+rc_filter_median_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                         const uint16_t *restrict src, int src_dim,
+                         int width, int height)
+{
+    int sdim = src_dim / 2;
+    int ddim = dst_dim / 2;
+    int y;
+    for (y = 0; y < height; y++) {
+        int x;
+        for (x = 0; x < width; x++) {
+            const uint16_t *ptr = &src[(y - 1)*sdim + x - 1];
+            int             v[3][3];
+            int             lo, mid, hi, k;
+
+            /* Sort the columns */
+            for (k = 0; k < 3; k++) {
+                v[0][k] = ptr[k];
+                v[1][k] = ptr[sdim + k];
+                v[2][k] = ptr[2*sdim + k];
+                RC_FILTER_MEDIAN_SORT3(v[0][k], v[1][k], v[2][k]);
+            }
+
+            /* Select the median from the row maximum, median and minimum */
+            lo  = MAX(MAX(v[0][0], v[0][1]), v[0][2]);
+            mid = RC_FILTER_MEDIAN_MED3(v[1][0], v[1][1], v[1][2]);
+            hi  = MIN(MIN(v[2][0], v[2][1]), v[2][2]);
+            dst[y*ddim + x] = RC_FILTER_MEDIAN_MED3(lo, mid, hi);
+        }
+    }
+}
+#endif
+
+/**
+ *  3x3 horizontal Sobel gradient on 16-bit pixels.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_horz_u16, 0)
+void
+rc_filter_sobel_3x3_horz_u16(uint16_t *restrict dst, int dst_dim,
+                             const uint16_t *restrict src, int src_dim,
+                             int width, int height)
+{
+    RC_FILTER_3X3_SEP(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                      RC_FILTER_SEP_DIFF, RC_FILTER_SEP_GAUSS,
+                      RC_FILTER_MOD_NONE, 8*0x8000 + 3, 1, 3);
+}
+#endif
+
+/**
+ *  3x3 horizontal Sobel gradient on 16-bit pixels, absolute value.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_horz_abs_u16, 0)
+void
+rc_filter_sobel_3x3_horz_abs_u16(uint16_t *restrict dst, int dst_dim,
+                                 const uint16_t *restrict src, int src_dim,
+                                 int width, int height)
+{
+    RC_FILTER_3X3_SEP(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                      RC_FILTER_SEP_DIFF, RC_FILTER_SEP_GAUSS,
+                      RC_FILTER_MOD_ABS, 1, 1, 2);
+}
+#endif
+
+/**
+ *  3x3 vertical Sobel gradient on 16-bit pixels.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_vert_u16, 0)
+void
+rc_filter_sobel_3x3_vert_u16(uint16_t *restrict dst, int dst_dim,
+                             const uint16_t *restrict src, int src_dim,
+                             int width, int height)
+{
+    RC_FILTER_3X3_SEP(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                      RC_FILTER_SEP_GAUSS, RC_FILTER_SEP_DIFF,
+                      RC_FILTER_MOD_NONE, 8*0x8000 + 3, 1, 3);
+}
+#endif
+
+/**
+ *  3x3 vertical Sobel gradient on 16-bit pixels, absolute value.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_vert_abs_u16, 0)
+void
+rc_filter_sobel_3x3_vert_abs_u16(uint16_t *restrict dst, int dst_dim,
+                                 const uint16_t *restrict src, int src_dim,
+                                 int width, int height)
+{
+    RC_FILTER_3X3_SEP(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                      RC_FILTER_SEP_GAUSS, RC_FILTER_SEP_DIFF,
+                      RC_FILTER_MOD_ABS, 1, 1, 2);
+}
+#endif
+
+/**
+ *  3x3 laplacian on 16-bit pixels.
+ */
+#if RC_IMPL(rc_filter_laplace_3x3_u16, 0)
+void
+rc_filter_laplace_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                          const uint16_t *restrict src, int src_dim,
+                          int width, int height)
+{
+    RC_FILTER_3X3_GEN(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                      RC_FILTER_GEN_LAPLACE, RC_FILTER_MOD_NONE,
+                      8*0x8000 + 3, 1, 3);
+}
+#endif
+
+/**
+ *  3x3 laplacian on 16-bit pixels, absolute value.
+ */
+#if RC_IMPL(rc_filter_laplace_3x3_abs_u16, 0)
+void
+rc_filter_laplace_3x3_abs_u16(uint16_t *restrict dst, int dst_dim,
+                              const uint16_t *restrict src, int src_dim,
+                              int width, int height)
+{
+    RC_FILTER_3X3_GEN(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                      RC_FILTER_GEN_LAPLACE, RC_FILTER_MOD_ABS,
+                      1, 1, 2);
+}
+#endif
+
+/**
+ *  3x3 highpass filter on 16-bit pixels.
+ */
+#if RC_IMPL(rc_filter_highpass_3x3_u16, 0)
+void
+rc_filter_highpass_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                           const uint16_t *restrict src, int src_dim,
+                           int width, int height)
+{
+    RC_FILTER_3X3_GEN(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                      RC_FILTER_GEN_HIGHPASS, RC_FILTER_MOD_NONE,
+                      16*0x8000 + 7, 1, 4);
+}
+#endif
+
+/**
+ *  3x3 highpass filter on 16-bit pixels, absolute value.
+ */
+#if RC_IMPL(rc_filter_highpass_3x3_abs_u16, 0)
+void
+rc_filter_highpass_3x3_abs_u16(uint16_t *restrict dst, int dst_dim,
+                               const uint16_t *restrict src, int src_dim,
+                               int width, int height)
+{
+    RC_FILTER_3X3_GEN(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                      RC_FILTER_GEN_HIGHPASS, RC_FILTER_MOD_ABS,
+                      3, 1, 3);
+}
+#endif
+
+/**
+ *  3x3 census transform.
+ */
+#if RC_IMPL(rc_filter_census_3x3_u8, 0)
+void
+rc_filter_census_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height)
+{
+    int y;
+    for (y = 0; y < height; y++) {
+        int x;
+        for (x = 0; x < width; x++) {
+            uint32_t code;
+            RC_FILTER_CENSUS(code, &src[y*src_dim + x], src_dim, 1);
+            dst[y*dst_dim + x] = code;
+        }
+    }
+}
+#endif
+
+/**
+ *  5x5 census transform.
+ */
+#if RC_IMPL(rc_filter_census_5x5_u8_u32, 0)
+void
+rc_filter_census_5x5_u8_u32(uint32_t *restrict dst, int dst_dim,
+                            const uint8_t *restrict src, int src_dim,
+                            int width, int height)
+{
+    int ddim = dst_dim / 4;
+    int y;
+    for (y = 0; y < height; y++) {
+        int x;
+        for (x = 0; x < width; x++) {
+            uint32_t code;
+            RC_FILTER_CENSUS(code, &src[y*src_dim + x], src_dim, 2);
+            dst[y*ddim + x] = code;
+        }
+    }
+}
+#endif
+
+/**
+ *  3x3 local binary patterns.
+ */
+#if RC_IMPL(rc_filter_lbp_3x3_u8, 0)
+void
+rc_filter_lbp_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                     const uint8_t *restrict src, int src_dim,
+                     int width, int height)
+{
+    int y;
+    for (y = 0; y < height; y++) {
+        int x;
+        for (x = 0; x < width; x++) {
+            int code;
+            RC_FILTER_LBP(code, &src[y*src_dim + x], src_dim);
+            dst[y*dst_dim + x] = code;
+        }
+    }
+}
+#endif
+
+/**
+ *  Hamming distance between 8-bit codes.
+ */
+#if RC_IMPL(rc_filter_census_cost_u8, 0)
+void
+rc_filter_census_cost_u8(uint8_t *restrict dst, int dst_dim,
+                         const uint8_t *restrict src1, int src1_dim,
+                         const uint8_t *restrict src2, int src2_dim,
+                         int width, int height, int disp)
+{
+    int len = MIN(disp, width);
+    int y;
+    for (y = 0; y < height; y++) {
+        const uint8_t *row1 = &src1[y*src1_dim];
+        const uint8_t *row2 = &src2[y*src2_dim];
+        uint8_t       *out  = &dst[y*dst_dim];
+        int            x;
+
+        memset(out, 8, len);
+        for (x = len; x < width; x++) {
+            out[x] = rc_table_bitcount[row1[x] ^ row2[x - disp]];
+        }
+    }
+}
+#endif
+
+/**
+ *  Hamming distance between 32-bit codes.
+ */
+#if RC_IMPL(rc_filter_census_cost_u32_u8, 0)
+void
+rc_filter_census_cost_u32_u8(uint8_t *restrict dst, int dst_dim,
+                             const uint32_t *restrict src1, int src1_dim,
+                             const uint32_t *restrict src2, int src2_dim,
+                             int width, int height, int disp)
+{
+    int len = MIN(disp, width);
+    int y;
+    for (y = 0; y < height; y++) {
+        const uint32_t *row1 = &src1[y*(src1_dim / 4)];
+        const uint32_t *row2 = &src2[y*(src2_dim / 4)];
+        uint8_t        *out  = &dst[y*dst_dim];
+        int             x;
+
+        memset(out, 32, len);
+        for (x = len; x < width; x++) {
+            uint32_t code = row1[x] ^ row2[x - disp];
+            out[x] = rc_table_bitcount[ code        & 0xff] +
+                     rc_table_bitcount[(code >>  8) & 0xff] +
+                     rc_table_bitcount[(code >> 16) & 0xff] +
+                     rc_table_bitcount[ code >> 24        ];
+        }
+    }
+}
+#endif
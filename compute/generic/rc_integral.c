@@ -41,9 +41,9 @@
  */
 
 /**
- *  8-bit integral image template.
+ *  Integral image template. The source dimension is given in pixels.
  */
-#define RC_INTEGRAL_SUM_U8(dst, dst_dim, src, src_dim, width, height)       \
+#define RC_INTEGRAL_SUM(dst, dst_dim, src, src_dim, width, height)          \
 do {                                                                        \
     int dim_ = (dst_dim) / sizeof *(dst);                                   \
     int x_, y_;                                                             \
@@ -80,7 +80,7 @@ rc_integral_sum_u8_u16(uint16_t *restrict dst, int dst_dim,
                        const uint8_t *restrict src, int src_dim,
                        int width, int height)
 {
-    RC_INTEGRAL_SUM_U8(dst, dst_dim, src, src_dim, width, height);
+    RC_INTEGRAL_SUM(dst, dst_dim, src, src_dim, width, height);
 }
 
 /**
@@ -91,5 +91,16 @@ rc_integral_sum_u8_u32(uint32_t *restrict dst, int dst_dim,
                        const uint8_t *restrict src, int src_dim,
                        int width, int height)
 {
-    RC_INTEGRAL_SUM_U8(dst, dst_dim, src, src_dim, width, height);
+    RC_INTEGRAL_SUM(dst, dst_dim, src, src_dim, width, height);
+}
+
+/**
+ *  Integral image: 16-bit source to 32-bit integral.
+ */
+void
+rc_integral_sum_u16_u32(uint32_t *restrict dst, int dst_dim,
+                        const uint16_t *restrict src, int src_dim,
+                        int width, int height)
+{
+    RC_INTEGRAL_SUM(dst, dst_dim, src, src_dim / 2, width, height);
 }
@@ -0,0 +1,92 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_match.c
+ *  @brief  RAPP Compute layer template matching, generic implementation.
+ */
+
+#include "rc_impl_cfg.h" /* Implementation cfg */
+#include "rc_match.h"    /* Matching API       */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Block sum of squared differences with early termination.
+ */
+#if RC_IMPL(rc_match_ssd_u8, 0)
+uint32_t
+rc_match_ssd_u8(const uint8_t *restrict blk, int blk_dim,
+                const uint8_t *restrict ref, int ref_dim,
+                int width, int height, uint32_t limit)
+{
+    uint32_t sum = 0;
+    int      y;
+
+    for (y = 0; y < height && sum <= limit; y++) {
+        const uint8_t *row1 = &blk[y*blk_dim];
+        const uint8_t *row2 = &ref[y*ref_dim];
+        int            x;
+        for (x = 0; x < width; x++) {
+            int dif = row1[x] - row2[x];
+            sum += dif*dif;
+        }
+    }
+
+    return sum;
+}
+#endif
+
+/**
+ *  Block sum of products.
+ */
+#if RC_IMPL(rc_match_mac_u8, 0)
+uint32_t
+rc_match_mac_u8(const uint8_t *restrict blk, int blk_dim,
+                const uint8_t *restrict ref, int ref_dim,
+                int width, int height)
+{
+    uint32_t sum = 0;
+    int      y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row1 = &blk[y*blk_dim];
+        const uint8_t *row2 = &ref[y*ref_dim];
+        int            x;
+        for (x = 0; x < width; x++) {
+            sum += row1[x]*row2[x];
+        }
+    }
+
+    return sum;
+}
+#endif
@@ -0,0 +1,216 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_morph.c
+ *  @brief  RAPP Compute layer 8-bit morphology, generic implementation.
+ *
+ *  ALGORITHM
+ *  ---------
+ *  Erosion and dilation with a line of length k are computed with the
+ *  van Herk/Gil-Werman algorithm. The line is split into blocks of k
+ *  pixels. Within each block we compute the running minimum (or maximum)
+ *  backwards from the end of the block, g, and forwards from the start
+ *  of the block, h. The window starting at position x within a block
+ *  then covers the tail of that block and the head of the next one,
+ *  and the result is
+ *
+ *    dst[x] = min(g[x], h[x + k - 1]).
+ *
+ *  This needs three comparisons per pixel regardless of k. The suffix
+ *  values are stored directly in the destination, and the prefix values
+ *  are kept in a running accumulator. In the vertical direction the
+ *  accumulator is a full row, so all operations are row-wise and map
+ *  directly onto vector min/max operations.
+ */
+
+#include "rc_impl_cfg.h" /* Implementation cfg */
+#include "rc_util.h"     /* MIN(), MAX()       */
+#include "rc_morph.h"    /* Morphology API     */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Template macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Horizontal van Herk/Gil-Werman line template.
+ */
+#define RC_MORPH_LINE_HORZ_TEMPLATE(dst, dst_dim, src, src_dim, \
+                                    width, height, len, op)     \
+do {                                                            \
+    int y_;                                                     \
+    for (y_ = 0; y_ < (height); y_++) {                         \
+        const uint8_t *sp_ = &(src)[y_*(src_dim)];              \
+        uint8_t       *dp_ = &(dst)[y_*(dst_dim)];              \
+        int            x_;                                      \
+        for (x_ = 0; x_ < (width); x_ += (len)) {               \
+            int n_ = MIN((len), (width) - x_);                  \
+            int acc_, i_;                                       \
+                                                                \
+            /* Backward running result over the block */        \
+            acc_ = sp_[x_ + (len) - 1];                         \
+            for (i_ = (len) - 2; i_ >= n_ - 1; i_--) {          \
+                acc_ = op(acc_, sp_[x_ + i_]);                  \
+            }                                                   \
+            dp_[x_ + n_ - 1] = acc_;                            \
+            for (i_ = n_ - 2; i_ >= 0; i_--) {                  \
+                acc_ = op(acc_, sp_[x_ + i_]);                  \
+                dp_[x_ + i_] = acc_;                            \
+            }                                                   \
+                                                                \
+            /* Forward running result over the next block */    \
+            if (n_ > 1) {                                       \
+                acc_ = sp_[x_ + (len)];                         \
+                dp_[x_ + 1] = op(dp_[x_ + 1], acc_);            \
+            }                                                   \
+            for (i_ = 2; i_ < n_; i_++) {                       \
+                acc_ = op(acc_, sp_[x_ + (len) + i_ - 1]);      \
+                dp_[x_ + i_] = op(dp_[x_ + i_], acc_);          \
+            }                                                   \
+        }                                                       \
+    }                                                           \
+} while (0)
+
+/**
+ *  Row-wise operation dst = op(src1, src2).
+ */
+#define RC_MORPH_ROW(dst, src1, src2, width, op) \
+do {                                             \
+    int x_;                                      \
+    for (x_ = 0; x_ < (width); x_++) {           \
+        (dst)[x_] = op((src1)[x_], (src2)[x_]);  \
+    }                                            \
+} while (0)
+
+/**
+ *  Vertical van Herk/Gil-Werman line template.
+ */
+#define RC_MORPH_LINE_VERT_TEMPLATE(dst, dst_dim, src, src_dim,          \
+                                    width, height, len, buf, op)         \
+do {                                                                     \
+    int y_;                                                              \
+    for (y_ = 0; y_ < (height); y_ += (len)) {                           \
+        const uint8_t *sp_ = &(src)[y_*(src_dim)];                       \
+        uint8_t       *dp_ = &(dst)[y_*(dst_dim)];                       \
+        int            n_  = MIN((len), (height) - y_);                  \
+        uint8_t       *lp_ = &dp_[(n_ - 1)*(dst_dim)];                   \
+        int            i_;                                               \
+                                                                         \
+        /* Backward running result over the block */                     \
+        RC_MORPH_ROW(lp_, &sp_[((len) - 1)*(src_dim)],                   \
+                     &sp_[((len) - 1)*(src_dim)], width, op);            \
+        for (i_ = (len) - 2; i_ >= n_ - 1; i_--) {                       \
+            RC_MORPH_ROW(lp_, lp_, &sp_[i_*(src_dim)], width, op);       \
+        }                                                                \
+        for (i_ = n_ - 2; i_ >= 0; i_--) {                               \
+            RC_MORPH_ROW(&dp_[i_*(dst_dim)], &dp_[(i_ + 1)*(dst_dim)],   \
+                         &sp_[i_*(src_dim)], width, op);                 \
+        }                                                                \
+                                                                         \
+        /* Forward running result over the next block */                 \
+        if (n_ > 1) {                                                    \
+            RC_MORPH_ROW(&dp_[(dst_dim)], &dp_[(dst_dim)],               \
+                         &sp_[(len)*(src_dim)], width, op);              \
+        }                                                                \
+        if (n_ > 2) {                                                    \
+            RC_MORPH_ROW(buf, &sp_[(len)*(src_dim)],                     \
+                         &sp_[((len) + 1)*(src_dim)], width, op);        \
+        }                                                                \
+        for (i_ = 2; i_ < n_; i_++) {                                    \
+            if (i_ > 2) {                                                \
+                RC_MORPH_ROW(buf, buf, &sp_[((len) + i_ - 1)*(src_dim)], \
+                             width, op);                                 \
+            }                                                            \
+            RC_MORPH_ROW(&dp_[i_*(dst_dim)], &dp_[i_*(dst_dim)],         \
+                         buf, width, op);                                \
+        }                                                                \
+    }                                                                    \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Erosion with a horizontal line.
+ */
+void
+rc_morph_erode_line_horz_u8(uint8_t *restrict dst, int dst_dim,
+                            const uint8_t *restrict src, int src_dim,
+                            int width, int height, int len)
+{
+    RC_MORPH_LINE_HORZ_TEMPLATE(dst, dst_dim, src, src_dim,
+                                width, height, len, MIN);
+}
+
+/**
+ *  Dilation with a horizontal line.
+ */
+void
+rc_morph_dilate_line_horz_u8(uint8_t *restrict dst, int dst_dim,
+                             const uint8_t *restrict src, int src_dim,
+                             int width, int height, int len)
+{
+    RC_MORPH_LINE_HORZ_TEMPLATE(dst, dst_dim, src, src_dim,
+                                width, height, len, MAX);
+}
+
+/**
+ *  Erosion with a vertical line.
+ */
+#if RC_IMPL(rc_morph_erode_line_vert_u8, 0)
+void
+rc_morph_erode_line_vert_u8(uint8_t *restrict dst, int dst_dim,
+                            const uint8_t *restrict src, int src_dim,
+                            int width, int height, int len,
+                            uint8_t *restrict buf)
+{
+    RC_MORPH_LINE_VERT_TEMPLATE(dst, dst_dim, src, src_dim,
+                                width, height, len, buf, MIN);
+}
+#endif
+
+/**
+ *  Dilation with a vertical line.
+ */
+#if RC_IMPL(rc_morph_dilate_line_vert_u8, 0)
+void
+rc_morph_dilate_line_vert_u8(uint8_t *restrict dst, int dst_dim,
+                             const uint8_t *restrict src, int src_dim,
+                             int width, int height, int len,
+                             uint8_t *restrict buf)
+{
+    RC_MORPH_LINE_VERT_TEMPLATE(dst, dst_dim, src, src_dim,
+                                width, height, len, buf, MAX);
+}
+#endif
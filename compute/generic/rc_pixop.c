@@ -85,6 +85,15 @@ do {                                 \
     (op1)    = MAX(diff, 0);         \
 } while (0)
 
+/**
+ *  Saturated addition, 16-bit.
+ */
+#define RC_PIXOP_ADDS16(op1, op2, arg) \
+do {                                   \
+    int sum = (op1) + (op2);           \
+    (op1)   = MIN(sum, 0xffff);        \
+} while (0)
+
 /**
  *  Halved subtraction.
  */
@@ -624,3 +633,105 @@ rc_pixop_norm_u8(uint8_t *restrict dst, int dst_dim,
                        RC_UNROLL(rc_pixop_norm_u8));
 }
 #endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  16-bit functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Saturated addition, 16-bit.
+ */
+#if RC_IMPL(rc_pixop_add_u16, 1)
+void
+rc_pixop_add_u16(uint16_t *restrict dst, int dst_dim,
+                 const uint16_t *restrict src, int src_dim,
+                 int width, int height)
+{
+    RC_PIXOP_TEMPLATE2(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                       RC_PIXOP_ADDS16, 0,
+                       RC_UNROLL(rc_pixop_add_u16));
+}
+#endif
+
+
+/**
+ *  Saturated subtraction, 16-bit.
+ */
+#if RC_IMPL(rc_pixop_sub_u16, 1)
+void
+rc_pixop_sub_u16(uint16_t *restrict dst, int dst_dim,
+                 const uint16_t *restrict src, int src_dim,
+                 int width, int height)
+{
+    RC_PIXOP_TEMPLATE2(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                       RC_PIXOP_SUBS, 0,
+                       RC_UNROLL(rc_pixop_sub_u16));
+}
+#endif
+
+
+/**
+ *  Absolute-value subtraction, 16-bit.
+ */
+#if RC_IMPL(rc_pixop_suba_u16, 1)
+void
+rc_pixop_suba_u16(uint16_t *restrict dst, int dst_dim,
+                  const uint16_t *restrict src, int src_dim,
+                  int width, int height)
+{
+    RC_PIXOP_TEMPLATE2(dst, dst_dim / 2, src, src_dim / 2, width, height,
+                       RC_PIXOP_SUBA, 0,
+                       RC_UNROLL(rc_pixop_suba_u16));
+}
+#endif
+
+
+/**
+ *  Shifted lookup-table transformation from 16 to 8 bits.
+ */
+#if RC_IMPL(rc_pixop_lut_u16_u8, 0)
+void
+rc_pixop_lut_u16_u8(uint8_t *restrict dst, int dst_dim,
+                    const uint16_t *restrict src, int src_dim,
+                    int width, int height,
+                    const uint8_t *restrict lut, int shift)
+{
+    int y;
+    for (y = 0; y < height; y++) {
+        const uint16_t *sp = &src[y*(src_dim / 2)];
+        uint8_t        *dp = &dst[y*dst_dim];
+        int             x;
+        for (x = 0; x < width; x++) {
+            dp[x] = lut[sp[x] >> shift];
+        }
+    }
+}
+#endif
+
+
+/**
+ *  Linear interpolation between two lookup-table transformations.
+ */
+#if RC_IMPL(rc_pixop_lerp_lut_u8, 0)
+void
+rc_pixop_lerp_lut_u8(uint8_t *restrict buf, int dim,
+                     int width, int height,
+                     const uint8_t *restrict lut1,
+                     const uint8_t *restrict lut2,
+                     const uint8_t *restrict blend)
+{
+    int y;
+    for (y = 0; y < height; y++) {
+        uint8_t *bp = &buf[y*dim];
+        int      x;
+        for (x = 0; x < width; x++) {
+            int pix = bp[x];
+            int alf = blend[x];
+            bp[x] = (lut1[pix]*(0x100 - alf) + lut2[pix]*alf + 0x80) >> 8;
+        }
+    }
+}
+#endif
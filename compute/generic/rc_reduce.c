@@ -198,3 +198,45 @@ rc_reduce_2x2_u8(uint8_t *restrict dst, int dst_dim,
     }
 }
 #endif
+
+
+/**
+ *  16-bit 2x2 reduction.
+ */
+#if RC_IMPL(rc_reduce_2x2_u16, 1)
+void
+rc_reduce_2x2_u16(uint16_t *restrict dst, int dst_dim,
+                  const uint16_t *restrict src, int src_dim,
+                  int width, int height)
+{
+    int w2   = width  / 2;
+    int h2   = height / 2;
+    int full = w2 / RC_UNROLL(rc_reduce_2x2_u16);
+    int rem  = w2 % RC_UNROLL(rc_reduce_2x2_u16);
+    int y;
+
+    for (y = 0; y < h2; y++) {
+        int i1 = 2*y*(src_dim / 2);
+        int i2 = i1 + src_dim / 2;
+        int j  = y*(dst_dim / 2);
+        int x;
+
+        /* Handle all unrolled iterations */
+        for (x = 0; x < full; x++) {
+            RC_REDUCE_2X2_ITER(dst, src, i1, i2, j);
+            if (RC_UNROLL(rc_reduce_2x2_u16) >= 2) {
+                RC_REDUCE_2X2_ITER(dst, src, i1, i2, j);
+            }
+            if (RC_UNROLL(rc_reduce_2x2_u16) == 4) {
+                RC_REDUCE_2X2_ITER(dst, src, i1, i2, j);
+                RC_REDUCE_2X2_ITER(dst, src, i1, i2, j);
+            }
+        }
+
+        /* Handle remaining iterations */
+        for (x = 0; x < rem; x++) {
+            RC_REDUCE_2X2_ITER(dst, src, i1, i2, j);
+        }
+    }
+}
+#endif
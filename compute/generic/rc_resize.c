@@ -0,0 +1,130 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_resize.c
+ *  @brief  RAPP Compute layer arbitrary-ratio resizing.
+ *
+ *  ALGORITHM
+ *  ---------
+ *  The resampling is separable, and each pass is a weighted sum of a
+ *  few consecutive source pixels or rows. The weights are fixed-point
+ *  values in Q.7 format, from precomputed tables. The sums are rounded
+ *  to nearest, and since the weights sum to one the result always fits
+ *  in 8 bits. The common cases with one and two taps, i.e. nearest
+ *  neighbour and bilinear interpolation, have dedicated loops.
+ */
+
+#include "rc_impl_cfg.h" /* Implementation cfg */
+#include "rc_resize.h"   /* Resize API         */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  8-bit horizontal resampling.
+ */
+#if RC_IMPL(rc_resize_horz_u8, 0)
+void
+rc_resize_horz_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height,
+                  const int *idx, const uint8_t *coef, int taps)
+{
+    int y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *sp = &src[y*src_dim];
+        uint8_t       *dp = &dst[y*dst_dim];
+        int            x;
+
+        if (taps == 1) {
+            /* Nearest neighbour */
+            for (x = 0; x < width; x++) {
+                dp[x] = sp[idx[x]];
+            }
+        }
+        else if (taps == 2) {
+            /* Linear interpolation */
+            for (x = 0; x < width; x++) {
+                const uint8_t *ptr = &sp[idx[x]];
+                const uint8_t *cf  = &coef[2*x];
+                dp[x] = (ptr[0]*cf[0] + ptr[1]*cf[1] + 0x40) >> 7;
+            }
+        }
+        else {
+            /* General weighted sum */
+            for (x = 0; x < width; x++) {
+                const uint8_t *ptr = &sp[idx[x]];
+                const uint8_t *cf  = &coef[taps*x];
+                int            sum = 0x40;
+                int            k;
+
+                for (k = 0; k < taps; k++) {
+                    sum += ptr[k]*cf[k];
+                }
+                dp[x] = sum >> 7;
+            }
+        }
+    }
+}
+#endif
+
+/**
+ *  8-bit vertical resampling.
+ */
+#if RC_IMPL(rc_resize_vert_u8, 0)
+void
+rc_resize_vert_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height,
+                  const int *idx, const uint8_t *coef, int taps)
+{
+    int y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *sp = &src[idx[y]*src_dim];
+        const uint8_t *cf = &coef[taps*y];
+        uint8_t       *dp = &dst[y*dst_dim];
+        int            x;
+
+        for (x = 0; x < width; x++) {
+            int sum = 0x40;
+            int k;
+
+            for (k = 0; k < taps; k++) {
+                sum += sp[k*src_dim + x]*cf[k];
+            }
+            dp[x] = sum >> 7;
+        }
+    }
+}
+#endif
@@ -37,12 +37,19 @@
  *  and the second updates the image-global sums. The reason for this
  *  differentiation is that the global sums may be 64 bits, and we
  *  want to update them less often than once per pixel.
+ *
+ *  The histogram functions accumulate into RC_STAT_HIST_BANKS
+ *  interleaved sub-histograms, with consecutive pixels going to
+ *  different banks. Runs of equal pixel values are common, and with
+ *  a single histogram each increment would depend on the store of the
+ *  previous one. The banks are added together at the end.
  */
 
 #include "rc_impl_cfg.h" /* Implementation cfg     */
 #include "rc_platform.h" /* Platform-specific      */
 #include "rc_table.h"    /* rc_table_bitcount[]    */
 #include "rc_stat.h"     /* Statistics API         */
+#include "rc_pixel.h"    /* RC_PIXEL_GET_BIN()     */
 #include "rc_util.h"     /* MIN, MAX               */
 #include "rc_word.h"     /* Word operations        */
 
@@ -53,6 +60,11 @@
  * -------------------------------------------------------------
  */
 
+/**
+ *  The number of interleaved sub-histograms.
+ */
+#define RC_STAT_HIST_BANKS 4
+
 /**
  *  Bit count operation.
  */
@@ -89,6 +101,74 @@ do {                                                    \
     s12 += val1*val2;                                   \
 } while (0)
 
+/**
+ *  Min and max operations.
+ */
+#define RC_STAT_MIN(min, arg, pix) \
+    ((min) = MIN(min, pix))
+
+#define RC_STAT_MAX(max, arg, pix) \
+    ((max) = MAX(max, pix))
+
+/**
+ *  Absolute difference and squared difference operations.
+ */
+#define RC_STAT_SAD(sum, pix1, pix2) \
+    ((sum) += (pix1) > (pix2) ? (pix1) - (pix2) : (pix2) - (pix1))
+
+#define RC_STAT_SSD(sum, pix1, pix2) \
+do {                                 \
+    int dif = (int)(pix1) - (pix2);  \
+    (sum) += dif*dif;                \
+} while (0)
+
+/**
+ *  Template for the difference sums of two images.
+ *  The row sum is at most width*0xff*0xff, and fits in 32 bits.
+ */
+#define RC_STAT_DIFF_TEMPLATE(src1, src1_dim, src2, src2_dim,  \
+                              width, height, sum, diff)        \
+do {                                                           \
+    int y;                                                     \
+    for (y = 0; y < (height); y++) {                           \
+        const uint8_t *row1 = &(src1)[y*(src1_dim)];           \
+        const uint8_t *row2 = &(src2)[y*(src2_dim)];           \
+        uint32_t       acc  = 0;                               \
+        int            x;                                      \
+        for (x = 0; x < (width); x++) {                        \
+            diff(acc, row1[x], row2[x]);                       \
+        }                                                      \
+        (sum) += acc;                                          \
+    }                                                          \
+} while (0)
+
+/**
+ *  The SSIM stabilizing constants C1 = (0.01*255)^2 and
+ *  C2 = (0.03*255)^2, scaled by 10000 to make them integers.
+ */
+#define RC_STAT_SSIM_C1 65025
+#define RC_STAT_SSIM_C2 585225
+
+/**
+ *  The SSIM of one window in units of 1/65536, from the window sums.
+ *  Both factors of the SSIM are expanded by the squared pixel count
+ *  and by 10000, and each ratio is computed in 16-bit fixed point.
+ *  All intermediate values fit in 63 bits.
+ */
+#define RC_STAT_SSIM(res, s1, s2, s11, s22, s12)                     \
+do {                                                                 \
+    int64_t n_    = RC_STAT_SSIM_WIN*RC_STAT_SSIM_WIN;               \
+    int64_t c1_   = RC_STAT_SSIM_C1*n_*n_;                           \
+    int64_t c2_   = RC_STAT_SSIM_C2*n_*n_;                           \
+    int64_t m12_  = (int64_t)(s1)*(s2);                              \
+    int64_t sq_   = (int64_t)(s1)*(s1) + (int64_t)(s2)*(s2);         \
+    int64_t num1_ = 20000*m12_ + c1_;                                \
+    int64_t den1_ = 10000*sq_ + c1_;                                 \
+    int64_t num2_ = 20000*(n_*(s12) - m12_) + c2_;                   \
+    int64_t den2_ = 10000*(n_*((int64_t)(s11) + (s22)) - sq_) + c2_; \
+    (res) = (num1_*65536 / den1_)*(num2_*65536 / den2_) / 65536;     \
+} while (0)
+
 /**
  *  Sum update.
  */
@@ -263,7 +343,47 @@ do {                                          \
     (i) += RC_WORD_SIZE;                      \
 } while (0)
 
+/**
+ *  Masked single-operand template. The pixels are reduced only where
+ *  the binary mask is set, and mask words that are all zero are
+ *  skipped without touching the corresponding pixels.
+ */
+#define RC_STAT_MASK_TEMPLATE(buf, dim, map, map_dim, width, height, \
+                              sum1, sum2, reduce)                    \
+do {                                                                 \
+    int y;                                                           \
+    for (y = 0; y < (height); y++) {                                 \
+        const uint8_t *row  = &(buf)[y*(dim)];                       \
+        const uint8_t *mrow = &(map)[y*(map_dim)];                   \
+        int            x;                                            \
+                                                                     \
+        /* Process one mask word at a time */                        \
+        for (x = 0; x < (width); x += 8*RC_WORD_SIZE) {              \
+            if (RC_WORD_LOAD(&mrow[x >> 3])) {                       \
+                int end = MIN(x + 8*RC_WORD_SIZE, width);            \
+                int i;                                               \
+                for (i = x; i < end; i++) {                          \
+                    if (RC_PIXEL_GET_BIN(mrow, 0, 0, i, 0)) {        \
+                        reduce(sum1, sum2, row[i]);                  \
+                    }                                                \
+                }                                                    \
+            }                                                        \
+        }                                                            \
+    }                                                                \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
 
+#if RC_IMPL(rc_stat_max_k_u8, 0)
+static int
+rc_stat_max_k_insert(const uint8_t *buf, int dim, unsigned *pos,
+                     int num, int k, int x, int y);
+#endif
 
 
 /*
@@ -431,3 +551,514 @@ rc_stat_max_u8(const uint8_t *buf, int dim, int width, int height)
     return max;
 }
 #endif
+
+
+/**
+ *  16-bit pixel sum.
+ */
+#if RC_IMPL(rc_stat_sum_u16, 1)
+uintmax_t
+rc_stat_sum_u16(const uint16_t *buf, int dim, int width, int height)
+{
+    uintmax_t sum = 0;
+    RC_STAT_TEMPLATE(buf, dim / 2, width, height, sum, 0,
+                     RC_STAT_SUM, RC_STAT_UPDATE,
+                     RC_UNROLL(rc_stat_sum_u16));
+    return sum;
+}
+#endif
+
+
+/**
+ *  16-bit pixel min.
+ */
+#if RC_IMPL(rc_stat_min_u16, 1)
+int
+rc_stat_min_u16(const uint16_t *buf, int dim, int width, int height)
+{
+    uint16_t min = UINT16_MAX;
+    RC_STAT_MINMAX_TEMPLATE(buf, dim / 2, width, height,
+                            min, MIN, RC_UNROLL(rc_stat_min_u16));
+    return min;
+}
+#endif
+
+/**
+ *  16-bit pixel max.
+ */
+#if RC_IMPL(rc_stat_max_u16, 1)
+int
+rc_stat_max_u16(const uint16_t *buf, int dim, int width, int height)
+{
+    uint16_t max = 0;
+    RC_STAT_MINMAX_TEMPLATE(buf, dim / 2, width, height,
+                            max, MAX, RC_UNROLL(rc_stat_max_u16));
+    return max;
+}
+#endif
+
+
+/**
+ *  8-bit pixel histogram.
+ */
+#if RC_IMPL(rc_stat_hist_u8, 0)
+void
+rc_stat_hist_u8(const uint8_t *buf, int dim,
+                int width, int height, uint32_t *hist)
+{
+    uint32_t bank[RC_STAT_HIST_BANKS][256] = {{0}};
+    int      len = width & ~(RC_STAT_HIST_BANKS - 1);
+    int      y, k;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row = &buf[y*dim];
+        int            x;
+
+        for (x = 0; x < len; x += RC_STAT_HIST_BANKS) {
+            bank[0][row[x    ]]++;
+            bank[1][row[x + 1]]++;
+            bank[2][row[x + 2]]++;
+            bank[3][row[x + 3]]++;
+        }
+        for (; x < width; x++) {
+            bank[0][row[x]]++;
+        }
+    }
+
+    for (k = 0; k < 256; k++) {
+        hist[k] = bank[0][k] + bank[1][k] + bank[2][k] + bank[3][k];
+    }
+}
+#endif
+
+
+/**
+ *  8-bit pixel histogram with a binary mask.
+ */
+#if RC_IMPL(rc_stat_hist_mask_u8, 0)
+void
+rc_stat_hist_mask_u8(const uint8_t *buf, int dim,
+                     const uint8_t *map, int map_dim,
+                     int width, int height, uint32_t *hist)
+{
+    uint32_t bank[RC_STAT_HIST_BANKS][256] = {{0}};
+    int      y, k;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row  = &buf[y*dim];
+        const uint8_t *mrow = &map[y*map_dim];
+        int            x;
+
+        /* Process eight pixels per mask byte, skipping empty bytes */
+        for (x = 0; x < width; x += 8) {
+            if (mrow[x >> 3]) {
+                int end = MIN(x + 8, width);
+                int i;
+                for (i = x; i < end; i++) {
+                    if (RC_PIXEL_GET_BIN(mrow, 0, 0, i, 0)) {
+                        bank[i & (RC_STAT_HIST_BANKS - 1)][row[i]]++;
+                    }
+                }
+            }
+        }
+    }
+
+    for (k = 0; k < 256; k++) {
+        hist[k] = bank[0][k] + bank[1][k] + bank[2][k] + bank[3][k];
+    }
+}
+#endif
+
+
+/**
+ *  8-bit pixel sum with a binary mask.
+ */
+#if RC_IMPL(rc_stat_sum_mask_u8, 0)
+uint32_t
+rc_stat_sum_mask_u8(const uint8_t *buf, int dim,
+                    const uint8_t *map, int map_dim,
+                    int width, int height)
+{
+    uint32_t sum = 0;
+    RC_STAT_MASK_TEMPLATE(buf, dim, map, map_dim, width, height,
+                          sum, 0, RC_STAT_SUM);
+    return sum;
+}
+#endif
+
+
+/**
+ *  8-bit pixel sum and squared sum with a binary mask.
+ */
+#if RC_IMPL(rc_stat_sum2_mask_u8, 0)
+void
+rc_stat_sum2_mask_u8(const uint8_t *buf, int dim,
+                     const uint8_t *map, int map_dim,
+                     int width, int height, uintmax_t sum[2])
+{
+    uint32_t  sum1 = 0;
+    uintmax_t sum2 = 0;
+    RC_STAT_MASK_TEMPLATE(buf, dim, map, map_dim, width, height,
+                          sum1, sum2, RC_STAT_SUM2);
+    sum[0] = sum1;
+    sum[1] = sum2;
+}
+#endif
+
+
+/**
+ *  8-bit pixel min with a binary mask.
+ */
+#if RC_IMPL(rc_stat_min_mask_u8, 0)
+int
+rc_stat_min_mask_u8(const uint8_t *buf, int dim,
+                    const uint8_t *map, int map_dim,
+                    int width, int height)
+{
+    uint8_t min = UINT8_MAX;
+    RC_STAT_MASK_TEMPLATE(buf, dim, map, map_dim, width, height,
+                          min, 0, RC_STAT_MIN);
+    return min;
+}
+#endif
+
+/**
+ *  8-bit pixel max with a binary mask.
+ */
+#if RC_IMPL(rc_stat_max_mask_u8, 0)
+int
+rc_stat_max_mask_u8(const uint8_t *buf, int dim,
+                    const uint8_t *map, int map_dim,
+                    int width, int height)
+{
+    uint8_t max = 0;
+    RC_STAT_MASK_TEMPLATE(buf, dim, map, map_dim, width, height,
+                          max, 0, RC_STAT_MAX);
+    return max;
+}
+#endif
+
+
+/**
+ *  Binary pixel min and max with location.
+ */
+#if RC_IMPL(rc_stat_minmax_loc_bin, 0)
+void
+rc_stat_minmax_loc_bin(const uint8_t *buf, int dim, int width, int height,
+                       int minmax[2], unsigned pos[4])
+{
+    int min = 1;
+    int max = 0;
+    int y;
+
+    pos[0] = pos[1] = pos[2] = pos[3] = 0;
+
+    for (y = 0; y < height && (min || !max); y++) {
+        const uint8_t *row = &buf[y*dim];
+        int            x;
+
+        /* Skip words that are all one when looking for the min,
+         * and all zero when looking for the max */
+        for (x = 0; x < width && (min || !max); x += 8*RC_WORD_SIZE) {
+            rc_word_t word = RC_WORD_LOAD(&row[x >> 3]);
+            if ((min && word != RC_WORD_ONE) || (!max && word)) {
+                int end = MIN(x + 8*RC_WORD_SIZE, width);
+                int i;
+                for (i = x; i < end; i++) {
+                    int pix = RC_PIXEL_GET_BIN(row, 0, 0, i, 0);
+                    if (min && !pix) {
+                        min    = 0;
+                        pos[0] = i;
+                        pos[1] = y;
+                    }
+                    if (!max && pix) {
+                        max    = 1;
+                        pos[2] = i;
+                        pos[3] = y;
+                    }
+                }
+            }
+        }
+    }
+
+    minmax[0] = min;
+    minmax[1] = max;
+}
+#endif
+
+
+/**
+ *  8-bit pixel min and max with location.
+ */
+#if RC_IMPL(rc_stat_minmax_loc_u8, 0)
+void
+rc_stat_minmax_loc_u8(const uint8_t *buf, int dim, int width, int height,
+                      int minmax[2], unsigned pos[4])
+{
+    unsigned min = UINT8_MAX;
+    unsigned max = 0;
+    int      y;
+
+    pos[0] = pos[1] = pos[2] = pos[3] = 0;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row = &buf[y*dim];
+        int            x;
+        for (x = 0; x < width; x++) {
+            unsigned pix = row[x];
+            if (pix < min) {
+                min    = pix;
+                pos[0] = x;
+                pos[1] = y;
+            }
+            if (pix > max) {
+                max    = pix;
+                pos[2] = x;
+                pos[3] = y;
+            }
+        }
+    }
+
+    minmax[0] = min;
+    minmax[1] = max;
+}
+#endif
+
+/**
+ *  8-bit top-K pixel locations.
+ */
+#if RC_IMPL(rc_stat_max_k_u8, 0)
+int
+rc_stat_max_k_u8(const uint8_t *buf, int dim, int width, int height,
+                 unsigned *pos, int k)
+{
+    unsigned thr = 0; /* Smallest value of a full list */
+    int      num = 0;
+    int      x, y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row = &buf[y*dim];
+        for (x = 0; x < width; x++) {
+            if (num < k || row[x] > thr) {
+                num = rc_stat_max_k_insert(buf, dim, pos, num, k, x, y);
+                thr = buf[pos[2*num - 1]*dim + pos[2*num - 2]];
+            }
+        }
+    }
+
+    return num;
+}
+#endif
+
+
+/**
+ *  8-bit pixel sum, min and max per tile.
+ */
+#if RC_IMPL(rc_stat_tiles_u8, 0)
+void
+rc_stat_tiles_u8(const uint8_t *buf, int dim, int width, int height,
+                 int tile_w, int tile_h, uint32_t *sum,
+                 uint8_t *min, uint8_t *max)
+{
+    int cols = (width - 1) / tile_w + 1; /* Tiles per row */
+    int ty;
+
+    for (ty = 0; ty < height; ty += tile_h) {
+        int th = MIN(tile_h, height - ty);
+        int y, k;
+
+        /* Initialize the tiles of this band */
+        for (k = 0; k < cols; k++) {
+            sum[k] = 0;
+            min[k] = UINT8_MAX;
+            max[k] = 0;
+        }
+
+        /* Stream the rows through the tiles */
+        for (y = ty; y < ty + th; y++) {
+            const uint8_t *row = &buf[y*dim];
+            int            x   = 0;
+
+            for (k = 0; k < cols; k++) {
+                int      end  = x + MIN(tile_w, width - x);
+                uint32_t tsum = sum[k];
+                unsigned tmin = min[k];
+                unsigned tmax = max[k];
+
+                for (; x < end; x++) {
+                    unsigned pix = row[x];
+                    tsum += pix;
+                    tmin  = MIN(tmin, pix);
+                    tmax  = MAX(tmax, pix);
+                }
+
+                sum[k] = tsum;
+                min[k] = tmin;
+                max[k] = tmax;
+            }
+        }
+
+        sum += cols;
+        min += cols;
+        max += cols;
+    }
+}
+#endif
+
+
+/**
+ *  8-bit sum of absolute differences.
+ */
+#if RC_IMPL(rc_stat_sad_u8, 0)
+uintmax_t
+rc_stat_sad_u8(const uint8_t *restrict src1, int src1_dim,
+               const uint8_t *restrict src2, int src2_dim,
+               int width, int height)
+{
+    uintmax_t sum = 0;
+    RC_STAT_DIFF_TEMPLATE(src1, src1_dim, src2, src2_dim,
+                          width, height, sum, RC_STAT_SAD);
+    return sum;
+}
+#endif
+
+
+/**
+ *  8-bit sum of squared differences.
+ */
+#if RC_IMPL(rc_stat_ssd_u8, 0)
+uintmax_t
+rc_stat_ssd_u8(const uint8_t *restrict src1, int src1_dim,
+               const uint8_t *restrict src2, int src2_dim,
+               int width, int height)
+{
+    uintmax_t sum = 0;
+    RC_STAT_DIFF_TEMPLATE(src1, src1_dim, src2, src2_dim,
+                          width, height, sum, RC_STAT_SSD);
+    return sum;
+}
+#endif
+
+
+/**
+ *  8-bit mean structural similarity.
+ *  The work buffer holds the five sums of each column over the last
+ *  RC_STAT_SSIM_WIN rows. For each row the new row is added and the
+ *  oldest row removed, and the window sums are then updated in the
+ *  same way while sliding along the row.
+ */
+#if RC_IMPL(rc_stat_ssim_u8, 0)
+int
+rc_stat_ssim_u8(const uint8_t *restrict src1, int src1_dim,
+                const uint8_t *restrict src2, int src2_dim,
+                int width, int height, uint32_t *restrict work)
+{
+    int64_t total = 0;
+    int64_t count = (int64_t)(width  - RC_STAT_SSIM_WIN + 1)*
+                             (height - RC_STAT_SSIM_WIN + 1);
+    int     x, y;
+
+    for (x = 0; x < 5*width; x++) {
+        work[x] = 0;
+    }
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row1 = &src1[y*src1_dim];
+        const uint8_t *row2 = &src2[y*src2_dim];
+        uint32_t       s1 = 0, s2 = 0, s11 = 0, s22 = 0, s12 = 0;
+
+        /* Update the column sums */
+        for (x = 0; x < width; x++) {
+            uint32_t *col = &work[5*x];
+            unsigned  p1  = row1[x];
+            unsigned  p2  = row2[x];
+            col[0] += p1;
+            col[1] += p2;
+            col[2] += p1*p1;
+            col[3] += p2*p2;
+            col[4] += p1*p2;
+        }
+        if (y >= RC_STAT_SSIM_WIN) {
+            const uint8_t *old1 = &row1[-RC_STAT_SSIM_WIN*src1_dim];
+            const uint8_t *old2 = &row2[-RC_STAT_SSIM_WIN*src2_dim];
+            for (x = 0; x < width; x++) {
+                uint32_t *col = &work[5*x];
+                unsigned  p1  = old1[x];
+                unsigned  p2  = old2[x];
+                col[0] -= p1;
+                col[1] -= p2;
+                col[2] -= p1*p1;
+                col[3] -= p2*p2;
+                col[4] -= p1*p2;
+            }
+        }
+        if (y < RC_STAT_SSIM_WIN - 1) {
+            continue;
+        }
+
+        /* Slide the window along the row */
+        for (x = 0; x < width; x++) {
+            const uint32_t *col = &work[5*x];
+            s1  += col[0];
+            s2  += col[1];
+            s11 += col[2];
+            s22 += col[3];
+            s12 += col[4];
+            if (x >= RC_STAT_SSIM_WIN) {
+                const uint32_t *old = &col[-5*RC_STAT_SSIM_WIN];
+                s1  -= old[0];
+                s2  -= old[1];
+                s11 -= old[2];
+                s22 -= old[3];
+                s12 -= old[4];
+            }
+            if (x >= RC_STAT_SSIM_WIN - 1) {
+                int ssim;
+                RC_STAT_SSIM(ssim, s1, s2, s11, s22, s12);
+                total += ssim;
+            }
+        }
+    }
+
+    return total / count;
+}
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+#if RC_IMPL(rc_stat_max_k_u8, 0)
+/**
+ *  Insert the pixel at (x, y) in the sorted top-K list of @e num
+ *  positions. The pixel must be larger than the smallest value of
+ *  a full list. Pixels of equal value are kept in raster order.
+ *  Returns the new number of positions.
+ */
+static int
+rc_stat_max_k_insert(const uint8_t *buf, int dim, unsigned *pos,
+                     int num, int k, int x, int y)
+{
+    unsigned pix = buf[y*dim + x];
+    int      i;
+
+    if (num < k) {
+        num++;
+    }
+
+    /* Shift the smaller values one step down the list */
+    for (i = num - 1; i > 0 && buf[pos[2*i - 1]*dim + pos[2*i - 2]] < pix;
+         i--)
+    {
+        pos[2*i]     = pos[2*i - 2];
+        pos[2*i + 1] = pos[2*i - 1];
+    }
+    pos[2*i]     = x;
+    pos[2*i + 1] = y;
+
+    return num;
+}
+#endif
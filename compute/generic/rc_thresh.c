@@ -30,6 +30,7 @@
  *  @brief  RAPP Compute layer thresholding to binary, generic implementation.
  */
 
+#include <stdlib.h>      /* abs()                  */
 #include "rc_impl_cfg.h" /* Implementation cfg     */
 #include "rc_thresh_tpl.h" /* Thresholding templates */
 #include "rc_thresh_pixel_tpl.h" /* Pixelwise thresholding templates */
@@ -67,6 +68,13 @@
     (RC_THRESH_CMPLT(op1, op2, 0) |      \
      RC_THRESH_CMPGT(op1, op3, 0))
 
+/**
+ *  Compute abs(op1 - op2) > thresh ? 1 : 0 without branches.
+ *  The threshold value is taken from the calling function.
+ */
+#define RC_THRESH_CMPGT_ABSDIFF(op1, op2, arg) \
+    RC_THRESH_CMPGT(abs((int)(op1) - (int)(op2)), thresh, 0)
+
 
 /*
  * -------------------------------------------------------------
@@ -210,3 +218,53 @@ rc_thresh_ltgt_pixel_u8(uint8_t *restrict dst, int dst_dim,
                                     RC_UNROLL(rc_thresh_ltgt_pixel_u8));
 }
 #endif
+
+
+/**
+ *  Single thresholding greater-than on 16-bit pixels.
+ */
+#if RC_IMPL(rc_thresh_gt_u16, 1)
+void
+rc_thresh_gt_u16(uint8_t *restrict dst, int dst_dim,
+                 const uint16_t *restrict src, int src_dim,
+                 int width, int height, int thresh)
+{
+    RC_THRESH_TEMPLATE(dst, dst_dim, src, src_dim / 2, width, height,
+                       thresh, 0, RC_THRESH_CMPGT,
+                       RC_UNROLL(rc_thresh_gt_u16));
+}
+#endif
+
+
+/**
+ *  Single thresholding less-than on 16-bit pixels.
+ */
+#if RC_IMPL(rc_thresh_lt_u16, 1)
+void
+rc_thresh_lt_u16(uint8_t *restrict dst, int dst_dim,
+                 const uint16_t *restrict src, int src_dim,
+                 int width, int height, int thresh)
+{
+    RC_THRESH_TEMPLATE(dst, dst_dim, src, src_dim / 2, width, height,
+                       thresh, 0, RC_THRESH_CMPLT,
+                       RC_UNROLL(rc_thresh_lt_u16));
+}
+#endif
+
+
+/**
+ *  Absolute-difference thresholding greater-than.
+ */
+#if RC_IMPL(rc_thresh_absdiff_gt_u8, 1)
+void
+rc_thresh_absdiff_gt_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src1, int src1_dim,
+                        const uint8_t *restrict src2, int src2_dim,
+                        int width, int height, int thresh)
+{
+    RC_THRESH_PIXEL_TEMPLATE_SINGLE(dst, dst_dim, src1, src1_dim,
+                                    src2, src2_dim,
+                                    width, height, RC_THRESH_CMPGT_ABSDIFF,
+                                    RC_UNROLL(rc_thresh_absdiff_gt_u8));
+}
+#endif
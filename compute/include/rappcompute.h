@@ -169,12 +169,19 @@
  *    - rc_thresh.h:      Thresholding.
  *    - rc_stat.h:        Sum and sum-of-squares statistics.
  *    - rc_moment_bin.h:  Binary image moments.
+ *    - rc_motion.h:      Motion estimation primitives.
+ *    - rc_match.h:       Template matching primitives.
  *    - rc_filter.h:      Fixed-filter convolutions.
+ *    - rc_edge.h:        Edge detection primitives.
+ *    - rc_feature.h:     Feature detection primitives.
+ *    - rc_bgmodel.h:     Background modelling.
+ *    - rc_morph.h:       8-bit morphology primitives.
  *    - rc_morph_bin.h:   Binary morphology primitives.
  *    - rc_pad.h:         8-bit padding.
  *    - rc_pad_bin.h:     Binary padding.
  *    - rc_reduce.h:      8-bit 2x spatial reduction.
  *    - rc_reduce_bin.h:  Binary 2x spatial reduction.
+ *    - rc_resize.h:      8-bit arbitrary-ratio resizing.
  *    - rc_expand_bin.h:  Binary 2x spatial expansion.
  *    - rc_rotate.h:      8-bit 90 degree rotation.
  *    - rc_rotate_bin.h:  Binary 90 degree rotation.
@@ -756,12 +763,19 @@
 #include "rc_thresh.h"      /* Thresholding to binary         */
 #include "rc_reduce.h"      /* 8-bit 2x reduction             */
 #include "rc_reduce_bin.h"  /* Binary 2x reduction            */
+#include "rc_resize.h"      /* 8-bit resizing                 */
 #include "rc_expand_bin.h"  /* Binary 2x expansion            */
 #include "rc_rotate.h"      /* 8-bit image rotation           */
 #include "rc_rotate_bin.h"  /* Binary image rotation          */
 #include "rc_stat.h"        /* Statistical operations         */
 #include "rc_moment_bin.h"  /* Binary image moments           */
+#include "rc_motion.h"      /* Motion estimation primitives   */
+#include "rc_match.h"       /* Template matching primitives   */
 #include "rc_filter.h"      /* Fixed-filter convolutions      */
+#include "rc_edge.h"        /* Edge detection primitives      */
+#include "rc_feature.h"     /* Feature detection primitives   */
+#include "rc_bgmodel.h"     /* Background modelling           */
+#include "rc_morph.h"       /* 8-bit morphology               */
 #include "rc_morph_bin.h"   /* Binary morphology              */
 #include "rc_fill.h"        /* Connected-components seed fill */
 #include "rc_pad.h"         /* 8-bit image padding            */
@@ -0,0 +1,108 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_bgmodel.h
+ *  @brief  RAPP Compute layer background modelling.
+ */
+
+#ifndef RC_BGMODEL_H
+#define RC_BGMODEL_H
+
+#include <stdint.h>
+#include "rc_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Background mean update with foreground detection.
+ *  A pixel is foreground if |src - mean| > thresh, using the mean
+ *  before the update. Where the input foreground mask is clear, the
+ *  mean is updated as with rc_pixop_lerpn_u8(). The new foreground
+ *  mask then replaces the old one.
+ *
+ *  @param[in,out] fg        Binary foreground mask buffer.
+ *  @param         fg_dim    Row dimension of the mask buffer.
+ *  @param[in,out] mean      Background mean pixel buffer.
+ *  @param         mean_dim  Row dimension of the mean buffer.
+ *  @param[in]     src       Source pixel buffer.
+ *  @param         src_dim   Row dimension of the source buffer.
+ *  @param         width     Image width in pixels.
+ *  @param         height    Image height in pixels.
+ *  @param         alpha8    The Q.8 learning rate in the range [0x1,0x7f].
+ *  @param         thresh    The foreground threshold in the range [0,255].
+ */
+RC_EXPORT void
+rc_bgmodel_update_u8(uint8_t *restrict fg, int fg_dim,
+                     uint8_t *restrict mean, int mean_dim,
+                     const uint8_t *restrict src, int src_dim,
+                     int width, int height, unsigned alpha8,
+                     unsigned thresh);
+
+/**
+ *  Background mean and deviation update with foreground detection.
+ *  A pixel is foreground if |src - mean| > thresh + 2*dev, saturated,
+ *  using the mean and deviation before the update. Where the input
+ *  foreground mask is clear, the mean is updated as with
+ *  rc_pixop_lerpn_u8(), and the deviation in the same way towards
+ *  |src - mean|. The new foreground mask then replaces the old one.
+ *
+ *  @param[in,out] fg        Binary foreground mask buffer.
+ *  @param         fg_dim    Row dimension of the mask buffer.
+ *  @param[in,out] mean      Background mean pixel buffer.
+ *  @param         mean_dim  Row dimension of the mean buffer.
+ *  @param[in,out] dev       Background mean absolute deviation buffer.
+ *  @param         dev_dim   Row dimension of the deviation buffer.
+ *  @param[in]     src       Source pixel buffer.
+ *  @param         src_dim   Row dimension of the source buffer.
+ *  @param         width     Image width in pixels.
+ *  @param         height    Image height in pixels.
+ *  @param         alpha8    The Q.8 learning rate in the range [0x1,0x7f].
+ *  @param         thresh    The foreground threshold in the range [0,255].
+ */
+RC_EXPORT void
+rc_bgmodel_update_dev_u8(uint8_t *restrict fg, int fg_dim,
+                         uint8_t *restrict mean, int mean_dim,
+                         uint8_t *restrict dev, int dev_dim,
+                         const uint8_t *restrict src, int src_dim,
+                         int width, int height, unsigned alpha8,
+                         unsigned thresh);
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RC_BGMODEL_H */
@@ -0,0 +1,79 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_edge.h
+ *  @brief  RAPP Compute layer edge detection primitives.
+ */
+
+#ifndef RC_EDGE_H
+#define RC_EDGE_H
+
+#include <stdint.h>
+#include "rc_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Non-maximum suppression of a gradient magnitude image.
+ *  A pixel is kept if it is larger than its neighbour before it and
+ *  not smaller than the neighbour after it, along the gradient
+ *  orientation code from rc_filter_sobel_3x3_magn_dir_u8(). Only the
+ *  two least significant bits of the code are used, so both 4 and 8
+ *  bins work. Suppressed pixels are set to zero.
+ *  The magnitude buffer is read one alignment unit outside the image
+ *  on each side, and one row above and below.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Row dimension of the destination buffer.
+ *  @param[in]  mag      Gradient magnitude buffer.
+ *  @param      mag_dim  Row dimension of the magnitude buffer.
+ *  @param[in]  dir      Gradient orientation code buffer.
+ *  @param      dir_dim  Row dimension of the orientation buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_edge_nms_u8(uint8_t *restrict dst, int dst_dim,
+               const uint8_t *restrict mag, int mag_dim,
+               const uint8_t *restrict dir, int dir_dim,
+               int width, int height);
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RC_EDGE_H */
@@ -0,0 +1,121 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_feature.h
+ *  @brief  RAPP Compute layer feature detection primitives.
+ */
+
+#ifndef RC_FEATURE_H
+#define RC_FEATURE_H
+
+#include <stdint.h>
+#include "rc_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  FAST corner score.
+ *  A pixel is a corner if there is an arc of nine contiguous pixels on
+ *  the Bresenham circle of radius three that are all brighter than the
+ *  center plus the threshold, or all darker than the center minus the
+ *  threshold. The score is the largest threshold for which the pixel
+ *  is still a corner, minus the threshold used, and zero for pixels
+ *  that are not corners. The source buffer is read three rows above
+ *  and below the image, and one alignment unit to the left and right.
+ *
+ *  @param[out] dst      Destination score buffer.
+ *  @param      dst_dim  Row dimension of the destination buffer.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Row dimension of the source buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param      thresh   The threshold, 0-254.
+ */
+RC_EXPORT void
+rc_feature_fast_u8(uint8_t *restrict dst, int dst_dim,
+                   const uint8_t *restrict src, int src_dim,
+                   int width, int height, int thresh);
+
+/**
+ *  Non-maximum suppression of a score image.
+ *  A pixel is kept if it is larger than its left and its three upper
+ *  neighbours, and not smaller than its right and its three lower
+ *  neighbours. Suppressed pixels are set to zero. The score buffer is
+ *  read one alignment unit outside the image on each side, and one row
+ *  above and below.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Row dimension of the destination buffer.
+ *  @param[in]  src      Source score buffer.
+ *  @param      src_dim  Row dimension of the source buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_feature_nms_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height);
+
+/**
+ *  Harris corner response.
+ *  Computes the response det(M) - k*trace(M)^2 with k = 3/64, where M
+ *  is the sum of the gradient products [gx*gx gx*gy; gx*gy gy*gy] over
+ *  the 3x3 neighbourhood. The response is shifted down 16 bits. For
+ *  gradients in the range [-1020, 1020] it fits in 32 bits. The
+ *  gradient buffers are read one pixel outside the image on each side,
+ *  and one row above and below.
+ *
+ *  @param[out] dst      Destination response buffer.
+ *  @param      dst_dim  Row dimension of the destination buffer in bytes.
+ *  @param[in]  gx       Horizontal gradient buffer.
+ *  @param      gx_dim   Row dimension of the gx buffer in bytes.
+ *  @param[in]  gy       Vertical gradient buffer.
+ *  @param      gy_dim   Row dimension of the gy buffer in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_feature_harris_s16_s32(int32_t *restrict dst, int dst_dim,
+                          const int16_t *restrict gx, int gx_dim,
+                          const int16_t *restrict gy, int gy_dim,
+                          int width, int height);
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RC_FEATURE_H */
@@ -110,6 +110,42 @@ rc_fill_8conn_rev_bin(uint8_t *restrict dst, int dst_dim,
                       const uint8_t *restrict map, int map_dim,
                       int width, int height);
 
+/**
+ *  8-connectivity seed fill forward iteration for multiple seeds.
+ *  Works as rc_fill_8conn_fwd_bin(), but processes all rows, since
+ *  the seed pixels may be spread over the whole image.
+ *
+ *  @param[in,out]  dst      Destination pixel buffer with the seeds.
+ *  @param          dst_dim  Row dimension of the destination buffer.
+ *  @param[in]      map      Map pixel buffer.
+ *  @param          map_dim  Row dimension of the map buffer.
+ *  @param          width    Image width in pixels.
+ *  @param          height   Image height in pixels.
+ *  @return         Nonzero if any pixel was filled, zero otherwise.
+ */
+RC_EXPORT int
+rc_fill_8conn_seed_fwd_bin(uint8_t *restrict dst, int dst_dim,
+                           const uint8_t *restrict map, int map_dim,
+                           int width, int height);
+
+/**
+ *  8-connectivity seed fill reverse iteration for multiple seeds.
+ *  Works as rc_fill_8conn_rev_bin(), but processes all rows, since
+ *  the seed pixels may be spread over the whole image.
+ *
+ *  @param[in,out]  dst      Destination pixel buffer with the seeds.
+ *  @param          dst_dim  Row dimension of the destination buffer.
+ *  @param[in]      map      Map pixel buffer.
+ *  @param          map_dim  Row dimension of the map buffer.
+ *  @param          width    Image width in pixels.
+ *  @param          height   Image height in pixels.
+ *  @return         Nonzero if any pixel was filled, zero otherwise.
+ */
+RC_EXPORT int
+rc_fill_8conn_seed_rev_bin(uint8_t *restrict dst, int dst_dim,
+                           const uint8_t *restrict map, int map_dim,
+                           int width, int height);
+
 
 #ifdef __cplusplus
 };
@@ -40,6 +40,36 @@
 extern "C" {
 #endif
 
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The maximum width and height of a user-specified convolution kernel.
+ */
+#define RC_FILTER_CONV_MAX 15
+
+/**
+ *  The maximum radius of the rank filter. This keeps the
+ *  neighbourhood histogram counts within 16 bits.
+ */
+#define RC_FILTER_RANK_MAX 127
+
+/**
+ *  The number of histogram bins per column used by the rank filter,
+ *  16 coarse bins and 256 fine bins.
+ */
+#define RC_FILTER_RANK_BINS (16 + 256)
+
+/**
+ *  The 16-bit fixed-point reciprocal of a box filter size.
+ */
+#define RC_FILTER_BOX_RECIP(size) \
+    ((0x10000 + (size) / 2) / (size))
+
+
 /*
  * -------------------------------------------------------------
  *  Exported functions
@@ -196,6 +226,135 @@ rc_filter_sobel_3x3_magn_u8(uint8_t *restrict dst, int dst_dim,
                             const uint8_t *restrict src, int src_dim,
                             int width, int height);
 
+/**
+ *  3x3 Sobel gradient magnitude and orientation.
+ *  The orientation code is the gradient direction rounded to a
+ *  multiple of 45 degrees, modulo bins.
+ *
+ *  @param[out]  mag      Magnitude pixel buffer.
+ *  @param       mag_dim  Row dimension of the magnitude buffer.
+ *  @param[out]  dir      Orientation code pixel buffer.
+ *  @param       dir_dim  Row dimension of the orientation buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ *  @param       bins     Number of orientation bins, 4 or 8.
+ */
+RC_EXPORT void
+rc_filter_sobel_3x3_magn_dir_u8(uint8_t *restrict mag, int mag_dim,
+                                uint8_t *restrict dir, int dir_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height, int bins);
+
+/**
+ *  3x3 Sobel gradient components, full precision.
+ *
+ *  @param[out]  gx       Horizontal gradient buffer.
+ *  @param       gx_dim   Row dimension of the horizontal gradient buffer.
+ *  @param[out]  gy       Vertical gradient buffer.
+ *  @param       gy_dim   Row dimension of the vertical gradient buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_sobel_3x3_grad_u8_s16(int16_t *restrict gx, int gx_dim,
+                                int16_t *restrict gy, int gy_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height);
+
+/**
+ *  1x2 horizontal difference, full precision.
+ *
+ *  @param[out]  dst      Destination buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_diff_1x2_horz_u8_s16(int16_t *restrict dst, int dst_dim,
+                               const uint8_t *restrict src, int src_dim,
+                               int width, int height);
+
+/**
+ *  2x1 vertical difference, full precision.
+ *
+ *  @param[out]  dst      Destination buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_diff_2x1_vert_u8_s16(int16_t *restrict dst, int dst_dim,
+                               const uint8_t *restrict src, int src_dim,
+                               int width, int height);
+
+/**
+ *  3x3 horizontal Sobel gradient, full precision.
+ *
+ *  @param[out]  dst      Destination buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_sobel_3x3_horz_u8_s16(int16_t *restrict dst, int dst_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height);
+
+/**
+ *  3x3 vertical Sobel gradient, full precision.
+ *
+ *  @param[out]  dst      Destination buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_sobel_3x3_vert_u8_s16(int16_t *restrict dst, int dst_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height);
+
+/**
+ *  3x3 laplacian, full precision.
+ *
+ *  @param[out]  dst      Destination buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_laplace_3x3_u8_s16(int16_t *restrict dst, int dst_dim,
+                             const uint8_t *restrict src, int src_dim,
+                             int width, int height);
+
+/**
+ *  3x3 highpass filter, full precision.
+ *
+ *  @param[out]  dst      Destination buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_highpass_3x3_u8_s16(int16_t *restrict dst, int dst_dim,
+                              const uint8_t *restrict src, int src_dim,
+                              int width, int height);
+
 /**
  *  3x3 gaussian.
  *
@@ -271,6 +430,392 @@ rc_filter_highpass_3x3_abs_u8(uint8_t *restrict dst, int dst_dim,
                               const uint8_t *restrict src, int src_dim,
                               int width, int height);
 
+/**
+ *  General 2D convolution with a user-specified kernel.
+ *  Computes dst = (sum(kern*src) + ((1 << shift) >> 1)) >> shift for each
+ *  pixel, saturated to [0,0xff]. The kernel dimensions must be odd and at
+ *  most #RC_FILTER_CONV_MAX. The sum of the positive coefficients and the
+ *  sum of the magnitudes of the negative coefficients must both be at
+ *  most 0x80.
+ *
+ *  @param[out]  dst          Destination pixel buffer.
+ *  @param       dst_dim      Row dimension of the destination buffer.
+ *  @param[in]   src          Source pixel buffer.
+ *  @param       src_dim      Row dimension of the source buffer.
+ *  @param       width        Image width in pixels.
+ *  @param       height       Image height in pixels.
+ *  @param[in]   kern         Kernel coefficients in row-major order.
+ *  @param       kern_width   Kernel width.
+ *  @param       kern_height  Kernel height.
+ *  @param       shift        Output right-shift value, in the range [0,15].
+ */
+RC_EXPORT void
+rc_filter_conv_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height,
+                  const int8_t *kern, int kern_width, int kern_height,
+                  int shift);
+
+/**
+ *  Separable convolution with user-specified kernels.
+ *  The vertical kernel is applied first. The intermediate result
+ *  is rounded and saturated to 8 bits in the same way as the final
+ *  result, see rc_filter_conv_u8(). Each kernel must satisfy the
+ *  same restrictions as the kernel of rc_filter_conv_u8().
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ *  @param[in]   xkern    Horizontal kernel coefficients.
+ *  @param       xlen     Horizontal kernel length.
+ *  @param       xshift   Horizontal pass right-shift value.
+ *  @param[in]   ykern    Vertical kernel coefficients.
+ *  @param       ylen     Vertical kernel length.
+ *  @param       yshift   Vertical pass right-shift value.
+ *  @param       row      Aligned work row of rc_align(width) bytes,
+ *                        with rc_align(xlen / 2) bytes of accessible
+ *                        memory on each side.
+ */
+RC_EXPORT void
+rc_filter_sep_u8(uint8_t *restrict dst, int dst_dim,
+                 const uint8_t *restrict src, int src_dim,
+                 int width, int height,
+                 const int8_t *xkern, int xlen, int xshift,
+                 const int8_t *ykern, int ylen, int yshift,
+                 uint8_t *restrict row);
+
+/**
+ *  3x3 median filter.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_median_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height);
+
+/**
+ *  5x5 median filter.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_median_5x5_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height);
+
+/**
+ *  Horizontal box filter with an odd size, computed with a running sum.
+ *  The result is the mean value of the pixels in the box, rounded
+ *  using a 16-bit fixed-point reciprocal of the size.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ *  @param       size     The box width, an odd number in the range [1, 255].
+ */
+RC_EXPORT void
+rc_filter_box_horz_u8(uint8_t *restrict dst, int dst_dim,
+                      const uint8_t *restrict src, int src_dim,
+                      int width, int height, int size);
+
+/**
+ *  Vertical box filter with an odd size, computed with running
+ *  column sums. The rounding is the same as for rc_filter_box_horz_u8().
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ *  @param       size     The box height, an odd number in the range [1, 255].
+ *  @param       sum      Aligned work buffer for the column sums,
+ *                        rc_align(width) elements.
+ */
+RC_EXPORT void
+rc_filter_box_vert_u8(uint8_t *restrict dst, int dst_dim,
+                      const uint8_t *restrict src, int src_dim,
+                      int width, int height, int size,
+                      uint16_t *restrict sum);
+
+/**
+ *  Rank filter over a square neighbourhood, computed with sliding
+ *  column histograms in constant time per pixel. The result is the
+ *  pixel value of the given rank in the sorted neighbourhood, where
+ *  rank 0 is the minimum and rank (2*radius + 1)^2 - 1 is the maximum.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ *  @param       radius   Neighbourhood radius, in the range
+ *                        [1, #RC_FILTER_RANK_MAX].
+ *  @param       rank     The rank of the output value.
+ *  @param       hist     Work buffer for the column histograms,
+ *                        (width + 2*radius)*#RC_FILTER_RANK_BINS elements.
+ */
+RC_EXPORT void
+rc_filter_rank_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height, int radius, int rank,
+                  uint16_t *restrict hist);
+
+/**
+ *  3x3 gaussian on 16-bit pixels.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_gauss_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                        const uint16_t *restrict src, int src_dim,
+                        int width, int height);
+
+/**
+ *  3x3 median filter on 16-bit pixels.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_median_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                         const uint16_t *restrict src, int src_dim,
+                         int width, int height);
+
+/**
+ *  3x3 horizontal Sobel gradient on 16-bit pixels.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_sobel_3x3_horz_u16(uint16_t *restrict dst, int dst_dim,
+                             const uint16_t *restrict src, int src_dim,
+                             int width, int height);
+
+/**
+ *  3x3 horizontal Sobel gradient on 16-bit pixels, absolute value.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_sobel_3x3_horz_abs_u16(uint16_t *restrict dst, int dst_dim,
+                                 const uint16_t *restrict src, int src_dim,
+                                 int width, int height);
+
+/**
+ *  3x3 vertical Sobel gradient on 16-bit pixels.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_sobel_3x3_vert_u16(uint16_t *restrict dst, int dst_dim,
+                             const uint16_t *restrict src, int src_dim,
+                             int width, int height);
+
+/**
+ *  3x3 vertical Sobel gradient on 16-bit pixels, absolute value.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_sobel_3x3_vert_abs_u16(uint16_t *restrict dst, int dst_dim,
+                                 const uint16_t *restrict src, int src_dim,
+                                 int width, int height);
+
+/**
+ *  3x3 laplacian on 16-bit pixels.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_laplace_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                          const uint16_t *restrict src, int src_dim,
+                          int width, int height);
+
+/**
+ *  3x3 laplacian on 16-bit pixels, absolute value.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_laplace_3x3_abs_u16(uint16_t *restrict dst, int dst_dim,
+                              const uint16_t *restrict src, int src_dim,
+                              int width, int height);
+
+/**
+ *  3x3 highpass filter on 16-bit pixels.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_highpass_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                           const uint16_t *restrict src, int src_dim,
+                           int width, int height);
+
+/**
+ *  3x3 highpass filter on 16-bit pixels, absolute value.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_highpass_3x3_abs_u16(uint16_t *restrict dst, int dst_dim,
+                               const uint16_t *restrict src, int src_dim,
+                               int width, int height);
+
+/**
+ *  3x3 census transform.
+ *
+ *  @param[out]  dst      Destination code buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_census_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height);
+
+/**
+ *  5x5 census transform with 32-bit codes.
+ *
+ *  @param[out]  dst      Destination code buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_census_5x5_u8_u32(uint32_t *restrict dst, int dst_dim,
+                            const uint8_t *restrict src, int src_dim,
+                            int width, int height);
+
+/**
+ *  3x3 local binary patterns.
+ *
+ *  @param[out]  dst      Destination code buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension of the source buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_filter_lbp_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                     const uint8_t *restrict src, int src_dim,
+                     int width, int height);
+
+/**
+ *  Hamming distance between 8-bit codes at a given disparity.
+ *  Computes dst[x] = popcount(src1[x] ^ src2[x - disp]) for
+ *  x >= disp, and dst[x] = 8 for x < disp.
+ *
+ *  @param[out]  dst      Destination cost buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src1     First code buffer.
+ *  @param       src1_dim Row dimension of the first code buffer.
+ *  @param[in]   src2     Second code buffer.
+ *  @param       src2_dim Row dimension of the second code buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ *  @param       disp     The disparity, a non-negative number.
+ */
+RC_EXPORT void
+rc_filter_census_cost_u8(uint8_t *restrict dst, int dst_dim,
+                         const uint8_t *restrict src1, int src1_dim,
+                         const uint8_t *restrict src2, int src2_dim,
+                         int width, int height, int disp);
+
+/**
+ *  Hamming distance between 32-bit codes at a given disparity.
+ *  Computes dst[x] = popcount(src1[x] ^ src2[x - disp]) for
+ *  x >= disp, and dst[x] = 32 for x < disp.
+ *
+ *  @param[out]  dst      Destination cost buffer.
+ *  @param       dst_dim  Row dimension of the destination buffer.
+ *  @param[in]   src1     First code buffer.
+ *  @param       src1_dim Row dimension in bytes of the first code buffer.
+ *  @param[in]   src2     Second code buffer.
+ *  @param       src2_dim Row dimension in bytes of the second code buffer.
+ *  @param       width    Image width in pixels.
+ *  @param       height   Image height in pixels.
+ *  @param       disp     The disparity, a non-negative number.
+ */
+RC_EXPORT void
+rc_filter_census_cost_u32_u8(uint8_t *restrict dst, int dst_dim,
+                             const uint32_t *restrict src1, int src1_dim,
+                             const uint32_t *restrict src2, int src2_dim,
+                             int width, int height, int disp);
+
 #ifdef __cplusplus
 };
 #endif
@@ -56,6 +56,14 @@ rc_integral_sum_u8_u32(uint32_t *restrict dst, int dst_dim,
                        const uint8_t *restrict src, int src_dim,
                        int width, int height);
 
+/**
+ *  Integral image: 16-bit source to 32-bit integral.
+ */
+RC_EXPORT void
+rc_integral_sum_u16_u32(uint32_t *restrict dst, int dst_dim,
+                        const uint16_t *restrict src, int src_dim,
+                        int width, int height);
+
 /**
  *  Integral histogram: 8-bit bin indices to 8-bit integral.
  */
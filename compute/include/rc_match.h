@@ -0,0 +1,94 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_match.h
+ *  @brief  RAPP Compute layer template matching primitives.
+ */
+
+#ifndef RC_MATCH_H
+#define RC_MATCH_H
+
+#include <stdint.h>
+#include "rc_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Block sum of squared differences with early termination.
+ *  The buffers and the limit are handled as for rc_motion_sad_u8().
+ *  The block must not have more than 2<sup>16</sup> pixels.
+ *
+ *  @param[in] blk      Aligned block pixel buffer.
+ *  @param     blk_dim  Row dimension of the block buffer.
+ *  @param[in] ref      Reference pixel buffer, of any alignment.
+ *  @param     ref_dim  Row dimension of the reference buffer.
+ *  @param     width    Block width in pixels.
+ *  @param     height   Block height in pixels.
+ *  @param     limit    The early termination limit.
+ *  @return             The sum of squared differences, if not
+ *                      larger than the limit.
+ */
+RC_EXPORT uint32_t
+rc_match_ssd_u8(const uint8_t *restrict blk, int blk_dim,
+                const uint8_t *restrict ref, int ref_dim,
+                int width, int height, uint32_t limit);
+
+/**
+ *  Block sum of products.
+ *  The block buffer must be aligned, but the reference buffer may
+ *  have any alignment. Only the pixels inside the block are read
+ *  from the reference buffer. The block must not have more than
+ *  2<sup>16</sup> pixels.
+ *
+ *  @param[in] blk      Aligned block pixel buffer.
+ *  @param     blk_dim  Row dimension of the block buffer.
+ *  @param[in] ref      Reference pixel buffer, of any alignment.
+ *  @param     ref_dim  Row dimension of the reference buffer.
+ *  @param     width    Block width in pixels.
+ *  @param     height   Block height in pixels.
+ *  @return             The sum of the pixelwise products.
+ */
+RC_EXPORT uint32_t
+rc_match_mac_u8(const uint8_t *restrict blk, int blk_dim,
+                const uint8_t *restrict ref, int ref_dim,
+                int width, int height);
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RC_MATCH_H */
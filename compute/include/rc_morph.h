@@ -0,0 +1,95 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_morph.h
+ *  @brief  RAPP Compute layer 8-bit morphology primitives.
+ */
+
+#ifndef RC_MORPH_H
+#define RC_MORPH_H
+
+#include <stdint.h>
+#include "rc_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Erosion with a horizontal line.
+ *  Computes dst(x, y) = min src(x + i, y), 0 <= i < len.
+ *  The source buffer may be unaligned.
+ */
+RC_EXPORT void
+rc_morph_erode_line_horz_u8(uint8_t *restrict dst, int dst_dim,
+                            const uint8_t *restrict src, int src_dim,
+                            int width, int height, int len);
+
+/**
+ *  Dilation with a horizontal line.
+ *  Computes dst(x, y) = max src(x + i, y), 0 <= i < len.
+ *  The source buffer may be unaligned.
+ */
+RC_EXPORT void
+rc_morph_dilate_line_horz_u8(uint8_t *restrict dst, int dst_dim,
+                             const uint8_t *restrict src, int src_dim,
+                             int width, int height, int len);
+
+/**
+ *  Erosion with a vertical line.
+ *  Computes dst(x, y) = min src(x, y + i), 0 <= i < len.
+ *  The buffer buf holds one row of rc_align(width) bytes.
+ */
+RC_EXPORT void
+rc_morph_erode_line_vert_u8(uint8_t *restrict dst, int dst_dim,
+                            const uint8_t *restrict src, int src_dim,
+                            int width, int height, int len,
+                            uint8_t *restrict buf);
+
+/**
+ *  Dilation with a vertical line.
+ *  Computes dst(x, y) = max src(x, y + i), 0 <= i < len.
+ *  The buffer buf holds one row of rc_align(width) bytes.
+ */
+RC_EXPORT void
+rc_morph_dilate_line_vert_u8(uint8_t *restrict dst, int dst_dim,
+                             const uint8_t *restrict src, int src_dim,
+                             int width, int height, int len,
+                             uint8_t *restrict buf);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RC_MORPH_H */
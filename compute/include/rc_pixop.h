@@ -285,6 +285,97 @@ rc_pixop_norm_u8(uint8_t *restrict dst, int dst_dim,
                  const uint8_t *restrict src, int src_dim,
                  int width, int height);
 
+
+/*
+ * -------------------------------------------------------------
+ *  16-bit functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Saturated addition, 16-bit.
+ *
+ *  @param[in,out] dst      Destination pixel buffer.
+ *  @param         dst_dim  Row dimension of the destination buffer.
+ *  @param[in]     src      Source pixel buffer.
+ *  @param         src_dim  Row dimension of the source buffer.
+ *  @param         width    Image width in pixels.
+ *  @param         height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_pixop_add_u16(uint16_t *restrict dst, int dst_dim,
+                        const uint16_t *restrict src, int src_dim,
+                        int width, int height);
+
+/**
+ *  Saturated subtraction, 16-bit.
+ *
+ *  @param[in,out] dst      Destination pixel buffer.
+ *  @param         dst_dim  Row dimension of the destination buffer.
+ *  @param[in]     src      Source pixel buffer.
+ *  @param         src_dim  Row dimension of the source buffer.
+ *  @param         width    Image width in pixels.
+ *  @param         height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_pixop_sub_u16(uint16_t *restrict dst, int dst_dim,
+                        const uint16_t *restrict src, int src_dim,
+                        int width, int height);
+
+/**
+ *  Absolute-value subtraction, 16-bit.
+ *
+ *  @param[in,out] dst      Destination pixel buffer.
+ *  @param         dst_dim  Row dimension of the destination buffer.
+ *  @param[in]     src      Source pixel buffer.
+ *  @param         src_dim  Row dimension of the source buffer.
+ *  @param         width    Image width in pixels.
+ *  @param         height   Image height in pixels.
+ */
+RC_EXPORT void
+rc_pixop_suba_u16(uint16_t *restrict dst, int dst_dim,
+                         const uint16_t *restrict src, int src_dim,
+                         int width, int height);
+
+/**
+ *  Shifted lookup-table transformation from 16 to 8 bits.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Row dimension of the destination buffer.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Row dimension of the source buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param[in]  lut      8-bit lookup table to use.
+ *  @param      shift    Right-shift value applied before the lookup.
+ */
+RC_EXPORT void
+rc_pixop_lut_u16_u8(uint8_t *restrict dst, int dst_dim,
+                    const uint16_t *restrict src, int src_dim,
+                    int width, int height,
+                    const uint8_t *restrict lut, int shift);
+
+/**
+ *  Linear interpolation between two lookup-table transformations.
+ *  Computes buf[i] = (lut1[buf[i]]*(0x100 - blend[x]) +
+ *  lut2[buf[i]]*blend[x] + 0x80) >> 8, where x is the column of the
+ *  pixel. The same blend factors are used for all rows.
+ *
+ *  @param[in,out] buf     Pixel buffer.
+ *  @param         dim     Row dimension of the pixel buffer.
+ *  @param         width   Image width in pixels.
+ *  @param         height  Image height in pixels.
+ *  @param[in]     lut1    The first 8-bit lookup table.
+ *  @param[in]     lut2    The second 8-bit lookup table.
+ *  @param[in]     blend   The Q.8 blend factor of each column.
+ */
+RC_EXPORT void
+rc_pixop_lerp_lut_u8(uint8_t *restrict buf, int dim,
+                     int width, int height,
+                     const uint8_t *restrict lut1,
+                     const uint8_t *restrict lut2,
+                     const uint8_t *restrict blend);
+
 #ifdef __cplusplus
 };
 #endif
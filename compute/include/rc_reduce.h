@@ -91,6 +91,21 @@ rc_reduce_2x2_u8(uint8_t *restrict dst, int dst_dim,
                  const uint8_t *restrict src, int src_dim,
                  int width, int height);
 
+/**
+ *  16-bit 2x2 reduction.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Row dimension in bytes of the source buffer.
+ *  @param      width    Source image width in pixels.
+ *  @param      height   Source image height in pixels.
+ */
+RC_EXPORT void
+rc_reduce_2x2_u16(uint16_t *restrict dst, int dst_dim,
+                  const uint16_t *restrict src, int src_dim,
+                  int width, int height);
+
 
 #ifdef __cplusplus
 };
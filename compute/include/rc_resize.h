@@ -0,0 +1,111 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_resize.h
+ *  @brief  RAPP Compute layer arbitrary-ratio resizing.
+ */
+
+#ifndef RC_RESIZE_H
+#define RC_RESIZE_H
+
+#include <stdint.h>
+#include "rc_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The maximum number of filter taps of rc_resize_vert_u8().
+ */
+#define RC_RESIZE_TAPS_MAX 17
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  8-bit horizontal resampling.
+ *  Each destination pixel x is a weighted sum of the source pixels
+ *  idx[x] to idx[x] + taps - 1, with the Q.7 weights coef[taps*x] to
+ *  coef[taps*x + taps - 1]. The weights of each pixel must sum to 128.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Row dimension of the destination buffer.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Row dimension of the source buffer.
+ *  @param      width    Destination image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param[in]  idx      The first source pixel of each destination pixel.
+ *  @param[in]  coef     The weights of each destination pixel.
+ *  @param      taps     The number of weights per pixel.
+ */
+RC_EXPORT void
+rc_resize_horz_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height,
+                  const int *idx, const uint8_t *coef, int taps);
+
+/**
+ *  8-bit vertical resampling.
+ *  Each destination row y is a weighted sum of the source rows idx[y]
+ *  to idx[y] + taps - 1, with the Q.7 weights coef[taps*y] to
+ *  coef[taps*y + taps - 1]. The weights of each row must sum to 128.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Row dimension of the destination buffer.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Row dimension of the source buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Destination image height in pixels.
+ *  @param[in]  idx      The first source row of each destination row.
+ *  @param[in]  coef     The weights of each destination row.
+ *  @param      taps     The number of weights per row,
+ *                       at most #RC_RESIZE_TAPS_MAX.
+ */
+RC_EXPORT void
+rc_resize_vert_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height,
+                  const int *idx, const uint8_t *coef, int taps);
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RC_RESIZE_H */
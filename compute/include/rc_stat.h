@@ -41,6 +41,18 @@ extern "C" {
 #endif
 
 
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The width and height of the SSIM window.
+ */
+#define RC_STAT_SSIM_WIN 8
+
+
 /*
  * -------------------------------------------------------------
  *  Exported functions
@@ -158,6 +170,256 @@ rc_stat_min_u8(const uint8_t *buf, int dim, int width, int height);
 RC_EXPORT int
 rc_stat_max_u8(const uint8_t *buf, int dim, int width, int height);
 
+/**
+ *  16-bit pixel sum.
+ *
+ *  @param[in]  buf     Input pixel buffer.
+ *  @param      dim     Row dimension in bytes of the input buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @return             The computed sum of all pixels.
+ */
+RC_EXPORT uintmax_t
+rc_stat_sum_u16(const uint16_t *buf, int dim, int width, int height);
+
+/**
+ *  16-bit pixel min.
+ *
+ *  @param[in]  buf     Input pixel buffer.
+ *  @param      dim     Row dimension in bytes of the input buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @return             The minimum pixel value in image.
+ */
+RC_EXPORT int
+rc_stat_min_u16(const uint16_t *buf, int dim, int width, int height);
+
+/**
+ *  16-bit pixel max.
+ *
+ *  @param[in]  buf     Input pixel buffer.
+ *  @param      dim     Row dimension in bytes of the input buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @return             The maximum pixel value in image.
+ */
+RC_EXPORT int
+rc_stat_max_u16(const uint16_t *buf, int dim, int width, int height);
+
+/**
+ *  8-bit pixel histogram.
+ *
+ *  @param[in]  buf     Input pixel buffer.
+ *  @param      dim     Row dimension in bytes of the input buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @param[out] hist    The 256-bin histogram.
+ */
+RC_EXPORT void
+rc_stat_hist_u8(const uint8_t *buf, int dim,
+                int width, int height, uint32_t *hist);
+
+/**
+ *  8-bit pixel histogram with a binary mask.
+ *
+ *  @param[in]  buf      Input pixel buffer.
+ *  @param      dim      Row dimension in bytes of the input buffer.
+ *  @param[in]  map      Binary mask buffer.
+ *  @param      map_dim  Row dimension in bytes of the mask buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param[out] hist     The 256-bin histogram.
+ */
+RC_EXPORT void
+rc_stat_hist_mask_u8(const uint8_t *buf, int dim,
+                     const uint8_t *map, int map_dim,
+                     int width, int height, uint32_t *hist);
+
+/**
+ *  8-bit pixel sum with a binary mask.
+ *
+ *  @param[in]  buf      Input pixel buffer.
+ *  @param      dim      Row dimension in bytes of the input buffer.
+ *  @param[in]  map      Binary mask buffer.
+ *  @param      map_dim  Row dimension in bytes of the mask buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              The sum of all pixels where the mask is set.
+ */
+RC_EXPORT uint32_t
+rc_stat_sum_mask_u8(const uint8_t *buf, int dim,
+                    const uint8_t *map, int map_dim,
+                    int width, int height);
+
+/**
+ *  8-bit pixel sum and squared sum with a binary mask.
+ *
+ *  @param[in]  buf      Input pixel buffer.
+ *  @param      dim      Row dimension in bytes of the input buffer.
+ *  @param[in]  map      Binary mask buffer.
+ *  @param      map_dim  Row dimension in bytes of the mask buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param[out] sum      The pixel sum and squared sum where the
+ *                       mask is set.
+ */
+RC_EXPORT void
+rc_stat_sum2_mask_u8(const uint8_t *buf, int dim,
+                     const uint8_t *map, int map_dim,
+                     int width, int height, uintmax_t sum[2]);
+
+/**
+ *  8-bit pixel min with a binary mask.
+ *
+ *  @param[in]  buf      Input pixel buffer.
+ *  @param      dim      Row dimension in bytes of the input buffer.
+ *  @param[in]  map      Binary mask buffer.
+ *  @param      map_dim  Row dimension in bytes of the mask buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              The minimum pixel value where the mask is set,
+ *                       or 0xff if the mask is empty.
+ */
+RC_EXPORT int
+rc_stat_min_mask_u8(const uint8_t *buf, int dim,
+                    const uint8_t *map, int map_dim,
+                    int width, int height);
+
+/**
+ *  8-bit pixel max with a binary mask.
+ *
+ *  @param[in]  buf      Input pixel buffer.
+ *  @param      dim      Row dimension in bytes of the input buffer.
+ *  @param[in]  map      Binary mask buffer.
+ *  @param      map_dim  Row dimension in bytes of the mask buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              The maximum pixel value where the mask is set,
+ *                       or zero if the mask is empty.
+ */
+RC_EXPORT int
+rc_stat_max_mask_u8(const uint8_t *buf, int dim,
+                    const uint8_t *map, int map_dim,
+                    int width, int height);
+
+/**
+ *  Binary pixel min and max with location.
+ *
+ *  @param[in]  buf     Input pixel buffer.
+ *  @param      dim     Row dimension of the input buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @param[out] minmax  The minimum and maximum pixel values.
+ *  @param[out] pos     The x and y coordinates of the first minimum
+ *                      pixel, followed by those of the first maximum.
+ */
+RC_EXPORT void
+rc_stat_minmax_loc_bin(const uint8_t *buf, int dim, int width, int height,
+                       int minmax[2], unsigned pos[4]);
+
+/**
+ *  8-bit pixel min and max with location.
+ *
+ *  @param[in]  buf     Input pixel buffer.
+ *  @param      dim     Row dimension of the input buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @param[out] minmax  The minimum and maximum pixel values.
+ *  @param[out] pos     The x and y coordinates of the first minimum
+ *                      pixel, followed by those of the first maximum.
+ */
+RC_EXPORT void
+rc_stat_minmax_loc_u8(const uint8_t *buf, int dim, int width, int height,
+                      int minmax[2], unsigned pos[4]);
+
+/**
+ *  8-bit top-K pixel locations.
+ *  The positions are sorted in decreasing pixel value order, and
+ *  pixels of equal value in raster order.
+ *
+ *  @param[in]  buf     Input pixel buffer.
+ *  @param      dim     Row dimension of the input buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @param[out] pos     Output x, y position pairs, at least 2*k elements.
+ *  @param      k       The number of positions to find, at least one.
+ *  @return             The number of positions found.
+ */
+RC_EXPORT int
+rc_stat_max_k_u8(const uint8_t *buf, int dim, int width, int height,
+                 unsigned *pos, int k);
+
+/**
+ *  8-bit pixel sum, min and max per tile.
+ *  The tiles are stored in raster order. The tiles in the last
+ *  column and row may be smaller than tile_w x tile_h.
+ *
+ *  @param[in]  buf     Input pixel buffer.
+ *  @param      dim     Row dimension of the input buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @param      tile_w  Tile width in pixels.
+ *  @param      tile_h  Tile height in pixels.
+ *  @param[out] sum     The pixel sum of each tile.
+ *  @param[out] min     The minimum pixel value of each tile.
+ *  @param[out] max     The maximum pixel value of each tile.
+ */
+RC_EXPORT void
+rc_stat_tiles_u8(const uint8_t *buf, int dim, int width, int height,
+                 int tile_w, int tile_h, uint32_t *sum,
+                 uint8_t *min, uint8_t *max);
+
+/**
+ *  8-bit sum of absolute differences.
+ *
+ *  @param[in]  src1      First source pixel buffer.
+ *  @param      src1_dim  Row dimension of the first source buffer.
+ *  @param[in]  src2      Second source pixel buffer.
+ *  @param      src2_dim  Row dimension of the second source buffer.
+ *  @param      width     Image width in pixels.
+ *  @param      height    Image height in pixels.
+ *  @return               The sum of absolute differences.
+ */
+RC_EXPORT uintmax_t
+rc_stat_sad_u8(const uint8_t *restrict src1, int src1_dim,
+               const uint8_t *restrict src2, int src2_dim,
+               int width, int height);
+
+/**
+ *  8-bit sum of squared differences.
+ *
+ *  @param[in]  src1      First source pixel buffer.
+ *  @param      src1_dim  Row dimension of the first source buffer.
+ *  @param[in]  src2      Second source pixel buffer.
+ *  @param      src2_dim  Row dimension of the second source buffer.
+ *  @param      width     Image width in pixels.
+ *  @param      height    Image height in pixels.
+ *  @return               The sum of squared differences.
+ */
+RC_EXPORT uintmax_t
+rc_stat_ssd_u8(const uint8_t *restrict src1, int src1_dim,
+               const uint8_t *restrict src2, int src2_dim,
+               int width, int height);
+
+/**
+ *  8-bit mean structural similarity.
+ *  The image must be at least #RC_STAT_SSIM_WIN pixels in both
+ *  directions.
+ *
+ *  @param[in]  src1      First source pixel buffer.
+ *  @param      src1_dim  Row dimension of the first source buffer.
+ *  @param[in]  src2      Second source pixel buffer.
+ *  @param      src2_dim  Row dimension of the second source buffer.
+ *  @param      width     Image width in pixels.
+ *  @param      height    Image height in pixels.
+ *  @param      work      Working buffer of 5*width uint32_t elements.
+ *  @return               The mean SSIM in units of 1/65536.
+ */
+RC_EXPORT int
+rc_stat_ssim_u8(const uint8_t *restrict src1, int src1_dim,
+                const uint8_t *restrict src2, int src2_dim,
+                int width, int height, uint32_t *restrict work);
+
 #ifdef __cplusplus
 };
 #endif
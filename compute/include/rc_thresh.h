@@ -188,6 +188,58 @@ rc_thresh_ltgt_pixel_u8(uint8_t *restrict dst, int dst_dim,
                         const uint8_t *restrict low, int low_dim,
                         const uint8_t *restrict high, int high_dim,
                         int width, int height);
+/**
+ *  Single thresholding greater-than on 16-bit pixels.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Row dimension in bytes of the source buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param      thresh   Threshold value.
+ */
+RC_EXPORT void
+rc_thresh_gt_u16(uint8_t *restrict dst, int dst_dim,
+                 const uint16_t *restrict src, int src_dim,
+                 int width, int height, int thresh);
+
+/**
+ *  Single thresholding less-than on 16-bit pixels.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Row dimension in bytes of the source buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param      thresh   Threshold value.
+ */
+RC_EXPORT void
+rc_thresh_lt_u16(uint8_t *restrict dst, int dst_dim,
+                 const uint16_t *restrict src, int src_dim,
+                 int width, int height, int thresh);
+
+/**
+ *  Absolute-difference thresholding greater-than.
+ *  Computes dst = abs(src1 - src2) > thresh for each pixel.
+ *
+ *  @param[out] dst       Destination pixel buffer.
+ *  @param      dst_dim   Row dimension in bytes of the destination buffer.
+ *  @param[in]  src1      First source pixel buffer.
+ *  @param      src1_dim  Row dimension in bytes of the first source buffer.
+ *  @param[in]  src2      Second source pixel buffer.
+ *  @param      src2_dim  Row dimension in bytes of the second source buffer.
+ *  @param      width     Image width in pixels.
+ *  @param      height    Image height in pixels.
+ *  @param      thresh    Threshold value, in the range [0, 254].
+ */
+RC_EXPORT void
+rc_thresh_absdiff_gt_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src1, int src1_dim,
+                        const uint8_t *restrict src2, int src2_dim,
+                        int width, int height, int thresh);
+
 #ifdef __cplusplus
 };
 #endif
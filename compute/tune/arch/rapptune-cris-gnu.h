@@ -468,6 +468,274 @@
 #define rc_filter_highpass_3x3_abs_u8_UNROLL                 1
 #define rc_filter_highpass_3x3_abs_u8_SCORE                  2.18e+06
 
+#define rc_filter_conv_u8_IMPL                               RC_IMPL_GEN
+#define rc_filter_conv_u8_UNROLL                             1
+#define rc_filter_conv_u8_SCORE                              0.0
+
+#define rc_filter_sep_u8_IMPL                                RC_IMPL_GEN
+#define rc_filter_sep_u8_UNROLL                              1
+#define rc_filter_sep_u8_SCORE                               0.0
+
+#define rc_filter_median_3x3_u8_IMPL                         RC_IMPL_GEN
+#define rc_filter_median_3x3_u8_UNROLL                       1
+#define rc_filter_median_3x3_u8_SCORE                        0.0
+
+#define rc_filter_median_5x5_u8_IMPL                         RC_IMPL_GEN
+#define rc_filter_median_5x5_u8_UNROLL                       1
+#define rc_filter_median_5x5_u8_SCORE                        0.0
+
+#define rc_filter_box_horz_u8_IMPL                           RC_IMPL_GEN
+#define rc_filter_box_horz_u8_UNROLL                         1
+#define rc_filter_box_horz_u8_SCORE                          0.0
+
+#define rc_filter_box_vert_u8_IMPL                           RC_IMPL_GEN
+#define rc_filter_box_vert_u8_UNROLL                         1
+#define rc_filter_box_vert_u8_SCORE                          0.0
+
+#define rc_filter_diff_1x2_horz_u8_s16_IMPL                  RC_IMPL_GEN
+#define rc_filter_diff_1x2_horz_u8_s16_UNROLL                1
+#define rc_filter_diff_1x2_horz_u8_s16_SCORE                 0.0
+
+#define rc_filter_diff_2x1_vert_u8_s16_IMPL                  RC_IMPL_GEN
+#define rc_filter_diff_2x1_vert_u8_s16_UNROLL                1
+#define rc_filter_diff_2x1_vert_u8_s16_SCORE                 0.0
+
+#define rc_filter_sobel_3x3_horz_u8_s16_IMPL                 RC_IMPL_GEN
+#define rc_filter_sobel_3x3_horz_u8_s16_UNROLL               1
+#define rc_filter_sobel_3x3_horz_u8_s16_SCORE                0.0
+
+#define rc_filter_sobel_3x3_vert_u8_s16_IMPL                 RC_IMPL_GEN
+#define rc_filter_sobel_3x3_vert_u8_s16_UNROLL               1
+#define rc_filter_sobel_3x3_vert_u8_s16_SCORE                0.0
+
+#define rc_filter_sobel_3x3_grad_u8_s16_IMPL                 RC_IMPL_GEN
+#define rc_filter_sobel_3x3_grad_u8_s16_UNROLL               1
+#define rc_filter_sobel_3x3_grad_u8_s16_SCORE                0.0
+
+#define rc_filter_sobel_3x3_magn_dir_u8_IMPL                 RC_IMPL_GEN
+#define rc_filter_sobel_3x3_magn_dir_u8_UNROLL               1
+#define rc_filter_sobel_3x3_magn_dir_u8_SCORE                0.0
+
+#define rc_filter_laplace_3x3_u8_s16_IMPL                    RC_IMPL_GEN
+#define rc_filter_laplace_3x3_u8_s16_UNROLL                  1
+#define rc_filter_laplace_3x3_u8_s16_SCORE                   0.0
+
+#define rc_filter_highpass_3x3_u8_s16_IMPL                   RC_IMPL_GEN
+#define rc_filter_highpass_3x3_u8_s16_UNROLL                 1
+#define rc_filter_highpass_3x3_u8_s16_SCORE                  0.0
+
+#define rc_pixop_add_u16_IMPL                                RC_IMPL_GEN
+#define rc_pixop_add_u16_UNROLL                              1
+#define rc_pixop_add_u16_SCORE                               0.0
+
+#define rc_pixop_sub_u16_IMPL                                RC_IMPL_GEN
+#define rc_pixop_sub_u16_UNROLL                              1
+#define rc_pixop_sub_u16_SCORE                               0.0
+
+#define rc_pixop_suba_u16_IMPL                               RC_IMPL_GEN
+#define rc_pixop_suba_u16_UNROLL                             1
+#define rc_pixop_suba_u16_SCORE                              0.0
+
+#define rc_pixop_lut_u16_u8_IMPL                             RC_IMPL_GEN
+#define rc_pixop_lut_u16_u8_UNROLL                           1
+#define rc_pixop_lut_u16_u8_SCORE                            0.0
+
+#define rc_thresh_gt_u16_IMPL                                RC_IMPL_GEN
+#define rc_thresh_gt_u16_UNROLL                              1
+#define rc_thresh_gt_u16_SCORE                               0.0
+
+#define rc_thresh_lt_u16_IMPL                                RC_IMPL_GEN
+#define rc_thresh_lt_u16_UNROLL                              1
+#define rc_thresh_lt_u16_SCORE                               0.0
+
+#define rc_stat_sum_u16_IMPL                                 RC_IMPL_GEN
+#define rc_stat_sum_u16_UNROLL                               1
+#define rc_stat_sum_u16_SCORE                                0.0
+
+#define rc_stat_min_u16_IMPL                                 RC_IMPL_GEN
+#define rc_stat_min_u16_UNROLL                               1
+#define rc_stat_min_u16_SCORE                                0.0
+
+#define rc_stat_max_u16_IMPL                                 RC_IMPL_GEN
+#define rc_stat_max_u16_UNROLL                               1
+#define rc_stat_max_u16_SCORE                                0.0
+
+#define rc_reduce_2x2_u16_IMPL                               RC_IMPL_GEN
+#define rc_reduce_2x2_u16_UNROLL                             1
+#define rc_reduce_2x2_u16_SCORE                              0.0
+
+#define rc_filter_gauss_3x3_u16_IMPL                         RC_IMPL_GEN
+#define rc_filter_gauss_3x3_u16_UNROLL                       1
+#define rc_filter_gauss_3x3_u16_SCORE                        0.0
+
+#define rc_filter_median_3x3_u16_IMPL                        RC_IMPL_GEN
+#define rc_filter_median_3x3_u16_UNROLL                      1
+#define rc_filter_median_3x3_u16_SCORE                       0.0
+
+#define rc_filter_sobel_3x3_horz_u16_IMPL                    RC_IMPL_GEN
+#define rc_filter_sobel_3x3_horz_u16_UNROLL                  1
+#define rc_filter_sobel_3x3_horz_u16_SCORE                   0.0
+
+#define rc_filter_sobel_3x3_horz_abs_u16_IMPL                RC_IMPL_GEN
+#define rc_filter_sobel_3x3_horz_abs_u16_UNROLL              1
+#define rc_filter_sobel_3x3_horz_abs_u16_SCORE               0.0
+
+#define rc_filter_sobel_3x3_vert_u16_IMPL                    RC_IMPL_GEN
+#define rc_filter_sobel_3x3_vert_u16_UNROLL                  1
+#define rc_filter_sobel_3x3_vert_u16_SCORE                   0.0
+
+#define rc_filter_sobel_3x3_vert_abs_u16_IMPL                RC_IMPL_GEN
+#define rc_filter_sobel_3x3_vert_abs_u16_UNROLL              1
+#define rc_filter_sobel_3x3_vert_abs_u16_SCORE               0.0
+
+#define rc_filter_laplace_3x3_u16_IMPL                       RC_IMPL_GEN
+#define rc_filter_laplace_3x3_u16_UNROLL                     1
+#define rc_filter_laplace_3x3_u16_SCORE                      0.0
+
+#define rc_filter_laplace_3x3_abs_u16_IMPL                   RC_IMPL_GEN
+#define rc_filter_laplace_3x3_abs_u16_UNROLL                 1
+#define rc_filter_laplace_3x3_abs_u16_SCORE                  0.0
+
+#define rc_filter_highpass_3x3_u16_IMPL                      RC_IMPL_GEN
+#define rc_filter_highpass_3x3_u16_UNROLL                    1
+#define rc_filter_highpass_3x3_u16_SCORE                     0.0
+
+#define rc_filter_highpass_3x3_abs_u16_IMPL                  RC_IMPL_GEN
+#define rc_filter_highpass_3x3_abs_u16_UNROLL                1
+#define rc_filter_highpass_3x3_abs_u16_SCORE                 0.0
+
+#define rc_stat_hist_u8_IMPL                                 RC_IMPL_GEN
+#define rc_stat_hist_u8_UNROLL                               1
+#define rc_stat_hist_u8_SCORE                                0.0
+
+#define rc_stat_hist_mask_u8_IMPL                            RC_IMPL_GEN
+#define rc_stat_hist_mask_u8_UNROLL                          1
+#define rc_stat_hist_mask_u8_SCORE                           0.0
+
+#define rc_stat_sum_mask_u8_IMPL                             RC_IMPL_GEN
+#define rc_stat_sum_mask_u8_UNROLL                           1
+#define rc_stat_sum_mask_u8_SCORE                            0.0
+
+#define rc_stat_sum2_mask_u8_IMPL                            RC_IMPL_GEN
+#define rc_stat_sum2_mask_u8_UNROLL                          1
+#define rc_stat_sum2_mask_u8_SCORE                           0.0
+
+#define rc_stat_min_mask_u8_IMPL                             RC_IMPL_GEN
+#define rc_stat_min_mask_u8_UNROLL                           1
+#define rc_stat_min_mask_u8_SCORE                            0.0
+
+#define rc_stat_max_mask_u8_IMPL                             RC_IMPL_GEN
+#define rc_stat_max_mask_u8_UNROLL                           1
+#define rc_stat_max_mask_u8_SCORE                            0.0
+
+#define rc_stat_minmax_loc_bin_IMPL                          RC_IMPL_GEN
+#define rc_stat_minmax_loc_bin_UNROLL                        1
+#define rc_stat_minmax_loc_bin_SCORE                         0.0
+
+#define rc_stat_minmax_loc_u8_IMPL                           RC_IMPL_GEN
+#define rc_stat_minmax_loc_u8_UNROLL                         1
+#define rc_stat_minmax_loc_u8_SCORE                          0.0
+
+#define rc_stat_max_k_u8_IMPL                                RC_IMPL_GEN
+#define rc_stat_max_k_u8_UNROLL                              1
+#define rc_stat_max_k_u8_SCORE                               0.0
+
+#define rc_stat_tiles_u8_IMPL                                RC_IMPL_GEN
+#define rc_stat_tiles_u8_UNROLL                              1
+#define rc_stat_tiles_u8_SCORE                               0.0
+
+#define rc_stat_sad_u8_IMPL                                  RC_IMPL_GEN
+#define rc_stat_sad_u8_UNROLL                                1
+#define rc_stat_sad_u8_SCORE                                 0.0
+
+#define rc_stat_ssd_u8_IMPL                                  RC_IMPL_GEN
+#define rc_stat_ssd_u8_UNROLL                                1
+#define rc_stat_ssd_u8_SCORE                                 0.0
+
+#define rc_stat_ssim_u8_IMPL                                 RC_IMPL_GEN
+#define rc_stat_ssim_u8_UNROLL                               1
+#define rc_stat_ssim_u8_SCORE                                0.0
+
+#define rc_motion_sad_u8_IMPL                                RC_IMPL_GEN
+#define rc_motion_sad_u8_UNROLL                              1
+#define rc_motion_sad_u8_SCORE                               0.0
+
+#define rc_match_ssd_u8_IMPL                                 RC_IMPL_GEN
+#define rc_match_ssd_u8_UNROLL                               1
+#define rc_match_ssd_u8_SCORE                                0.0
+
+#define rc_match_mac_u8_IMPL                                 RC_IMPL_GEN
+#define rc_match_mac_u8_UNROLL                               1
+#define rc_match_mac_u8_SCORE                                0.0
+
+#define rc_filter_census_3x3_u8_IMPL                         RC_IMPL_GEN
+#define rc_filter_census_3x3_u8_UNROLL                       1
+#define rc_filter_census_3x3_u8_SCORE                        0.0
+
+#define rc_filter_census_5x5_u8_u32_IMPL                     RC_IMPL_GEN
+#define rc_filter_census_5x5_u8_u32_UNROLL                   1
+#define rc_filter_census_5x5_u8_u32_SCORE                    0.0
+
+#define rc_filter_lbp_3x3_u8_IMPL                            RC_IMPL_GEN
+#define rc_filter_lbp_3x3_u8_UNROLL                          1
+#define rc_filter_lbp_3x3_u8_SCORE                           0.0
+
+#define rc_filter_census_cost_u8_IMPL                        RC_IMPL_GEN
+#define rc_filter_census_cost_u8_UNROLL                      1
+#define rc_filter_census_cost_u8_SCORE                       0.0
+
+#define rc_filter_census_cost_u32_u8_IMPL                    RC_IMPL_GEN
+#define rc_filter_census_cost_u32_u8_UNROLL                  1
+#define rc_filter_census_cost_u32_u8_SCORE                   0.0
+
+#define rc_feature_fast_u8_IMPL                              RC_IMPL_GEN
+#define rc_feature_fast_u8_UNROLL                            1
+#define rc_feature_fast_u8_SCORE                             0.0
+
+#define rc_feature_nms_u8_IMPL                               RC_IMPL_GEN
+#define rc_feature_nms_u8_UNROLL                             1
+#define rc_feature_nms_u8_SCORE                              0.0
+
+#define rc_feature_harris_s16_s32_IMPL                       RC_IMPL_GEN
+#define rc_feature_harris_s16_s32_UNROLL                     1
+#define rc_feature_harris_s16_s32_SCORE                      0.0
+
+#define rc_resize_horz_u8_IMPL                               RC_IMPL_GEN
+#define rc_resize_horz_u8_UNROLL                             1
+#define rc_resize_horz_u8_SCORE                              0.0
+
+#define rc_resize_vert_u8_IMPL                               RC_IMPL_GEN
+#define rc_resize_vert_u8_UNROLL                             1
+#define rc_resize_vert_u8_SCORE                              0.0
+
+#define rc_pixop_lerp_lut_u8_IMPL                            RC_IMPL_GEN
+#define rc_pixop_lerp_lut_u8_UNROLL                          1
+#define rc_pixop_lerp_lut_u8_SCORE                           0.0
+
+#define rc_thresh_absdiff_gt_u8_IMPL                         RC_IMPL_GEN
+#define rc_thresh_absdiff_gt_u8_UNROLL                       1
+#define rc_thresh_absdiff_gt_u8_SCORE                        0.0
+
+#define rc_bgmodel_update_u8_IMPL                            RC_IMPL_GEN
+#define rc_bgmodel_update_u8_UNROLL                          1
+#define rc_bgmodel_update_u8_SCORE                           0.0
+
+#define rc_bgmodel_update_dev_u8_IMPL                        RC_IMPL_GEN
+#define rc_bgmodel_update_dev_u8_UNROLL                      1
+#define rc_bgmodel_update_dev_u8_SCORE                       0.0
+
+#define rc_edge_nms_u8_IMPL                                  RC_IMPL_GEN
+#define rc_edge_nms_u8_UNROLL                                1
+#define rc_edge_nms_u8_SCORE                                 0.0
+
+#define rc_morph_erode_line_vert_u8_IMPL                     RC_IMPL_GEN
+#define rc_morph_erode_line_vert_u8_UNROLL                   1
+#define rc_morph_erode_line_vert_u8_SCORE                    0.0
+
+#define rc_morph_dilate_line_vert_u8_IMPL                    RC_IMPL_GEN
+#define rc_morph_dilate_line_vert_u8_UNROLL                  1
+#define rc_morph_dilate_line_vert_u8_SCORE                   0.0
+
 #define rc_morph_erode_line_1x2_bin_IMPL                     RC_IMPL_GEN
 #define rc_morph_erode_line_1x2_bin_UNROLL                   4
 #define rc_morph_erode_line_1x2_bin_SCORE                    5.72e+07
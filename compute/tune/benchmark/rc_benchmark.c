@@ -117,6 +117,8 @@ typedef struct rc_bmark_data_st {
     uint8_t *aux;     /* Auxiliary buffer large enough for all images  */
     uint8_t *aux2;    /* Second similar auxiliary buffer */
     uint8_t *map;     /* Buffer for binary mapping.                     */
+    int     *idx;     /* Resize index table, 2x reduction               */
+    uint8_t *coef;    /* Resize coefficient table, 2x reduction         */
     int      dim_bin; /* Binary row dimension, with padding             */
     int      dim_u8;  /* 8-bit row dimension, with padding              */
     int      rot_u8;  /* 8-bit rotatated row dimension, no padding      */
@@ -197,6 +199,87 @@ rc_bmark_exec_rotate(int (*func)(), const int *args);
 static void
 rc_bmark_exec_thresh_pixel(int (*func)(), const int *args);
 
+static void
+rc_bmark_exec_conv(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_sep(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_line(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u8_u8_u8(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u8_s16(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_grad(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u16(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u16_u16(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u16_bin(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u16_u8_p(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u8_hist(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u8_bin_hist(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_bin_loc(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u8_loc(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u8_max_k(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u8_tiles(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u8_lut2(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u8_u8_bin(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_bgmean(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_bgdev(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_motion_sad(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_match_mac(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_u8_u32(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_census_cost(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_census_cost_u32(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_harris(int (*func)(), const int *args);
+
+static void
+rc_bmark_exec_resize(int (*func)(), const int *args);
+
 
 /*
  * -------------------------------------------------------------
@@ -206,6 +289,11 @@ rc_bmark_exec_thresh_pixel(int (*func)(), const int *args);
 
 static volatile int rc_bmark_done = 0;
 
+/**
+ *  Convolution kernel with all taps active.
+ */
+static int8_t rc_bmark_kernel[15*15];
+
 static rc_bmark_data_t rc_bmark_data;
 
 static const rc_bmark_table_t rc_bmark_suite[] = {
@@ -341,6 +429,77 @@ static const rc_bmark_table_t rc_bmark_suite[] = {
     RC_BMARK_ENTRY(rc_filter_laplace_3x3_abs_u8,          u8_u8,     0, 0),
     RC_BMARK_ENTRY(rc_filter_highpass_3x3_u8,             u8_u8,     0, 0),
     RC_BMARK_ENTRY(rc_filter_highpass_3x3_abs_u8,         u8_u8,     0, 0),
+    RC_BMARK_ENTRY(rc_filter_conv_u8,                     conv,      5, 5),
+    RC_BMARK_ENTRY(rc_filter_sep_u8,                      sep,       5, 5),
+    RC_BMARK_ENTRY(rc_filter_median_3x3_u8,               u8_u8,     0, 0),
+    RC_BMARK_ENTRY(rc_filter_median_5x5_u8,               u8_u8,     0, 0),
+    RC_BMARK_ENTRY(rc_filter_box_horz_u8,                 line,      9, 0),
+    RC_BMARK_ENTRY(rc_filter_box_vert_u8,                 line,      9, 0),
+    RC_BMARK_ENTRY(rc_filter_diff_1x2_horz_u8_s16,        u8_s16,    0, 0),
+    RC_BMARK_ENTRY(rc_filter_diff_2x1_vert_u8_s16,        u8_s16,    0, 0),
+    RC_BMARK_ENTRY(rc_filter_sobel_3x3_horz_u8_s16,       u8_s16,    0, 0),
+    RC_BMARK_ENTRY(rc_filter_sobel_3x3_vert_u8_s16,       u8_s16,    0, 0),
+    RC_BMARK_ENTRY(rc_filter_sobel_3x3_grad_u8_s16,       grad,      0, 2),
+    RC_BMARK_ENTRY(rc_filter_sobel_3x3_magn_dir_u8,       grad,      8, 1),
+    RC_BMARK_ENTRY(rc_filter_laplace_3x3_u8_s16,          u8_s16,    0, 0),
+    RC_BMARK_ENTRY(rc_filter_highpass_3x3_u8_s16,         u8_s16,    0, 0),
+    RC_BMARK_ENTRY(rc_pixop_add_u16,                      u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_pixop_sub_u16,                      u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_pixop_suba_u16,                     u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_pixop_lut_u16_u8,                   u16_u8_p,  8, 0),
+    RC_BMARK_ENTRY(rc_thresh_gt_u16,                      u16_bin, 0x8000, 0),
+    RC_BMARK_ENTRY(rc_thresh_lt_u16,                      u16_bin, 0x8000, 0),
+    RC_BMARK_ENTRY(rc_stat_sum_u16,                       u16,       0, 0),
+    RC_BMARK_ENTRY(rc_stat_min_u16,                       u16,       0, 0),
+    RC_BMARK_ENTRY(rc_stat_max_u16,                       u16,       0, 0),
+    RC_BMARK_ENTRY(rc_reduce_2x2_u16,                     u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_filter_gauss_3x3_u16,               u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_filter_median_3x3_u16,              u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_filter_sobel_3x3_horz_u16,          u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_filter_sobel_3x3_horz_abs_u16,      u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_filter_sobel_3x3_vert_u16,          u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_filter_sobel_3x3_vert_abs_u16,      u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_filter_laplace_3x3_u16,             u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_filter_laplace_3x3_abs_u16,         u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_filter_highpass_3x3_u16,            u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_filter_highpass_3x3_abs_u16,        u16_u16,   0, 0),
+    RC_BMARK_ENTRY(rc_stat_hist_u8,                       u8_hist,   0, 0),
+    RC_BMARK_ENTRY(rc_stat_hist_mask_u8,                  u8_bin_hist, 0, 0),
+    RC_BMARK_ENTRY(rc_stat_sum_mask_u8,                   u8_bin_hist, 0, 0),
+    RC_BMARK_ENTRY(rc_stat_sum2_mask_u8,                  u8_bin_hist, 0, 0),
+    RC_BMARK_ENTRY(rc_stat_min_mask_u8,                   u8_bin_hist, 0, 0),
+    RC_BMARK_ENTRY(rc_stat_max_mask_u8,                   u8_bin_hist, 0, 0),
+    RC_BMARK_ENTRY(rc_stat_minmax_loc_bin,                bin_loc,   0, 0),
+    RC_BMARK_ENTRY(rc_stat_minmax_loc_u8,                 u8_loc,    0, 0),
+    RC_BMARK_ENTRY(rc_stat_max_k_u8,                      u8_max_k,  16, 0),
+    RC_BMARK_ENTRY(rc_stat_tiles_u8,                      u8_tiles,  16, 16),
+    RC_BMARK_ENTRY(rc_stat_sad_u8,                        u8_u8,     0, 0),
+    RC_BMARK_ENTRY(rc_stat_ssd_u8,                        u8_u8,     0, 0),
+    RC_BMARK_ENTRY(rc_stat_ssim_u8,                       u8_u8_p,   0, 0),
+    RC_BMARK_ENTRY(rc_motion_sad_u8,                      motion_sad, 16, 0),
+    RC_BMARK_ENTRY(rc_match_ssd_u8,                       motion_sad, 16, 0),
+    RC_BMARK_ENTRY(rc_match_mac_u8,                       match_mac, 16, 0),
+    RC_BMARK_ENTRY(rc_filter_census_3x3_u8,               u8_u8,     0, 0),
+    RC_BMARK_ENTRY(rc_filter_census_5x5_u8_u32,           u8_u32,    0, 0),
+    RC_BMARK_ENTRY(rc_filter_lbp_3x3_u8,                  u8_u8,     0, 0),
+    RC_BMARK_ENTRY(rc_filter_census_cost_u8,              census_cost, 5, 0),
+    RC_BMARK_ENTRY(rc_filter_census_cost_u32_u8,
+                   census_cost_u32, 5, 0),
+    RC_BMARK_ENTRY(rc_feature_fast_u8,                    u8_u8,    20, 0),
+    RC_BMARK_ENTRY(rc_feature_nms_u8,                     u8_u8,     0, 0),
+    RC_BMARK_ENTRY(rc_feature_harris_s16_s32,             harris,    0, 0),
+    RC_BMARK_ENTRY(rc_resize_horz_u8,                     resize,    2, 0),
+    RC_BMARK_ENTRY(rc_resize_vert_u8,                     resize,    2, 0),
+    RC_BMARK_ENTRY(rc_pixop_lerp_lut_u8,                  u8_lut2,   0, 0),
+    RC_BMARK_ENTRY(rc_thresh_absdiff_gt_u8,               u8_u8_bin, 0x40, 0),
+    /* Background modelling */
+    RC_BMARK_ENTRY(rc_bgmodel_update_u8,                  bgmean,    8, 0x20),
+    RC_BMARK_ENTRY(rc_bgmodel_update_dev_u8,              bgdev,     8, 0x10),
+    /* Edge detection */
+    RC_BMARK_ENTRY(rc_edge_nms_u8,                        u8_u8_u8,  0, 0),
+    /* 8-bit morphology */
+    RC_BMARK_ENTRY(rc_morph_erode_line_vert_u8,           line,      9, 0),
+    RC_BMARK_ENTRY(rc_morph_dilate_line_vert_u8,          line,      9, 0),
     /* Binary morphology */
     RC_BMARK_ENTRY(rc_morph_erode_line_1x2_bin,           bin_bin,   0, 0),
     RC_BMARK_ENTRY(rc_morph_dilate_line_1x2_bin,          bin_bin,   0, 0),
@@ -676,6 +835,7 @@ rc_bmark_setup(void *lib, int width, int height)
     int      offset;
     int      size;
     int      pad;
+    int      k;
 
     align = dlsym(lib, "rc_align");
     alloc = dlsym(lib, "rc_malloc");
@@ -695,7 +855,9 @@ rc_bmark_setup(void *lib, int width, int height)
      *  We assume that doubling the alignment is sufficient.
      */
     offset  = 2*align(offset / 2 + 1);
-    size    = MAX(dim_u8*(height + RC_BMARK_PADDING), rot_u8*width) + offset;
+
+    /* Make room for 16-bit destination images */
+    size    = MAX(2*dim_u8*(height + RC_BMARK_PADDING), rot_u8*width) + offset;
 
     rc_bmark_data.dst     = (*alloc)(size);
     rc_bmark_data.src     = (*alloc)(size);
@@ -715,11 +877,21 @@ rc_bmark_setup(void *lib, int width, int height)
     memset(rc_bmark_data.src, 0, size);
     memset(rc_bmark_data.aux, 0, size);
     memset(rc_bmark_data.aux2, 0, size);
+    memset(rc_bmark_kernel, 1, sizeof rc_bmark_kernel);
 
     memset(&rc_bmark_data.map[0], 0, size/3);
     memset(&rc_bmark_data.map[dim_bin * (height / 3)], 0xff, size/3);
     memset(&rc_bmark_data.map[dim_bin * (2 * height / 3)], 0x55, size/3);
 
+    /* Set up the resize tables for a 2x bilinear reduction */
+    rc_bmark_data.idx  = malloc(MAX(width, height)*sizeof(int));
+    rc_bmark_data.coef = malloc(2*MAX(width, height));
+    for (k = 0; k < MAX(width, height); k++) {
+        rc_bmark_data.idx[k]        = 2*k;
+        rc_bmark_data.coef[2*k]     = 64;
+        rc_bmark_data.coef[2*k + 1] = 64;
+    }
+
     rc_bmark_data.dst += offset;
     rc_bmark_data.src += offset;
     rc_bmark_data.aux += offset;
@@ -735,6 +907,8 @@ rc_bmark_cleanup(void)
     (*rc_bmark_data.release)(&rc_bmark_data.aux[-rc_bmark_data.offset]);
     (*rc_bmark_data.release)(&rc_bmark_data.aux2[-rc_bmark_data.offset]);
     (*rc_bmark_data.release)(&rc_bmark_data.map[-rc_bmark_data.offset]);
+    free(rc_bmark_data.idx);
+    free(rc_bmark_data.coef);
 }
 
 static void
@@ -909,3 +1083,278 @@ rc_bmark_exec_thresh_pixel(int (*func)(), const int *args)
                 rc_bmark_data.width, rc_bmark_data.height);
     }
 }
+
+static void
+rc_bmark_exec_conv(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.dst,   rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            rc_bmark_kernel, args[0], args[1], 8);
+}
+
+static void
+rc_bmark_exec_sep(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.dst,   rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            rc_bmark_kernel, args[0], 4,
+            rc_bmark_kernel, args[1], 4,
+            rc_bmark_data.aux + RC_BMARK_PADDING);
+}
+
+static void
+rc_bmark_exec_line(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.dst,   rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height, args[0],
+            rc_bmark_data.aux);
+}
+
+static void
+rc_bmark_exec_u8_u8_u8(int (*func)(), const int *args)
+{
+    (void)args;
+    (*func)(rc_bmark_data.dst,   rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.aux,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height);
+}
+
+static void
+rc_bmark_exec_u8_s16(int (*func)(), const int *args)
+{
+    (void)args;
+    (*func)(rc_bmark_data.dst,   2*rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height);
+}
+
+static void
+rc_bmark_exec_grad(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.dst,   args[1]*rc_bmark_data.dim_u8,
+            rc_bmark_data.aux,   args[1]*rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height, args[0]);
+}
+
+static void
+rc_bmark_exec_u16(int (*func)(), const int *args)
+{
+    (void)args;
+    (*func)(rc_bmark_data.dst,   2*rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height);
+}
+
+static void
+rc_bmark_exec_u16_u16(int (*func)(), const int *args)
+{
+    (void)args;
+    (*func)(rc_bmark_data.dst,   2*rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   2*rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height);
+}
+
+static void
+rc_bmark_exec_u16_bin(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.dst,   rc_bmark_data.dim_bin,
+            rc_bmark_data.src,   2*rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            args[0]);
+}
+
+static void
+rc_bmark_exec_u16_u8_p(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.dst,   rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   2*rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            rc_bmark_data.aux,   args[0]);
+}
+
+static void
+rc_bmark_exec_u8_hist(int (*func)(), const int *args)
+{
+    (void)args;
+    (*func)(rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            rc_bmark_data.aux);
+}
+
+static void
+rc_bmark_exec_u8_bin_hist(int (*func)(), const int *args)
+{
+    (void)args;
+    (*func)(rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.map,   rc_bmark_data.dim_bin,
+            rc_bmark_data.width, rc_bmark_data.height,
+            rc_bmark_data.aux);
+}
+
+static void
+rc_bmark_exec_bin_loc(int (*func)(), const int *args)
+{
+    int      minmax[2];
+    unsigned pos[4];
+    (void)args;
+    (*func)(rc_bmark_data.src,   rc_bmark_data.dim_bin,
+            rc_bmark_data.width, rc_bmark_data.height,
+            minmax, pos);
+}
+
+static void
+rc_bmark_exec_u8_loc(int (*func)(), const int *args)
+{
+    int      minmax[2];
+    unsigned pos[4];
+    (void)args;
+    (*func)(rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            minmax, pos);
+}
+
+static void
+rc_bmark_exec_u8_max_k(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            (unsigned*)rc_bmark_data.aux, args[0]);
+}
+
+static void
+rc_bmark_exec_u8_tiles(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            args[0], args[1],    (uint32_t*)rc_bmark_data.aux,
+            rc_bmark_data.aux2,  rc_bmark_data.dst);
+}
+
+static void
+rc_bmark_exec_u8_lut2(int (*func)(), const int *args)
+{
+    (void)args;
+    (*func)(rc_bmark_data.dst,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            rc_bmark_data.aux,   &rc_bmark_data.aux[256],
+            rc_bmark_data.aux2);
+}
+
+static void
+rc_bmark_exec_u8_u8_bin(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.dst,   rc_bmark_data.dim_bin,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.aux,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            args[0]);
+}
+
+static void
+rc_bmark_exec_bgmean(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.aux2,  rc_bmark_data.dim_bin,
+            rc_bmark_data.dst,   rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            args[0], args[1]);
+}
+
+static void
+rc_bmark_exec_bgdev(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.aux2,  rc_bmark_data.dim_bin,
+            rc_bmark_data.dst,   rc_bmark_data.dim_u8,
+            rc_bmark_data.aux,   rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height,
+            args[0], args[1]);
+}
+
+static void
+rc_bmark_exec_motion_sad(int (*func)(), const int *args)
+{
+    int size = args[0];
+    int x, y;
+
+    /* Match all blocks against misaligned reference blocks */
+    for (y = 0; y + size <= rc_bmark_data.height; y += size) {
+        for (x = 0; x + size < rc_bmark_data.width; x += size) {
+            int blk = y*rc_bmark_data.dim_u8 + x;
+            (*func)(&rc_bmark_data.src[blk],     rc_bmark_data.dim_u8,
+                    &rc_bmark_data.dst[blk + 1], rc_bmark_data.dim_u8,
+                    size, size, UINT32_MAX);
+        }
+    }
+}
+
+static void
+rc_bmark_exec_match_mac(int (*func)(), const int *args)
+{
+    int size = args[0];
+    int x, y;
+
+    /* Correlate all blocks with misaligned reference blocks */
+    for (y = 0; y + size <= rc_bmark_data.height; y += size) {
+        for (x = 0; x + size < rc_bmark_data.width; x += size) {
+            int blk = y*rc_bmark_data.dim_u8 + x;
+            (*func)(&rc_bmark_data.src[blk],     rc_bmark_data.dim_u8,
+                    &rc_bmark_data.dst[blk + 1], rc_bmark_data.dim_u8,
+                    size, size);
+        }
+    }
+}
+
+static void
+rc_bmark_exec_u8_u32(int (*func)(), const int *args)
+{
+    /* Use half the height to fit the 32-bit destination */
+    (void)args;
+    (*func)(rc_bmark_data.dst,   4*rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height / 2);
+}
+
+static void
+rc_bmark_exec_census_cost(int (*func)(), const int *args)
+{
+    (*func)(rc_bmark_data.dst,   rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   rc_bmark_data.dim_u8,
+            rc_bmark_data.aux,   rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height, (int)args[0]);
+}
+
+static void
+rc_bmark_exec_census_cost_u32(int (*func)(), const int *args)
+{
+    /* Use half the height to fit the 32-bit sources */
+    (*func)(rc_bmark_data.dst,   rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   4*rc_bmark_data.dim_u8,
+            rc_bmark_data.aux,   4*rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height / 2, (int)args[0]);
+}
+
+static void
+rc_bmark_exec_harris(int (*func)(), const int *args)
+{
+    /* Use half the height to fit the 32-bit destination */
+    (void)args;
+    (*func)(rc_bmark_data.dst,   4*rc_bmark_data.dim_u8,
+            rc_bmark_data.src,   2*rc_bmark_data.dim_u8,
+            rc_bmark_data.aux,   2*rc_bmark_data.dim_u8,
+            rc_bmark_data.width, rc_bmark_data.height / 2);
+}
+
+static void
+rc_bmark_exec_resize(int (*func)(), const int *args)
+{
+    /* Use half the width and height, as set up in the tables */
+    (*func)(rc_bmark_data.dst,       rc_bmark_data.dim_u8,
+            rc_bmark_data.src,       rc_bmark_data.dim_u8,
+            rc_bmark_data.width / 2, rc_bmark_data.height / 2,
+            rc_bmark_data.idx,       rc_bmark_data.coef, args[0]);
+}
@@ -0,0 +1,243 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_bgmodel.c
+ *  @brief  RAPP Compute layer background modelling, vector implementation.
+ *
+ *  One vector of the foreground mask covers eight pixel vectors. It is
+ *  loaded before any of the new mask words in it are stored, and the
+ *  update condition for each pixel vector is expanded from it with
+ *  RC_VEC_SETMASKV() in the same way as for the conditional operations.
+ *  The new foreground mask is packed with RC_VEC_GETMASKW() into a word
+ *  accumulator as in the pixelwise thresholding.
+ */
+
+#include <stdlib.h>      /* NULL                  */
+#include "rc_impl_cfg.h" /* Implementation config */
+#include "rc_vector.h"   /* Vector operations     */
+#include "rc_word.h"     /* Word operations       */
+#include "rc_util.h"     /* RC_DIV_CEIL()         */
+#include "rc_bgmodel.h"  /* Background API        */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Bitwise select dstv = maskv ? srcv2 : srcv1.
+ */
+#define RC_BGMODEL_SELECT(dstv, srcv1, srcv2, maskv) \
+do {                                                 \
+    rc_vec_t t1_, t2_;                               \
+    RC_VEC_ANDNOT(t1_, srcv1, maskv);                \
+    RC_VEC_AND(t2_, srcv2, maskv);                   \
+    RC_VEC_OR(dstv, t1_, t2_);                       \
+} while (0)
+
+/**
+ *  Mean update iteration.
+ */
+#define RC_BGMODEL_MEAN(acc, pos, fgv, src, i, mean, m, dev, n, \
+                        thrv, alpha8, blendv)                   \
+do {                                                            \
+    rc_vec_t sv_, av_, uv_, cv_;                                \
+    unsigned mask_;                                             \
+    RC_VEC_LOAD(sv_, &(src)[i]);                                \
+    RC_VEC_LOAD(av_, &(mean)[m]);                               \
+    RC_VEC_SUBA(cv_, sv_, av_);                                 \
+    RC_VEC_CMPGT(cv_, cv_, thrv);                               \
+    RC_VEC_GETMASKW(mask_, cv_);                                \
+    (acc) |= RC_WORD_INSERT(mask_, pos, RC_VEC_SIZE);           \
+    RC_VEC_LERPN(uv_, av_, sv_, alpha8, blendv);                \
+    RC_BGMODEL_SELECT(av_, uv_, av_, fgv);                      \
+    RC_VEC_STORE(&(mean)[m], av_);                              \
+    (void)(dev);                                                \
+} while (0)
+
+/**
+ *  Mean and deviation update iteration.
+ */
+#define RC_BGMODEL_DEV(acc, pos, fgv, src, i, mean, m, dev, n, \
+                       thrv, alpha8, blendv)                   \
+do {                                                           \
+    rc_vec_t sv_, av_, dv_, ev_, uv_, cv_;                     \
+    unsigned mask_;                                            \
+    RC_VEC_LOAD(sv_, &(src)[i]);                               \
+    RC_VEC_LOAD(av_, &(mean)[m]);                              \
+    RC_VEC_LOAD(dv_, &(dev)[n]);                               \
+    RC_VEC_SUBA(ev_, sv_, av_);                                \
+    RC_VEC_ADDS(cv_, thrv, dv_);                               \
+    RC_VEC_ADDS(cv_, cv_, dv_);                                \
+    RC_VEC_CMPGT(cv_, ev_, cv_);                               \
+    RC_VEC_GETMASKW(mask_, cv_);                               \
+    (acc) |= RC_WORD_INSERT(mask_, pos, RC_VEC_SIZE);          \
+    RC_VEC_LERPN(uv_, av_, sv_, alpha8, blendv);               \
+    RC_BGMODEL_SELECT(av_, uv_, av_, fgv);                     \
+    RC_VEC_STORE(&(mean)[m], av_);                             \
+    RC_VEC_LERPN(uv_, dv_, ev_, alpha8, blendv);               \
+    RC_BGMODEL_SELECT(dv_, uv_, dv_, fgv);                     \
+    RC_VEC_STORE(&(dev)[n], dv_);                              \
+} while (0)
+
+/**
+ *  Update the pixel vectors covered by one vector of the foreground
+ *  mask. The old mask vector is loaded before any new mask words are
+ *  stored over it.
+ */
+#define RC_BGMODEL_BLOCK(fg, j, src, i, mean, m, dev, n, num,          \
+                         thrv, alpha8, blendv, iter)                   \
+do {                                                                   \
+    rc_word_t acc_ = RC_WORD_ZERO;                                     \
+    rc_vec_t  mv_;                                                     \
+    int       k_;                                                      \
+                                                                       \
+    RC_VEC_LOAD(mv_, &(fg)[j]);                                        \
+    for (k_ = 0; k_ < (num); k_++) {                                   \
+        int      pos_ = k_*RC_VEC_SIZE % (8*RC_WORD_SIZE);             \
+        rc_vec_t fgv_, tv_;                                            \
+                                                                       \
+        /* Expand the update condition from the old mask */            \
+        RC_VEC_SETMASKV(fgv_, mv_);                                    \
+        RC_VEC_SHLC(tv_, mv_, RC_VEC_SIZE / 8);                        \
+        mv_ = tv_;                                                     \
+                                                                       \
+        iter(acc_, pos_, fgv_, src, i, mean, m, dev, n,                \
+             thrv, alpha8, blendv);                                    \
+        (i) += RC_VEC_SIZE;                                            \
+        (m) += RC_VEC_SIZE;                                            \
+        (n) += RC_VEC_SIZE;                                            \
+                                                                       \
+        /* Store full words and the last partial word */               \
+        if (pos_ + RC_VEC_SIZE == 8*RC_WORD_SIZE || k_ == (num) - 1) { \
+            RC_WORD_STORE(&(fg)[j], acc_);                             \
+            (j) += RC_WORD_SIZE;                                       \
+            acc_ = RC_WORD_ZERO;                                       \
+        }                                                              \
+    }                                                                  \
+} while (0)
+
+/**
+ *  Background update template.
+ *  The caller needs to wrap this in a
+ *  RC_VEC_DECLARE() / RC_VEC_CLEANUP() pair.
+ */
+#define RC_BGMODEL_TEMPLATE(fg, fg_dim, mean, mean_dim, dev, dev_dim,  \
+                            src, src_dim, width, height,               \
+                            alpha8, thresh, iter)                      \
+do {                                                                   \
+    int      tot_ = RC_DIV_CEIL(width, RC_VEC_SIZE);                   \
+    int      len_ = tot_ / 8;                                          \
+    int      rem_ = tot_ % 8;                                          \
+    rc_vec_t thrv_, blendv_;                                           \
+    int      y_;                                                       \
+                                                                       \
+    RC_VEC_SPLAT(thrv_, thresh);                                       \
+    RC_VEC_BLENDN(blendv_, alpha8);                                    \
+                                                                       \
+    for (y_ = 0; y_ < (height); y_++) {                                \
+        int i_ = y_*(src_dim);                                         \
+        int j_ = y_*(fg_dim);                                          \
+        int m_ = y_*(mean_dim);                                        \
+        int n_ = y_*(dev_dim);                                         \
+        int x_;                                                        \
+                                                                       \
+        /* Handle all full mask vectors */                             \
+        for (x_ = 0; x_ < len_; x_++) {                                \
+            RC_BGMODEL_BLOCK(fg, j_, src, i_, mean, m_, dev, n_, 8,    \
+                             thrv_, alpha8, blendv_, iter);            \
+        }                                                              \
+                                                                       \
+        /* Handle the partial mask vector */                           \
+        if (rem_) {                                                    \
+            RC_BGMODEL_BLOCK(fg, j_, src, i_, mean, m_, dev, n_, rem_, \
+                             thrv_, alpha8, blendv_, iter);            \
+        }                                                              \
+    }                                                                  \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+#if RC_VEC_SIZE >= RC_WORD_SIZE                          && \
+    defined RC_VEC_SETMASKV && defined RC_VEC_GETMASKW && \
+    defined RC_VEC_SHLC     && defined RC_VEC_SPLAT    && \
+    defined RC_VEC_SUBA     && defined RC_VEC_CMPGT    && \
+    defined RC_VEC_LERPN    && defined RC_VEC_BLENDN   && \
+    defined RC_VEC_ANDNOT   && defined RC_VEC_AND      && \
+    defined RC_VEC_OR
+
+/**
+ *  Background mean update.
+ */
+#if RC_IMPL(rc_bgmodel_update_u8, 0)
+void
+rc_bgmodel_update_u8(uint8_t *restrict fg, int fg_dim,
+                     uint8_t *restrict mean, int mean_dim,
+                     const uint8_t *restrict src, int src_dim,
+                     int width, int height, unsigned alpha8,
+                     unsigned thresh)
+{
+    uint8_t *dev = NULL;
+    RC_VEC_DECLARE();
+    RC_BGMODEL_TEMPLATE(fg, fg_dim, mean, mean_dim, dev, 0,
+                        src, src_dim, width, height,
+                        alpha8, thresh, RC_BGMODEL_MEAN);
+    RC_VEC_CLEANUP();
+}
+#endif
+
+/**
+ *  Background mean and deviation update.
+ */
+#if RC_IMPL(rc_bgmodel_update_dev_u8, 0)
+#ifdef RC_VEC_ADDS
+void
+rc_bgmodel_update_dev_u8(uint8_t *restrict fg, int fg_dim,
+                         uint8_t *restrict mean, int mean_dim,
+                         uint8_t *restrict dev, int dev_dim,
+                         const uint8_t *restrict src, int src_dim,
+                         int width, int height, unsigned alpha8,
+                         unsigned thresh)
+{
+    RC_VEC_DECLARE();
+    RC_BGMODEL_TEMPLATE(fg, fg_dim, mean, mean_dim, dev, dev_dim,
+                        src, src_dim, width, height,
+                        alpha8, thresh, RC_BGMODEL_DEV);
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+#endif /* RC_VEC_SIZE >= RC_WORD_SIZE && ... */
@@ -0,0 +1,172 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_edge.c
+ *  @brief  RAPP Compute layer edge detection, vector implementation.
+ *
+ *  The non-maximum suppression gathers all eight neighbours of a vector
+ *  with the sliding three-row window used by the 3x3 filters. The two
+ *  bits of the orientation code are expanded to full field masks, and
+ *  the neighbours before and after each pixel are then selected with
+ *  two levels of bitwise blending. The comparison masks are expanded in
+ *  the same way to clear the suppressed pixels.
+ */
+
+#include "rc_impl_cfg.h" /* Implementation config */
+#include "rc_vector.h"   /* Vector operations     */
+#include "rc_util.h"     /* RC_DIV_CEIL()         */
+#include "rc_edge.h"     /* Edge detection API    */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Expand the most significant bit of each field to the full field.
+ */
+#define RC_EDGE_MASK(dstv, srcv, msbv) \
+do {                                   \
+    RC_VEC_AND(dstv, srcv, msbv);      \
+    RC_VEC_ADDS(dstv, dstv, dstv);     \
+} while (0)
+
+/**
+ *  Bitwise select dstv = maskv ? srcv2 : srcv1.
+ */
+#define RC_EDGE_SELECT(dstv, srcv1, srcv2, maskv) \
+do {                                              \
+    rc_vec_t t1_, t2_;                            \
+    RC_VEC_ANDNOT(t1_, srcv1, maskv);             \
+    RC_VEC_AND(t2_, srcv2, maskv);                \
+    RC_VEC_OR(dstv, t1_, t2_);                    \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Non-maximum suppression.
+ */
+#if RC_IMPL(rc_edge_nms_u8, 0)
+#if defined RC_VEC_ALIGNC && defined RC_VEC_CMPGT && \
+    defined RC_VEC_CMPGE  && defined RC_VEC_ANDNOT
+void
+rc_edge_nms_u8(uint8_t *restrict dst, int dst_dim,
+               const uint8_t *restrict mag, int mag_dim,
+               const uint8_t *restrict dir, int dir_dim,
+               int width, int height)
+{
+    int      len = RC_VEC_SIZE*RC_DIV_CEIL(width, RC_VEC_SIZE);
+    rc_vec_t msbv, bit0v, bit1v, add0v, add1v;
+    int      y;
+    RC_VEC_DECLARE();
+
+    RC_VEC_SPLAT(msbv,  0x80);
+    RC_VEC_SPLAT(bit0v, 1);
+    RC_VEC_SPLAT(bit1v, 2);
+    RC_VEC_SPLAT(add0v, 0x7f);
+    RC_VEC_SPLAT(add1v, 0x7e);
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *mp = &mag[y*mag_dim];
+        rc_vec_t       u1, u2, u3, m1, m2, m3, d1, d2, d3;
+        int            x;
+
+        /* Initialize the sliding window */
+        RC_VEC_LOAD(u1, &mp[-mag_dim - RC_VEC_SIZE]);
+        RC_VEC_LOAD(u2, &mp[-mag_dim]);
+        RC_VEC_LOAD(m1, &mp[-RC_VEC_SIZE]);
+        RC_VEC_LOAD(m2, &mp[0]);
+        RC_VEC_LOAD(d1, &mp[mag_dim - RC_VEC_SIZE]);
+        RC_VEC_LOAD(d2, &mp[mag_dim]);
+
+        for (x = 0; x < len; x += RC_VEC_SIZE) {
+            rc_vec_t ul, ur, ml, mr, dl, dr;
+            rc_vec_t cv, s0v, s1v, lov, hiv, prev, next, gtv, gev;
+
+            /* Load the next vectors */
+            RC_VEC_LOAD(u3, &mp[x - mag_dim + RC_VEC_SIZE]);
+            RC_VEC_LOAD(m3, &mp[x + RC_VEC_SIZE]);
+            RC_VEC_LOAD(d3, &mp[x + mag_dim + RC_VEC_SIZE]);
+
+            /* Get the left and right neighbours */
+            RC_VEC_ALIGNC(ul, u1, u2, RC_VEC_SIZE - 1);
+            RC_VEC_ALIGNC(ur, u2, u3, 1);
+            RC_VEC_ALIGNC(ml, m1, m2, RC_VEC_SIZE - 1);
+            RC_VEC_ALIGNC(mr, m2, m3, 1);
+            RC_VEC_ALIGNC(dl, d1, d2, RC_VEC_SIZE - 1);
+            RC_VEC_ALIGNC(dr, d2, d3, 1);
+
+            /* Expand the orientation code bits to full masks */
+            RC_VEC_LOAD(cv, &dir[y*dir_dim + x]);
+            RC_VEC_AND(s0v, cv, bit0v);
+            RC_VEC_ADDS(s0v, s0v, add0v);
+            RC_EDGE_MASK(s0v, s0v, msbv);
+            RC_VEC_AND(s1v, cv, bit1v);
+            RC_VEC_ADDS(s1v, s1v, add1v);
+            RC_EDGE_MASK(s1v, s1v, msbv);
+
+            /* Select the neighbour before the pixel */
+            RC_EDGE_SELECT(lov,  ml,  ul,  s0v);
+            RC_EDGE_SELECT(hiv,  u2,  ur,  s0v);
+            RC_EDGE_SELECT(prev, lov, hiv, s1v);
+
+            /* Select the neighbour after the pixel */
+            RC_EDGE_SELECT(lov,  mr,  dr,  s0v);
+            RC_EDGE_SELECT(hiv,  d2,  dl,  s0v);
+            RC_EDGE_SELECT(next, lov, hiv, s1v);
+
+            /* Keep the local maxima */
+            RC_VEC_CMPGT(gtv, m2, prev);
+            RC_VEC_CMPGE(gev, m2, next);
+            RC_VEC_AND(gtv, gtv, gev);
+            RC_EDGE_MASK(gtv, gtv, msbv);
+            RC_VEC_AND(gtv, gtv, m2);
+            RC_VEC_STORE(&dst[y*dst_dim + x], gtv);
+
+            /* Slide the window */
+            u1 = u2;
+            u2 = u3;
+            m1 = m2;
+            m2 = m3;
+            d1 = d2;
+            d2 = d3;
+        }
+    }
+
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
@@ -0,0 +1,328 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_feature.c
+ *  @brief  RAPP Compute layer feature detection, vector implementation.
+ *
+ *  The FAST segment test keeps the saturated differences of all sixteen
+ *  circle pixels in vectors. The circle pixels are taken from aligned
+ *  loads of the three vectors around each row with RC_VEC_ALIGNC(). The
+ *  four compass pixels are loaded first. If no field of the best compass
+ *  pair minimum is greater than the threshold, the comparison mask
+ *  extracted with RC_VEC_GETMASKW() is zero, and the vector is rejected
+ *  without loading the remaining pixels. Otherwise the minima over all
+ *  arcs of nine pixels are computed by doubling, i.e. from the minima
+ *  over two, four and eight pixels, with 80 min/max operations for
+ *  each polarity.
+ *
+ *  The non-maximum suppression uses the sliding three-row window of
+ *  the 3x3 filters, and clears the suppressed pixels with expanded
+ *  comparison masks.
+ */
+
+#include "rc_impl_cfg.h" /* Implementation config */
+#include "rc_vector.h"   /* Vector operations     */
+#include "rc_util.h"     /* RC_DIV_CEIL()         */
+#include "rc_feature.h"  /* Feature API           */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Load the pixels dx to the left and to the right of the aligned
+ *  vector at ptr.
+ */
+#define RC_FEATURE_LOAD_LR(lv, rv, ptr, dx)          \
+do {                                                 \
+    rc_vec_t pv_, cv_, nv_;                          \
+    RC_VEC_LOAD(pv_, &(ptr)[-RC_VEC_SIZE]);          \
+    RC_VEC_LOAD(cv_, ptr);                           \
+    RC_VEC_LOAD(nv_, &(ptr)[RC_VEC_SIZE]);           \
+    RC_VEC_ALIGNC(lv, pv_, cv_, RC_VEC_SIZE - (dx)); \
+    RC_VEC_ALIGNC(rv, cv_, nv_, dx);                 \
+} while (0)
+
+/**
+ *  Compute the saturated differences of circle pixel k from the
+ *  center vector cv, for both polarities.
+ */
+#define RC_FEATURE_FAST_DIFF(bv, dv, k, pv, cv) \
+do {                                            \
+    RC_VEC_SUBS((bv)[k], pv, cv);               \
+    RC_VEC_SUBS((dv)[k], cv, pv);               \
+} while (0)
+
+/**
+ *  Update sv with the maximum of the compass pair minima.
+ */
+#define RC_FEATURE_FAST_COMPASS(sv, dv)        \
+do {                                           \
+    rc_vec_t m1_, m2_;                         \
+    RC_VEC_MIN(m1_, (dv)[0],  (dv)[4]);        \
+    RC_VEC_MIN(m2_, (dv)[4],  (dv)[8]);        \
+    RC_VEC_MAX(sv, sv, m1_);                   \
+    RC_VEC_MAX(sv, sv, m2_);                   \
+    RC_VEC_MIN(m1_, (dv)[8],  (dv)[12]);       \
+    RC_VEC_MIN(m2_, (dv)[12], (dv)[0]);        \
+    RC_VEC_MAX(sv, sv, m1_);                   \
+    RC_VEC_MAX(sv, sv, m2_);                   \
+} while (0)
+
+/**
+ *  Update sv with the maximum over all arcs of nine pixels of the
+ *  minimum difference in the arc.
+ */
+#define RC_FEATURE_FAST_ARC(sv, dv)                          \
+do {                                                         \
+    rc_vec_t m2_[16], m4_[16];                               \
+    int      k_;                                             \
+    for (k_ = 0; k_ < 16; k_++) {                            \
+        RC_VEC_MIN(m2_[k_], (dv)[k_], (dv)[(k_ + 1) & 15]);  \
+    }                                                        \
+    for (k_ = 0; k_ < 16; k_++) {                            \
+        RC_VEC_MIN(m4_[k_], m2_[k_], m2_[(k_ + 2) & 15]);    \
+    }                                                        \
+    for (k_ = 0; k_ < 16; k_++) {                            \
+        rc_vec_t a_;                                         \
+        RC_VEC_MIN(a_, m4_[k_], m4_[(k_ + 4) & 15]);         \
+        RC_VEC_MIN(a_, a_, (dv)[(k_ + 8) & 15]);             \
+        RC_VEC_MAX(sv, sv, a_);                              \
+    }                                                        \
+} while (0)
+
+/**
+ *  Get the mask word of the fields in srcv that are greater than
+ *  the threshold. The limit vector limv holds the threshold plus
+ *  RC_FEATURE_FAST_BIAS. Without mask extraction nothing is rejected.
+ */
+#if defined RC_VEC_CMPGE && \
+   (defined RC_VEC_HINT_CMPGE || !defined RC_VEC_CMPGT)
+#define RC_FEATURE_FAST_BIAS 1
+#define RC_FEATURE_FAST_CMP(dstv, srcv, limv) \
+    RC_VEC_CMPGE(dstv, srcv, limv)
+#elif defined RC_VEC_CMPGT
+#define RC_FEATURE_FAST_BIAS 0
+#define RC_FEATURE_FAST_CMP(dstv, srcv, limv) \
+    RC_VEC_CMPGT(dstv, srcv, limv)
+#endif
+
+#if defined RC_FEATURE_FAST_CMP && defined RC_VEC_GETMASKW
+#define RC_FEATURE_FAST_MASK(mask, srcv, limv) \
+do {                                           \
+    rc_vec_t cmp_;                             \
+    RC_FEATURE_FAST_CMP(cmp_, srcv, limv);     \
+    RC_VEC_GETMASKW(mask, cmp_);               \
+} while (0)
+#else
+#undef  RC_FEATURE_FAST_BIAS
+#define RC_FEATURE_FAST_BIAS 0
+#define RC_FEATURE_FAST_MASK(mask, srcv, limv) \
+    ((void)(limv), (mask) = 1)
+#endif
+
+/**
+ *  Expand the most significant bit of each field to the full field.
+ */
+#define RC_FEATURE_MASK(dstv, srcv, msbv) \
+do {                                      \
+    RC_VEC_AND(dstv, srcv, msbv);         \
+    RC_VEC_ADDS(dstv, dstv, dstv);        \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  FAST corner score.
+ */
+#if RC_IMPL(rc_feature_fast_u8, 0)
+#if defined RC_VEC_ALIGNC && defined RC_VEC_MIN && defined RC_VEC_MAX
+void
+rc_feature_fast_u8(uint8_t *restrict dst, int dst_dim,
+                   const uint8_t *restrict src, int src_dim,
+                   int width, int height, int thresh)
+{
+    int      len = RC_VEC_SIZE*RC_DIV_CEIL(width, RC_VEC_SIZE);
+    rc_vec_t zerov, thrv, limv;
+    int      y;
+    RC_VEC_DECLARE();
+
+    RC_VEC_ZERO(zerov);
+    RC_VEC_SPLAT(thrv, thresh);
+    RC_VEC_SPLAT(limv, thresh + RC_FEATURE_FAST_BIAS);
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *sp = &src[y*src_dim];
+        int            x;
+
+        for (x = 0; x < len; x += RC_VEC_SIZE) {
+            const uint8_t *ptr = &sp[x];
+            rc_vec_t       bv[16], dv[16];
+            rc_vec_t       cv, lv, rv, sv;
+            unsigned       mask;
+
+            /* Compute the differences of the compass pixels */
+            RC_VEC_LOAD(cv, ptr);
+            RC_VEC_LOAD(lv, &ptr[-3*src_dim]);
+            RC_VEC_LOAD(rv, &ptr[3*src_dim]);
+            RC_FEATURE_FAST_DIFF(bv, dv, 0, lv, cv);
+            RC_FEATURE_FAST_DIFF(bv, dv, 8, rv, cv);
+            RC_FEATURE_LOAD_LR(lv, rv, ptr, 3);
+            RC_FEATURE_FAST_DIFF(bv, dv, 12, lv, cv);
+            RC_FEATURE_FAST_DIFF(bv, dv, 4,  rv, cv);
+
+            /* Reject the vector if no compass pair passes the test */
+            sv = zerov;
+            RC_FEATURE_FAST_COMPASS(sv, bv);
+            RC_FEATURE_FAST_COMPASS(sv, dv);
+            RC_FEATURE_FAST_MASK(mask, sv, limv);
+            if (!mask) {
+                RC_VEC_STORE(&dst[y*dst_dim + x], zerov);
+                continue;
+            }
+
+            /* Compute the differences of the remaining pixels */
+            RC_FEATURE_LOAD_LR(lv, rv, &ptr[-3*src_dim], 1);
+            RC_FEATURE_FAST_DIFF(bv, dv, 15, lv, cv);
+            RC_FEATURE_FAST_DIFF(bv, dv, 1,  rv, cv);
+            RC_FEATURE_LOAD_LR(lv, rv, &ptr[-2*src_dim], 2);
+            RC_FEATURE_FAST_DIFF(bv, dv, 14, lv, cv);
+            RC_FEATURE_FAST_DIFF(bv, dv, 2,  rv, cv);
+            RC_FEATURE_LOAD_LR(lv, rv, &ptr[-src_dim], 3);
+            RC_FEATURE_FAST_DIFF(bv, dv, 13, lv, cv);
+            RC_FEATURE_FAST_DIFF(bv, dv, 3,  rv, cv);
+            RC_FEATURE_LOAD_LR(lv, rv, &ptr[src_dim], 3);
+            RC_FEATURE_FAST_DIFF(bv, dv, 11, lv, cv);
+            RC_FEATURE_FAST_DIFF(bv, dv, 5,  rv, cv);
+            RC_FEATURE_LOAD_LR(lv, rv, &ptr[2*src_dim], 2);
+            RC_FEATURE_FAST_DIFF(bv, dv, 10, lv, cv);
+            RC_FEATURE_FAST_DIFF(bv, dv, 6,  rv, cv);
+            RC_FEATURE_LOAD_LR(lv, rv, &ptr[3*src_dim], 1);
+            RC_FEATURE_FAST_DIFF(bv, dv, 9,  lv, cv);
+            RC_FEATURE_FAST_DIFF(bv, dv, 7,  rv, cv);
+
+            /* Compute the score */
+            sv = zerov;
+            RC_FEATURE_FAST_ARC(sv, bv);
+            RC_FEATURE_FAST_ARC(sv, dv);
+            RC_VEC_SUBS(sv, sv, thrv);
+            RC_VEC_STORE(&dst[y*dst_dim + x], sv);
+        }
+    }
+
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+/**
+ *  Non-maximum suppression of a score image.
+ */
+#if RC_IMPL(rc_feature_nms_u8, 0)
+#if defined RC_VEC_ALIGNC && defined RC_VEC_CMPGT && \
+    defined RC_VEC_CMPGE  && defined RC_VEC_MAX
+void
+rc_feature_nms_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height)
+{
+    int      len = RC_VEC_SIZE*RC_DIV_CEIL(width, RC_VEC_SIZE);
+    rc_vec_t msbv;
+    int      y;
+    RC_VEC_DECLARE();
+
+    RC_VEC_SPLAT(msbv, 0x80);
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *sp = &src[y*src_dim];
+        rc_vec_t       u1, u2, u3, m1, m2, m3, d1, d2, d3;
+        int            x;
+
+        /* Initialize the sliding window */
+        RC_VEC_LOAD(u1, &sp[-src_dim - RC_VEC_SIZE]);
+        RC_VEC_LOAD(u2, &sp[-src_dim]);
+        RC_VEC_LOAD(m1, &sp[-RC_VEC_SIZE]);
+        RC_VEC_LOAD(m2, &sp[0]);
+        RC_VEC_LOAD(d1, &sp[src_dim - RC_VEC_SIZE]);
+        RC_VEC_LOAD(d2, &sp[src_dim]);
+
+        for (x = 0; x < len; x += RC_VEC_SIZE) {
+            rc_vec_t ul, ur, ml, mr, dl, dr;
+            rc_vec_t prev, next, gtv, gev;
+
+            /* Load the next vectors */
+            RC_VEC_LOAD(u3, &sp[x - src_dim + RC_VEC_SIZE]);
+            RC_VEC_LOAD(m3, &sp[x + RC_VEC_SIZE]);
+            RC_VEC_LOAD(d3, &sp[x + src_dim + RC_VEC_SIZE]);
+
+            /* Get the left and right neighbours */
+            RC_VEC_ALIGNC(ul, u1, u2, RC_VEC_SIZE - 1);
+            RC_VEC_ALIGNC(ur, u2, u3, 1);
+            RC_VEC_ALIGNC(ml, m1, m2, RC_VEC_SIZE - 1);
+            RC_VEC_ALIGNC(mr, m2, m3, 1);
+            RC_VEC_ALIGNC(dl, d1, d2, RC_VEC_SIZE - 1);
+            RC_VEC_ALIGNC(dr, d2, d3, 1);
+
+            /* Get the largest neighbours before and after the pixel */
+            RC_VEC_MAX(prev, ml, ul);
+            RC_VEC_MAX(prev, prev, u2);
+            RC_VEC_MAX(prev, prev, ur);
+            RC_VEC_MAX(next, mr, dl);
+            RC_VEC_MAX(next, next, d2);
+            RC_VEC_MAX(next, next, dr);
+
+            /* Keep the local maxima */
+            RC_VEC_CMPGT(gtv, m2, prev);
+            RC_VEC_CMPGE(gev, m2, next);
+            RC_VEC_AND(gtv, gtv, gev);
+            RC_FEATURE_MASK(gtv, gtv, msbv);
+            RC_VEC_AND(gtv, gtv, m2);
+            RC_VEC_STORE(&dst[y*dst_dim + x], gtv);
+
+            /* Slide the window */
+            u1 = u2;
+            u2 = u3;
+            m1 = m2;
+            m2 = m3;
+            d1 = d2;
+            d2 = d3;
+        }
+    }
+
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
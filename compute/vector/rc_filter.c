@@ -160,10 +160,45 @@
  *  is possible to use different combinations of AVGT/AVGR and SUBHT/SUBHR,
  *  the implementation will be determined by the RC_VEC_HINT_* mechanism
  *  of the vector interface.
+ *
+ *  The user-kernel convolutions are the exception to the 8-bit rule.
+ *  They accumulate the products in 16-bit fields using the widening
+ *  multiply-accumulate operation RC_VEC_MACW(), and then round and
+ *  saturate the result with RC_VEC_PACKW(). The horizontally displaced
+ *  vectors are produced from the previous, current and next vectors
+ *  in the same way as for the 3x3 filters.
+ *
+ *  The signed 16-bit filter variants use the same widening operations.
+ *  The kernels are given as compile-time constants to a common template,
+ *  so that only the nonzero taps are computed. The accumulators are
+ *  stored directly using RC_VEC_GETW(). The fused Sobel gradient
+ *  accumulates both components from the same three row loads.
+ *
+ *  The median filters are built on compare-exchange operations with
+ *  RC_VEC_MIN() and RC_VEC_MAX(). The 3x3 median uses the 3x3 template,
+ *  where the vertical component sorts each column. The 5x5 median keeps
+ *  the sorted columns of the previous, current and next vectors, so
+ *  that each column is sorted only once.
+ *
+ *  The census transforms and the local binary patterns compare the
+ *  horizontally displaced neighbour vectors to the center vector with
+ *  RC_VEC_CMPGT() or RC_VEC_CMPGE(), whichever is hinted. Each code
+ *  byte is built by shifting the comparison bits in from the most
+ *  significant end with an average against zero. If the hinted
+ *  comparison has the opposite sense, the code is inverted at the end.
+ *  The three code bytes of the 5x5 transform are interleaved to 32-bit
+ *  codes with RC_VEC_ZIPLO() and RC_VEC_ZIPHI(), where available.
+ *  The census costs count the bits of the XOR of the codes, either with
+ *  table lookups of the nibble bit counts using RC_VEC_SHUFFLE(), or
+ *  with shifts and masks. The second code image is read with misaligned
+ *  loads, and the bitcounts of 32-bit codes are summed and packed to
+ *  8 bits.
  */
 
+#include <string.h>      /* memset()           */
 #include "rc_impl_cfg.h" /* Implementation cfg */
 #include "rc_util.h"     /* RC_DIV_CEIL()      */
+#include "rc_table.h"    /* Bitcount table     */
 #include "rc_vector.h"   /* Vector API         */
 #include "rc_filter.h"   /* Fixed-filter API   */
 
@@ -825,6 +860,611 @@ do {                                                        \
 } while (0)
 
 
+/*
+ * -------------------------------------------------------------
+ *  User-kernel convolution macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Get the vector displaced by a signed field offset in the range
+ *  [-7, 7] from the current vector, using the previous and the next
+ *  vectors. The offset is not a compile-time constant.
+ */
+#if defined RC_VEC_ALIGNC && RC_VEC_SIZE >= 8
+#define RC_FILTER_CONV_ALIGN(dstv, prev, cur, next, off)                 \
+do {                                                                     \
+    switch (off) {                                                       \
+        case -7: RC_VEC_ALIGNC(dstv, prev, cur, RC_VEC_SIZE - 7); break; \
+        case -6: RC_VEC_ALIGNC(dstv, prev, cur, RC_VEC_SIZE - 6); break; \
+        case -5: RC_VEC_ALIGNC(dstv, prev, cur, RC_VEC_SIZE - 5); break; \
+        case -4: RC_VEC_ALIGNC(dstv, prev, cur, RC_VEC_SIZE - 4); break; \
+        case -3: RC_VEC_ALIGNC(dstv, prev, cur, RC_VEC_SIZE - 3); break; \
+        case -2: RC_VEC_ALIGNC(dstv, prev, cur, RC_VEC_SIZE - 2); break; \
+        case -1: RC_VEC_ALIGNC(dstv, prev, cur, RC_VEC_SIZE - 1); break; \
+        default: (dstv) = (cur); break;                                  \
+        case  1: RC_VEC_ALIGNC(dstv, cur, next, 1); break;               \
+        case  2: RC_VEC_ALIGNC(dstv, cur, next, 2); break;               \
+        case  3: RC_VEC_ALIGNC(dstv, cur, next, 3); break;               \
+        case  4: RC_VEC_ALIGNC(dstv, cur, next, 4); break;               \
+        case  5: RC_VEC_ALIGNC(dstv, cur, next, 5); break;               \
+        case  6: RC_VEC_ALIGNC(dstv, cur, next, 6); break;               \
+        case  7: RC_VEC_ALIGNC(dstv, cur, next, 7); break;               \
+    }                                                                    \
+} while (0)
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Widening 3x3 macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The widening 3x3 convolution template with a constant kernel.
+ *  The kernel coefficients kij are compile-time constants in the
+ *  range [-0x80, 0x80], where kij is applied to the source pixel at
+ *  row offset i - 2 and column offset j - 2. Rows and columns with
+ *  zero coefficients only are never loaded.
+ */
+#if defined RC_VEC_ALIGNC && defined RC_VEC_COEF && \
+    defined RC_VEC_MACW   && defined RC_VEC_GETW
+#define RC_FILTER_WIDE_TEMPLATE(dst, dst_dim, src, src_dim, width, height, \
+                                k11, k12, k13, k21, k22, k23,              \
+                                k31, k32, k33)                             \
+do {                                                                       \
+    rc_vec_t c11, c12, c13, c21, c22, c23, c31, c32, c33;                  \
+    int      dim = (dst_dim) / (int)sizeof *(dst);                         \
+    int      tot = RC_DIV_CEIL(width, RC_VEC_SIZE);                        \
+    int      y;                                                            \
+                                                                           \
+    RC_VEC_DECLARE();                                                      \
+                                                                           \
+    /* Set up the coefficient vectors */                                   \
+    RC_VEC_COEF(c11, k11); RC_VEC_COEF(c12, k12); RC_VEC_COEF(c13, k13);   \
+    RC_VEC_COEF(c21, k21); RC_VEC_COEF(c22, k22); RC_VEC_COEF(c23, k23);   \
+    RC_VEC_COEF(c31, k31); RC_VEC_COEF(c32, k32); RC_VEC_COEF(c33, k33);   \
+                                                                           \
+    for (y = 0; y < (height); y++) {                                       \
+        int x;                                                             \
+        for (x = 0; x < tot; x++) {                                        \
+            const uint8_t *ptr = &(src)[y*(src_dim) + x*RC_VEC_SIZE];      \
+            int16_t       *out = &(dst)[y*dim + x*RC_VEC_SIZE];            \
+            rc_vec_t       acc1, acc2, dv1, dv2;                           \
+                                                                           \
+            RC_VEC_ZERO(acc1);                                             \
+            RC_VEC_ZERO(acc2);                                             \
+            RC_FILTER_WIDE_ROW(acc1, acc2, &ptr[-(src_dim)],               \
+                               k11, k12, k13, c11, c12, c13);              \
+            RC_FILTER_WIDE_ROW(acc1, acc2, ptr,                            \
+                               k21, k22, k23, c21, c22, c23);              \
+            RC_FILTER_WIDE_ROW(acc1, acc2, &ptr[src_dim],                  \
+                               k31, k32, k33, c31, c32, c33);              \
+                                                                           \
+            /* Store the second half only if inside the image */           \
+            RC_VEC_GETW(dv1, dv2, acc1, acc2);                             \
+            RC_VEC_STORE(out, dv1);                                        \
+            if (x*RC_VEC_SIZE + RC_VEC_SIZE/2 < (width)) {                 \
+                RC_VEC_STORE(&out[RC_VEC_SIZE/2], dv2);                    \
+            }                                                              \
+        }                                                                  \
+    }                                                                      \
+    RC_VEC_CLEANUP();                                                      \
+} while (0)
+
+/**
+ *  Accumulate the contributions from one source row.
+ */
+#define RC_FILTER_WIDE_ROW(acc1, acc2, ptr, k1, k2, k3, c1, c2, c3) \
+do {                                                                \
+    if ((k1) != 0 || (k2) != 0 || (k3) != 0) {                      \
+        rc_vec_t cv, sv;                                            \
+        RC_VEC_LOAD(cv, ptr);                                       \
+        if ((k1) != 0) {                                            \
+            RC_VEC_LOAD(sv, &(ptr)[-RC_VEC_SIZE]);                  \
+            RC_VEC_ALIGNC(sv, sv, cv, RC_VEC_SIZE - 1);             \
+            RC_VEC_MACW(acc1, acc2, sv, c1);                        \
+        }                                                           \
+        if ((k2) != 0) {                                            \
+            RC_VEC_MACW(acc1, acc2, cv, c2);                        \
+        }                                                           \
+        if ((k3) != 0) {                                            \
+            RC_VEC_LOAD(sv, &(ptr)[RC_VEC_SIZE]);                   \
+            RC_VEC_ALIGNC(sv, cv, sv, 1);                           \
+            RC_VEC_MACW(acc1, acc2, sv, c3);                        \
+        }                                                           \
+    }                                                               \
+} while (0)
+#endif
+
+/*
+ * -------------------------------------------------------------
+ *  Median filter macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compare-exchange, leaving the minimum in a and the maximum in b.
+ */
+#if defined RC_VEC_MIN && defined RC_VEC_MAX
+#define RC_FILTER_MEDIAN_CE(a, b) \
+do {                              \
+    rc_vec_t min_;                \
+    RC_VEC_MIN(min_, a, b);       \
+    RC_VEC_MAX(b, a, b);          \
+    (a) = min_;                   \
+} while (0)
+#endif
+
+/**
+ *  Sort three vectors.
+ */
+#define RC_FILTER_MEDIAN_SORT3(v0, v1, v2) \
+do {                                       \
+    RC_FILTER_MEDIAN_CE(v0, v1);           \
+    RC_FILTER_MEDIAN_CE(v1, v2);           \
+    RC_FILTER_MEDIAN_CE(v0, v1);           \
+} while (0)
+
+/**
+ *  Sort five vectors with the optimal nine-comparator network.
+ */
+#define RC_FILTER_MEDIAN_SORT5(v0, v1, v2, v3, v4) \
+do {                                               \
+    RC_FILTER_MEDIAN_CE(v0, v1);                   \
+    RC_FILTER_MEDIAN_CE(v3, v4);                   \
+    RC_FILTER_MEDIAN_CE(v2, v4);                   \
+    RC_FILTER_MEDIAN_CE(v2, v3);                   \
+    RC_FILTER_MEDIAN_CE(v1, v4);                   \
+    RC_FILTER_MEDIAN_CE(v0, v3);                   \
+    RC_FILTER_MEDIAN_CE(v0, v2);                   \
+    RC_FILTER_MEDIAN_CE(v1, v3);                   \
+    RC_FILTER_MEDIAN_CE(v1, v2);                   \
+} while (0)
+
+/**
+ *  Median of three vectors.
+ */
+#if defined RC_VEC_MIN && defined RC_VEC_MAX
+#define RC_FILTER_MEDIAN_MED3(med, v0, v1, v2) \
+do {                                           \
+    rc_vec_t lo_, hi_;                         \
+    RC_VEC_MIN(lo_, v0, v1);                   \
+    RC_VEC_MAX(hi_, v0, v1);                   \
+    RC_VEC_MIN(hi_, hi_, v2);                  \
+    RC_VEC_MAX(med, lo_, hi_);                 \
+} while (0)
+#endif
+
+/**
+ *  Median operator, vertical component.
+ *  Sorts the column and stores the minimum, median and maximum
+ *  in the first, second and third output value, respectively.
+ */
+#define RC_FILTER_MEDIAN_V(v1x, v2x, v3x, p1, p2, p3) \
+do {                                                  \
+    (v1x) = (p1);                                     \
+    (v2x) = (p2);                                     \
+    (v3x) = (p3);                                     \
+    RC_FILTER_MEDIAN_SORT3(v1x, v2x, v3x);            \
+} while (0)
+
+/**
+ *  Median operator, horizontal component.
+ *  The median is the median of the maximum of the column minima,
+ *  the median of the column medians and the minimum of the
+ *  column maxima.
+ */
+#if defined RC_VEC_ALIGNC && defined RC_FILTER_MEDIAN_MED3
+#define RC_FILTER_MEDIAN_H(med, v11, v12, v13, v21, \
+                           v22, v23, v31, v32, v33) \
+do {                                                \
+    rc_vec_t u1, u3, lo, mid, hi;                   \
+    RC_VEC_ALIGNC(u1, v11, v12, RC_VEC_SIZE - 1);   \
+    RC_VEC_ALIGNC(u3, v12, v13, 1);                 \
+    RC_VEC_MAX(lo, u1, u3);                         \
+    RC_VEC_MAX(lo, lo, v12);                        \
+    RC_VEC_ALIGNC(u1, v21, v22, RC_VEC_SIZE - 1);   \
+    RC_VEC_ALIGNC(u3, v22, v23, 1);                 \
+    RC_FILTER_MEDIAN_MED3(mid, u1, v22, u3);        \
+    RC_VEC_ALIGNC(u1, v31, v32, RC_VEC_SIZE - 1);   \
+    RC_VEC_ALIGNC(u3, v32, v33, 1);                 \
+    RC_VEC_MIN(hi, u1, u3);                         \
+    RC_VEC_MIN(hi, hi, v32);                        \
+    RC_FILTER_MEDIAN_MED3(med, lo, mid, hi);        \
+} while (0)
+#endif
+
+/**
+ *  Load and sort a column of five vectors.
+ */
+#define RC_FILTER_MEDIAN_COL5(col, ptr, dim)             \
+do {                                                     \
+    RC_VEC_LOAD((col)[0], &(ptr)[0]);                    \
+    RC_VEC_LOAD((col)[1], &(ptr)[dim]);                  \
+    RC_VEC_LOAD((col)[2], &(ptr)[2*(dim)]);              \
+    RC_VEC_LOAD((col)[3], &(ptr)[3*(dim)]);              \
+    RC_VEC_LOAD((col)[4], &(ptr)[4*(dim)]);              \
+    RC_FILTER_MEDIAN_SORT5((col)[0], (col)[1], (col)[2], \
+                           (col)[3], (col)[4]);          \
+} while (0)
+
+/**
+ *  Move the minimum of the vectors m[lo], ..., m[hi] to m[lo]
+ *  and the maximum to m[hi].
+ */
+#define RC_FILTER_MEDIAN_EXTREMES(m, lo, hi)   \
+do {                                           \
+    int k_;                                    \
+    for (k_ = (lo) + 1; k_ <= (hi); k_++) {    \
+        RC_FILTER_MEDIAN_CE((m)[lo], (m)[k_]); \
+    }                                          \
+    for (k_ = (lo) + 1; k_ < (hi); k_++) {     \
+        RC_FILTER_MEDIAN_CE((m)[k_], (m)[hi]); \
+    }                                          \
+} while (0)
+
+/**
+ *  The 5x5 median of a neighbourhood v[row][col] with sorted columns.
+ *  See the generic implementation for a description of the pruning
+ *  and the forgetful selection of the median.
+ */
+#define RC_FILTER_MEDIAN_5X5(med, v)                                   \
+do {                                                                   \
+    rc_vec_t m_[13];                                                   \
+    int      r_;                                                       \
+    for (r_ = 0; r_ < 5; r_++) {                                       \
+        RC_FILTER_MEDIAN_SORT5((v)[r_][0], (v)[r_][1], (v)[r_][2],     \
+                               (v)[r_][3], (v)[r_][4]);                \
+    }                                                                  \
+    m_[0]  = (v)[0][3]; m_[1]  = (v)[0][4]; m_[2]  = (v)[1][2];        \
+    m_[3]  = (v)[1][3]; m_[4]  = (v)[1][4]; m_[5]  = (v)[2][1];        \
+    m_[6]  = (v)[2][2]; m_[7]  = (v)[2][3]; m_[8]  = (v)[3][0];        \
+    m_[9]  = (v)[3][1]; m_[10] = (v)[3][2]; m_[11] = (v)[4][0];        \
+    m_[12] = (v)[4][1];                                                \
+    for (r_ = 0; r_ < 5; r_++) {                                       \
+        RC_FILTER_MEDIAN_EXTREMES(m_, r_, 7);                          \
+        m_[7] = m_[r_ + 8];                                            \
+    }                                                                  \
+    RC_FILTER_MEDIAN_EXTREMES(m_, 5, 7);                               \
+    (med) = m_[6];                                                     \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Census transform macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Set the most significant bit of dstv if the neighbour nv is less
+ *  than the center cv, or if RC_FILTER_CENSUS_GE is set, if nv is
+ *  greater than or equal to cv.
+ */
+#if defined RC_VEC_CMPGE && \
+   (defined RC_VEC_HINT_CMPGE || !defined RC_VEC_CMPGT)
+#define RC_FILTER_CENSUS_GE 1
+#define RC_FILTER_CENSUS_CMP(dstv, nv, cv) \
+    RC_VEC_CMPGE(dstv, nv, cv)
+#elif defined RC_VEC_CMPGT
+#define RC_FILTER_CENSUS_GE 0
+#define RC_FILTER_CENSUS_CMP(dstv, nv, cv) \
+    RC_VEC_CMPGT(dstv, cv, nv)
+#endif
+
+/**
+ *  Shift all fields one bit to the right. The least significant bit
+ *  of each field must be zero, so that a rounding average is exact.
+ *  The zero vector zerov is taken from the calling function.
+ */
+#if defined RC_VEC_AVGR && \
+   (defined RC_VEC_HINT_AVGR || !defined RC_VEC_AVGT)
+#define RC_FILTER_CENSUS_SHR1(dstv, srcv) \
+    RC_VEC_AVGR(dstv, srcv, zerov)
+#elif defined RC_VEC_AVGT
+#define RC_FILTER_CENSUS_SHR1(dstv, srcv) \
+    RC_VEC_AVGT(dstv, srcv, zerov)
+#endif
+
+#if defined RC_FILTER_CENSUS_CMP && defined RC_FILTER_CENSUS_SHR1
+
+/**
+ *  Add one comparison bit to a code vector. The bits enter at the most
+ *  significant end, so after eight bits the first one is the least
+ *  significant. The shift is exact, since at most seven shifts follow
+ *  each bit. The vectors zerov and msbv are taken from the calling
+ *  function.
+ */
+#define RC_FILTER_CENSUS_BIT(code, nv, cv) \
+do {                                       \
+    rc_vec_t bv_;                          \
+    RC_FILTER_CENSUS_CMP(bv_, nv, cv);     \
+    RC_VEC_AND(bv_, bv_, msbv);            \
+    RC_FILTER_CENSUS_SHR1(code, code);     \
+    RC_VEC_OR(code, code, bv_);            \
+} while (0)
+
+/**
+ *  Finish a code of less-than bits.
+ */
+#if RC_FILTER_CENSUS_GE
+#define RC_FILTER_CENSUS_LT_END(code) \
+    RC_VEC_NOT(code, code)
+#else
+#define RC_FILTER_CENSUS_LT_END(code) \
+    ((void)0)
+#endif
+
+/**
+ *  Finish a code of greater-than-or-equal bits.
+ */
+#if RC_FILTER_CENSUS_GE
+#define RC_FILTER_CENSUS_GE_END(code) \
+    ((void)0)
+#else
+#define RC_FILTER_CENSUS_GE_END(code) \
+    RC_VEC_NOT(code, code)
+#endif
+
+/**
+ *  The census transform template. The columns of the neighbourhood
+ *  of radius rad slide to the right, and the operation op computes
+ *  and stores the codes for the neighbourhood v[row][col] of each
+ *  destination vector.
+ */
+#define RC_FILTER_CENSUS_TEMPLATE(dst, dst_dim, src, src_dim,         \
+                                  width, height, rad, op)             \
+do {                                                                  \
+    rc_vec_t zerov, msbv;                                             \
+    int      tot = RC_DIV_CEIL(width, RC_VEC_SIZE);                   \
+    int      y;                                                       \
+                                                                      \
+    RC_VEC_DECLARE();                                                 \
+    RC_VEC_ZERO(zerov);                                               \
+    RC_VEC_SPLAT(msbv, 0x80);                                         \
+    for (y = 0; y < (height); y++) {                                  \
+        const uint8_t *ptr = &(src)[(y - (rad))*(src_dim)];           \
+        rc_vec_t       prev[2*(rad) + 1], cur[2*(rad) + 1];           \
+        rc_vec_t       next[2*(rad) + 1];                             \
+        int            x, k;                                          \
+                                                                      \
+        /* Set up the first two columns */                            \
+        for (k = 0; k <= 2*(rad); k++) {                              \
+            RC_VEC_LOAD(prev[k], &ptr[k*(src_dim) - RC_VEC_SIZE]);    \
+            RC_VEC_LOAD(cur[k],  &ptr[k*(src_dim)]);                  \
+        }                                                             \
+                                                                      \
+        for (x = 0; x < tot; x++) {                                   \
+            rc_vec_t v[2*(rad) + 1][2*(rad) + 1];                     \
+                                                                      \
+            /* Get the horizontally displaced rows */                 \
+            for (k = 0; k <= 2*(rad); k++) {                          \
+                RC_VEC_LOAD(next[k], &ptr[k*(src_dim) +               \
+                                          (x + 1)*RC_VEC_SIZE]);      \
+                if ((rad) > 1) {                                      \
+                    RC_VEC_ALIGNC(v[k][0], prev[k], cur[k],           \
+                                  RC_VEC_SIZE - 2);                   \
+                    RC_VEC_ALIGNC(v[k][2*(rad)], cur[k], next[k], 2); \
+                }                                                     \
+                RC_VEC_ALIGNC(v[k][(rad) - 1], prev[k], cur[k],       \
+                              RC_VEC_SIZE - 1);                       \
+                RC_VEC_ALIGNC(v[k][(rad) + 1], cur[k], next[k], 1);   \
+                v[k][rad] = cur[k];                                   \
+            }                                                         \
+                                                                      \
+            op(dst, dst_dim, v, x, y, width);                         \
+                                                                      \
+            /* Slide the columns */                                   \
+            for (k = 0; k <= 2*(rad); k++) {                          \
+                prev[k] = cur[k];                                     \
+                cur[k]  = next[k];                                    \
+            }                                                         \
+        }                                                             \
+    }                                                                 \
+    RC_VEC_CLEANUP();                                                 \
+} while (0)
+
+/**
+ *  The 3x3 census operation.
+ */
+#define RC_FILTER_CENSUS_OP_3X3(dst, dst_dim, v, x, y, width)     \
+do {                                                              \
+    rc_vec_t code_;                                               \
+    RC_VEC_ZERO(code_);                                           \
+    RC_FILTER_CENSUS_BIT(code_, (v)[0][0], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[0][1], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[0][2], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[1][0], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[1][2], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[2][0], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[2][1], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[2][2], (v)[1][1]);            \
+    RC_FILTER_CENSUS_LT_END(code_);                               \
+    RC_VEC_STORE(&(dst)[(y)*(dst_dim) + (x)*RC_VEC_SIZE], code_); \
+} while (0)
+
+/**
+ *  The 3x3 local binary pattern operation.
+ */
+#define RC_FILTER_CENSUS_OP_LBP(dst, dst_dim, v, x, y, width)     \
+do {                                                              \
+    rc_vec_t code_;                                               \
+    RC_VEC_ZERO(code_);                                           \
+    RC_FILTER_CENSUS_BIT(code_, (v)[0][0], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[0][1], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[0][2], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[1][2], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[2][2], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[2][1], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[2][0], (v)[1][1]);            \
+    RC_FILTER_CENSUS_BIT(code_, (v)[1][0], (v)[1][1]);            \
+    RC_FILTER_CENSUS_GE_END(code_);                               \
+    RC_VEC_STORE(&(dst)[(y)*(dst_dim) + (x)*RC_VEC_SIZE], code_); \
+} while (0)
+
+/**
+ *  Store the three code byte vectors of the 5x5 census transform as
+ *  32-bit codes, for the len first pixels. The bytes are laid out in
+ *  the host byte order, as the four planes pv[0], ..., pv[3]. The
+ *  planes 0 and 2 and the planes 1 and 3 are interleaved first, and
+ *  the resulting byte pairs are then interleaved to 32-bit fields.
+ *  Only the vectors that hold some of the len pixels are stored.
+ */
+#if defined RC_VEC_ZIPLO && defined RC_VEC_ZIPHI
+#ifdef RC_BIG_ENDIAN
+#define RC_FILTER_CENSUS_PLANES(pv, code, zerov) \
+do {                                             \
+    (pv)[0] = (zerov);                           \
+    (pv)[1] = (code)[2];                         \
+    (pv)[2] = (code)[1];                         \
+    (pv)[3] = (code)[0];                         \
+} while (0)
+#else
+#define RC_FILTER_CENSUS_PLANES(pv, code, zerov) \
+do {                                             \
+    (pv)[0] = (code)[0];                         \
+    (pv)[1] = (code)[1];                         \
+    (pv)[2] = (code)[2];                         \
+    (pv)[3] = (zerov);                           \
+} while (0)
+#endif
+
+#define RC_FILTER_CENSUS_STORE_5X5(out, code, len)                 \
+do {                                                               \
+    rc_vec_t pv_[4], lo_[2], hi_[2], wv_[4];                       \
+    int      n_;                                                   \
+    RC_FILTER_CENSUS_PLANES(pv_, code, zerov);                     \
+    RC_VEC_ZIPLO(lo_[0], pv_[0], pv_[2]);                          \
+    RC_VEC_ZIPHI(lo_[1], pv_[0], pv_[2]);                          \
+    RC_VEC_ZIPLO(hi_[0], pv_[1], pv_[3]);                          \
+    RC_VEC_ZIPHI(hi_[1], pv_[1], pv_[3]);                          \
+    for (n_ = 0; n_ < 2; n_++) {                                   \
+        RC_VEC_ZIPLO(wv_[2*n_],     lo_[n_], hi_[n_]);             \
+        RC_VEC_ZIPHI(wv_[2*n_ + 1], lo_[n_], hi_[n_]);             \
+    }                                                              \
+    for (n_ = 0; n_ < 4 && n_*(RC_VEC_SIZE / 4) < (len); n_++) {   \
+        RC_VEC_STORE((rc_vec_t*)&(out)[n_*(RC_VEC_SIZE / 4)],      \
+                     wv_[n_]);                                     \
+    }                                                              \
+} while (0)
+#else
+#define RC_FILTER_CENSUS_STORE_5X5(out, code, len)                 \
+do {                                                               \
+    rc_vec_t       tmp_[3];                                        \
+    const uint8_t *buf_ = (const uint8_t*)tmp_;                    \
+    int            n_;                                             \
+    for (n_ = 0; n_ < 3; n_++) {                                   \
+        RC_VEC_STORE(&tmp_[n_], (code)[n_]);                       \
+    }                                                              \
+    for (n_ = 0; n_ < (len); n_++) {                               \
+        (out)[n_] = buf_[n_] | buf_[RC_VEC_SIZE + n_] << 8 |       \
+                    (uint32_t)buf_[2*RC_VEC_SIZE + n_] << 16;      \
+    }                                                              \
+} while (0)
+#endif
+
+/**
+ *  The 5x5 census operation. The three code bytes are computed
+ *  as separate vectors, and interleaved to 32-bit codes.
+ */
+#define RC_FILTER_CENSUS_OP_5X5(dst, dst_dim, v, x, y, width)          \
+do {                                                                   \
+    rc_vec_t  code_[3];                                                \
+    uint32_t *out_ = &(dst)[(y)*((dst_dim) / 4) + (x)*RC_VEC_SIZE];    \
+    int       len_ = MIN(RC_VEC_SIZE, (width) - (x)*RC_VEC_SIZE);      \
+    int       i_, j_, k_;                                              \
+                                                                       \
+    for (k_ = 0; k_ < 3; k_++) {                                       \
+        RC_VEC_ZERO(code_[k_]);                                        \
+    }                                                                  \
+    for (i_ = 0, k_ = 0; i_ < 5; i_++) {                               \
+        for (j_ = 0; j_ < 5; j_++) {                                   \
+            if (i_ != 2 || j_ != 2) {                                  \
+                RC_FILTER_CENSUS_BIT(code_[k_ / 8], (v)[i_][j_],       \
+                                     (v)[2][2]);                       \
+                k_++;                                                  \
+            }                                                          \
+        }                                                              \
+    }                                                                  \
+    for (k_ = 0; k_ < 3; k_++) {                                       \
+        RC_FILTER_CENSUS_LT_END(code_[k_]);                            \
+    }                                                                  \
+    RC_FILTER_CENSUS_STORE_5X5(out_, code_, len_);                     \
+} while (0)
+
+#endif /* RC_FILTER_CENSUS_CMP && RC_FILTER_CENSUS_SHR1 */
+
+/**
+ *  Count the bits in each field. If the vectors hold at least 16
+ *  fields, the bit counts of the low and high nibbles are looked up
+ *  with RC_VEC_SHUFFLE() in the table vector cntv[1], where field k
+ *  holds the bit count of k. Otherwise the bit pairs, nibbles and bytes
+ *  are summed in turn, where the shifted operand is masked so that its
+ *  least significant bit is zero. The vector zerov and the constant
+ *  vectors cntv, set up by RC_FILTER_CENSUS_BITCNT_INIT(), are taken
+ *  from the calling function.
+ */
+#if defined RC_VEC_SHUFFLE && RC_VEC_SIZE >= 16 && \
+    defined RC_FILTER_CENSUS_SHR1 && defined RC_VEC_ANDNOT && \
+    defined RC_VEC_ADDS
+#define RC_FILTER_CENSUS_BITCNT_INIT(cntv)                      \
+do {                                                            \
+    union { rc_vec_t vec; uint8_t byte[RC_VEC_SIZE]; } tab_;    \
+    int k_;                                                     \
+    for (k_ = 0; k_ < RC_VEC_SIZE; k_++) {                      \
+        tab_.byte[k_] = (k_ & 1) + (k_ >> 1 & 1) +              \
+                        (k_ >> 2 & 1) + (k_ >> 3 & 1);          \
+    }                                                           \
+    RC_VEC_SPLAT((cntv)[0], 0x0f);                              \
+    RC_VEC_LOAD((cntv)[1], &tab_.vec);                          \
+} while (0)
+
+#define RC_FILTER_CENSUS_BITCNT(dstv, srcv) \
+do {                                        \
+    rc_vec_t t_;                            \
+    RC_VEC_ANDNOT(t_, srcv, cntv[0]);       \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_VEC_AND(dstv, srcv, cntv[0]);        \
+    RC_VEC_SHUFFLE(dstv, cntv[1], dstv);    \
+    RC_VEC_SHUFFLE(t_, cntv[1], t_);        \
+    RC_VEC_ADDS(dstv, dstv, t_);            \
+} while (0)
+
+#elif defined RC_FILTER_CENSUS_SHR1 && defined RC_VEC_ANDNOT && \
+      defined RC_VEC_ADDS && defined RC_VEC_SUBS
+#define RC_FILTER_CENSUS_BITCNT_INIT(cntv) \
+do {                                       \
+    RC_VEC_SPLAT((cntv)[0], 0x55);         \
+    RC_VEC_SPLAT((cntv)[1], 0x33);         \
+    RC_VEC_SPLAT((cntv)[2], 0x0f);         \
+} while (0)
+
+#define RC_FILTER_CENSUS_BITCNT(dstv, srcv) \
+do {                                        \
+    rc_vec_t t_;                            \
+    RC_VEC_ANDNOT(t_, srcv, cntv[0]);       \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_VEC_SUBS(dstv, srcv, t_);            \
+    RC_VEC_ANDNOT(t_, dstv, cntv[1]);       \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_VEC_AND(dstv, dstv, cntv[1]);        \
+    RC_VEC_ADDS(dstv, dstv, t_);            \
+    RC_VEC_ANDNOT(t_, dstv, cntv[2]);       \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_FILTER_CENSUS_SHR1(t_, t_);          \
+    RC_VEC_AND(dstv, dstv, cntv[2]);        \
+    RC_VEC_ADDS(dstv, dstv, t_);            \
+} while (0)
+#endif
+
 /*
  * -------------------------------------------------------------
  *  Exported functions
@@ -1140,3 +1780,680 @@ rc_filter_highpass_3x3_abs_u8(uint8_t *restrict dst, int dst_dim,
 }
 #endif
 #endif
+
+/**
+ *  1x2 horizontal difference, full precision.
+ *  The result is exact.
+ */
+#if RC_IMPL(rc_filter_diff_1x2_horz_u8_s16, 0)
+#ifdef RC_FILTER_WIDE_TEMPLATE
+void
+rc_filter_diff_1x2_horz_u8_s16(int16_t *restrict dst, int dst_dim,
+                               const uint8_t *restrict src, int src_dim,
+                               int width, int height)
+{
+    RC_FILTER_WIDE_TEMPLATE(dst, dst_dim, src, src_dim, width, height,
+                             0,  0,  0,
+                            -1,  1,  0,
+                             0,  0,  0);
+}
+#endif
+#endif
+
+/**
+ *  2x1 vertical difference, full precision.
+ *  The result is exact.
+ */
+#if RC_IMPL(rc_filter_diff_2x1_vert_u8_s16, 0)
+#ifdef RC_FILTER_WIDE_TEMPLATE
+void
+rc_filter_diff_2x1_vert_u8_s16(int16_t *restrict dst, int dst_dim,
+                               const uint8_t *restrict src, int src_dim,
+                               int width, int height)
+{
+    RC_FILTER_WIDE_TEMPLATE(dst, dst_dim, src, src_dim, width, height,
+                             0, -1,  0,
+                             0,  1,  0,
+                             0,  0,  0);
+}
+#endif
+#endif
+
+/**
+ *  3x3 horizontal Sobel gradient, full precision.
+ *  The result is exact.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_horz_u8_s16, 0)
+#ifdef RC_FILTER_WIDE_TEMPLATE
+void
+rc_filter_sobel_3x3_horz_u8_s16(int16_t *restrict dst, int dst_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height)
+{
+    RC_FILTER_WIDE_TEMPLATE(dst, dst_dim, src, src_dim, width, height,
+                            -1,  0,  1,
+                            -2,  0,  2,
+                            -1,  0,  1);
+}
+#endif
+#endif
+
+/**
+ *  3x3 vertical Sobel gradient, full precision.
+ *  The result is exact.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_vert_u8_s16, 0)
+#ifdef RC_FILTER_WIDE_TEMPLATE
+void
+rc_filter_sobel_3x3_vert_u8_s16(int16_t *restrict dst, int dst_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height)
+{
+    RC_FILTER_WIDE_TEMPLATE(dst, dst_dim, src, src_dim, width, height,
+                            -1, -2, -1,
+                             0,  0,  0,
+                             1,  2,  1);
+}
+#endif
+#endif
+
+/**
+ *  3x3 Sobel gradient components, full precision.
+ *  Both components are accumulated from the same source vectors,
+ *  so the source is only read once. The result is exact.
+ */
+#if RC_IMPL(rc_filter_sobel_3x3_grad_u8_s16, 0)
+#ifdef RC_FILTER_WIDE_TEMPLATE
+void
+rc_filter_sobel_3x3_grad_u8_s16(int16_t *restrict gx, int gx_dim,
+                                int16_t *restrict gy, int gy_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height)
+{
+    rc_vec_t p1, p2, m1, m2;
+    int      xdim = gx_dim / (int)sizeof *gx;
+    int      ydim = gy_dim / (int)sizeof *gy;
+    int      tot  = RC_DIV_CEIL(width, RC_VEC_SIZE);
+    int      y;
+
+    RC_VEC_DECLARE();
+
+    /* Set up the coefficient vectors */
+    RC_VEC_COEF(p1,  1);
+    RC_VEC_COEF(p2,  2);
+    RC_VEC_COEF(m1, -1);
+    RC_VEC_COEF(m2, -2);
+
+    for (y = 0; y < height; y++) {
+        int x;
+        for (x = 0; x < tot; x++) {
+            const uint8_t *ptr = &src[y*src_dim + x*RC_VEC_SIZE];
+            int16_t       *xout = &gx[y*xdim + x*RC_VEC_SIZE];
+            int16_t       *yout = &gy[y*ydim + x*RC_VEC_SIZE];
+            rc_vec_t       xacc1, xacc2, yacc1, yacc2;
+            rc_vec_t       lv, cv, rv, dv1, dv2;
+            int            k;
+
+            RC_VEC_ZERO(xacc1);
+            RC_VEC_ZERO(xacc2);
+            RC_VEC_ZERO(yacc1);
+            RC_VEC_ZERO(yacc2);
+
+            /* Accumulate the three source rows */
+            for (k = -1; k <= 1; k++) {
+                const uint8_t *row = &ptr[k*src_dim];
+
+                /* Load the left, center and right neighbours */
+                RC_VEC_LOAD(cv, row);
+                RC_VEC_LOAD(lv, &row[-RC_VEC_SIZE]);
+                RC_VEC_LOAD(rv, &row[RC_VEC_SIZE]);
+                RC_VEC_ALIGNC(lv, lv, cv, RC_VEC_SIZE - 1);
+                RC_VEC_ALIGNC(rv, cv, rv, 1);
+
+                /* Horizontal gradient, [-1 0 1] weighted by [1 2 1] */
+                RC_VEC_MACW(xacc1, xacc2, lv, k == 0 ? m2 : m1);
+                RC_VEC_MACW(xacc1, xacc2, rv, k == 0 ? p2 : p1);
+
+                /* Vertical gradient, [1 2 1] weighted by [-1 0 1] */
+                if (k != 0) {
+                    RC_VEC_MACW(yacc1, yacc2, lv, k < 0 ? m1 : p1);
+                    RC_VEC_MACW(yacc1, yacc2, cv, k < 0 ? m2 : p2);
+                    RC_VEC_MACW(yacc1, yacc2, rv, k < 0 ? m1 : p1);
+                }
+            }
+
+            /* Store the second half only if inside the image */
+            RC_VEC_GETW(dv1, dv2, xacc1, xacc2);
+            RC_VEC_STORE(xout, dv1);
+            if (x*RC_VEC_SIZE + RC_VEC_SIZE/2 < width) {
+                RC_VEC_STORE(&xout[RC_VEC_SIZE/2], dv2);
+            }
+            RC_VEC_GETW(dv1, dv2, yacc1, yacc2);
+            RC_VEC_STORE(yout, dv1);
+            if (x*RC_VEC_SIZE + RC_VEC_SIZE/2 < width) {
+                RC_VEC_STORE(&yout[RC_VEC_SIZE/2], dv2);
+            }
+        }
+    }
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+/**
+ *  3x3 laplacian, full precision.
+ *  The result is exact.
+ */
+#if RC_IMPL(rc_filter_laplace_3x3_u8_s16, 0)
+#ifdef RC_FILTER_WIDE_TEMPLATE
+void
+rc_filter_laplace_3x3_u8_s16(int16_t *restrict dst, int dst_dim,
+                             const uint8_t *restrict src, int src_dim,
+                             int width, int height)
+{
+    RC_FILTER_WIDE_TEMPLATE(dst, dst_dim, src, src_dim, width, height,
+                             0, -1,  0,
+                            -1,  4, -1,
+                             0, -1,  0);
+}
+#endif
+#endif
+
+/**
+ *  3x3 highpass filter, full precision.
+ *  The result is exact.
+ */
+#if RC_IMPL(rc_filter_highpass_3x3_u8_s16, 0)
+#ifdef RC_FILTER_WIDE_TEMPLATE
+void
+rc_filter_highpass_3x3_u8_s16(int16_t *restrict dst, int dst_dim,
+                              const uint8_t *restrict src, int src_dim,
+                              int width, int height)
+{
+    RC_FILTER_WIDE_TEMPLATE(dst, dst_dim, src, src_dim, width, height,
+                            -1, -1, -1,
+                            -1,  8, -1,
+                            -1, -1, -1);
+}
+#endif
+#endif
+
+/**
+ *  General 2D convolution.
+ */
+#if RC_IMPL(rc_filter_conv_u8, 0)
+#if defined RC_FILTER_CONV_ALIGN && defined RC_VEC_COEF && \
+    defined RC_VEC_MACW && defined RC_VEC_PACKW
+void
+rc_filter_conv_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height,
+                  const int8_t *kern, int kern_width, int kern_height,
+                  int shift)
+{
+    rc_vec_t coef[RC_FILTER_CONV_MAX*RC_FILTER_CONV_MAX];
+    int      xrad = kern_width  / 2;
+    int      yrad = kern_height / 2;
+    int      tot  = RC_DIV_CEIL(width, RC_VEC_SIZE);
+    int      y, k;
+
+    RC_VEC_DECLARE();
+
+    /* Set up the coefficient vectors */
+    for (k = 0; k < kern_width*kern_height; k++) {
+        RC_VEC_COEF(coef[k], kern[k]);
+    }
+
+    for (y = 0; y < height; y++) {
+        int x;
+        for (x = 0; x < tot; x++) {
+            const uint8_t *ptr = &src[(y - yrad)*src_dim + x*RC_VEC_SIZE];
+            rc_vec_t       acc1, acc2, pv;
+            int            i, j;
+
+            RC_VEC_ZERO(acc1);
+            RC_VEC_ZERO(acc2);
+            for (i = 0, k = 0; i < kern_height; i++, ptr += src_dim) {
+                rc_vec_t prev, cur, next;
+
+                RC_VEC_LOAD(cur, ptr);
+                prev = next = cur;
+                if (xrad > 0) {
+                    RC_VEC_LOAD(prev, &ptr[-RC_VEC_SIZE]);
+                    RC_VEC_LOAD(next, &ptr[ RC_VEC_SIZE]);
+                }
+
+                for (j = -xrad; j <= xrad; j++, k++) {
+                    if (kern[k] != 0) {
+                        rc_vec_t sv;
+                        RC_FILTER_CONV_ALIGN(sv, prev, cur, next, j);
+                        RC_VEC_MACW(acc1, acc2, sv, coef[k]);
+                    }
+                }
+            }
+
+            RC_VEC_PACKW(pv, acc1, acc2, shift);
+            RC_VEC_STORE(&dst[y*dst_dim + x*RC_VEC_SIZE], pv);
+        }
+    }
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+/**
+ *  Separable convolution.
+ */
+#if RC_IMPL(rc_filter_sep_u8, 0)
+#if defined RC_FILTER_CONV_ALIGN && defined RC_VEC_COEF && \
+    defined RC_VEC_MACW && defined RC_VEC_PACKW
+void
+rc_filter_sep_u8(uint8_t *restrict dst, int dst_dim,
+                 const uint8_t *restrict src, int src_dim,
+                 int width, int height,
+                 const int8_t *xkern, int xlen, int xshift,
+                 const int8_t *ykern, int ylen, int yshift,
+                 uint8_t *restrict row)
+{
+    rc_vec_t xcoef[RC_FILTER_CONV_MAX];
+    rc_vec_t ycoef[RC_FILTER_CONV_MAX];
+    int      xrad = xlen / 2;
+    int      yrad = ylen / 2;
+    int      pad  = xrad > 0;
+    int      tot  = RC_DIV_CEIL(width, RC_VEC_SIZE);
+    int      y, k;
+
+    RC_VEC_DECLARE();
+
+    /* Set up the coefficient vectors */
+    for (k = 0; k < xlen; k++) {
+        RC_VEC_COEF(xcoef[k], xkern[k]);
+    }
+    for (k = 0; k < ylen; k++) {
+        RC_VEC_COEF(ycoef[k], ykern[k]);
+    }
+
+    for (y = 0; y < height; y++) {
+        int x;
+
+        /* Vertical pass to the row buffer, including the border */
+        for (x = -pad; x < tot + pad; x++) {
+            const uint8_t *ptr = &src[(y - yrad)*src_dim + x*RC_VEC_SIZE];
+            rc_vec_t       acc1, acc2, pv;
+
+            RC_VEC_ZERO(acc1);
+            RC_VEC_ZERO(acc2);
+            for (k = 0; k < ylen; k++, ptr += src_dim) {
+                if (ykern[k] != 0) {
+                    rc_vec_t sv;
+                    RC_VEC_LOAD(sv, ptr);
+                    RC_VEC_MACW(acc1, acc2, sv, ycoef[k]);
+                }
+            }
+
+            RC_VEC_PACKW(pv, acc1, acc2, yshift);
+            RC_VEC_STORE(&row[x*RC_VEC_SIZE], pv);
+        }
+
+        /* Horizontal pass to the destination row */
+        for (x = 0; x < tot; x++) {
+            rc_vec_t prev, cur, next;
+            rc_vec_t acc1, acc2, pv;
+
+            RC_VEC_LOAD(cur, &row[x*RC_VEC_SIZE]);
+            prev = next = cur;
+            if (pad) {
+                RC_VEC_LOAD(prev, &row[(x - 1)*RC_VEC_SIZE]);
+                RC_VEC_LOAD(next, &row[(x + 1)*RC_VEC_SIZE]);
+            }
+
+            RC_VEC_ZERO(acc1);
+            RC_VEC_ZERO(acc2);
+            for (k = 0; k < xlen; k++) {
+                if (xkern[k] != 0) {
+                    rc_vec_t sv;
+                    RC_FILTER_CONV_ALIGN(sv, prev, cur, next, k - xrad);
+                    RC_VEC_MACW(acc1, acc2, sv, xcoef[k]);
+                }
+            }
+
+            RC_VEC_PACKW(pv, acc1, acc2, xshift);
+            RC_VEC_STORE(&dst[y*dst_dim + x*RC_VEC_SIZE], pv);
+        }
+    }
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+/**
+ *  3x3 median filter.
+ *  The result is exact.
+ */
+#if RC_IMPL(rc_filter_median_3x3_u8, 0)
+#if defined RC_FILTER_3X3_TEMPLATE && defined RC_FILTER_MEDIAN_H && \
+    defined RC_FILTER_MEDIAN_CE
+void
+rc_filter_median_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height)
+{
+    RC_FILTER_3X3_TEMPLATE(dst, dst_dim, src, src_dim, width, height,
+                           RC_FILTER_MEDIAN_H, RC_FILTER_MEDIAN_V);
+}
+#endif
+#endif
+
+/**
+ *  5x5 median filter.
+ *  The result is exact.
+ */
+#if RC_IMPL(rc_filter_median_5x5_u8, 0)
+#if defined RC_VEC_ALIGNC && defined RC_FILTER_MEDIAN_CE
+void
+rc_filter_median_5x5_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height)
+{
+    int tot = RC_DIV_CEIL(width, RC_VEC_SIZE);
+    int y;
+
+    RC_VEC_DECLARE();
+    for (y = 0; y < height; y++) {
+        const uint8_t *ptr = &src[(y - 2)*src_dim];
+        rc_vec_t       prev[5], cur[5], next[5];
+        int            x;
+
+        /* Set up the first two columns */
+        RC_FILTER_MEDIAN_COL5(prev, &ptr[-RC_VEC_SIZE], src_dim);
+        RC_FILTER_MEDIAN_COL5(cur,  ptr,                src_dim);
+
+        for (x = 0; x < tot; x++) {
+            rc_vec_t v[5][5], med;
+            int      k;
+
+            RC_FILTER_MEDIAN_COL5(next, &ptr[(x + 1)*RC_VEC_SIZE], src_dim);
+
+            /* Get the horizontally displaced sorted columns */
+            for (k = 0; k < 5; k++) {
+                RC_VEC_ALIGNC(v[k][0], prev[k], cur[k], RC_VEC_SIZE - 2);
+                RC_VEC_ALIGNC(v[k][1], prev[k], cur[k], RC_VEC_SIZE - 1);
+                RC_VEC_ALIGNC(v[k][3], cur[k],  next[k], 1);
+                RC_VEC_ALIGNC(v[k][4], cur[k],  next[k], 2);
+                v[k][2] = cur[k];
+            }
+
+            RC_FILTER_MEDIAN_5X5(med, v);
+            RC_VEC_STORE(&dst[y*dst_dim + x*RC_VEC_SIZE], med);
+
+            /* Slide the columns */
+            for (k = 0; k < 5; k++) {
+                prev[k] = cur[k];
+                cur[k]  = next[k];
+            }
+        }
+    }
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+/**
+ *  Vertical box filter.
+ *  The column sums are kept in the field layout of RC_VEC_MACW(), which
+ *  is only used for widening the source rows. The remaining 16-bit
+ *  operations are field-wise, so the layout does not matter. The
+ *  sums never exceed 255*255, and the reciprocal of size 1 is clamped
+ *  to 0xffff, which still maps the sums 0-255 exactly.
+ */
+#if RC_IMPL(rc_filter_box_vert_u8, 0)
+#if defined RC_VEC_COEF && defined RC_VEC_MACW && defined RC_VEC_PACKW && \
+    defined RC_VEC_SPLAT16 && defined RC_VEC_ADDS16 &&                  \
+    defined RC_VEC_SUBS16 && defined RC_VEC_MULHR16
+void
+rc_filter_box_vert_u8(uint8_t *restrict dst, int dst_dim,
+                      const uint8_t *restrict src, int src_dim,
+                      int width, int height, int size,
+                      uint16_t *restrict sum)
+{
+    rc_vec_t *sv  = (rc_vec_t*)sum;
+    int       rad = size / 2;
+    int       tot = RC_DIV_CEIL(width, RC_VEC_SIZE);
+    rc_vec_t  one, rcp, zero;
+    int       x, y;
+
+    RC_VEC_DECLARE();
+    RC_VEC_COEF(one, 1);
+    RC_VEC_SPLAT16(rcp, MIN(RC_FILTER_BOX_RECIP(size), 0xffff));
+    RC_VEC_ZERO(zero);
+
+    /* Sum all but the bottom row of the first box */
+    for (x = 0; x < tot; x++) {
+        rc_vec_t acc1 = zero, acc2 = zero;
+        for (y = -rad; y < rad; y++) {
+            rc_vec_t pv;
+            RC_VEC_LOAD(pv, &src[y*src_dim + x*RC_VEC_SIZE]);
+            RC_VEC_MACW(acc1, acc2, pv, one);
+        }
+        sv[2*x]     = acc1;
+        sv[2*x + 1] = acc2;
+    }
+
+    /* Slide the box over the columns */
+    for (y = 0; y < height; y++) {
+        const uint8_t *add = &src[(y + rad)*src_dim];
+        const uint8_t *sub = &src[(y - rad)*src_dim];
+        uint8_t       *out = &dst[y*dst_dim];
+
+        for (x = 0; x < tot; x++) {
+            rc_vec_t sum1 = sv[2*x], sum2 = sv[2*x + 1];
+            rc_vec_t acc1 = zero, acc2 = zero;
+            rc_vec_t pv;
+
+            /* Add the bottom row and map the box sum */
+            RC_VEC_LOAD(pv, &add[x*RC_VEC_SIZE]);
+            RC_VEC_MACW(acc1, acc2, pv, one);
+            RC_VEC_ADDS16(sum1, sum1, acc1);
+            RC_VEC_ADDS16(sum2, sum2, acc2);
+            RC_VEC_MULHR16(acc1, sum1, rcp);
+            RC_VEC_MULHR16(acc2, sum2, rcp);
+            RC_VEC_PACKW(pv, acc1, acc2, 0);
+            RC_VEC_STORE(&out[x*RC_VEC_SIZE], pv);
+
+            /* Subtract the top row */
+            acc1 = acc2 = zero;
+            RC_VEC_LOAD(pv, &sub[x*RC_VEC_SIZE]);
+            RC_VEC_MACW(acc1, acc2, pv, one);
+            RC_VEC_SUBS16(sv[2*x],     sum1, acc1);
+            RC_VEC_SUBS16(sv[2*x + 1], sum2, acc2);
+        }
+    }
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+/**
+ *  3x3 census transform.
+ */
+#if RC_IMPL(rc_filter_census_3x3_u8, 0)
+#if defined RC_VEC_ALIGNC && defined RC_FILTER_CENSUS_BIT
+void
+rc_filter_census_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height)
+{
+    RC_FILTER_CENSUS_TEMPLATE(dst, dst_dim, src, src_dim, width, height,
+                              1, RC_FILTER_CENSUS_OP_3X3);
+}
+#endif
+#endif
+
+/**
+ *  5x5 census transform.
+ */
+#if RC_IMPL(rc_filter_census_5x5_u8_u32, 0)
+#if defined RC_VEC_ALIGNC && defined RC_FILTER_CENSUS_BIT
+void
+rc_filter_census_5x5_u8_u32(uint32_t *restrict dst, int dst_dim,
+                            const uint8_t *restrict src, int src_dim,
+                            int width, int height)
+{
+    RC_FILTER_CENSUS_TEMPLATE(dst, dst_dim, src, src_dim, width, height,
+                              2, RC_FILTER_CENSUS_OP_5X5);
+}
+#endif
+#endif
+
+/**
+ *  3x3 local binary patterns.
+ */
+#if RC_IMPL(rc_filter_lbp_3x3_u8, 0)
+#if defined RC_VEC_ALIGNC && defined RC_FILTER_CENSUS_BIT
+void
+rc_filter_lbp_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                     const uint8_t *restrict src, int src_dim,
+                     int width, int height)
+{
+    RC_FILTER_CENSUS_TEMPLATE(dst, dst_dim, src, src_dim, width, height,
+                              1, RC_FILTER_CENSUS_OP_LBP);
+}
+#endif
+#endif
+
+/**
+ *  Hamming distance between 8-bit codes.
+ */
+#if RC_IMPL(rc_filter_census_cost_u8, 0)
+#if defined RC_VEC_LDINIT && defined RC_FILTER_CENSUS_BITCNT
+void
+rc_filter_census_cost_u8(uint8_t *restrict dst, int dst_dim,
+                         const uint8_t *restrict src1, int src1_dim,
+                         const uint8_t *restrict src2, int src2_dim,
+                         int width, int height, int disp)
+{
+    int      off = RC_DIV_CEIL(disp, RC_VEC_SIZE); /* First full vector */
+    int      tot = RC_DIV_CEIL(width, RC_VEC_SIZE);
+    int      len = MIN(off*RC_VEC_SIZE, width);
+    int      y;
+    rc_vec_t zerov, cntv[3];
+
+    RC_VEC_DECLARE();
+    RC_VEC_ZERO(zerov);
+    RC_FILTER_CENSUS_BITCNT_INIT(cntv);
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row1 = &src1[y*src1_dim];
+        const uint8_t *row2 = &src2[y*src2_dim];
+        uint8_t       *out  = &dst[y*dst_dim];
+        int            x;
+
+        /* Handle the leading pixels in scalar code */
+        memset(out, 8, MIN(disp, len));
+        for (x = disp; x < len; x++) {
+            out[x] = rc_table_bitcount[row1[x] ^ row2[x - disp]];
+        }
+
+        /* Process the remaining vectors with misaligned loads */
+        if (off < tot) {
+            const uint8_t *ptr;
+            rc_vec_t       v1, v2, v3;
+            int            i = 0;
+
+            RC_VEC_LDINIT(v1, v2, v3, ptr, &row2[off*RC_VEC_SIZE - disp]);
+            for (x = off; x < tot; x++, i += RC_VEC_SIZE) {
+                rc_vec_t sv1, sv2, cv;
+                RC_VEC_LOAD(sv1, &row1[x*RC_VEC_SIZE]);
+                RC_VEC_LOADU(sv2, v1, v2, v3, &ptr[i]);
+                RC_VEC_XOR(cv, sv1, sv2);
+                RC_FILTER_CENSUS_BITCNT(cv, cv);
+                RC_VEC_STORE(&out[x*RC_VEC_SIZE], cv);
+            }
+        }
+    }
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+/**
+ *  Hamming distance between 32-bit codes.
+ */
+#if RC_IMPL(rc_filter_census_cost_u32_u8, 0)
+#if defined RC_VEC_LDINIT && defined RC_VEC_SHLC && \
+    defined RC_VEC_PACK   && defined RC_FILTER_CENSUS_BITCNT
+void
+rc_filter_census_cost_u32_u8(uint8_t *restrict dst, int dst_dim,
+                             const uint32_t *restrict src1, int src1_dim,
+                             const uint32_t *restrict src2, int src2_dim,
+                             int width, int height, int disp)
+{
+    int      off = RC_DIV_CEIL(disp, RC_VEC_SIZE); /* First full vector */
+    int      tot = RC_DIV_CEIL(width, RC_VEC_SIZE);
+    int      len = MIN(off*RC_VEC_SIZE, width);
+    int      end = RC_DIV_CEIL(4*width, RC_VEC_SIZE); /* Code vectors */
+    int      y;
+    rc_vec_t zerov, cntv[3];
+
+    RC_VEC_DECLARE();
+    RC_VEC_ZERO(zerov);
+    RC_FILTER_CENSUS_BITCNT_INIT(cntv);
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row1 = (const uint8_t*)src1 + y*src1_dim;
+        const uint8_t *row2 = (const uint8_t*)src2 + y*src2_dim;
+        uint8_t       *out  = &dst[y*dst_dim];
+        int            x;
+
+        /* Handle the leading pixels in scalar code */
+        memset(out, 32, MIN(disp, len));
+        for (x = disp; x < len; x++) {
+            const uint8_t *ptr1 = &row1[4*x];
+            const uint8_t *ptr2 = &row2[4*(x - disp)];
+            out[x] = rc_table_bitcount[ptr1[0] ^ ptr2[0]] +
+                     rc_table_bitcount[ptr1[1] ^ ptr2[1]] +
+                     rc_table_bitcount[ptr1[2] ^ ptr2[2]] +
+                     rc_table_bitcount[ptr1[3] ^ ptr2[3]];
+        }
+
+        /**
+         *  Process the remaining vectors with misaligned loads.
+         *  The bitcounts of the four bytes of each code are summed
+         *  into the first byte, and the sums are packed together.
+         */
+        if (off < tot) {
+            const uint8_t *ptr;
+            rc_vec_t       v1, v2, v3;
+            int            i = 0;
+
+            RC_VEC_LDINIT(v1, v2, v3, ptr, &row2[4*(off*RC_VEC_SIZE - disp)]);
+            for (x = off; x < tot; x++) {
+                rc_vec_t cv[4], pv1, pv2;
+                int      k;
+                for (k = 0; k < 4; k++, i += RC_VEC_SIZE) {
+                    rc_vec_t sv1, sv2, tv;
+                    if (4*x + k >= end) {
+                        /* Past the end of the row */
+                        RC_VEC_ZERO(cv[k]);
+                        continue;
+                    }
+                    RC_VEC_LOAD(sv1, &row1[(4*x + k)*RC_VEC_SIZE]);
+                    RC_VEC_LOADU(sv2, v1, v2, v3, &ptr[i]);
+                    RC_VEC_XOR(sv1, sv1, sv2);
+                    RC_FILTER_CENSUS_BITCNT(sv1, sv1);
+                    RC_VEC_SHLC(tv, sv1, 1);
+                    RC_VEC_ADDS(sv1, sv1, tv);
+                    RC_VEC_SHLC(tv, sv1, 2);
+                    RC_VEC_ADDS(cv[k], sv1, tv);
+                }
+                RC_VEC_PACK(pv1, cv[0], cv[1]);
+                RC_VEC_PACK(pv2, cv[2], cv[3]);
+                RC_VEC_PACK(pv1, pv1, pv2);
+                RC_VEC_STORE(&out[x*RC_VEC_SIZE], pv1);
+            }
+        }
+    }
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
@@ -0,0 +1,125 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_match.c
+ *  @brief  RAPP Compute layer template matching, vector implementation.
+ */
+
+#include "rc_impl_cfg.h"  /* Implementation cfg       */
+#include "rc_vector.h"    /* Vector API               */
+#include "rc_match.h"     /* Matching API             */
+#include "rc_match_tpl.h" /* Block matching templates */
+
+#if defined RC_VEC_MACN && RC_VEC_MACN > 1 && RC_VEC_MACN % 4 != 0
+#error RC_VEC_MACN must be divisible by 4
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Accumulate the squared differences.
+ */
+#define RC_MATCH_ACCUM_SSD(acc, vec1, vec2) \
+do {                                        \
+    rc_vec_t dif_;                          \
+    RC_VEC_SUBA(dif_, vec1, vec2);          \
+    RC_VEC_MACV(acc, dif_, dif_);           \
+} while (0)
+
+/**
+ *  Accumulate the products.
+ */
+#define RC_MATCH_ACCUM_MAC(acc, vec1, vec2) \
+    RC_VEC_MACV(acc, vec1, vec2)
+
+/**
+ *  Reduce the accumulator vector to the scalar sum.
+ */
+#define RC_MATCH_REDUCE(sum, acc) \
+do {                              \
+    uint32_t tmp_;                \
+    RC_VEC_MACR(tmp_, acc);       \
+    RC_VEC_ZERO(acc);             \
+    (sum) += tmp_;                \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Block sum of squared differences with early termination.
+ */
+#if defined RC_MATCH_TEMPLATE && defined RC_VEC_SUBA && \
+    defined RC_VEC_MACV && defined RC_VEC_MACR && defined RC_VEC_MACN
+#if RC_IMPL(rc_match_ssd_u8, 0)
+uint32_t
+rc_match_ssd_u8(const uint8_t *restrict blk, int blk_dim,
+                const uint8_t *restrict ref, int ref_dim,
+                int width, int height, uint32_t limit)
+{
+    uint32_t sum = 0;
+    RC_VEC_DECLARE();
+    RC_MATCH_TEMPLATE(blk, blk_dim, ref, ref_dim, width, height,
+                      limit, sum, RC_MATCH_ACCUM_SSD, RC_MATCH_REDUCE,
+                      RC_VEC_MACN);
+    RC_VEC_CLEANUP();
+    return sum;
+}
+#endif
+#endif
+
+/**
+ *  Block sum of products.
+ */
+#if defined RC_MATCH_TEMPLATE && defined RC_VEC_MACV && \
+    defined RC_VEC_MACR && defined RC_VEC_MACN
+#if RC_IMPL(rc_match_mac_u8, 0)
+uint32_t
+rc_match_mac_u8(const uint8_t *restrict blk, int blk_dim,
+                const uint8_t *restrict ref, int ref_dim,
+                int width, int height)
+{
+    uint32_t sum = 0;
+    RC_VEC_DECLARE();
+    RC_MATCH_TEMPLATE(blk, blk_dim, ref, ref_dim, width, height,
+                      UINT32_MAX, sum, RC_MATCH_ACCUM_MAC,
+                      RC_MATCH_REDUCE, RC_VEC_MACN);
+    RC_VEC_CLEANUP();
+    return sum;
+}
+#endif
+#endif
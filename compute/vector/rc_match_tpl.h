@@ -0,0 +1,243 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_match_tpl.h
+ *  @brief  RAPP Compute layer block matching templates.
+ *
+ *  IMPLEMENTATION
+ *  --------------
+ *  The block buffer is aligned, but the reference block may start at
+ *  any field. Only aligned vectors are loaded from the reference, and
+ *  they are realigned with RC_VEC_ALIGNC(). The alignment shift must
+ *  be a constant, so the template is expanded once for every field
+ *  offset. The next aligned vector is only loaded if the block extends
+ *  into it, so no data is read beyond the alignment boundary of the
+ *  last pixel in a block row. A partial last vector is masked in both
+ *  buffers before it is accumulated.
+ *
+ *  The accumulation and reduction steps are given as macro arguments.
+ *  The accumulator is reduced after each row, to check the partial
+ *  sum against the early termination limit.
+ */
+
+#ifndef RC_MATCH_TPL_H
+#define RC_MATCH_TPL_H
+
+#include "rc_vector.h" /* Vector operations */
+
+/*
+ * -------------------------------------------------------------
+ *  Exported block matching template
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The block matching template. It computes the sum over all block
+ *  pixels of the accumulation step accum, which is reduced to the
+ *  scalar sum with the reduction step reduce at least every num
+ *  accumulations. The caller needs to wrap this in a
+ *  RC_VEC_DECLARE() / RC_VEC_CLEANUP() pair.
+ */
+#ifdef RC_VEC_ALIGNC
+#define RC_MATCH_TEMPLATE(blk, blk_dim, ref, ref_dim, width, height,   \
+                          limit, sum, accum, reduce, num)              \
+do {                                                                   \
+    int            off_ = (uintptr_t)(ref) % RC_VEC_SIZE;              \
+    const uint8_t *ptr_ = &(ref)[-off_];                               \
+    rc_vec_t       mask_;                                              \
+                                                                       \
+    /* Set up the field mask of a partial last vector */               \
+    RC_VEC_ZERO(mask_);                                                \
+    if ((width) % RC_VEC_SIZE) {                                       \
+        union { rc_vec_t v; uint8_t raw[RC_VEC_SIZE]; } buf_;          \
+        int i_;                                                        \
+        for (i_ = 0; i_ < RC_VEC_SIZE; i_++) {                         \
+            buf_.raw[i_] = i_ < (width) % RC_VEC_SIZE ? 0xff : 0;      \
+        }                                                              \
+        RC_VEC_LOAD(mask_, &buf_.v);                                   \
+    }                                                                  \
+                                                                       \
+    switch (off_) {                                                    \
+        case 0:                                                        \
+            RC_MATCH_BLOCK(blk, blk_dim, ptr_, ref_dim, width, height, \
+                           limit, sum, mask_, accum, reduce, num,      \
+                           0, RC_MATCH_LOAD_VA);                       \
+            break;                                                     \
+        RC_MATCH_CASES_4(blk, blk_dim, ptr_, ref_dim, width, height,   \
+                         limit, sum, mask_, accum, reduce, num);       \
+        RC_MATCH_CASES_8(blk, blk_dim, ptr_, ref_dim, width, height,   \
+                         limit, sum, mask_, accum, reduce, num);       \
+        RC_MATCH_CASES_16(blk, blk_dim, ptr_, ref_dim, width, height,  \
+                          limit, sum, mask_, accum, reduce, num);      \
+        default:                                                       \
+            break;                                                     \
+    }                                                                  \
+} while (0)
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Internal block matching templates
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Load an aligned reference vector.
+ */
+#define RC_MATCH_LOAD_VA(vec, ptr, off, next) \
+do {                                          \
+    RC_VEC_LOAD(vec, ptr);                    \
+    (void)(next);                             \
+} while (0)
+
+/**
+ *  Load a reference vector starting at field off of an aligned vector.
+ *  The next aligned vector is only loaded if @e next is true.
+ */
+#define RC_MATCH_LOAD_VM(vec, ptr, off, next)      \
+do {                                               \
+    rc_vec_t lo_, hi_;                             \
+    RC_VEC_LOAD(lo_, ptr);                         \
+    hi_ = lo_;                                     \
+    if (next) {                                    \
+        RC_VEC_LOAD(hi_, &(ptr)[RC_VEC_SIZE]);     \
+    }                                              \
+    RC_VEC_ALIGNC(vec, lo_, hi_, off);             \
+} while (0)
+
+/**
+ *  The block template for one field offset. The reference pointer
+ *  is aligned, and the reference block starts at field offset off
+ *  from it.
+ */
+#define RC_MATCH_BLOCK(blk, blk_dim, ref, ref_dim, width, height,   \
+                       limit, sum, maskv, accum, reduce, num,       \
+                       off, load)                                   \
+do {                                                                \
+    int      len_  = (width) / RC_VEC_SIZE * RC_VEC_SIZE;           \
+    int      tail_ = (width) - len_;                                \
+    int      next_ = (off) + tail_ > RC_VEC_SIZE;                   \
+    int      cnt_  = 0;                                             \
+    int      y_;                                                    \
+    rc_vec_t acc_;                                                  \
+                                                                    \
+    RC_VEC_ZERO(acc_);                                              \
+    for (y_ = 0; y_ < (height) && (sum) <= (limit); y_++) {         \
+        const uint8_t *row1_ = &(blk)[y_*(blk_dim)];                \
+        const uint8_t *row2_ = &(ref)[y_*(ref_dim)];                \
+        int            x_;                                          \
+                                                                    \
+        for (x_ = 0; x_ < len_; x_ += RC_VEC_SIZE) {                \
+            rc_vec_t vec1_, vec2_;                                  \
+            RC_VEC_LOAD(vec1_, &row1_[x_]);                         \
+            load(vec2_, &row2_[x_], off, 1);                        \
+            accum(acc_, vec1_, vec2_);                              \
+            if (++cnt_ == (num)) {                                  \
+                reduce(sum, acc_);                                  \
+                cnt_ = 0;                                           \
+            }                                                       \
+        }                                                           \
+        if (tail_) {                                                \
+            rc_vec_t vec1_, vec2_;                                  \
+            RC_VEC_LOAD(vec1_, &row1_[len_]);                       \
+            load(vec2_, &row2_[len_], off, next_);                  \
+            RC_VEC_AND(vec1_, vec1_, maskv);                        \
+            RC_VEC_AND(vec2_, vec2_, maskv);                        \
+            accum(acc_, vec1_, vec2_);                              \
+        }                                                           \
+        reduce(sum, acc_);                                          \
+        cnt_ = 0;                                                   \
+    }                                                               \
+} while (0)
+
+/**
+ *  One case of the field offset switch.
+ */
+#define RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,   \
+                      limit, sum, maskv, accum, reduce, num, off)  \
+    case off:                                                      \
+        RC_MATCH_BLOCK(blk, blk_dim, ref, ref_dim, width, height,  \
+                       limit, sum, maskv, accum, reduce, num,      \
+                       off, RC_MATCH_LOAD_VM);                     \
+        break
+
+/**
+ *  The misaligned cases of the field offset switch, in groups
+ *  of four fields.
+ */
+#define RC_MATCH_CASES_4(blk, blk_dim, ref, ref_dim, width, height,     \
+                         limit, sum, maskv, accum, reduce, num)         \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 1);            \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 2);            \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 3)
+
+#if RC_VEC_SIZE > 4
+#define RC_MATCH_CASES_8(blk, blk_dim, ref, ref_dim, width, height,     \
+                         limit, sum, maskv, accum, reduce, num)         \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 4);            \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 5);            \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 6);            \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 7)
+#else
+#define RC_MATCH_CASES_8(blk, blk_dim, ref, ref_dim, width, height,     \
+                         limit, sum, maskv, accum, reduce, num)
+#endif
+
+#if RC_VEC_SIZE > 8
+#define RC_MATCH_CASES_16(blk, blk_dim, ref, ref_dim, width, height,    \
+                          limit, sum, maskv, accum, reduce, num)        \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 8);            \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 9);            \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 10);           \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 11);           \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 12);           \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 13);           \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 14);           \
+    RC_MATCH_CASE(blk, blk_dim, ref, ref_dim, width, height,            \
+                  limit, sum, maskv, accum, reduce, num, 15)
+#else
+#define RC_MATCH_CASES_16(blk, blk_dim, ref, ref_dim, width, height,    \
+                          limit, sum, maskv, accum, reduce, num)
+#endif
+
+#endif /* RC_MATCH_TPL_H */
@@ -0,0 +1,152 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_morph.c
+ *  @brief  RAPP Compute layer 8-bit morphology, vector implementation.
+ *
+ *  The vertical van Herk/Gil-Werman passes only use row-wise min/max
+ *  operations, so we process one vector of horizontally adjacent
+ *  pixels at a time. See the generic implementation for the details
+ *  of the algorithm.
+ */
+
+#include "rc_impl_cfg.h" /* Implementation config */
+#include "rc_vector.h"   /* Vector operations     */
+#include "rc_util.h"     /* RC_DIV_CEIL(), MIN()  */
+#include "rc_morph.h"    /* Morphology API        */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Template macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Row-wise operation dst = op(src1, src2).
+ */
+#define RC_MORPH_ROW(dst, src1, src2, len, op)    \
+do {                                              \
+    int x_;                                       \
+    for (x_ = 0; x_ < (len); x_ += RC_VEC_SIZE) { \
+        rc_vec_t v1_, v2_;                        \
+        RC_VEC_LOAD(v1_, &(src1)[x_]);            \
+        RC_VEC_LOAD(v2_, &(src2)[x_]);            \
+        op(v1_, v1_, v2_);                        \
+        RC_VEC_STORE(&(dst)[x_], v1_);            \
+    }                                             \
+} while (0)
+
+/**
+ *  Vertical van Herk/Gil-Werman line template.
+ */
+#define RC_MORPH_LINE_VERT_TEMPLATE(dst, dst_dim, src, src_dim,          \
+                                    width, height, len, buf, op)         \
+do {                                                                     \
+    int tot_ = RC_VEC_SIZE*RC_DIV_CEIL(width, RC_VEC_SIZE);              \
+    int y_;                                                              \
+    RC_VEC_DECLARE();                                                    \
+    for (y_ = 0; y_ < (height); y_ += (len)) {                           \
+        const uint8_t *sp_ = &(src)[y_*(src_dim)];                       \
+        uint8_t       *dp_ = &(dst)[y_*(dst_dim)];                       \
+        int            n_  = MIN((len), (height) - y_);                  \
+        uint8_t       *lp_ = &dp_[(n_ - 1)*(dst_dim)];                   \
+        int            i_;                                               \
+                                                                         \
+        /* Backward running result over the block */                     \
+        RC_MORPH_ROW(lp_, &sp_[((len) - 1)*(src_dim)],                   \
+                     &sp_[((len) - 1)*(src_dim)], tot_, op);             \
+        for (i_ = (len) - 2; i_ >= n_ - 1; i_--) {                       \
+            RC_MORPH_ROW(lp_, lp_, &sp_[i_*(src_dim)], tot_, op);        \
+        }                                                                \
+        for (i_ = n_ - 2; i_ >= 0; i_--) {                               \
+            RC_MORPH_ROW(&dp_[i_*(dst_dim)], &dp_[(i_ + 1)*(dst_dim)],   \
+                         &sp_[i_*(src_dim)], tot_, op);                  \
+        }                                                                \
+                                                                         \
+        /* Forward running result over the next block */                 \
+        if (n_ > 1) {                                                    \
+            RC_MORPH_ROW(&dp_[(dst_dim)], &dp_[(dst_dim)],               \
+                         &sp_[(len)*(src_dim)], tot_, op);               \
+        }                                                                \
+        if (n_ > 2) {                                                    \
+            RC_MORPH_ROW(buf, &sp_[(len)*(src_dim)],                     \
+                         &sp_[((len) + 1)*(src_dim)], tot_, op);         \
+        }                                                                \
+        for (i_ = 2; i_ < n_; i_++) {                                    \
+            if (i_ > 2) {                                                \
+                RC_MORPH_ROW(buf, buf, &sp_[((len) + i_ - 1)*(src_dim)], \
+                             tot_, op);                                  \
+            }                                                            \
+            RC_MORPH_ROW(&dp_[i_*(dst_dim)], &dp_[i_*(dst_dim)],         \
+                         buf, tot_, op);                                 \
+        }                                                                \
+    }                                                                    \
+    RC_VEC_CLEANUP();                                                    \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Erosion with a vertical line.
+ */
+#if    RC_IMPL(rc_morph_erode_line_vert_u8, 0)
+#ifdef RC_VEC_MIN
+void
+rc_morph_erode_line_vert_u8(uint8_t *restrict dst, int dst_dim,
+                            const uint8_t *restrict src, int src_dim,
+                            int width, int height, int len,
+                            uint8_t *restrict buf)
+{
+    RC_MORPH_LINE_VERT_TEMPLATE(dst, dst_dim, src, src_dim,
+                                width, height, len, buf, RC_VEC_MIN);
+}
+#endif
+#endif
+
+/**
+ *  Dilation with a vertical line.
+ */
+#if    RC_IMPL(rc_morph_dilate_line_vert_u8, 0)
+#ifdef RC_VEC_MAX
+void
+rc_morph_dilate_line_vert_u8(uint8_t *restrict dst, int dst_dim,
+                             const uint8_t *restrict src, int src_dim,
+                             int width, int height, int len,
+                             uint8_t *restrict buf)
+{
+    RC_MORPH_LINE_VERT_TEMPLATE(dst, dst_dim, src, src_dim,
+                                width, height, len, buf, RC_VEC_MAX);
+}
+#endif
+#endif
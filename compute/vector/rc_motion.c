@@ -0,0 +1,107 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_motion.c
+ *  @brief  RAPP Compute layer motion estimation, vector implementation.
+ *
+ *  IMPLEMENTATION
+ *  --------------
+ *  The block SAD is computed with the block matching templates, see
+ *  rc_match_tpl.h.
+ */
+
+#include "rc_impl_cfg.h"  /* Implementation cfg       */
+#include "rc_vector.h"    /* Vector API               */
+#include "rc_motion.h"    /* Motion API               */
+#include "rc_match_tpl.h" /* Block matching templates */
+
+#if defined RC_VEC_SUMN && RC_VEC_SUMN > 1 && RC_VEC_SUMN % 4 != 0
+#error RC_VEC_SUMN must be divisible by 4
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local macros
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Accumulate the absolute differences.
+ */
+#ifdef RC_VEC_SADV
+#define RC_MOTION_ACCUM(acc, vec1, vec2) \
+    RC_VEC_SADV(acc, vec1, vec2)
+#elif defined RC_VEC_SUBA && defined RC_VEC_SUMV
+#define RC_MOTION_ACCUM(acc, vec1, vec2) \
+do {                                     \
+    rc_vec_t dif_;                       \
+    RC_VEC_SUBA(dif_, vec1, vec2);       \
+    RC_VEC_SUMV(acc, dif_);              \
+} while (0)
+#endif
+
+/**
+ *  Reduce the accumulator vector to the scalar sum.
+ */
+#define RC_MOTION_REDUCE(sum, acc) \
+do {                               \
+    uint32_t tmp_;                 \
+    RC_VEC_SUMR(tmp_, acc);        \
+    RC_VEC_ZERO(acc);              \
+    (sum) += tmp_;                 \
+} while (0)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Block sum of absolute differences with early termination.
+ */
+#if defined RC_MATCH_TEMPLATE && defined RC_MOTION_ACCUM && \
+    defined RC_VEC_SUMR && defined RC_VEC_SUMN
+#if RC_IMPL(rc_motion_sad_u8, 0)
+uint32_t
+rc_motion_sad_u8(const uint8_t *restrict blk, int blk_dim,
+                 const uint8_t *restrict ref, int ref_dim,
+                 int width, int height, uint32_t limit)
+{
+    uint32_t sum = 0;
+    RC_VEC_DECLARE();
+    RC_MATCH_TEMPLATE(blk, blk_dim, ref, ref_dim, width, height,
+                      limit, sum, RC_MOTION_ACCUM, RC_MOTION_REDUCE,
+                      RC_VEC_SUMN);
+    RC_VEC_CLEANUP();
+    return sum;
+}
+#endif
+#endif
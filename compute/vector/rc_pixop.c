@@ -85,6 +85,24 @@
     RC_VEC_SUBA(vec1, vec1, vec2)
 #endif
 
+#ifdef RC_VEC_ADDS16
+#define RC_PIXOP_ADDS16(vec1, vec2, arg1, arg2) \
+    RC_VEC_ADDS16(vec1, vec1, vec2)
+#endif
+
+#ifdef RC_VEC_SUBS16
+#define RC_PIXOP_SUBS16(vec1, vec2, arg1, arg2) \
+    RC_VEC_SUBS16(vec1, vec1, vec2)
+
+#define RC_PIXOP_SUBA16(vec1, vec2, arg1, arg2) \
+do {                                            \
+    rc_vec_t tmp_;                              \
+    RC_VEC_SUBS16(tmp_, vec2, vec1);            \
+    RC_VEC_SUBS16(vec1, vec1, vec2);            \
+    RC_VEC_OR(vec1, vec1, tmp_);                \
+} while (0)
+#endif
+
 #if defined RC_VEC_LERP && defined RC_VEC_BLEND
 #define RC_PIXOP_LERP_NOR(vec1, vec2, blend8, blendv) \
     RC_VEC_LERP(vec1, vec1, vec2, blend8, blendv)
@@ -714,3 +732,81 @@ rc_pixop_norm_u8(uint8_t *restrict dst, int dst_dim,
 }
 #endif
 #endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  16-bit functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Saturated addition, 16-bit.
+ *  The 16-bit pixels are processed as pairs of bytes.
+ */
+#if    RC_IMPL(rc_pixop_add_u16, 1)
+#ifdef RC_PIXOP_ADDS16
+void
+rc_pixop_add_u16(uint16_t *restrict dst, int dst_dim,
+                 const uint16_t *restrict src, int src_dim,
+                 int width, int height)
+{
+    RC_VEC_DECLARE();
+
+    RC_PIXOP_TEMPLATE2((uint8_t *)dst, dst_dim,
+                       (const uint8_t *)src, src_dim, 2*width, height,
+                       RC_PIXOP_ADDS16, 0, 0,
+                       RC_UNROLL(rc_pixop_add_u16));
+
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+
+/**
+ *  Saturated subtraction, 16-bit.
+ *  The 16-bit pixels are processed as pairs of bytes.
+ */
+#if    RC_IMPL(rc_pixop_sub_u16, 1)
+#ifdef RC_PIXOP_SUBS16
+void
+rc_pixop_sub_u16(uint16_t *restrict dst, int dst_dim,
+                 const uint16_t *restrict src, int src_dim,
+                 int width, int height)
+{
+    RC_VEC_DECLARE();
+
+    RC_PIXOP_TEMPLATE2((uint8_t *)dst, dst_dim,
+                       (const uint8_t *)src, src_dim, 2*width, height,
+                       RC_PIXOP_SUBS16, 0, 0,
+                       RC_UNROLL(rc_pixop_sub_u16));
+
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+
+/**
+ *  Absolute-value subtraction, 16-bit.
+ *  The 16-bit pixels are processed as pairs of bytes.
+ */
+#if    RC_IMPL(rc_pixop_suba_u16, 1)
+#ifdef RC_PIXOP_SUBA16
+void
+rc_pixop_suba_u16(uint16_t *restrict dst, int dst_dim,
+                  const uint16_t *restrict src, int src_dim,
+                  int width, int height)
+{
+    RC_VEC_DECLARE();
+
+    RC_PIXOP_TEMPLATE2((uint8_t *)dst, dst_dim,
+                       (const uint8_t *)src, src_dim, 2*width, height,
+                       RC_PIXOP_SUBA16, 0, 0,
+                       RC_UNROLL(rc_pixop_suba_u16));
+
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
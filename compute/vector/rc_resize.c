@@ -0,0 +1,101 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rc_resize.c
+ *  @brief  RAPP Compute layer arbitrary-ratio resizing, vector implementation.
+ *
+ *  The vertical pass is a weighted sum of whole rows with the same
+ *  weights for all pixels, and it is computed with the widening
+ *  multiply-accumulate operation RC_VEC_MACW(). The weights are at most
+ *  128 and sum to 128, so the 16-bit accumulators never overflow.
+ *  The source rows with zero weight are not loaded. The horizontal
+ *  pass gathers pixels from arbitrary positions, and it has no vector
+ *  implementation.
+ */
+
+#include "rc_impl_cfg.h" /* Implementation config */
+#include "rc_vector.h"   /* Vector operations     */
+#include "rc_util.h"     /* RC_DIV_CEIL()         */
+#include "rc_resize.h"   /* Resize API            */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  8-bit vertical resampling.
+ */
+#if RC_IMPL(rc_resize_vert_u8, 0)
+#if defined RC_VEC_COEF && defined RC_VEC_MACW && defined RC_VEC_PACKW
+void
+rc_resize_vert_u8(uint8_t *restrict dst, int dst_dim,
+                  const uint8_t *restrict src, int src_dim,
+                  int width, int height,
+                  const int *idx, const uint8_t *coef, int taps)
+{
+    int tot = RC_DIV_CEIL(width, RC_VEC_SIZE);
+    int y;
+
+    RC_VEC_DECLARE();
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *sp = &src[idx[y]*src_dim];
+        const uint8_t *cf = &coef[taps*y];
+        rc_vec_t       cv[RC_RESIZE_TAPS_MAX];
+        int            x, k;
+
+        /* Set up the coefficient vectors */
+        for (k = 0; k < taps; k++) {
+            RC_VEC_COEF(cv[k], cf[k]);
+        }
+
+        for (x = 0; x < tot; x++) {
+            const uint8_t *ptr = &sp[x*RC_VEC_SIZE];
+            rc_vec_t       acc1, acc2, pv;
+
+            RC_VEC_ZERO(acc1);
+            RC_VEC_ZERO(acc2);
+            for (k = 0; k < taps; k++, ptr += src_dim) {
+                if (cf[k] != 0) {
+                    rc_vec_t sv;
+                    RC_VEC_LOAD(sv, ptr);
+                    RC_VEC_MACW(acc1, acc2, sv, cv[k]);
+                }
+            }
+
+            RC_VEC_PACKW(pv, acc1, acc2, 7);
+            RC_VEC_STORE(&dst[y*dst_dim + x*RC_VEC_SIZE], pv);
+        }
+    }
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
@@ -44,10 +44,18 @@
  *  count is 1, suffixed with gen/GEN, and one where the count is
  *  greater than 1, suffixed with acc/ACC. Template macros are used
  *  if the template is used in more than one place.
+ *
+ *  The masked functions expand one binary mask vector at a time to
+ *  eight 8-bit field masks with RC_VEC_SETMASKV(), and clear the
+ *  unmasked pixels before accumulating. A mask vector where all words
+ *  are zero is skipped together with its eight pixel vectors. The
+ *  accumulator is reduced after each mask vector if needed to stay
+ *  within the iteration count.
  */
 
 #include "rc_impl_cfg.h" /* Implementation cfg */
 #include "rc_vector.h"   /* Vector API         */
+#include "rc_word.h"     /* Word operations    */
 #include "rc_util.h"     /* Utilities          */
 #include "rc_stat.h"     /* Statistics API     */
 
@@ -87,6 +95,27 @@ do {                                        \
 } while (0)
 #endif
 
+#if defined RC_VEC_SADV
+#define RC_STAT_ACCUM_SAD(acc, vec1, vec2) \
+    RC_VEC_SADV(acc, vec1, vec2)
+#elif defined RC_VEC_SUBA && defined RC_VEC_SUMV
+#define RC_STAT_ACCUM_SAD(acc, vec1, vec2) \
+do {                                       \
+    rc_vec_t dif_;                         \
+    RC_VEC_SUBA(dif_, vec1, vec2);         \
+    RC_VEC_SUMV(acc, dif_);                \
+} while (0)
+#endif
+
+#if defined RC_VEC_SUBA && defined RC_VEC_MACV
+#define RC_STAT_ACCUM_SSD(acc, vec1, vec2) \
+do {                                       \
+    rc_vec_t dif_;                         \
+    RC_VEC_SUBA(dif_, vec1, vec2);         \
+    RC_VEC_MACV(acc, dif_, dif_);          \
+} while (0)
+#endif
+
 #if defined RC_VEC_CNTR && defined RC_VEC_ZERO
 #define RC_STAT_REDUCE_CNT(sum1, sum2, acc1, acc2) \
 do {                                               \
@@ -143,6 +172,17 @@ do {                                               \
 } while (0)
 #endif
 
+#if defined RC_VEC_MACR && defined RC_VEC_ZERO
+#define RC_STAT_REDUCE_MAC(sum1, sum2, acc1, acc2) \
+do {                                               \
+    uint32_t tmp;                                  \
+    RC_VEC_MACR(tmp, acc1);                        \
+    RC_VEC_ZERO(acc1);                             \
+    (sum1) += tmp;                                 \
+    (void)(acc2);                                  \
+} while (0)
+#endif
+
 
 /**
  *  Single-operand template.
@@ -300,6 +340,36 @@ do {                                          \
 } while (0)
 #endif
 
+/**
+ *  Template for the difference sums of two images.
+ *  The accumulator is reduced after every iter vectors.
+ */
+#define RC_STAT_DIFF_TEMPLATE(src1, src1_dim, src2, src2_dim, width, \
+                              height, sum, acc, accum, reduce, iter) \
+do {                                                                 \
+    int len = RC_DIV_CEIL(width, RC_VEC_SIZE)*RC_VEC_SIZE;           \
+    int cnt = 0;                                                     \
+    int y;                                                           \
+                                                                     \
+    for (y = 0; y < (height); y++) {                                 \
+        const uint8_t *row1 = &(src1)[y*(src1_dim)];                 \
+        const uint8_t *row2 = &(src2)[y*(src2_dim)];                 \
+        int            x;                                            \
+                                                                     \
+        for (x = 0; x < len; x += RC_VEC_SIZE) {                     \
+            rc_vec_t vec1, vec2;                                     \
+            RC_VEC_LOAD(vec1, &row1[x]);                             \
+            RC_VEC_LOAD(vec2, &row2[x]);                             \
+            accum(acc, vec1, vec2);                                  \
+            if (++cnt == (iter)) {                                   \
+                reduce(sum, 0, acc, acc);                            \
+                cnt = 0;                                             \
+            }                                                        \
+        }                                                            \
+    }                                                                \
+    reduce(sum, 0, acc, acc);                                        \
+} while (0)
+
 /**
  *  Find min or max in vector
  */
@@ -317,11 +387,55 @@ do {                                                      \
 } while (0)
 
 
+/**
+ *  Find min or max in a vector of 16-bit fields.
+ */
+#define RC_STAT_MINMAX_REDUCE16(vec, res, minmax)              \
+do {                                                           \
+    /* Get a buf_.raw[] that is correctly aligned */           \
+    union { rc_vec_t v; uint16_t raw[RC_VEC_SIZE / 2]; } buf_; \
+    int i;                                                     \
+                                                               \
+    RC_VEC_STORE(&buf_.v, vec);                                \
+    res = buf_.raw[0];                                         \
+    for (i = 1; i < RC_VEC_SIZE / 2; i++) {                    \
+        res = minmax(res, buf_.raw[i]);                        \
+    }                                                          \
+} while (0)
+
+
 /**
  *  Template for the min max functions.
  */
 #define RC_STAT_MINMAX_TEMPLATE(buf, dim, width, height, vec,   \
                                 res, minmax, reduce, unroll)    \
+do {                                                            \
+    RC_STAT_MINMAX_ACCUM_(buf, dim, width, height, vec,         \
+                          minmax, unroll);                      \
+                                                                \
+    /* Find min or max in the resulting vector */               \
+    RC_STAT_MINMAX_REDUCE(vec, res, reduce);                    \
+} while (0)
+
+/**
+ *  Template for the 16-bit min max functions.
+ *  The width is given in pixels, the dimension in bytes.
+ */
+#define RC_STAT_MINMAX_TEMPLATE16(buf, dim, width, height, vec, \
+                                  res, minmax, reduce, unroll)  \
+do {                                                            \
+    RC_STAT_MINMAX_ACCUM_(buf, dim, 2*(width), height, vec,     \
+                          minmax, unroll);                      \
+                                                                \
+    /* Find min or max in the resulting vector */               \
+    RC_STAT_MINMAX_REDUCE16(vec, res, reduce);                  \
+} while (0)
+
+/**
+ *  Accumulate the min or max of all vectors in an image.
+ */
+#define RC_STAT_MINMAX_ACCUM_(buf, dim, width, height, vec,     \
+                              minmax, unroll)                   \
 do {                                                            \
     int len  = RC_DIV_CEIL(width, RC_VEC_SIZE);                 \
     int full = (len) / (unroll);                                \
@@ -349,11 +463,188 @@ do {                                                            \
             RC_STAT_ITER(buf, i, vec, vec, minmax);             \
         }                                                       \
     }                                                           \
-                                                                \
-    /* Find min or max in the resulting vector */               \
-    RC_STAT_MINMAX_REDUCE(vec, res, reduce);                    \
 } while (0)
 
+/**
+ *  Masked sum accumulation.
+ */
+#if defined RC_VEC_AND && defined RC_VEC_SUMV
+#define RC_STAT_MASK_ACCUM_SUM(acc1, acc2, vec, maskv) \
+do {                                                   \
+    rc_vec_t mvec_;                                    \
+    RC_VEC_AND(mvec_, vec, maskv);                     \
+    RC_VEC_SUMV(acc1, mvec_);                          \
+} while (0)
+#endif
+
+/**
+ *  Masked sum and squared sum accumulation.
+ */
+#if defined RC_VEC_AND && defined RC_VEC_SUMV && defined RC_VEC_MACV
+#define RC_STAT_MASK_ACCUM_SUM2(acc1, acc2, vec, maskv) \
+do {                                                    \
+    rc_vec_t mvec_;                                     \
+    RC_VEC_AND(mvec_, vec, maskv);                      \
+    RC_VEC_SUMV(acc1, mvec_);                           \
+    RC_VEC_MACV(acc2, mvec_, mvec_);                    \
+} while (0)
+#endif
+
+/**
+ *  Masked min accumulation. Unmasked pixels are set to 0xff.
+ */
+#if defined RC_VEC_ORNOT && defined RC_VEC_MIN
+#define RC_STAT_MASK_ACCUM_MIN(acc1, acc2, vec, maskv) \
+do {                                                   \
+    rc_vec_t mvec_;                                    \
+    RC_VEC_ORNOT(mvec_, vec, maskv);                   \
+    RC_VEC_MIN(acc1, acc1, mvec_);                     \
+} while (0)
+#endif
+
+/**
+ *  Masked max accumulation. Unmasked pixels are set to zero.
+ */
+#if defined RC_VEC_AND && defined RC_VEC_MAX
+#define RC_STAT_MASK_ACCUM_MAX(acc1, acc2, vec, maskv) \
+do {                                                   \
+    rc_vec_t mvec_;                                    \
+    RC_VEC_AND(mvec_, vec, maskv);                     \
+    RC_VEC_MAX(acc1, acc1, mvec_);                     \
+} while (0)
+#endif
+
+/**
+ *  The min and max accumulators need no intermediate reduction.
+ */
+#define RC_STAT_MASK_REDUCE_NONE(sum1, sum2, acc1, acc2) \
+do {                                                     \
+    (void)(acc1);                                        \
+    (void)(acc2);                                        \
+} while (0)
+
+/**
+ *  Masked single-operand template. One mask vector covers eight
+ *  pixel vectors, and is skipped if all its words are zero.
+ *  The accumulators are reduced at most every @e iter pixel vectors.
+ *  The caller needs to wrap this in a
+ *  RC_VEC_DECLARE() / RC_VEC_CLEANUP() pair.
+ */
+#if defined RC_VEC_SETMASKV && defined RC_VEC_SHLC && \
+    RC_VEC_SIZE >= RC_WORD_SIZE
+#define RC_STAT_MASK_TEMPLATE(buf, dim, map, map_dim, width, height, \
+                              sum1, sum2, acc1, acc2,                \
+                              accum, reduce, iter)                   \
+do {                                                                 \
+    int tot_ = RC_DIV_CEIL(width, RC_VEC_SIZE); /* Pixel vectors */  \
+    int cnt_ = 0;                               /* Accumulated   */  \
+    int y_;                                                          \
+                                                                     \
+    for (y_ = 0; y_ < (height); y_++) {                              \
+        int i_ = y_*(dim);                                           \
+        int m_ = y_*(map_dim);                                       \
+        int x_;                                                      \
+                                                                     \
+        for (x_ = 0; x_ < tot_; x_ += 8) {                           \
+            rc_word_t word_ = 0;                                     \
+            int       k_;                                            \
+                                                                     \
+            /* Check if any mask bit is set */                       \
+            for (k_ = 0; k_ < RC_VEC_SIZE; k_ += RC_WORD_SIZE) {     \
+                word_ |= RC_WORD_LOAD(&(map)[m_ + k_]);              \
+            }                                                        \
+                                                                     \
+            if (word_) {                                             \
+                int      num_ = MIN(tot_ - x_, 8);                   \
+                rc_vec_t mv_;                                        \
+                                                                     \
+                RC_VEC_LOAD(mv_, &(map)[m_]);                        \
+                for (k_ = 0; k_ < num_; k_++) {                      \
+                    rc_vec_t vec_, ev_, tv_;                         \
+                    RC_VEC_LOAD(vec_, &(buf)[i_ + k_*RC_VEC_SIZE]);  \
+                    RC_VEC_SETMASKV(ev_, mv_);                       \
+                    accum(acc1, acc2, vec_, ev_);                    \
+                    RC_VEC_SHLC(tv_, mv_, RC_VEC_SIZE / 8);          \
+                    mv_ = tv_;                                       \
+                    if ((iter) < 8) {                                \
+                        reduce(sum1, sum2, acc1, acc2);              \
+                    }                                                \
+                }                                                    \
+                                                                     \
+                /* Reduce before the accumulators can overflow */    \
+                cnt_ += 8;                                           \
+                if ((iter) >= 8 && cnt_ > (iter) - 8) {              \
+                    reduce(sum1, sum2, acc1, acc2);                  \
+                    cnt_ = 0;                                        \
+                }                                                    \
+            }                                                        \
+            i_ += 8*RC_VEC_SIZE;                                     \
+            m_ += RC_VEC_SIZE;                                       \
+        }                                                            \
+    }                                                                \
+    reduce(sum1, sum2, acc1, acc2);                                  \
+} while (0)
+#endif
+
+/**
+ *  Check if any bit is set in a vector, one word at a time.
+ */
+#if RC_VEC_SIZE >= RC_WORD_SIZE
+#define RC_STAT_NONZERO(res, vec)                         \
+do {                                                      \
+    /* Get a buf_.raw[] that is correctly aligned */      \
+    union { rc_vec_t v; uint8_t raw[RC_VEC_SIZE]; } buf_; \
+    int k_;                                               \
+                                                          \
+    RC_VEC_STORE(&buf_.v, vec);                           \
+    (res) = 0;                                            \
+    for (k_ = 0; k_ < RC_VEC_SIZE; k_ += RC_WORD_SIZE) {  \
+        (res) |= RC_WORD_LOAD(&buf_.raw[k_]);             \
+    }                                                     \
+} while (0)
+#endif
+
+/**
+ *  Find min or max in a vector by folding it onto itself, halving
+ *  the number of candidate fields in each step. The result ends up
+ *  in the first field.
+ */
+#ifdef RC_VEC_SHLC
+#define RC_STAT_MINMAX_FOLD(vec, minmax, bytes) \
+do {                                            \
+    rc_vec_t tmp_;                              \
+    RC_VEC_SHLC(tmp_, vec, bytes);              \
+    minmax(vec, vec, tmp_);                     \
+} while (0)
+
+#if RC_VEC_SIZE > 8
+#define RC_STAT_MINMAX_FOLD8(vec, minmax) \
+    RC_STAT_MINMAX_FOLD(vec, minmax, 8)
+#else
+#define RC_STAT_MINMAX_FOLD8(vec, minmax) ((void)0)
+#endif
+
+#if RC_VEC_SIZE > 4
+#define RC_STAT_MINMAX_FOLD4(vec, minmax) \
+    RC_STAT_MINMAX_FOLD(vec, minmax, 4)
+#else
+#define RC_STAT_MINMAX_FOLD4(vec, minmax) ((void)0)
+#endif
+
+#define RC_STAT_MINMAX_TREE(vec, res, minmax)             \
+do {                                                      \
+    /* Get a buf_.raw[] that is correctly aligned */      \
+    union { rc_vec_t v; uint8_t raw[RC_VEC_SIZE]; } buf_; \
+                                                          \
+    RC_STAT_MINMAX_FOLD8(vec, minmax);                    \
+    RC_STAT_MINMAX_FOLD4(vec, minmax);                    \
+    RC_STAT_MINMAX_FOLD(vec, minmax, 2);                  \
+    RC_STAT_MINMAX_FOLD(vec, minmax, 1);                  \
+    RC_VEC_STORE(&buf_.v, vec);                           \
+    (res) = buf_.raw[0];                                  \
+} while (0)
+#endif
+
 /*
  * -------------------------------------------------------------
  *  Local functions fwd declare
@@ -375,6 +666,16 @@ rc_stat_xsum_acc(const uint8_t *restrict src1, int src1_dim,
 #endif
 #endif
 
+#if defined RC_VEC_MAX && defined RC_VEC_SUBS && defined RC_VEC_SPLAT && \
+    defined RC_STAT_NONZERO
+#define RC_STAT_max_k_gate
+#if RC_IMPL(rc_stat_max_k_u8, 0)
+static int
+rc_stat_max_k_insert(const uint8_t *buf, int dim, unsigned *pos,
+                     int num, int k, int x, int y);
+#endif
+#endif
+
 
 /*
  * -------------------------------------------------------------
@@ -563,6 +864,642 @@ rc_stat_max_u8(const uint8_t *buf, int dim, int width, int height)
 #endif
 
 
+/**
+ *  16-bit pixel min.
+ */
+#if defined RC_VEC_MIN16 && defined RC_VEC_SPLAT16
+#if RC_IMPL(rc_stat_min_u16, 1)
+int
+rc_stat_min_u16(const uint16_t *buf, int dim, int width, int height)
+{
+    const uint8_t *ptr = (const uint8_t *)buf;
+    rc_vec_t       vec;
+    uint16_t       min;
+    RC_VEC_DECLARE();
+
+    RC_VEC_SPLAT16(vec, 0xffff);
+    RC_STAT_MINMAX_TEMPLATE16(ptr, dim, width, height,
+                              vec, min, RC_VEC_MIN16, MIN,
+                              RC_UNROLL(rc_stat_min_u16));
+
+    RC_VEC_CLEANUP();
+    return min;
+}
+#endif
+#endif
+
+
+/**
+ *  16-bit pixel max.
+ */
+#if defined RC_VEC_MAX16 && defined RC_VEC_ZERO
+#if RC_IMPL(rc_stat_max_u16, 1)
+int
+rc_stat_max_u16(const uint16_t *buf, int dim, int width, int height)
+{
+    const uint8_t *ptr = (const uint8_t *)buf;
+    rc_vec_t       vec;
+    uint16_t       max;
+    RC_VEC_DECLARE();
+
+    RC_VEC_ZERO(vec);
+    RC_STAT_MINMAX_TEMPLATE16(ptr, dim, width, height,
+                              vec, max, RC_VEC_MAX16, MAX,
+                              RC_UNROLL(rc_stat_max_u16));
+
+    RC_VEC_CLEANUP();
+    return max;
+}
+#endif
+#endif
+
+/**
+ *  8-bit pixel sum with a binary mask.
+ */
+#if defined RC_STAT_MASK_TEMPLATE && defined RC_STAT_MASK_ACCUM_SUM && \
+    defined RC_STAT_REDUCE_SUM && defined RC_VEC_SUMN
+#if RC_IMPL(rc_stat_sum_mask_u8, 0)
+uint32_t
+rc_stat_sum_mask_u8(const uint8_t *buf, int dim,
+                    const uint8_t *map, int map_dim,
+                    int width, int height)
+{
+    uint32_t sum = 0;
+    rc_vec_t acc;
+    RC_VEC_DECLARE();
+
+    RC_VEC_ZERO(acc);
+    RC_STAT_MASK_TEMPLATE(buf, dim, map, map_dim, width, height,
+                          sum, 0, acc, acc, RC_STAT_MASK_ACCUM_SUM,
+                          RC_STAT_REDUCE_SUM, RC_VEC_SUMN);
+
+    RC_VEC_CLEANUP();
+    return sum;
+}
+#endif
+#endif
+
+
+/**
+ *  8-bit pixel sum and squared sum with a binary mask.
+ */
+#if defined RC_STAT_MASK_TEMPLATE && defined RC_STAT_MASK_ACCUM_SUM2 && \
+    defined RC_STAT_REDUCE_SUM2 && defined RC_VEC_SUMN && \
+    defined RC_VEC_MACN
+#if RC_IMPL(rc_stat_sum2_mask_u8, 0)
+void
+rc_stat_sum2_mask_u8(const uint8_t *buf, int dim,
+                     const uint8_t *map, int map_dim,
+                     int width, int height, uintmax_t sum[2])
+{
+    uint32_t  sum1 = 0;
+    uintmax_t sum2 = 0;
+    rc_vec_t  acc1, acc2;
+    RC_VEC_DECLARE();
+
+    RC_VEC_ZERO(acc1);
+    RC_VEC_ZERO(acc2);
+    RC_STAT_MASK_TEMPLATE(buf, dim, map, map_dim, width, height,
+                          sum1, sum2, acc1, acc2, RC_STAT_MASK_ACCUM_SUM2,
+                          RC_STAT_REDUCE_SUM2,
+                          MIN(RC_VEC_SUMN, RC_VEC_MACN));
+    sum[0] = sum1;
+    sum[1] = sum2;
+
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+
+/**
+ *  8-bit pixel min with a binary mask.
+ */
+#if defined RC_STAT_MASK_TEMPLATE && defined RC_STAT_MASK_ACCUM_MIN && \
+    defined RC_VEC_SPLAT
+#if RC_IMPL(rc_stat_min_mask_u8, 0)
+int
+rc_stat_min_mask_u8(const uint8_t *buf, int dim,
+                    const uint8_t *map, int map_dim,
+                    int width, int height)
+{
+    rc_vec_t vec;
+    uint8_t  min;
+    RC_VEC_DECLARE();
+
+    RC_VEC_SPLAT(vec, 0xff);
+    RC_STAT_MASK_TEMPLATE(buf, dim, map, map_dim, width, height,
+                          0, 0, vec, vec, RC_STAT_MASK_ACCUM_MIN,
+                          RC_STAT_MASK_REDUCE_NONE, 8);
+    RC_STAT_MINMAX_REDUCE(vec, min, MIN);
+
+    RC_VEC_CLEANUP();
+    return min;
+}
+#endif
+#endif
+
+
+/**
+ *  8-bit pixel max with a binary mask.
+ */
+#if defined RC_STAT_MASK_TEMPLATE && defined RC_STAT_MASK_ACCUM_MAX && \
+    defined RC_VEC_ZERO
+#if RC_IMPL(rc_stat_max_mask_u8, 0)
+int
+rc_stat_max_mask_u8(const uint8_t *buf, int dim,
+                    const uint8_t *map, int map_dim,
+                    int width, int height)
+{
+    rc_vec_t vec;
+    uint8_t  max;
+    RC_VEC_DECLARE();
+
+    RC_VEC_ZERO(vec);
+    RC_STAT_MASK_TEMPLATE(buf, dim, map, map_dim, width, height,
+                          0, 0, vec, vec, RC_STAT_MASK_ACCUM_MAX,
+                          RC_STAT_MASK_REDUCE_NONE, 8);
+    RC_STAT_MINMAX_REDUCE(vec, max, MAX);
+
+    RC_VEC_CLEANUP();
+    return max;
+}
+#endif
+#endif
+
+/**
+ *  8-bit pixel min and max with location.
+ *  The row min and max vectors start at the current global values,
+ *  so a field only changes if the row has a new strict min or max.
+ *  The horizontal reduction is only done for those rows, and only
+ *  the first row with the final min and max is searched for the
+ *  location.
+ */
+#if defined RC_VEC_MIN && defined RC_VEC_MAX && defined RC_VEC_XOR && \
+    defined RC_VEC_OR  && defined RC_VEC_SPLAT && defined RC_STAT_NONZERO
+#if RC_IMPL(rc_stat_minmax_loc_u8, 0)
+void
+rc_stat_minmax_loc_u8(const uint8_t *buf, int dim, int width, int height,
+                      int minmax[2], unsigned pos[4])
+{
+    int      len  = width / RC_VEC_SIZE; /* Full vectors */
+    uint8_t  min  = UINT8_MAX;
+    uint8_t  max  = 0;
+    int      ymin = 0;
+    int      ymax = 0;
+    rc_vec_t minv, maxv;
+    int      x, y;
+    RC_VEC_DECLARE();
+
+    RC_VEC_SPLAT(minv, min);
+    RC_VEC_SPLAT(maxv, max);
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row   = &buf[y*dim];
+        rc_vec_t       rminv = minv;
+        rc_vec_t       rmaxv = maxv;
+        rc_vec_t       tminv, tmaxv, difv;
+        rc_word_t      dif;
+        uint8_t        rmin  = min;
+        uint8_t        rmax  = max;
+        int            j;
+
+        /* Accumulate the row min and max of all full vectors */
+        for (x = 0, j = 0; x < len; x++, j += RC_VEC_SIZE) {
+            rc_vec_t vec;
+            RC_VEC_LOAD(vec, &row[j]);
+            RC_VEC_MIN(rminv, rminv, vec);
+            RC_VEC_MAX(rmaxv, rmaxv, vec);
+        }
+
+        /* Handle the remaining pixels, without reading the padding */
+        for (; j < width; j++) {
+            rmin = MIN(rmin, row[j]);
+            rmax = MAX(rmax, row[j]);
+        }
+
+        /* Reduce if the row has a new min or max */
+        RC_VEC_XOR(tminv, rminv, minv);
+        RC_VEC_XOR(tmaxv, rmaxv, maxv);
+        RC_VEC_OR(difv, tminv, tmaxv);
+        RC_STAT_NONZERO(dif, difv);
+        if (dif || rmin < min || rmax > max) {
+            uint8_t vmin, vmax;
+            RC_STAT_MINMAX_REDUCE(rminv, vmin, MIN);
+            RC_STAT_MINMAX_REDUCE(rmaxv, vmax, MAX);
+            rmin = MIN(rmin, vmin);
+            rmax = MAX(rmax, vmax);
+            if (rmin < min) {
+                min  = rmin;
+                ymin = y;
+                RC_VEC_SPLAT(minv, min);
+            }
+            if (rmax > max) {
+                max  = rmax;
+                ymax = y;
+                RC_VEC_SPLAT(maxv, max);
+            }
+        }
+    }
+
+    /* Locate the first min and max pixels in their rows */
+    x = 0;
+    while (buf[ymin*dim + x] != min) {
+        x++;
+    }
+    pos[0] = x;
+    pos[1] = ymin;
+    x = 0;
+    while (buf[ymax*dim + x] != max) {
+        x++;
+    }
+    pos[2] = x;
+    pos[3] = ymax;
+
+    minmax[0] = min;
+    minmax[1] = max;
+
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+/**
+ *  The number of vectors in a block of the top-K search.
+ */
+#define RC_STAT_MAX_K_BLOCK 4
+
+/**
+ *  8-bit top-K pixel locations.
+ *  The max of the full vectors of each row is compared with the
+ *  smallest value of the list, and then the max of each block of
+ *  vectors in the rows that have a larger pixel. Only the blocks
+ *  with a larger pixel are searched. The remaining pixels of a row
+ *  are checked one by one, without reading the padding.
+ */
+#ifdef RC_STAT_max_k_gate
+#if RC_IMPL(rc_stat_max_k_u8, 0)
+int
+rc_stat_max_k_u8(const uint8_t *buf, int dim, int width, int height,
+                 unsigned *pos, int k)
+{
+    int      len = width & ~(RC_VEC_SIZE - 1); /* Full vectors   */
+    unsigned thr = 0;                           /* Smallest value */
+    int      num = 0;
+    rc_vec_t thrv;
+    int      x, y;
+    RC_VEC_DECLARE();
+
+    RC_VEC_SPLAT(thrv, 0);
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *row = &buf[y*dim];
+        rc_vec_t       rmaxv = thrv;
+        rc_word_t      rdif;
+
+        /* Check if the row has a pixel above the threshold */
+        for (x = 0; x < len; x += RC_VEC_SIZE) {
+            rc_vec_t vec;
+            RC_VEC_LOAD(vec, &row[x]);
+            RC_VEC_MAX(rmaxv, rmaxv, vec);
+        }
+        RC_VEC_SUBS(rmaxv, rmaxv, thrv);
+        RC_STAT_NONZERO(rdif, rmaxv);
+
+        /* Search the blocks that have a pixel above the threshold */
+        for (x = 0; (rdif || num < k) && x < len;
+             x += RC_STAT_MAX_K_BLOCK*RC_VEC_SIZE)
+        {
+            int       end = MIN(len, x + RC_STAT_MAX_K_BLOCK*RC_VEC_SIZE);
+            rc_vec_t  maxv, vec;
+            rc_word_t dif;
+            int       i;
+
+            RC_VEC_LOAD(maxv, &row[x]);
+            for (i = x + RC_VEC_SIZE; i < end; i += RC_VEC_SIZE) {
+                RC_VEC_LOAD(vec, &row[i]);
+                RC_VEC_MAX(maxv, maxv, vec);
+            }
+            RC_VEC_SUBS(maxv, maxv, thrv);
+            RC_STAT_NONZERO(dif, maxv);
+
+            if (dif || num < k) {
+                for (i = x; i < end; i++) {
+                    if (num < k || row[i] > thr) {
+                        num = rc_stat_max_k_insert(buf, dim, pos,
+                                                   num, k, i, y);
+                        thr = buf[pos[2*num - 1]*dim + pos[2*num - 2]];
+                    }
+                }
+                RC_VEC_SPLAT(thrv, thr);
+            }
+        }
+
+        /* Handle the remaining pixels */
+        for (x = len; x < width; x++) {
+            if (num < k || row[x] > thr) {
+                num = rc_stat_max_k_insert(buf, dim, pos, num, k, x, y);
+                thr = buf[pos[2*num - 1]*dim + pos[2*num - 2]];
+            }
+        }
+        RC_VEC_SPLAT(thrv, thr);
+    }
+
+    RC_VEC_CLEANUP();
+
+    return num;
+}
+#endif
+#endif
+
+/**
+ *  The number of tile columns and rows processed at a time
+ *  by the tile statistics.
+ */
+#define RC_STAT_TILES_GROUP 32
+#define RC_STAT_TILES_ROWS  16
+
+/**
+ *  Create a tile mask vector with the lanes [beg, end) set.
+ */
+#define RC_STAT_TILES_MASK(maskv, beg, end)                 \
+do {                                                        \
+    union { rc_vec_t v; uint8_t raw[RC_VEC_SIZE]; } mbuf_;  \
+    int                                             lane_;  \
+    for (lane_ = 0; lane_ < RC_VEC_SIZE; lane_++) {         \
+        mbuf_.raw[lane_] = lane_ >= (beg) && lane_ < (end)  \
+                           ? 0xff : 0;                      \
+    }                                                       \
+    RC_VEC_LOAD(maskv, &mbuf_.v);                           \
+} while (0)
+
+/**
+ *  Accumulate the pixels of a vector selected by a mask
+ *  to the tile statistics.
+ */
+#define RC_STAT_TILES_MASKED(accv, minv, maxv, vec, maskv) \
+do {                                                       \
+    rc_vec_t inv_, outv_;                                  \
+    RC_VEC_AND(inv_, vec, maskv);                          \
+    RC_VEC_ORNOT(outv_, vec, maskv);                       \
+    RC_VEC_SUMV(accv, inv_);                               \
+    RC_VEC_MIN(minv, minv, outv_);                         \
+    RC_VEC_MAX(maxv, maxv, inv_);                          \
+} while (0)
+
+/**
+ *  8-bit pixel sum, min and max per tile.
+ *  The rows of each band of tiles are streamed through one set of
+ *  vector accumulators per tile, for a group of tile columns and a
+ *  few rows at a time. The tiles can have any width. The aligned
+ *  vectors at the tile edges are masked, so that the pixels of the
+ *  neighbouring tiles and the padding are ignored. The sums are
+ *  reduced after as many rows as the accumulators can hold, or
+ *  within the rows if a tile row has more than RC_VEC_SUMN vectors.
+ */
+#if defined RC_VEC_SUMV && defined RC_STAT_REDUCE_SUM && \
+    defined RC_VEC_SUMN && defined RC_VEC_MIN && defined RC_VEC_MAX && \
+    defined RC_VEC_AND && defined RC_VEC_ORNOT && \
+    defined RC_VEC_SPLAT && defined RC_STAT_MINMAX_TREE
+#if RC_IMPL(rc_stat_tiles_u8, 0)
+void
+rc_stat_tiles_u8(const uint8_t *buf, int dim, int width, int height,
+                 int tile_w, int tile_h, uint32_t *sum,
+                 uint8_t *min, uint8_t *max)
+{
+    int cols = (width - 1) / tile_w + 1; /* Tiles per row */
+    int ty;
+    RC_VEC_DECLARE();
+
+    for (ty = 0; ty < height; ty += tile_h) {
+        int th = MIN(tile_h, height - ty);
+        int col;
+
+        for (col = 0; col < cols; col += RC_STAT_TILES_GROUP) {
+            rc_vec_t accv [RC_STAT_TILES_GROUP];
+            rc_vec_t minv [RC_STAT_TILES_GROUP];
+            rc_vec_t maxv [RC_STAT_TILES_GROUP];
+            rc_vec_t headv[RC_STAT_TILES_GROUP]; /* Head vector mask */
+            rc_vec_t tailv[RC_STAT_TILES_GROUP]; /* Tail vector mask */
+            uint32_t tsum [RC_STAT_TILES_GROUP];
+            int      plain[RC_STAT_TILES_GROUP]; /* Full vectors only */
+            int      head [RC_STAT_TILES_GROUP]; /* Head vector or -1 */
+            int      beg  [RC_STAT_TILES_GROUP]; /* First full vector */
+            int      end  [RC_STAT_TILES_GROUP]; /* End of full vectors */
+            int      tail [RC_STAT_TILES_GROUP]; /* Tail vector or -1 */
+            int      num = MIN(RC_STAT_TILES_GROUP, cols - col);
+            int      nv  = 0; /* Max vectors in a tile row          */
+            int      len;     /* Rows between the sum reductions    */
+            int      rows;    /* Rows processed per tile visit      */
+            int      cnt = 0; /* Rows accumulated since a reduction */
+            int      wide;    /* Reduce the sums within the rows    */
+            int      y, i;
+
+            /* Initialize the tile accumulators and vector ranges */
+            for (i = 0; i < num; i++) {
+                int x0 = (col + i)*tile_w;
+                int x1 = x0 + MIN(tile_w, width - x0);
+                int xa = x0 & ~(RC_VEC_SIZE - 1);
+
+                head[i] = -1;
+                beg[i]  = x0;
+                end[i]  = x1 & ~(RC_VEC_SIZE - 1);
+                tail[i] = -1;
+
+                if (x0 != xa && x1 <= xa + RC_VEC_SIZE) {
+                    /* The tile is inside a single vector */
+                    head[i] = xa;
+                    beg[i]  = end[i] = xa + RC_VEC_SIZE;
+                    RC_STAT_TILES_MASK(headv[i], x0 - xa, x1 - xa);
+                }
+                else {
+                    if (x0 != xa) {
+                        head[i] = xa;
+                        beg[i]  = xa + RC_VEC_SIZE;
+                        RC_STAT_TILES_MASK(headv[i], x0 - xa, RC_VEC_SIZE);
+                    }
+                    if (x1 != end[i]) {
+                        tail[i] = end[i];
+                        RC_STAT_TILES_MASK(tailv[i], 0, x1 - end[i]);
+                    }
+                }
+
+                nv      = MAX(nv, (x1 - xa + RC_VEC_SIZE - 1) / RC_VEC_SIZE);
+                tsum[i] = 0;
+                RC_VEC_ZERO(accv[i]);
+                RC_VEC_SPLAT(minv[i], 0xff);
+                RC_VEC_ZERO(maxv[i]);
+            }
+
+            /* Set up the sum reductions */
+            wide = nv > RC_VEC_SUMN;
+            len  = wide ? 1 : RC_VEC_SUMN / nv;
+            rows = MIN(RC_STAT_TILES_ROWS, len);
+            for (i = 0; i < num; i++) {
+                plain[i] = head[i] < 0 && tail[i] < 0 && !wide;
+            }
+
+            /* Stream the rows through the tiles */
+            for (y = ty; y < ty + th; y += rows) {
+                int ye = MIN(ty + th, y + rows);
+
+                for (i = 0; i < num; i++) {
+                    rc_vec_t sumv = accv[i];
+                    rc_vec_t lov  = minv[i];
+                    rc_vec_t hiv  = maxv[i];
+                    uint32_t s    = tsum[i];
+                    int      r;
+
+                    if (plain[i]) {
+                        /* Only full vectors, without any reductions */
+                        for (r = y; r < ye; r++) {
+                            const uint8_t *row = &buf[r*dim];
+                            int            x;
+                            for (x = beg[i]; x < end[i]; x += RC_VEC_SIZE) {
+                                rc_vec_t vec;
+                                RC_VEC_LOAD(vec, &row[x]);
+                                RC_VEC_SUMV(sumv, vec);
+                                RC_VEC_MIN(lov, lov, vec);
+                                RC_VEC_MAX(hiv, hiv, vec);
+                            }
+                        }
+                    }
+                    else {
+                        for (r = y; r < ye; r++) {
+                            const uint8_t *row = &buf[r*dim];
+                            rc_vec_t       vec;
+                            int            x = beg[i];
+
+                            /* Masked head vector */
+                            if (head[i] >= 0) {
+                                RC_VEC_LOAD(vec, &row[head[i]]);
+                                RC_STAT_TILES_MASKED(sumv, lov, hiv,
+                                                     vec, headv[i]);
+                            }
+
+                            /* Full vectors, reduced every RC_VEC_SUMN
+                             * vectors for wide tiles */
+                            while (x < end[i]) {
+                                int xe = end[i];
+                                if (wide) {
+                                    RC_STAT_REDUCE_SUM(s, 0, sumv, sumv);
+                                    xe = MIN(xe, x + RC_VEC_SUMN*
+                                                     RC_VEC_SIZE);
+                                }
+                                do {
+                                    RC_VEC_LOAD(vec, &row[x]);
+                                    RC_VEC_SUMV(sumv, vec);
+                                    RC_VEC_MIN(lov, lov, vec);
+                                    RC_VEC_MAX(hiv, hiv, vec);
+                                    x += RC_VEC_SIZE;
+                                } while (x < xe);
+                            }
+
+                            /* Masked tail vector */
+                            if (tail[i] >= 0) {
+                                if (wide) {
+                                    RC_STAT_REDUCE_SUM(s, 0, sumv, sumv);
+                                }
+                                RC_VEC_LOAD(vec, &row[tail[i]]);
+                                RC_STAT_TILES_MASKED(sumv, lov, hiv,
+                                                     vec, tailv[i]);
+                            }
+                        }
+                    }
+
+                    accv[i] = sumv;
+                    minv[i] = lov;
+                    maxv[i] = hiv;
+                    tsum[i] = s;
+                }
+
+                /* Reduce the sums before the accumulators overflow */
+                cnt += ye - y;
+                if (cnt + rows > len) {
+                    for (i = 0; i < num; i++) {
+                        RC_STAT_REDUCE_SUM(tsum[i], 0, accv[i], accv[i]);
+                    }
+                    cnt = 0;
+                }
+            }
+
+            /* Reduce the tile accumulators */
+            for (i = 0; i < num; i++) {
+                uint8_t vmin, vmax;
+
+                RC_STAT_REDUCE_SUM(tsum[i], 0, accv[i], accv[i]);
+                RC_STAT_MINMAX_TREE(minv[i], vmin, RC_VEC_MIN);
+                RC_STAT_MINMAX_TREE(maxv[i], vmax, RC_VEC_MAX);
+
+                sum[col + i] = tsum[i];
+                min[col + i] = vmin;
+                max[col + i] = vmax;
+            }
+        }
+
+        sum += cols;
+        min += cols;
+        max += cols;
+    }
+
+    RC_VEC_CLEANUP();
+}
+#endif
+#endif
+
+/**
+ *  8-bit sum of absolute differences.
+ */
+#if defined RC_STAT_ACCUM_SAD && defined RC_STAT_REDUCE_SUM && \
+    defined RC_VEC_SUMN
+#if RC_IMPL(rc_stat_sad_u8, 0)
+uintmax_t
+rc_stat_sad_u8(const uint8_t *restrict src1, int src1_dim,
+               const uint8_t *restrict src2, int src2_dim,
+               int width, int height)
+{
+    uintmax_t sum = 0;
+    rc_vec_t  acc;
+    RC_VEC_DECLARE();
+
+    RC_VEC_ZERO(acc);
+    RC_STAT_DIFF_TEMPLATE(src1, src1_dim, src2, src2_dim, width, height,
+                          sum, acc, RC_STAT_ACCUM_SAD,
+                          RC_STAT_REDUCE_SUM, RC_VEC_SUMN);
+
+    RC_VEC_CLEANUP();
+    return sum;
+}
+#endif
+#endif
+
+
+/**
+ *  8-bit sum of squared differences.
+ */
+#if defined RC_STAT_ACCUM_SSD && defined RC_STAT_REDUCE_MAC && \
+    defined RC_VEC_MACN
+#if RC_IMPL(rc_stat_ssd_u8, 0)
+uintmax_t
+rc_stat_ssd_u8(const uint8_t *restrict src1, int src1_dim,
+               const uint8_t *restrict src2, int src2_dim,
+               int width, int height)
+{
+    uintmax_t sum = 0;
+    rc_vec_t  acc;
+    RC_VEC_DECLARE();
+
+    RC_VEC_ZERO(acc);
+    RC_STAT_DIFF_TEMPLATE(src1, src1_dim, src2, src2_dim, width, height,
+                          sum, acc, RC_STAT_ACCUM_SSD,
+                          RC_STAT_REDUCE_MAC, RC_VEC_MACN);
+
+    RC_VEC_CLEANUP();
+    return sum;
+}
+#endif
+#endif
+
 /*
  * -------------------------------------------------------------
  *  Local functions
@@ -731,3 +1668,37 @@ rc_stat_xsum_acc(const uint8_t *restrict src1, int src1_dim,
 #endif
 
 #endif
+
+#ifdef RC_STAT_max_k_gate
+#if RC_IMPL(rc_stat_max_k_u8, 0)
+/**
+ *  Insert the pixel at (x, y) in the sorted top-K list of @e num
+ *  positions. The pixel must be larger than the smallest value of
+ *  a full list. Pixels of equal value are kept in raster order.
+ *  Returns the new number of positions.
+ */
+static int
+rc_stat_max_k_insert(const uint8_t *buf, int dim, unsigned *pos,
+                     int num, int k, int x, int y)
+{
+    unsigned pix = buf[y*dim + x];
+    int      i;
+
+    if (num < k) {
+        num++;
+    }
+
+    /* Shift the smaller values one step down the list */
+    for (i = num - 1; i > 0 && buf[pos[2*i - 1]*dim + pos[2*i - 2]] < pix;
+         i--)
+    {
+        pos[2*i]     = pos[2*i - 2];
+        pos[2*i + 1] = pos[2*i - 1];
+    }
+    pos[2*i]     = x;
+    pos[2*i + 1] = y;
+
+    return num;
+}
+#endif
+#endif
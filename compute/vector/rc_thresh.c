@@ -70,6 +70,20 @@
     RC_VEC_CMPGE(dstv, thrv, srcv)
 #endif
 
+/**
+ *  Compare greater-than on 16-bit fields.
+ */
+#ifdef RC_VEC_CMPGT16
+#define RC_THRESH_CMPGT16(dstv, srcv, thrv) \
+    RC_VEC_CMPGT16(dstv, srcv, thrv)
+
+/**
+ *  Compare less-than on 16-bit fields.
+ */
+#define RC_THRESH_CMPLT16(dstv, srcv, thrv) \
+    RC_VEC_CMPGT16(dstv, thrv, srcv)
+#endif
+
 /**
  *  Compare greater-than AND less-than.
  */
@@ -122,6 +136,30 @@ do {                                                \
 } while (0)
 #endif
 
+/**
+ *  Compare absolute difference greater-than.
+ *  The threshold vector thrv is taken from the calling function.
+ */
+#if defined RC_VEC_SUBA && defined RC_VEC_CMPGT
+#define RC_THRESH_CMPGT_ABSDIFF(dstv, srcv1, srcv2, arg) \
+do {                                                     \
+    RC_VEC_SUBA(dstv, srcv1, srcv2);                     \
+    RC_VEC_CMPGT(dstv, dstv, thrv);                      \
+} while (0)
+#endif
+
+/**
+ *  Compare absolute difference greater-than-or-equal.
+ *  The threshold vector thrv is taken from the calling function.
+ */
+#if defined RC_VEC_SUBA && defined RC_VEC_CMPGE
+#define RC_THRESH_CMPGE_ABSDIFF(dstv, srcv1, srcv2, arg) \
+do {                                                     \
+    RC_VEC_SUBA(dstv, srcv1, srcv2);                     \
+    RC_VEC_CMPGE(dstv, dstv, thrv);                      \
+} while (0)
+#endif
+
 
 /*
  * -------------------------------------------------------------
@@ -280,6 +318,39 @@ rc_thresh_lt_pixel_u8(uint8_t *restrict dst, int dst_dim,
 #endif
 #endif
 
+
+/**
+ *  Absolute-difference thresholding greater-than.
+ */
+#if RC_IMPL(rc_thresh_absdiff_gt_u8, 1)
+#if ( defined RC_VEC_HINT_CMPGT && defined RC_THRESH_CMPGT_ABSDIFF) || \
+    (!defined RC_VEC_HINT_CMPGT && defined RC_THRESH_CMPGE_ABSDIFF)
+void
+rc_thresh_absdiff_gt_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src1, int src1_dim,
+                        const uint8_t *restrict src2, int src2_dim,
+                        int width, int height, int thresh)
+{
+    rc_vec_t thrv;
+#ifdef RC_VEC_HINT_CMPGT
+    /* Use the faster CMPGT directly */
+    RC_VEC_SPLAT(thrv, thresh);
+    RC_THRESH_PIXEL_TEMPLATE_SINGLE(dst, dst_dim, src1, src1_dim,
+                                    src2, src2_dim,
+                                    width, height, RC_THRESH_CMPGT_ABSDIFF,
+                                    RC_UNROLL(rc_thresh_absdiff_gt_u8));
+#else
+    /* Use the faster CMPGE with an adjusted threshold */
+    RC_VEC_SPLAT(thrv, thresh + 1);
+    RC_THRESH_PIXEL_TEMPLATE_SINGLE(dst, dst_dim, src1, src1_dim,
+                                    src2, src2_dim,
+                                    width, height, RC_THRESH_CMPGE_ABSDIFF,
+                                    RC_UNROLL(rc_thresh_absdiff_gt_u8));
+#endif
+}
+#endif
+#endif
+
 #endif /* RC_THRESH_TEMPLATE_SINGLE */
 
 
@@ -327,3 +398,43 @@ rc_thresh_ltgt_pixel_u8(uint8_t *restrict dst, int dst_dim,
 #endif
 
 #endif /* RC_THRESH_TEMPLATE_DOUBLE */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported 16-bit functions
+ * -------------------------------------------------------------
+ */
+
+#if defined RC_THRESH_TEMPLATE16 && defined RC_THRESH_CMPGT16
+
+/**
+ *  Single thresholding greater-than on 16-bit pixels.
+ */
+#if RC_IMPL(rc_thresh_gt_u16, 0)
+void
+rc_thresh_gt_u16(uint8_t *restrict dst, int dst_dim,
+                 const uint16_t *restrict src, int src_dim,
+                 int width, int height, int thresh)
+{
+    RC_THRESH_TEMPLATE16(dst, dst_dim, (const uint8_t *)src, src_dim,
+                         width, height, thresh, RC_THRESH_CMPGT16);
+}
+#endif
+
+
+/**
+ *  Single thresholding less-than on 16-bit pixels.
+ */
+#if RC_IMPL(rc_thresh_lt_u16, 0)
+void
+rc_thresh_lt_u16(uint8_t *restrict dst, int dst_dim,
+                 const uint16_t *restrict src, int src_dim,
+                 int width, int height, int thresh)
+{
+    RC_THRESH_TEMPLATE16(dst, dst_dim, (const uint8_t *)src, src_dim,
+                         width, height, thresh, RC_THRESH_CMPLT16);
+}
+#endif
+
+#endif /* RC_THRESH_TEMPLATE16 */
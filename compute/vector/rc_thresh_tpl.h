@@ -58,6 +58,14 @@
 #define RC_THRESH_TEMPLATE RC_THRESH_WORD
 #endif
 
+/**
+ *  The 16-bit thresholding template.
+ */
+#if defined RC_VEC_SPLAT16  && defined RC_VEC_PACKM16 && \
+    defined RC_VEC_GETMASKW && defined RC_VEC_ZERO
+#define RC_THRESH_TEMPLATE16 RC_THRESH_WORD16
+#endif
+
 
 /*
  * -------------------------------------------------------------
@@ -170,6 +178,60 @@ do {                                                                          \
 } while (0)
 
 
+/**
+ *  Threshold-to-binary template for 16-bit pixels using a word accumulator.
+ *  Each iteration compares two source vectors, i.e. RC_VEC_SIZE pixels,
+ *  and packs the 16-bit masks to one 8-bit mask vector. The last word is
+ *  always handled separately, and the second vector of its last iteration
+ *  is only loaded if it holds any image pixels.
+ */
+#define RC_THRESH_WORD16(dst, dst_dim, src, src_dim,                          \
+                         width, height, thresh, cmp)                          \
+do {                                                                          \
+    int      div_ = (8*RC_WORD_SIZE) / RC_VEC_SIZE;  /* Vectors per word   */ \
+    int      tot_ = RC_DIV_CEIL(width, RC_VEC_SIZE); /* Num src vec pairs  */ \
+    int      blk_ = (tot_ - 1) / div_;               /* Leading dst words  */ \
+    int      end_ = tot_ - blk_*div_;                /* Last dst word size */ \
+    int      lst_ = (tot_ - 1)*RC_VEC_SIZE + RC_VEC_SIZE / 2 < (width);       \
+    rc_vec_t thr_;                                                            \
+    int      y_;                                                              \
+                                                                              \
+    RC_VEC_DECLARE();                                                         \
+                                                                              \
+    /* Vectorize the threshold */                                             \
+    RC_VEC_SPLAT16(thr_, thresh);                                             \
+                                                                              \
+    /* Process all rows */                                                    \
+    for (y_ = 0; y_ < (height); y_++) {                                       \
+        int i_ = y_*(src_dim);                                                \
+        int j_ = y_*(dst_dim);                                                \
+        int x_;                                                               \
+                                                                              \
+        /* Handle all full destination word blocks */                         \
+        for (x_ = 0; x_ < blk_; x_++, j_ += RC_WORD_SIZE) {                   \
+            rc_word_t acc_ = RC_WORD_ZERO;                                    \
+            int       k_, b_;                                                 \
+            for (k_ = 0, b_ = 0; k_ < div_; k_++) {                           \
+                RC_THRESH_WORD16_ITER_(src, acc_, i_, b_, cmp, thr_, 1);      \
+            }                                                                 \
+            RC_WORD_STORE(&(dst)[j_], acc_);                                  \
+        }                                                                     \
+                                                                              \
+        /* Handle the last destination word */                                \
+        {                                                                     \
+            rc_word_t acc_ = RC_WORD_ZERO;                                    \
+            int       b_   = 0;                                               \
+            for (x_ = 0; x_ < end_ - 1; x_++) {                               \
+                RC_THRESH_WORD16_ITER_(src, acc_, i_, b_, cmp, thr_, 1);      \
+            }                                                                 \
+            RC_THRESH_WORD16_ITER_(src, acc_, i_, b_, cmp, thr_, lst_);       \
+            RC_WORD_STORE(&(dst)[j_], acc_);                                  \
+        }                                                                     \
+    }                                                                         \
+    RC_VEC_CLEANUP();                                                         \
+} while (0)
+
+
 /*
  * -------------------------------------------------------------
  *  Internal support macros for word-based thresholding template
@@ -315,6 +377,27 @@ do {                                                                          \
     (pos) += RC_VEC_SIZE;                             /* Advance acc pos   */ \
 } while (0)
 
+/**
+ *  16-bit thresholding template iteration.
+ */
+#define RC_THRESH_WORD16_ITER_(src, acc, idx, pos, cmp, thr, load2)           \
+do {                                                                          \
+    rc_vec_t vec1_, vec2_;                                                    \
+    unsigned mask_;                                                           \
+    RC_VEC_LOAD(vec1_, &(src)[idx]);                  /* Load first half   */ \
+    cmp(vec1_, vec1_, thr);                           /* Cmp to threshold  */ \
+    RC_VEC_ZERO(vec2_);                                                       \
+    if (load2) {                                      /* Load second half  */ \
+        RC_VEC_LOAD(vec2_, &(src)[(idx) + RC_VEC_SIZE]);                      \
+        cmp(vec2_, vec2_, thr);                                               \
+    }                                                                         \
+    RC_VEC_PACKM16(vec1_, vec1_, vec2_);              /* Pack to 8 bits    */ \
+    RC_VEC_GETMASKW(mask_, vec1_);                    /* Pack to binary    */ \
+    (acc) |= RC_WORD_INSERT(mask_, pos, RC_VEC_SIZE); /* Update accum      */ \
+    (idx) += 2*RC_VEC_SIZE;                           /* Advance src index */ \
+    (pos) += RC_VEC_SIZE;                             /* Advance acc pos   */ \
+} while (0)
+
 
 /*
  * -------------------------------------------------------------
@@ -0,0 +1,109 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_bgmodel.c
+ *  @brief  RAPP background modelling.
+ */
+
+#include "rappcompute.h"    /* RAPP Compute API   */
+#include "rapp_api.h"       /* API symbol macro   */
+#include "rapp_util.h"      /* Validation         */
+#include "rapp_error.h"     /* Error codes        */
+#include "rapp_error_int.h" /* Error handling     */
+#include "rapp_bgmodel.h"   /* Background API     */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+RAPP_API(int, rapp_bgmodel_update_u8,
+         (uint8_t *restrict fg, int fg_dim,
+          uint8_t *restrict mean, int mean_dim,
+          uint8_t *restrict dev, int dev_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, unsigned alpha8, int thresh))
+{
+    int bdim = (width + 7) / 8;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(fg, fg_dim, mean, mean_dim, height,
+                                     rc_align(bdim), rc_align(width)) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(fg, fg_dim, src, src_dim, height,
+                                     rc_align(bdim), rc_align(width)) ||
+        !RAPP_VALIDATE_RESTRICT(mean, mean_dim, src, src_dim,
+                                height, width) ||
+        (dev &&
+         (!RAPP_VALIDATE_RESTRICT_PLUS(fg, fg_dim, dev, dev_dim, height,
+                                       rc_align(bdim), rc_align(width)) ||
+          !RAPP_VALIDATE_RESTRICT(mean, mean_dim, dev, dev_dim,
+                                  height, width) ||
+          !RAPP_VALIDATE_RESTRICT(dev, dev_dim, src, src_dim,
+                                  height, width))))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_BIN(fg, fg_dim, width, height) ||
+        !RAPP_VALIDATE_U8(mean, mean_dim, width, height))
+    {
+        return rapp_error_bin_u8(fg, fg_dim, mean, mean_dim,
+                                 width, height);
+    }
+    if (!RAPP_VALIDATE_U8(src, src_dim, width, height)) {
+        return rapp_error_u8(src, src_dim, width, height);
+    }
+    if (dev && !RAPP_VALIDATE_U8(dev, dev_dim, width, height)) {
+        return rapp_error_u8(dev, dev_dim, width, height);
+    }
+
+    if (alpha8 < 1 || alpha8 > 0x7f || thresh < 0 || thresh > 0xff) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    if (dev) {
+        rc_bgmodel_update_dev_u8(fg, fg_dim, mean, mean_dim, dev, dev_dim,
+                                 src, src_dim, width, height,
+                                 alpha8, thresh);
+    }
+    else {
+        rc_bgmodel_update_u8(fg, fg_dim, mean, mean_dim, src, src_dim,
+                             width, height, alpha8, thresh);
+    }
+
+    return RAPP_OK;
+}
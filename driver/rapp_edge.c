@@ -0,0 +1,294 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_edge.c
+ *  @brief  RAPP edge detection.
+ *
+ *  ALGORITHM
+ *  ---------
+ *  The Canny edge detector is computed in strips of rows. For each strip
+ *  we compute the Gaussian-smoothed image two rows above and below the
+ *  strip, and replicate it one pixel outside the image. The gradient
+ *  magnitude and orientation are then computed one row above and below
+ *  the strip, and the magnitude is padded with zeros. This is all that
+ *  is needed for the non-maximum suppression of the strip rows. The
+ *  suppressed magnitude is thresholded with the high threshold directly
+ *  into the destination image, and with the low threshold into a full
+ *  size binary image in the working buffer. The temporary 8-bit images
+ *  only span the strip, and are reused for the next strip.
+ *
+ *  The hysteresis step is a connected-components seed fill of the weak
+ *  edge pixel map, seeded with the strong edge pixels in the destination
+ *  image. Since the seeds are spread over the whole image, we use the
+ *  multiple-seed fill iterations that always process all rows, and
+ *  alternate forward and reverse passes until there is no change.
+ */
+
+#include <string.h>         /* memcpy()           */
+#include "rappcompute.h"    /* RAPP Compute API   */
+#include "rapp_api.h"       /* API symbol macro   */
+#include "rapp_util.h"      /* Validation         */
+#include "rapp_error.h"     /* Error codes        */
+#include "rapp_error_int.h" /* Error handling     */
+#include "rapp_edge.h"      /* Edge detection API */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The number of rows in each strip of the Canny edge detector.
+ */
+#define RAPP_EDGE_CANNY_ROWS 32
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static int
+rapp_edge_canny_worksize(int width, int height);
+
+static void
+rapp_edge_canny_strip(uint8_t *dst, int dst_dim,
+                      uint8_t *weak, int weak_dim,
+                      const uint8_t *src, int src_dim,
+                      int width, int height, int y0, int rows,
+                      int low, int high, uint8_t *work);
+
+static void
+rapp_edge_canny_thresh(uint8_t *dst, int dst_dim,
+                       const uint8_t *src, int src_dim,
+                       int width, int height, int thresh);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  the Canny edge detector.
+ */
+RAPP_API(int, rapp_edge_canny_worksize_u8, (int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (width < 1 || height < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    return rapp_edge_canny_worksize(width, height);
+}
+
+/**
+ *  Canny edge detection.
+ */
+RAPP_API(int, rapp_edge_canny_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int low, int high,
+          void *restrict work))
+{
+    int      size = rapp_edge_canny_worksize(MAX(width, 1), MAX(height, 1));
+    int      rows = MIN(RAPP_EDGE_CANNY_ROWS, height);
+    int      bdim = rc_align((width + 7) / 8);
+    uint8_t *weak = &((uint8_t*)work)[size - MAX(height, 1)*bdim];
+    int      y;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, bdim,
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)) ||
+        !RAPP_VALIDATE_RESTRICT_OFFSET(src, src_dim, work, 0, height,
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1),
+                                       0, size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, work, 0, height,
+                                     bdim, size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_BIN(dst, dst_dim, width, height)) {
+        return rapp_error_bin(dst, dst_dim, width, height);
+    }
+    if (!RAPP_VALIDATE_U8(src, src_dim, width + 2*RC_ALIGNMENT, height)) {
+        return rapp_error_u8(src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    if (low < 0 || high > 0xff || low > high) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    else if (!work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Compute the strong and weak edge pixels in strips */
+    for (y = 0; y < height; y += rows) {
+        rapp_edge_canny_strip(dst, dst_dim, weak, bdim, src, src_dim,
+                              width, height, y, MIN(rows, height - y),
+                              low, high, work);
+    }
+
+    /* Connect the weak edge pixels to the strong ones */
+    do {
+        rc_fill_8conn_seed_fwd_bin(dst, dst_dim, weak, bdim, width, height);
+    } while (rc_fill_8conn_seed_rev_bin(dst, dst_dim, weak, bdim,
+                                        width, height));
+
+    return RAPP_OK;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the size of the working buffer. It holds the smoothed
+ *  strip, the magnitude and orientation strips, and the binary
+ *  weak edge pixel map.
+ */
+static int
+rapp_edge_canny_worksize(int width, int height)
+{
+    int rows = MIN(RAPP_EDGE_CANNY_ROWS, height);
+    int dim  = rc_align(width) + 2*RC_ALIGNMENT;
+
+    return (2*rows + 6)*dim + (rows + 2)*rc_align(width) +
+           height*rc_align((width + 7) / 8);
+}
+
+/**
+ *  Compute the strong and weak edge pixels of one strip.
+ *  The smoothed image and the magnitude have one alignment unit
+ *  of padding on each side.
+ */
+static void
+rapp_edge_canny_strip(uint8_t *dst, int dst_dim,
+                      uint8_t *weak, int weak_dim,
+                      const uint8_t *src, int src_dim,
+                      int width, int height, int y0, int rows,
+                      int low, int high, uint8_t *work)
+{
+    int      dim  = rc_align(width) + 2*RC_ALIGNMENT;
+    int      ddim = rc_align(width);
+    uint8_t *gbuf = &work[2*dim + RC_ALIGNMENT];               /* Row y0 */
+    uint8_t *mbuf = &work[(rows + 4)*dim + dim + RC_ALIGNMENT]; /* Row y0 */
+    uint8_t *dbuf = &work[(2*rows + 6)*dim + ddim];             /* Row y0 */
+    int      my0  = MAX(y0 - 1, 0);                     /* First grad row */
+    int      my1  = MIN(y0 + rows + 1, height);         /* Last grad row  */
+    int      gy0  = MAX(my0 - 1, 0);                    /* First smooth   */
+    int      gy1  = MIN(my1 + 1, height);               /* Last smooth    */
+
+    /* Smooth the image */
+    rc_filter_gauss_3x3_u8(&gbuf[(gy0 - y0)*dim], dim,
+                           &src[gy0*src_dim], src_dim, width, gy1 - gy0);
+
+    /* Replicate the smoothed image outside the top and bottom */
+    if (my0 == 0) {
+        memcpy(&gbuf[-(y0 + 1)*dim], &gbuf[-y0*dim], width);
+    }
+    if (my1 == height) {
+        memcpy(&gbuf[(height - y0)*dim],
+               &gbuf[(height - y0 - 1)*dim], width);
+    }
+
+    /* Replicate the smoothed image outside the left and right */
+    rc_pad_clamp_left_u8(&gbuf[(my0 - y0 - 1)*dim], dim,
+                         width, my1 - my0 + 2, 1);
+    rc_pad_clamp_right_u8(&gbuf[(my0 - y0 - 1)*dim], dim,
+                          width, my1 - my0 + 2, 1);
+
+    /* Compute the gradient magnitude and orientation */
+    rc_filter_sobel_3x3_magn_dir_u8(&mbuf[(my0 - y0)*dim], dim,
+                                    &dbuf[(my0 - y0)*ddim], ddim,
+                                    &gbuf[(my0 - y0)*dim], dim,
+                                    width, my1 - my0, 4);
+
+    /* Clear the magnitude outside the image */
+    if (my0 == y0) {
+        rc_pixop_set_u8(&mbuf[-dim - RC_ALIGNMENT], dim, dim, 1, 0);
+    }
+    if (my1 == y0 + rows) {
+        rc_pixop_set_u8(&mbuf[rows*dim - RC_ALIGNMENT], dim, dim, 1, 0);
+    }
+    rc_pad_const_left_u8(&mbuf[-dim], dim, width, rows + 2,
+                         RC_ALIGNMENT, 0);
+    rc_pad_const_right_u8(&mbuf[-dim], dim, width, rows + 2,
+                          dim - RC_ALIGNMENT - width, 0);
+
+    /* Suppress the non-maximum pixels into the smoothing buffer */
+    rc_edge_nms_u8(work, ddim, mbuf, dim, dbuf, ddim, width, rows);
+
+    /* Threshold the strong and weak edge pixels */
+    rapp_edge_canny_thresh(&dst[y0*dst_dim], dst_dim, work, ddim,
+                           width, rows, high);
+    rapp_edge_canny_thresh(&weak[y0*weak_dim], weak_dim, work, ddim,
+                           width, rows, low);
+}
+
+/**
+ *  Threshold the suppressed magnitude to binary.
+ */
+static void
+rapp_edge_canny_thresh(uint8_t *dst, int dst_dim,
+                       const uint8_t *src, int src_dim,
+                       int width, int height, int thresh)
+{
+    if (thresh == 0xff) {
+        /* Handle the always-false case */
+        rc_pixop_set_u8(dst, dst_dim, (width + 7) / 8, height, 0);
+    }
+    else {
+        rc_thresh_gt_u8(dst, dst_dim, src, src_dim, width, height, thresh);
+    }
+}
@@ -404,6 +404,92 @@ rapp_error_u8_u32(const uint8_t *buf1, int dim1, int width1, int height1,
     return err;
 }
 
+/**
+ *  Get the error code for two 16-bit images.
+ */
+int
+rapp_error_u16_u16(const uint16_t *buf1, int dim1, int width1, int height1,
+                   const uint16_t *buf2, int dim2, int width2, int height2)
+{
+    int err = rapp_error_u16(buf1, dim1, width1, height1);
+
+    if (!err) {
+        err = rapp_error_u16(buf2, dim2, width2, height2);
+    }
+
+    return err;
+}
+
+/**
+ *  Get the error code for a 16-bit image and a 32-bit image.
+ */
+int
+rapp_error_u16_u32(const uint16_t *buf1, int dim1, int width1, int height1,
+                   const uint32_t *buf2, int dim2, int width2, int height2)
+{
+    int err = rapp_error_u16(buf1, dim1, width1, height1);
+
+    if (!err) {
+        err = rapp_error_u32(buf2, dim2, width2, height2);
+    }
+
+    return err;
+}
+
+/**
+ *  Get the error code for three 8-bit images.
+ */
+int
+rapp_error_u8_u8_u8(const uint8_t *buf1, int dim1, int width1, int height1,
+                    const uint8_t *buf2, int dim2, int width2, int height2,
+                    const uint8_t *buf3, int dim3, int width3, int height3)
+{
+    int err = rapp_error_u8_u8(buf1, dim1, width1, height1,
+                               buf2, dim2, width2, height2);
+
+    if (!err) {
+        err = rapp_error_u8(buf3, dim3, width3, height3);
+    }
+
+    return err;
+}
+
+/**
+ *  Get the error code for a signed 16-bit image and an 8-bit image.
+ */
+int
+rapp_error_s16_u8(const int16_t *buf1, int dim1, int width1, int height1,
+                  const uint8_t *buf2, int dim2, int width2, int height2)
+{
+    int err = rapp_error_u16((const uint16_t *)buf1, dim1, width1, height1);
+
+    if (!err) {
+        err = rapp_error_u8(buf2, dim2, width2, height2);
+    }
+
+    return err;
+}
+
+/**
+ *  Get the error code for two signed 16-bit images and an 8-bit image.
+ */
+int
+rapp_error_s16_s16_u8(const int16_t *buf1, int dim1, int width1, int height1,
+                      const int16_t *buf2, int dim2, int width2, int height2,
+                      const uint8_t *buf3, int dim3, int width3, int height3)
+{
+    int err = rapp_error_u16((const uint16_t *)buf1, dim1, width1, height1);
+
+    if (!err) {
+        err = rapp_error_u16((const uint16_t *)buf2, dim2, width2, height2);
+    }
+    if (!err) {
+        err = rapp_error_u8(buf3, dim3, width3, height3);
+    }
+
+    return err;
+}
+
 #if RC_ASSERTED_RETURNS
 /**
  *  Call abort.
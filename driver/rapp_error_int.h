@@ -150,6 +150,43 @@ int
 rapp_error_u8_u32(const uint8_t *buf1, int dim1, int width1, int height1,
                   const uint32_t *buf2, int dim2, int width2, int height2);
 
+/**
+ *  Get the error code for two 16-bit images.
+ */
+int
+rapp_error_u16_u16(const uint16_t *buf1, int dim1, int width1, int height1,
+                   const uint16_t *buf2, int dim2, int width2, int height2);
+
+/**
+ *  Get the error code for a 16-bit image and a 32-bit image.
+ */
+int
+rapp_error_u16_u32(const uint16_t *buf1, int dim1, int width1, int height1,
+                   const uint32_t *buf2, int dim2, int width2, int height2);
+
+/**
+ *  Get the error code for three 8-bit images.
+ */
+int
+rapp_error_u8_u8_u8(const uint8_t *buf1, int dim1, int width1, int height1,
+                    const uint8_t *buf2, int dim2, int width2, int height2,
+                    const uint8_t *buf3, int dim3, int width3, int height3);
+
+/**
+ *  Get the error code for a signed 16-bit image and an 8-bit image.
+ */
+int
+rapp_error_s16_u8(const int16_t *buf1, int dim1, int width1, int height1,
+                  const uint8_t *buf2, int dim2, int width2, int height2);
+
+/**
+ *  Get the error code for two signed 16-bit images and an 8-bit image.
+ */
+int
+rapp_error_s16_s16_u8(const int16_t *buf1, int dim1, int width1, int height1,
+                      const int16_t *buf2, int dim2, int width2, int height2,
+                      const uint8_t *buf3, int dim3, int width3, int height3);
+
 /**
  *  Just call abort.
  */
@@ -0,0 +1,444 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_feature.c
+ *  @brief  RAPP feature detection.
+ *
+ *  ALGORITHM
+ *  ---------
+ *  Both detectors are computed in strips of rows. The FAST score is
+ *  computed one row above and below the strip, and padded with zeros
+ *  outside the image, which is all that is needed for the non-maximum
+ *  suppression of the strip rows. The corners are then collected from
+ *  the suppressed scores. Rows with no corners are skipped after a
+ *  vectorized row max.
+ *
+ *  The Harris detector computes the Sobel gradients two rows above and
+ *  below the strip, and pads them with zeros outside the image. The
+ *  response is computed one row above and below the strip. It is a
+ *  32-bit image, so the thresholding and the non-maximum suppression
+ *  are done with scalar code while collecting the corners, only
+ *  comparing the neighbours of the pixels above the threshold.
+ */
+
+#include <string.h>         /* memset()              */
+#include "rappcompute.h"    /* RAPP Compute API      */
+#include "rapp_api.h"       /* API symbol macro      */
+#include "rapp_util.h"      /* Validation            */
+#include "rapp_error.h"     /* Error codes           */
+#include "rapp_error_int.h" /* Error handling        */
+#include "rapp_feature.h"   /* Feature detection API */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The number of rows in each strip of the feature detectors.
+ */
+#define RAPP_FEATURE_ROWS 32
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static int
+rapp_feature_worksize(int width, int height);
+
+static int
+rapp_feature_fast_strip(const uint8_t *src, int src_dim,
+                        int width, int height, int y0, int rows,
+                        int thresh, int nms, unsigned *pos,
+                        int num, int max, uint8_t *work);
+
+static int
+rapp_feature_harris_strip(const uint8_t *src, int src_dim,
+                          int width, int height, int y0, int rows,
+                          int thresh, int nms, unsigned *pos,
+                          int num, int max, uint8_t *work);
+
+static int
+rapp_feature_list(const uint8_t *buf, int dim, int width, int rows,
+                  int y0, unsigned *pos, int num, int max);
+
+static bool
+rapp_feature_harris_peak(const int32_t *ptr, int dim, int x, int y,
+                         int width, int height);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  the feature detectors.
+ */
+RAPP_API(int, rapp_feature_worksize_u8, (int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (width < 1 || height < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    return rapp_feature_worksize(width, height);
+}
+
+/**
+ *  FAST corner detection.
+ */
+RAPP_API(int, rapp_feature_fast_u8,
+         (const uint8_t *restrict src, int src_dim,
+          int width, int height, int thresh, int nms,
+          unsigned *restrict pos, int max, void *restrict work))
+{
+    int size = rapp_feature_worksize(MAX(width, 1), MAX(height, 1));
+    int rows = MIN(RAPP_FEATURE_ROWS, height);
+    int num  = 0;
+    int y;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(src, src_dim, work, 0, height,
+                                       -3*src_dim - RC_ALIGNMENT,
+                                       rc_align(3*src_dim + width + 3),
+                                       0, size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(pos, 0, work, 0, 1,
+                                     2*MAX(max, 0)*(int)sizeof *pos,
+                                     size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(src, src_dim, width + 2*RC_ALIGNMENT, height)) {
+        return rapp_error_u8(src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    if (thresh < 0 || thresh > 0xff || max < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    else if (!pos || !work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* No pixel differs more than the largest threshold */
+    if (thresh == 0xff) {
+        return 0;
+    }
+
+    /* Collect the corners in strips */
+    for (y = 0; y < height && num < max; y += rows) {
+        num = rapp_feature_fast_strip(src, src_dim, width, height,
+                                      y, MIN(rows, height - y),
+                                      thresh, nms, pos, num, max, work);
+    }
+
+    return num;
+}
+
+/**
+ *  Harris corner detection.
+ */
+RAPP_API(int, rapp_feature_harris_u8,
+         (const uint8_t *restrict src, int src_dim,
+          int width, int height, int thresh, int nms,
+          unsigned *restrict pos, int max, void *restrict work))
+{
+    int size = rapp_feature_worksize(MAX(width, 1), MAX(height, 1));
+    int rows = MIN(RAPP_FEATURE_ROWS, height);
+    int num  = 0;
+    int y;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(src, src_dim, work, 0, height,
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1),
+                                       0, size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(pos, 0, work, 0, 1,
+                                     2*MAX(max, 0)*(int)sizeof *pos,
+                                     size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(src, src_dim, width + 2*RC_ALIGNMENT, height)) {
+        return rapp_error_u8(src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    if (thresh < 0 || max < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    else if (!pos || !work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Collect the corners in strips */
+    for (y = 0; y < height && num < max; y += rows) {
+        num = rapp_feature_harris_strip(src, src_dim, width, height,
+                                        y, MIN(rows, height - y),
+                                        thresh, nms, pos, num, max, work);
+    }
+
+    return num;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the size of the working buffer. The FAST detector needs
+ *  the score strip and the suppressed strip, and the Harris detector
+ *  needs the two gradient strips and the response strip.
+ */
+static int
+rapp_feature_worksize(int width, int height)
+{
+    int rows = MIN(RAPP_FEATURE_ROWS, height);
+    int dim  = rc_align(width) + 2*RC_ALIGNMENT;
+    int gdim = rc_align(2*width) + 2*RC_ALIGNMENT;
+    int fast = (rows + 2)*dim + rows*rc_align(width);
+    int harr = 2*(rows + 4)*gdim + (rows + 2)*rc_align(4*width);
+
+    return MAX(fast, harr);
+}
+
+/**
+ *  Collect the FAST corners of one strip. The score has one alignment
+ *  unit of padding on each side.
+ */
+static int
+rapp_feature_fast_strip(const uint8_t *src, int src_dim,
+                        int width, int height, int y0, int rows,
+                        int thresh, int nms, unsigned *pos,
+                        int num, int max, uint8_t *work)
+{
+    int      dim  = rc_align(width) + 2*RC_ALIGNMENT;
+    int      ndim = rc_align(width);
+    uint8_t *sbuf = &work[dim + RC_ALIGNMENT];          /* Row y0     */
+    uint8_t *nbuf = &work[(rows + 2)*dim];              /* Row y0     */
+    int      sy0  = nms ? MAX(y0 - 1, 0) : y0;          /* First row  */
+    int      sy1  = nms ? MIN(y0 + rows + 1, height)    /* Last row   */
+                        : y0 + rows;
+
+    /* Compute the corner score */
+    rc_feature_fast_u8(&sbuf[(sy0 - y0)*dim], dim, &src[sy0*src_dim],
+                       src_dim, width, sy1 - sy0, thresh);
+
+    if (!nms) {
+        return rapp_feature_list(sbuf, dim, width, rows, y0,
+                                 pos, num, max);
+    }
+
+    /* Clear the score outside the image */
+    if (sy0 == y0) {
+        rc_pixop_set_u8(&sbuf[-dim - RC_ALIGNMENT], dim, dim, 1, 0);
+    }
+    if (sy1 == y0 + rows) {
+        rc_pixop_set_u8(&sbuf[rows*dim - RC_ALIGNMENT], dim, dim, 1, 0);
+    }
+    rc_pad_const_left_u8(&sbuf[-dim], dim, width, rows + 2,
+                         RC_ALIGNMENT, 0);
+    rc_pad_const_right_u8(&sbuf[-dim], dim, width, rows + 2,
+                          dim - RC_ALIGNMENT - width, 0);
+
+    /* Suppress the non-maximum scores */
+    rc_feature_nms_u8(nbuf, ndim, sbuf, dim, width, rows);
+
+    return rapp_feature_list(nbuf, ndim, width, rows, y0, pos, num, max);
+}
+
+/**
+ *  Collect the Harris corners of one strip. The gradients have one
+ *  alignment unit of padding on each side.
+ */
+static int
+rapp_feature_harris_strip(const uint8_t *src, int src_dim,
+                          int width, int height, int y0, int rows,
+                          int thresh, int nms, unsigned *pos,
+                          int num, int max, uint8_t *work)
+{
+    int      gdim = rc_align(2*width) + 2*RC_ALIGNMENT;
+    int      rdim = rc_align(4*width);
+    uint8_t *xbuf = &work[2*gdim + RC_ALIGNMENT];            /* Row y0 */
+    uint8_t *ybuf = &xbuf[(rows + 4)*gdim];                  /* Row y0 */
+    int32_t *rbuf = (int32_t*)&work[2*(rows + 4)*gdim];      /* Row y0-1 */
+    int      ry0  = nms ? MAX(y0 - 1, 0) : y0;       /* First response */
+    int      ry1  = nms ? MIN(y0 + rows + 1, height) /* Last response  */
+                        : y0 + rows;
+    int      gy0  = MAX(ry0 - 1, 0);                 /* First gradient */
+    int      gy1  = MIN(ry1 + 1, height);            /* Last gradient  */
+    int      rd   = rdim / (int)sizeof *rbuf;
+    int      y;
+
+    /* Compute the gradients */
+    rc_filter_sobel_3x3_grad_u8_s16((int16_t*)&xbuf[(gy0 - y0)*gdim], gdim,
+                                    (int16_t*)&ybuf[(gy0 - y0)*gdim], gdim,
+                                    &src[gy0*src_dim], src_dim,
+                                    width, gy1 - gy0);
+
+    /* Clear the gradients outside the image */
+    if (ry0 == 0) {
+        memset(&xbuf[-(y0 + 1)*gdim - RC_ALIGNMENT], 0, gdim);
+        memset(&ybuf[-(y0 + 1)*gdim - RC_ALIGNMENT], 0, gdim);
+    }
+    if (ry1 == height) {
+        memset(&xbuf[(height - y0)*gdim - RC_ALIGNMENT], 0, gdim);
+        memset(&ybuf[(height - y0)*gdim - RC_ALIGNMENT], 0, gdim);
+    }
+    rc_pad_const_left_u8(&xbuf[(ry0 - y0 - 1)*gdim], gdim, 2*width,
+                         ry1 - ry0 + 2, RC_ALIGNMENT, 0);
+    rc_pad_const_right_u8(&xbuf[(ry0 - y0 - 1)*gdim], gdim, 2*width,
+                          ry1 - ry0 + 2, gdim - RC_ALIGNMENT - 2*width, 0);
+    rc_pad_const_left_u8(&ybuf[(ry0 - y0 - 1)*gdim], gdim, 2*width,
+                         ry1 - ry0 + 2, RC_ALIGNMENT, 0);
+    rc_pad_const_right_u8(&ybuf[(ry0 - y0 - 1)*gdim], gdim, 2*width,
+                          ry1 - ry0 + 2, gdim - RC_ALIGNMENT - 2*width, 0);
+
+    /* Compute the response */
+    rc_feature_harris_s16_s32(&rbuf[(ry0 - y0 + 1)*rd], rdim,
+                              (int16_t*)&xbuf[(ry0 - y0)*gdim], gdim,
+                              (int16_t*)&ybuf[(ry0 - y0)*gdim], gdim,
+                              width, ry1 - ry0);
+
+    /* Collect the corners */
+    for (y = 0; y < rows; y++) {
+        const int32_t *row = &rbuf[(y + 1)*rd];
+        int            x;
+
+        for (x = 0; x < width; x++) {
+            if (row[x] > thresh &&
+                (!nms || rapp_feature_harris_peak(&row[x], rd, x, y0 + y,
+                                                  width, height)))
+            {
+                pos[2*num]     = x;
+                pos[2*num + 1] = y0 + y;
+                if (++num == max) {
+                    return num;
+                }
+            }
+        }
+    }
+
+    return num;
+}
+
+/**
+ *  Append the positions of all nonzero pixels to the corner list.
+ */
+static int
+rapp_feature_list(const uint8_t *buf, int dim, int width, int rows,
+                  int y0, unsigned *pos, int num, int max)
+{
+    int y;
+
+    for (y = 0; y < rows; y++) {
+        const uint8_t *row = &buf[y*dim];
+        int            x;
+
+        /* Skip the row if it has no corners. The max may include
+         * the padding, in which case the row is searched needlessly,
+         * but still correctly. */
+        if (rc_stat_max_u8(row, dim, width, 1) == 0) {
+            continue;
+        }
+
+        for (x = 0; x < width; x++) {
+            if (row[x]) {
+                pos[2*num]     = x;
+                pos[2*num + 1] = y0 + y;
+                if (++num == max) {
+                    return num;
+                }
+            }
+        }
+    }
+
+    return num;
+}
+
+/**
+ *  Check if a Harris response pixel is a local maximum. The neighbours
+ *  outside the image do not suppress it.
+ */
+static bool
+rapp_feature_harris_peak(const int32_t *ptr, int dim, int x, int y,
+                         int width, int height)
+{
+    int32_t val = *ptr;
+    int     x0  = MAX(x - 1, 0) - x;
+    int     x1  = MIN(x + 1, width - 1) - x;
+    int     k;
+
+    if ((x > 0 && ptr[-1] >= val) ||
+        (x < width - 1 && ptr[1] > val))
+    {
+        return false;
+    }
+
+    for (k = x0; k <= x1; k++) {
+        if ((y > 0 && ptr[k - dim] >= val) ||
+            (y < height - 1 && ptr[k + dim] > val))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
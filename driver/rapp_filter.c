@@ -30,6 +30,7 @@
  *  @brief  RAPP fixed filters.
  */
 
+#include <limits.h>         /* INT_MAX          */
 #include "rappcompute.h"    /* RAPP Compute API */
 #include "rapp_api.h"       /* API symbol macro */
 #include "rapp_util.h"      /* Validation       */
@@ -38,6 +39,109 @@
 #include "rapp_filter.h"    /* Fixed-filter API */
 
 
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The smallest Gaussian sigma value, in units of 1/16 pixel.
+ */
+#define RAPP_FILTER_GAUSS_MIN 16
+
+/**
+ *  The largest Gaussian sigma value, in units of 1/16 pixel.
+ */
+#define RAPP_FILTER_GAUSS_MAX 320
+
+/**
+ *  The smallest sigma value that uses the box filter approximation.
+ *  Smaller values use a tabulated separable kernel.
+ */
+#define RAPP_FILTER_GAUSS_BOX 48
+
+/**
+ *  The number of box filter passes in the Gaussian approximation.
+ */
+#define RAPP_FILTER_GAUSS_PASSES 3
+
+
+/*
+ * -------------------------------------------------------------
+ *  Global variables
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Gaussian kernels for sigma values below RAPP_FILTER_GAUSS_BOX,
+ *  in steps of 1/16 pixel. Each row holds the center coefficient
+ *  followed by the coefficients at distance 1 to 7. The full
+ *  kernels sum to 128.
+ */
+static const int8_t
+rapp_filter_gauss_tab[RAPP_FILTER_GAUSS_BOX -
+                      RAPP_FILTER_GAUSS_MIN][RC_FILTER_CONV_MAX / 2 + 1] = {
+    {52, 31,  7,  0,  0,  0,  0,  0},  /* 1.0000 */
+    {48, 31,  8,  1,  0,  0,  0,  0},  /* 1.0625 */
+    {46, 31,  9,  1,  0,  0,  0,  0},  /* 1.1250 */
+    {44, 30, 10,  2,  0,  0,  0,  0},  /* 1.1875 */
+    {42, 30, 11,  2,  0,  0,  0,  0},  /* 1.2500 */
+    {40, 29, 12,  3,  0,  0,  0,  0},  /* 1.3125 */
+    {38, 28, 13,  3,  1,  0,  0,  0},  /* 1.3750 */
+    {36, 28, 13,  4,  1,  0,  0,  0},  /* 1.4375 */
+    {34, 27, 14,  5,  1,  0,  0,  0},  /* 1.5000 */
+    {34, 27, 14,  5,  1,  0,  0,  0},  /* 1.5625 */
+    {32, 26, 15,  6,  1,  0,  0,  0},  /* 1.6250 */
+    {30, 26, 15,  6,  2,  0,  0,  0},  /* 1.6875 */
+    {30, 25, 15,  7,  2,  0,  0,  0},  /* 1.7500 */
+    {28, 24, 15,  7,  3,  1,  0,  0},  /* 1.8125 */
+    {28, 24, 15,  7,  3,  1,  0,  0},  /* 1.8750 */
+    {26, 23, 16,  8,  3,  1,  0,  0},  /* 1.9375 */
+    {26, 23, 16,  8,  3,  1,  0,  0},  /* 2.0000 */
+    {26, 22, 15,  9,  4,  1,  0,  0},  /* 2.0625 */
+    {24, 22, 15,  9,  4,  2,  0,  0},  /* 2.1250 */
+    {24, 21, 15,  9,  4,  2,  1,  0},  /* 2.1875 */
+    {24, 20, 15,  9,  5,  2,  1,  0},  /* 2.2500 */
+    {22, 20, 15, 10,  5,  2,  1,  0},  /* 2.3125 */
+    {22, 20, 15, 10,  5,  2,  1,  0},  /* 2.3750 */
+    {22, 19, 15, 10,  5,  3,  1,  0},  /* 2.4375 */
+    {20, 19, 15, 10,  6,  3,  1,  0},  /* 2.5000 */
+    {20, 19, 15, 10,  6,  3,  1,  0},  /* 2.5625 */
+    {20, 18, 15, 10,  6,  3,  1,  1},  /* 2.6250 */
+    {20, 18, 14, 10,  6,  3,  2,  1},  /* 2.6875 */
+    {20, 17, 14, 10,  6,  4,  2,  1},  /* 2.7500 */
+    {18, 17, 14, 10,  7,  4,  2,  1},  /* 2.8125 */
+    {18, 17, 14, 10,  7,  4,  2,  1},  /* 2.8750 */
+    {18, 17, 14, 10,  7,  4,  2,  1},  /* 2.9375 */
+};
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static int
+rapp_filter_kernel_valid(const int8_t *kern, int len);
+
+static void
+rapp_filter_gauss_boxes(int sigma, int *size);
+
+static int
+rapp_filter_gauss_radius(int sigma);
+
+static int
+rapp_filter_gauss_worksize(int width, int height, int sigma);
+
+static int
+rapp_filter_rank_worksize(int width, int radius);
+
+static int
+rapp_filter_census_disp_valid(int dst_dim, int height, int disparities);
+
+
 /*
  * -------------------------------------------------------------
  *  Exported functions
@@ -370,6 +474,97 @@ RAPP_API(int, rapp_filter_sobel_3x3_magn_u8,
     return RAPP_OK;
 }
 
+RAPP_API(int, rapp_filter_sobel_3x3_magn_dir_u8,
+         (uint8_t *restrict mag, int mag_dim,
+          uint8_t *restrict dir, int dir_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int bins))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(mag, mag_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)) ||
+        !RAPP_VALIDATE_RESTRICT_OFFSET(dir, dir_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)) ||
+        !RAPP_VALIDATE_RESTRICT(mag, mag_dim, dir, dir_dim, height, width))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(mag, mag_dim, width,                  height) ||
+        !RAPP_VALIDATE_U8(dir, dir_dim, width,                  height) ||
+        !RAPP_VALIDATE_U8(src, src_dim, width + 2*RC_ALIGNMENT, height))
+    {
+        return rapp_error_u8_u8_u8(mag, mag_dim, width,          height,
+                                   dir, dir_dim, width,          height,
+                                   src, src_dim, width + 2*RC_ALIGNMENT,
+                                   height);
+    }
+
+    if (bins != 4 && bins != 8) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    /* Perform convolution */
+    rc_filter_sobel_3x3_magn_dir_u8(mag, mag_dim, dir, dir_dim,
+                                    src, src_dim, width, height, bins);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_sobel_3x3_grad_u8_s16,
+         (int16_t *restrict gx, int gx_dim,
+          int16_t *restrict gy, int gy_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(gx, gx_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)) ||
+        !RAPP_VALIDATE_RESTRICT_OFFSET(gy, gy_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)) ||
+        !RAPP_VALIDATE_RESTRICT(gx, gx_dim, gy, gy_dim, height, 2*width))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_S16(gx,  gx_dim,  width,                  height) ||
+        !RAPP_VALIDATE_S16(gy,  gy_dim,  width,                  height) ||
+        !RAPP_VALIDATE_U8 (src, src_dim, width + 2*RC_ALIGNMENT, height))
+    {
+        return rapp_error_s16_s16_u8(gx,  gx_dim,  width,        height,
+                                     gy,  gy_dim,  width,        height,
+                                     src, src_dim, width + 2*RC_ALIGNMENT,
+                                     height);
+    }
+
+    /* Perform convolution */
+    rc_filter_sobel_3x3_grad_u8_s16(gx, gx_dim, gy, gy_dim,
+                                    src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
 RAPP_API(int, rapp_filter_gauss_3x3_u8,
          (uint8_t *restrict dst, int dst_dim,
           const uint8_t *restrict src, int src_dim,
@@ -534,3 +729,1302 @@ RAPP_API(int, rapp_filter_highpass_3x3_abs_u8,
 
     return RAPP_OK;
 }
+
+RAPP_API(int, rapp_filter_diff_1x2_horz_u8_s16,
+         (int16_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -RC_ALIGNMENT, rc_align(width)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_S16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U8 (src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_s16_u8(dst, dst_dim, width,                height,
+                                 src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_diff_1x2_horz_u8_s16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_diff_2x1_vert_u8_s16,
+         (int16_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim, rc_align(width)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_S16(dst, dst_dim, width, height) ||
+        !RAPP_VALIDATE_U8 (src, src_dim, width, height))
+    {
+        return rapp_error_s16_u8(dst, dst_dim, width, height,
+                                 src, src_dim, width, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_diff_2x1_vert_u8_s16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_sobel_3x3_horz_u8_s16,
+         (int16_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_S16(dst, dst_dim, width,                  height) ||
+        !RAPP_VALIDATE_U8 (src, src_dim, width + 2*RC_ALIGNMENT, height))
+    {
+        return rapp_error_s16_u8(dst, dst_dim, width,                  height,
+                                 src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_sobel_3x3_horz_u8_s16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_sobel_3x3_vert_u8_s16,
+         (int16_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_S16(dst, dst_dim, width,                  height) ||
+        !RAPP_VALIDATE_U8 (src, src_dim, width + 2*RC_ALIGNMENT, height))
+    {
+        return rapp_error_s16_u8(dst, dst_dim, width,                  height,
+                                 src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_sobel_3x3_vert_u8_s16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_laplace_3x3_u8_s16,
+         (int16_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_S16(dst, dst_dim, width,                  height) ||
+        !RAPP_VALIDATE_U8 (src, src_dim, width + 2*RC_ALIGNMENT, height))
+    {
+        return rapp_error_s16_u8(dst, dst_dim, width,                  height,
+                                 src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_laplace_3x3_u8_s16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_highpass_3x3_u8_s16,
+         (int16_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_S16(dst, dst_dim, width,                  height) ||
+        !RAPP_VALIDATE_U8 (src, src_dim, width + 2*RC_ALIGNMENT, height))
+    {
+        return rapp_error_s16_u8(dst, dst_dim, width,                  height,
+                                 src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_highpass_3x3_u8_s16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_conv_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height,
+          const int8_t *kern, int kern_width, int kern_height,
+          int shift))
+{
+    int xpad = rc_align(kern_width  / 2);
+    int ypad = kern_height / 2;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -ypad*src_dim - xpad,
+                                       ypad*src_dim + rc_align(width) + xpad))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, width,          height) ||
+        !RAPP_VALIDATE_U8(src, src_dim, width + 2*xpad, height))
+    {
+        return rapp_error_u8_u8(dst, dst_dim, width,          height,
+                                src, src_dim, width + 2*xpad, height);
+    }
+
+    if (!kern) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    if (kern_width  < 1 || kern_width  > RC_FILTER_CONV_MAX ||
+        kern_height < 1 || kern_height > RC_FILTER_CONV_MAX ||
+        kern_width % 2 == 0 || kern_height % 2 == 0 ||
+        shift < 0 || shift > 15 ||
+        !rapp_filter_kernel_valid(kern, kern_width*kern_height))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    /* Perform convolution */
+    rc_filter_conv_u8(dst, dst_dim, src, src_dim, width, height,
+                      kern, kern_width, kern_height, shift);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_sep_worksize_u8, (int width))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (width < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    return rc_align(width) + 2*rc_align(RC_FILTER_CONV_MAX / 2);
+}
+
+RAPP_API(int, rapp_filter_sep_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height,
+          const int8_t *xkern, int xlen, int xshift,
+          const int8_t *ykern, int ylen, int yshift,
+          void *restrict work))
+{
+    int xpad = rc_align(xlen / 2);
+    int ypad = ylen / 2;
+    int size = rc_align(width) + 2*rc_align(RC_FILTER_CONV_MAX / 2);
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -ypad*src_dim - xpad,
+                                       ypad*src_dim + rc_align(width) + xpad))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(src, src_dim, work, 0, height,
+                                       -ypad*src_dim - xpad,
+                                       ypad*src_dim + rc_align(width) + xpad,
+                                       0, size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, work, 0, height,
+                                     rc_align(width), size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, width,          height) ||
+        !RAPP_VALIDATE_U8(src, src_dim, width + 2*xpad, height))
+    {
+        return rapp_error_u8_u8(dst, dst_dim, width,          height,
+                                src, src_dim, width + 2*xpad, height);
+    }
+
+    if (!xkern || !ykern || !work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    if (xlen < 1 || xlen > RC_FILTER_CONV_MAX || xlen % 2 == 0 ||
+        ylen < 1 || ylen > RC_FILTER_CONV_MAX || ylen % 2 == 0 ||
+        xshift < 0 || xshift > 15 || yshift < 0 || yshift > 15 ||
+        !rapp_filter_kernel_valid(xkern, xlen) ||
+        !rapp_filter_kernel_valid(ykern, ylen))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    /* Perform convolution */
+    rc_filter_sep_u8(dst, dst_dim, src, src_dim, width, height,
+                     xkern, xlen, xshift, ykern, ylen, yshift,
+                     (uint8_t*)work + rc_align(RC_FILTER_CONV_MAX / 2));
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_gauss_padding_u8, (int sigma))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (sigma < RAPP_FILTER_GAUSS_MIN || sigma > RAPP_FILTER_GAUSS_MAX) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    return rapp_filter_gauss_radius(sigma);
+}
+
+RAPP_API(int, rapp_filter_gauss_worksize_u8,
+         (int width, int height, int sigma))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (width < 1 || height < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    if (sigma < RAPP_FILTER_GAUSS_MIN || sigma > RAPP_FILTER_GAUSS_MAX) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    return rapp_filter_gauss_worksize(width, height, sigma);
+}
+
+RAPP_API(int, rapp_filter_gauss_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int sigma,
+          void *restrict work))
+{
+    int rad  = rapp_filter_gauss_radius(sigma);
+    int xpad = rc_align(rad);
+    int size = rapp_filter_gauss_worksize(width, height, sigma);
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -rad*src_dim - xpad,
+                                       rad*src_dim + rc_align(width) + xpad))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(src, src_dim, work, 0, height,
+                                       -rad*src_dim - xpad,
+                                       rad*src_dim + rc_align(width) + xpad,
+                                       0, size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, work, 0, height,
+                                     rc_align(width), size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, width,          height) ||
+        !RAPP_VALIDATE_U8(src, src_dim, width + 2*xpad, height))
+    {
+        return rapp_error_u8_u8(dst, dst_dim, width,          height,
+                                src, src_dim, width + 2*xpad, height);
+    }
+
+    if (sigma < RAPP_FILTER_GAUSS_MIN || sigma > RAPP_FILTER_GAUSS_MAX) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    else if (!work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    if (sigma < RAPP_FILTER_GAUSS_BOX) {
+        /* Separable convolution with a tabulated kernel */
+        const int8_t *tab = rapp_filter_gauss_tab[sigma -
+                                                  RAPP_FILTER_GAUSS_MIN];
+        int8_t        kern[RC_FILTER_CONV_MAX];
+        int           len = RC_FILTER_CONV_MAX / 2;
+        int           k;
+
+        /* Skip the zero-valued tail coefficients */
+        while (tab[len] == 0) {
+            len--;
+        }
+        for (k = -len; k <= len; k++) {
+            kern[len + k] = tab[k < 0 ? -k : k];
+        }
+
+        rc_filter_sep_u8(dst, dst_dim, src, src_dim, width, height,
+                         kern, 2*len + 1, 7, kern, 2*len + 1, 7,
+                         (uint8_t*)work + rc_align(RC_FILTER_CONV_MAX / 2));
+    }
+    else {
+        /**
+         *  Three passes of box filters in each direction. The horizontal
+         *  passes are performed on all rows needed by the vertical passes,
+         *  and each pass extends over the border needed by the next one.
+         */
+        int       box[RAPP_FILTER_GAUSS_PASSES];
+        int       dim  = rc_align(width) + 2*xpad;
+        int       rows = height + 2*rad;
+        uint8_t  *buf1 = (uint8_t*)work + rad*dim + xpad;
+        uint8_t  *buf2 = buf1 + rows*dim;
+        uint16_t *sum  = (uint16_t*)((uint8_t*)work + 2*rows*dim);
+        int       r2, r3;
+
+        rapp_filter_gauss_boxes(sigma, box);
+        r2 = box[1] / 2;
+        r3 = box[2] / 2;
+
+        /* Horizontal passes */
+        rc_filter_box_horz_u8(&buf1[-rad*dim - r2 - r3], dim,
+                              &src[-rad*src_dim - r2 - r3], src_dim,
+                              width + 2*(r2 + r3), rows, box[0]);
+        rc_filter_box_horz_u8(&buf2[-rad*dim - r3], dim,
+                              &buf1[-rad*dim - r3], dim,
+                              width + 2*r3, rows, box[1]);
+        rc_filter_box_horz_u8(&buf1[-rad*dim], dim,
+                              &buf2[-rad*dim], dim,
+                              width, rows, box[2]);
+
+        /* Vertical passes */
+        rc_filter_box_vert_u8(&buf2[-(r2 + r3)*dim], dim,
+                              &buf1[-(r2 + r3)*dim], dim,
+                              width, height + 2*(r2 + r3), box[0], sum);
+        rc_filter_box_vert_u8(&buf1[-r3*dim], dim,
+                              &buf2[-r3*dim], dim,
+                              width, height + 2*r3, box[1], sum);
+        rc_filter_box_vert_u8(dst, dst_dim, buf1, dim,
+                              width, height, box[2], sum);
+    }
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_median_3x3_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, width,                  height) ||
+        !RAPP_VALIDATE_U8(src, src_dim, width + 2*RC_ALIGNMENT, height))
+    {
+        return rapp_error_u8_u8(dst, dst_dim, width,                  height,
+                                src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    /* Perform filtering */
+    rc_filter_median_3x3_u8(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_median_5x5_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -2*src_dim - RC_ALIGNMENT,
+                                       2*src_dim + rc_align(width) +
+                                       RC_ALIGNMENT))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, width,                  height) ||
+        !RAPP_VALIDATE_U8(src, src_dim, width + 2*RC_ALIGNMENT, height))
+    {
+        return rapp_error_u8_u8(dst, dst_dim, width,                  height,
+                                src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    /* Perform filtering */
+    rc_filter_median_5x5_u8(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_rank_worksize_u8, (int width, int radius))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (width < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    if (radius < 1 || radius > RC_FILTER_RANK_MAX) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    return rapp_filter_rank_worksize(width, radius);
+}
+
+RAPP_API(int, rapp_filter_rank_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int radius, int rank,
+          void *restrict work))
+{
+    int xpad = rc_align(radius);
+    int size = rapp_filter_rank_worksize(width, radius);
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -radius*src_dim - xpad,
+                                       radius*src_dim + rc_align(width) +
+                                       xpad))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(src, src_dim, work, 0, height,
+                                       -radius*src_dim - xpad,
+                                       radius*src_dim + rc_align(width) +
+                                       xpad, 0, size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, work, 0, height,
+                                     rc_align(width), size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, width,          height) ||
+        !RAPP_VALIDATE_U8(src, src_dim, width + 2*xpad, height))
+    {
+        return rapp_error_u8_u8(dst, dst_dim, width,          height,
+                                src, src_dim, width + 2*xpad, height);
+    }
+
+    if (radius < 1 || radius > RC_FILTER_RANK_MAX ||
+        rank < 0 || rank >= (2*radius + 1)*(2*radius + 1))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    else if (!work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Perform filtering */
+    rc_filter_rank_u8(dst, dst_dim, src, src_dim, width, height,
+                      radius, rank, work);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_gauss_3x3_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + 2*width + 2)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_u16_u16(dst, dst_dim, width,                height,
+                                  src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_gauss_3x3_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_median_3x3_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + 2*width + 2)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_u16_u16(dst, dst_dim, width,                height,
+                                  src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform filtering */
+    rc_filter_median_3x3_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_sobel_3x3_horz_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + 2*width + 2)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_u16_u16(dst, dst_dim, width,                height,
+                                  src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_sobel_3x3_horz_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_sobel_3x3_horz_abs_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + 2*width + 2)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_u16_u16(dst, dst_dim, width,                height,
+                                  src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_sobel_3x3_horz_abs_u16(dst, dst_dim, src, src_dim,
+                                     width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_sobel_3x3_vert_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + 2*width + 2)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_u16_u16(dst, dst_dim, width,                height,
+                                  src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_sobel_3x3_vert_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_sobel_3x3_vert_abs_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + 2*width + 2)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_u16_u16(dst, dst_dim, width,                height,
+                                  src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_sobel_3x3_vert_abs_u16(dst, dst_dim, src, src_dim,
+                                     width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_laplace_3x3_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + 2*width + 2)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_u16_u16(dst, dst_dim, width,                height,
+                                  src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_laplace_3x3_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_laplace_3x3_abs_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + 2*width + 2)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_u16_u16(dst, dst_dim, width,                height,
+                                  src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_laplace_3x3_abs_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_highpass_3x3_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + 2*width + 2)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_u16_u16(dst, dst_dim, width,                height,
+                                  src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_highpass_3x3_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_highpass_3x3_abs_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(2*width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + 2*width + 2)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width,                height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width + RC_ALIGNMENT, height))
+    {
+        return rapp_error_u16_u16(dst, dst_dim, width,                height,
+                                  src, src_dim, width + RC_ALIGNMENT, height);
+    }
+
+    /* Perform convolution */
+    rc_filter_highpass_3x3_abs_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_census_3x3_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, width,                  height) ||
+        !RAPP_VALIDATE_U8(src, src_dim, width + 2*RC_ALIGNMENT, height))
+    {
+        return rapp_error_u8_u8(dst, dst_dim, width,                  height,
+                                src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    /* Perform the transform */
+    rc_filter_census_3x3_u8(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_census_5x5_u8_u32,
+         (uint32_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(4*width),
+                                       -2*src_dim - RC_ALIGNMENT,
+                                       2*src_dim + rc_align(width) +
+                                       RC_ALIGNMENT))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(src, src_dim, width + 2*RC_ALIGNMENT, height) ||
+        !RAPP_VALIDATE_U32(dst, dst_dim, width,                 height))
+    {
+        return rapp_error_u8_u32(src, src_dim, width + 2*RC_ALIGNMENT, height,
+                                 dst, dst_dim, width,                 height);
+    }
+
+    /* Perform the transform */
+    rc_filter_census_5x5_u8_u32(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_lbp_3x3_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -src_dim - RC_ALIGNMENT,
+                                       rc_align(src_dim + width + 1)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, width,                  height) ||
+        !RAPP_VALIDATE_U8(src, src_dim, width + 2*RC_ALIGNMENT, height))
+    {
+        return rapp_error_u8_u8(dst, dst_dim, width,                  height,
+                                src, src_dim, width + 2*RC_ALIGNMENT, height);
+    }
+
+    /* Perform the transform */
+    rc_filter_lbp_3x3_u8(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_census_cost_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src1, int src1_dim,
+          const uint8_t *restrict src2, int src2_dim,
+          int width, int height, int disparities))
+{
+    int vol; /* Offset of the last cost image */
+    int d;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate the number of disparities before sizing the volume */
+    if (!rapp_filter_census_disp_valid(dst_dim, height, disparities)) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    vol = (disparities - 1)*height*dst_dim;
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src1, src1_dim, height,
+                                       0, vol + rc_align(width),
+                                       0, rc_align(width)) ||
+        !RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src2, src2_dim, height,
+                                       0, vol + rc_align(width),
+                                       0, rc_align(width)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst,  dst_dim,  width, height) ||
+        !RAPP_VALIDATE_U8(src1, src1_dim, width, height) ||
+        !RAPP_VALIDATE_U8(src2, src2_dim, width, height))
+    {
+        return rapp_error_u8_u8_u8(dst,  dst_dim,  width, height,
+                                   src1, src1_dim, width, height,
+                                   src2, src2_dim, width, height);
+    }
+
+    /* Compute the cost image of each disparity */
+    for (d = 0; d < disparities; d++) {
+        rc_filter_census_cost_u8(&dst[d*height*dst_dim], dst_dim,
+                                 src1, src1_dim, src2, src2_dim,
+                                 width, height, d);
+    }
+
+    return RAPP_OK;
+}
+
+RAPP_API(int, rapp_filter_census_cost_u32_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint32_t *restrict src1, int src1_dim,
+          const uint32_t *restrict src2, int src2_dim,
+          int width, int height, int disparities))
+{
+    int vol; /* Offset of the last cost image */
+    int d;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate the number of disparities before sizing the volume */
+    if (!rapp_filter_census_disp_valid(dst_dim, height, disparities)) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    vol = (disparities - 1)*height*dst_dim;
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src1, src1_dim, height,
+                                       0, vol + rc_align(width),
+                                       0, rc_align(4*width)) ||
+        !RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src2, src2_dim, height,
+                                       0, vol + rc_align(width),
+                                       0, rc_align(4*width)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst,   dst_dim,  width, height) ||
+        !RAPP_VALIDATE_U32(src1, src1_dim, width, height) ||
+        !RAPP_VALIDATE_U32(src2, src2_dim, width, height))
+    {
+        int err = rapp_error_u8_u32(dst,  dst_dim,  width, height,
+                                    src1, src1_dim, width, height);
+        return err ? err : rapp_error_u32(src2, src2_dim, width, height);
+    }
+
+    /* Compute the cost image of each disparity */
+    for (d = 0; d < disparities; d++) {
+        rc_filter_census_cost_u32_u8(&dst[d*height*dst_dim], dst_dim,
+                                     src1, src1_dim, src2, src2_dim,
+                                     width, height, d);
+    }
+
+    return RAPP_OK;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Check that the sums of the positive and the negative coefficients
+ *  of a kernel both have a magnitude of at most 128. This guarantees that
+ *  the 16-bit accumulators of the vector implementations never overflow.
+ */
+static int
+rapp_filter_kernel_valid(const int8_t *kern, int len)
+{
+    int pos = 0;
+    int neg = 0;
+    int k;
+
+    for (k = 0; k < len; k++) {
+        if (kern[k] > 0) {
+            pos += kern[k];
+        }
+        else {
+            neg -= kern[k];
+        }
+    }
+
+    return pos <= 128 && neg <= 128;
+}
+
+/**
+ *  Compute the box filter sizes that approximate a Gaussian.
+ *  The ideal box size w for n passes satisfies n*(w*w - 1)/12 = sigma^2.
+ *  We use the largest odd size below the ideal one for the first m passes,
+ *  and the next odd size for the remaining passes, with m chosen to get
+ *  the total variance as close to sigma^2 as possible. The sigma value
+ *  is in units of 1/16 pixel, so sigma^2 is in units of 1/256.
+ */
+static void
+rapp_filter_gauss_boxes(int sigma, int *size)
+{
+    int n   = RAPP_FILTER_GAUSS_PASSES;
+    int var = sigma*sigma;
+    int lim = (12*var / n + 256) >> 8;
+    int num, den, w, m, k;
+
+    /* Compute the largest odd size w with w*w <= 12*sigma^2/n + 1 */
+    w = 1;
+    while ((w + 2)*(w + 2) <= lim) {
+        w += 2;
+    }
+
+    /* Compute the number of passes m with size w */
+    num = 256*n*(w*w + 4*w + 3) - 12*var;
+    den = 256*(4*w + 4);
+    m   = CLAMP((num + den / 2) / den, 0, n);
+
+    for (k = 0; k < n; k++) {
+        size[k] = k < m ? w : w + 2;
+    }
+}
+
+/**
+ *  Get the filter radius, i.e. the padding needed, for a sigma value.
+ *  Out-of-range values are clamped.
+ */
+static int
+rapp_filter_gauss_radius(int sigma)
+{
+    int box[RAPP_FILTER_GAUSS_PASSES];
+    int rad = 0;
+    int k;
+
+    sigma = CLAMP(sigma, RAPP_FILTER_GAUSS_MIN, RAPP_FILTER_GAUSS_MAX);
+    if (sigma < RAPP_FILTER_GAUSS_BOX) {
+        return RC_FILTER_CONV_MAX / 2;
+    }
+
+    rapp_filter_gauss_boxes(sigma, box);
+    for (k = 0; k < RAPP_FILTER_GAUSS_PASSES; k++) {
+        rad += box[k] / 2;
+    }
+
+    return rad;
+}
+
+/**
+ *  Get the working buffer size for a Gaussian filter.
+ *  The box filter approximation needs two intermediate images
+ *  including the border, and a row of 16-bit column sums.
+ */
+static int
+rapp_filter_gauss_worksize(int width, int height, int sigma)
+{
+    int rad = rapp_filter_gauss_radius(sigma);
+
+    if (sigma < RAPP_FILTER_GAUSS_BOX) {
+        return rc_align(width) + 2*rc_align(RC_FILTER_CONV_MAX / 2);
+    }
+
+    return 2*(height + 2*rad)*(rc_align(width) + 2*rc_align(rad)) +
+           rc_align(width)*sizeof(uint16_t);
+}
+
+/**
+ *  Compute the size of the rank filter working buffer.
+ */
+static int
+rapp_filter_rank_worksize(int width, int radius)
+{
+    return (width + 2*radius)*RC_FILTER_RANK_BINS*sizeof(uint16_t);
+}
+
+/**
+ *  Check the number of disparities of a census cost volume. There must
+ *  be at least one, and the offsets into the volume must fit in an int.
+ *  More than one disparity is only accepted for a valid image size.
+ */
+static int
+rapp_filter_census_disp_valid(int dst_dim, int height, int disparities)
+{
+    if (disparities == 1) {
+        return true;
+    }
+
+    return disparities > 1 && height > 0 && dst_dim > 0 &&
+           height <= INT_MAX / dst_dim &&
+           disparities <= INT_MAX / (height*dst_dim);
+}
@@ -223,3 +223,39 @@ RAPP_API(int, rapp_integral_sum_u8_u32,
 
     return RAPP_OK;
 }
+
+/**
+ *  Integral image: 16-bit source to 32-bit integral.
+ */
+RAPP_API(int, rapp_integral_sum_u16_u32,
+         (uint32_t *restrict dst, int dst_dim,
+         const uint16_t *restrict src, int src_dim,
+         int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(src, src_dim, dst, dst_dim, height,
+                                       -RC_ALIGNMENT - src_dim,
+                                       rc_align(2*width),
+                                       0, rc_align(4*width)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(src, src_dim, width, height) ||
+        !RAPP_VALIDATE_U32(dst, dst_dim, width, height))
+    {
+        return rapp_error_u16_u32(src, src_dim, width, height,
+                                  dst, dst_dim, width, height);
+    }
+
+    /* Perform operation */
+    rc_integral_sum_u16_u32(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
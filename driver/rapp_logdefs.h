@@ -275,6 +275,48 @@
 #define RAPP_LOG_ARGSFORMAT_rapp_pixop_norm_u8 "%p, %d, %p, %d, %d, %d"
 #define RAPP_LOG_RETFORMAT_rapp_pixop_norm_u8 "%d"
 
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_pixop_add_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_pixop_add_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_pixop_add_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_pixop_add_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_pixop_add_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_pixop_sub_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_pixop_sub_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_pixop_sub_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_pixop_sub_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_pixop_sub_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_pixop_suba_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_pixop_suba_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_pixop_suba_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_pixop_suba_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_pixop_suba_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_pixop_lut_u16_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_pixop_lut_u16_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_pixop_lut_u16_u8 dst, dst_dim, src, src_dim, width, height, lut, shift
+#define RAPP_LOG_ARGSFORMAT_rapp_pixop_lut_u16_u8 "%p, %d, %p, %d, %d, %d, %p, %d"
+#define RAPP_LOG_RETFORMAT_rapp_pixop_lut_u16_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_pixop_equalize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_pixop_equalize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_pixop_equalize_u8 buf, dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_pixop_equalize_u8 "%p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_pixop_equalize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_pixop_clahe_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_pixop_clahe_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_pixop_clahe_worksize_u8 width, tiles
+#define RAPP_LOG_ARGSFORMAT_rapp_pixop_clahe_worksize_u8 "%d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_pixop_clahe_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_pixop_clahe_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_pixop_clahe_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_pixop_clahe_u8 buf, dim, width, height, tiles, clip, work
+#define RAPP_LOG_ARGSFORMAT_rapp_pixop_clahe_u8 "%p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_pixop_clahe_u8 "%d"
+
 #define RAPP_LOG_IDENTITY_IF_RETURN_rapp_type_u8_to_bin(x) x
 #define RAPP_LOG_IDENTITY_IF_ARGS_rapp_type_u8_to_bin(x) x
 #define RAPP_LOG_ARGLIST_rapp_type_u8_to_bin dst, dst_dim, src, src_dim, width, height
@@ -335,6 +377,54 @@
 #define RAPP_LOG_ARGSFORMAT_rapp_thresh_ltgt_pixel_u8 "%p, %d, %p, %d, %p, %d, %p, %d, %d, %d"
 #define RAPP_LOG_RETFORMAT_rapp_thresh_ltgt_pixel_u8 "%d"
 
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_thresh_gt_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_thresh_gt_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_thresh_gt_u16 dst, dst_dim, src, src_dim, width, height, thresh
+#define RAPP_LOG_ARGSFORMAT_rapp_thresh_gt_u16 "%p, %d, %p, %d, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_thresh_gt_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_thresh_lt_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_thresh_lt_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_thresh_lt_u16 dst, dst_dim, src, src_dim, width, height, thresh
+#define RAPP_LOG_ARGSFORMAT_rapp_thresh_lt_u16 "%p, %d, %p, %d, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_thresh_lt_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_thresh_auto_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_thresh_auto_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_thresh_auto_u8 dst, dst_dim, src, src_dim, width, height, method, percent, hist
+#define RAPP_LOG_ARGSFORMAT_rapp_thresh_auto_u8 "%p, %d, %p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_thresh_auto_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_thresh_adaptive_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_thresh_adaptive_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_thresh_adaptive_worksize_u8 width, radius
+#define RAPP_LOG_ARGSFORMAT_rapp_thresh_adaptive_worksize_u8 "%d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_thresh_adaptive_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_thresh_adaptive_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_thresh_adaptive_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_thresh_adaptive_u8 dst, dst_dim, src, src_dim, width, height, radius, offset, work
+#define RAPP_LOG_ARGSFORMAT_rapp_thresh_adaptive_u8 "%p, %d, %p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_thresh_adaptive_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_thresh_absdiff_gt_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_thresh_absdiff_gt_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_thresh_absdiff_gt_u8 dst, dst_dim, src1, src1_dim, src2, src2_dim, width, height, thresh
+#define RAPP_LOG_ARGSFORMAT_rapp_thresh_absdiff_gt_u8 "%p, %d, %p, %d, %p, %d, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_thresh_absdiff_gt_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_thresh_absdiff_hyst_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_thresh_absdiff_hyst_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_thresh_absdiff_hyst_worksize_u8 width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_thresh_absdiff_hyst_worksize_u8 "%d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_thresh_absdiff_hyst_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_thresh_absdiff_hyst_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_thresh_absdiff_hyst_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_thresh_absdiff_hyst_u8 dst, dst_dim, src1, src1_dim, src2, src2_dim, width, height, low, high, work
+#define RAPP_LOG_ARGSFORMAT_rapp_thresh_absdiff_hyst_u8 "%p, %d, %p, %d, %p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_thresh_absdiff_hyst_u8 "%d"
+
 #define RAPP_LOG_IDENTITY_IF_RETURN_rapp_reduce_1x2_u8(x) x
 #define RAPP_LOG_IDENTITY_IF_ARGS_rapp_reduce_1x2_u8(x) x
 #define RAPP_LOG_ARGLIST_rapp_reduce_1x2_u8 dst, dst_dim, src, src_dim, width, height
@@ -353,6 +443,12 @@
 #define RAPP_LOG_ARGSFORMAT_rapp_reduce_2x2_u8 "%p, %d, %p, %d, %d, %d"
 #define RAPP_LOG_RETFORMAT_rapp_reduce_2x2_u8 "%d"
 
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_reduce_2x2_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_reduce_2x2_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_reduce_2x2_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_reduce_2x2_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_reduce_2x2_u16 "%d"
+
 #define RAPP_LOG_IDENTITY_IF_RETURN_rapp_reduce_1x2_rk1_bin(x) x
 #define RAPP_LOG_IDENTITY_IF_ARGS_rapp_reduce_1x2_rk1_bin(x) x
 #define RAPP_LOG_ARGLIST_rapp_reduce_1x2_rk1_bin dst, dst_dim, src, src_dim, width, height
@@ -503,6 +599,18 @@
 #define RAPP_LOG_ARGSFORMAT_rapp_filter_sobel_3x3_magn_u8 "%p, %d, %p, %d, %d, %d"
 #define RAPP_LOG_RETFORMAT_rapp_filter_sobel_3x3_magn_u8 "%d"
 
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_sobel_3x3_magn_dir_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_sobel_3x3_magn_dir_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_sobel_3x3_magn_dir_u8 mag, mag_dim, dir, dir_dim, src, src_dim, width, height, bins
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_sobel_3x3_magn_dir_u8 "%p, %d, %p, %d, %p, %d, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_sobel_3x3_magn_dir_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_sobel_3x3_grad_u8_s16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_sobel_3x3_grad_u8_s16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_sobel_3x3_grad_u8_s16 gx, gx_dim, gy, gy_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_sobel_3x3_grad_u8_s16 "%p, %d, %p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_sobel_3x3_grad_u8_s16 "%d"
+
 #define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_gauss_3x3_u8(x) x
 #define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_gauss_3x3_u8(x) x
 #define RAPP_LOG_ARGLIST_rapp_filter_gauss_3x3_u8 dst, dst_dim, src, src_dim, width, height
@@ -533,6 +641,192 @@
 #define RAPP_LOG_ARGSFORMAT_rapp_filter_highpass_3x3_abs_u8 "%p, %d, %p, %d, %d, %d"
 #define RAPP_LOG_RETFORMAT_rapp_filter_highpass_3x3_abs_u8 "%d"
 
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_diff_1x2_horz_u8_s16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_diff_1x2_horz_u8_s16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_diff_1x2_horz_u8_s16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_diff_1x2_horz_u8_s16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_diff_1x2_horz_u8_s16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_diff_2x1_vert_u8_s16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_diff_2x1_vert_u8_s16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_diff_2x1_vert_u8_s16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_diff_2x1_vert_u8_s16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_diff_2x1_vert_u8_s16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_sobel_3x3_horz_u8_s16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_sobel_3x3_horz_u8_s16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_sobel_3x3_horz_u8_s16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_sobel_3x3_horz_u8_s16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_sobel_3x3_horz_u8_s16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_sobel_3x3_vert_u8_s16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_sobel_3x3_vert_u8_s16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_sobel_3x3_vert_u8_s16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_sobel_3x3_vert_u8_s16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_sobel_3x3_vert_u8_s16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_laplace_3x3_u8_s16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_laplace_3x3_u8_s16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_laplace_3x3_u8_s16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_laplace_3x3_u8_s16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_laplace_3x3_u8_s16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_highpass_3x3_u8_s16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_highpass_3x3_u8_s16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_highpass_3x3_u8_s16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_highpass_3x3_u8_s16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_highpass_3x3_u8_s16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_conv_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_conv_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_conv_u8 dst, dst_dim, src, src_dim, width, height, kern, kern_width, kern_height, shift
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_conv_u8 "%p, %d, %p, %d, %d, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_conv_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_sep_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_sep_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_sep_worksize_u8 width
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_sep_worksize_u8 "%d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_sep_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_sep_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_sep_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_sep_u8 dst, dst_dim, src, src_dim, width, height, xkern, xlen, xshift, ykern, ylen, yshift, work
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_sep_u8 "%p, %d, %p, %d, %d, %d, %p, %d, %d, %p, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_filter_sep_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_gauss_padding_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_gauss_padding_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_gauss_padding_u8 sigma
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_gauss_padding_u8 "%d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_gauss_padding_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_gauss_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_gauss_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_gauss_worksize_u8 width, height, sigma
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_gauss_worksize_u8 "%d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_gauss_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_gauss_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_gauss_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_gauss_u8 dst, dst_dim, src, src_dim, width, height, sigma, work
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_gauss_u8 "%p, %d, %p, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_filter_gauss_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_median_3x3_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_median_3x3_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_median_3x3_u8 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_median_3x3_u8 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_median_3x3_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_median_5x5_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_median_5x5_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_median_5x5_u8 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_median_5x5_u8 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_median_5x5_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_rank_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_rank_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_rank_worksize_u8 width, radius
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_rank_worksize_u8 "%d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_rank_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_rank_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_rank_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_rank_u8 dst, dst_dim, src, src_dim, width, height, radius, rank, work
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_rank_u8 "%p, %d, %p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_filter_rank_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_gauss_3x3_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_gauss_3x3_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_gauss_3x3_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_gauss_3x3_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_gauss_3x3_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_median_3x3_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_median_3x3_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_median_3x3_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_median_3x3_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_median_3x3_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_sobel_3x3_horz_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_sobel_3x3_horz_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_sobel_3x3_horz_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_sobel_3x3_horz_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_sobel_3x3_horz_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_sobel_3x3_horz_abs_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_sobel_3x3_horz_abs_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_sobel_3x3_horz_abs_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_sobel_3x3_horz_abs_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_sobel_3x3_horz_abs_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_sobel_3x3_vert_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_sobel_3x3_vert_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_sobel_3x3_vert_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_sobel_3x3_vert_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_sobel_3x3_vert_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_sobel_3x3_vert_abs_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_sobel_3x3_vert_abs_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_sobel_3x3_vert_abs_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_sobel_3x3_vert_abs_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_sobel_3x3_vert_abs_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_laplace_3x3_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_laplace_3x3_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_laplace_3x3_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_laplace_3x3_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_laplace_3x3_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_laplace_3x3_abs_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_laplace_3x3_abs_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_laplace_3x3_abs_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_laplace_3x3_abs_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_laplace_3x3_abs_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_highpass_3x3_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_highpass_3x3_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_highpass_3x3_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_highpass_3x3_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_highpass_3x3_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_highpass_3x3_abs_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_highpass_3x3_abs_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_highpass_3x3_abs_u16 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_highpass_3x3_abs_u16 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_highpass_3x3_abs_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_census_3x3_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_census_3x3_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_census_3x3_u8 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_census_3x3_u8 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_census_3x3_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_census_5x5_u8_u32(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_census_5x5_u8_u32(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_census_5x5_u8_u32 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_census_5x5_u8_u32 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_census_5x5_u8_u32 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_lbp_3x3_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_lbp_3x3_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_lbp_3x3_u8 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_lbp_3x3_u8 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_lbp_3x3_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_census_cost_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_census_cost_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_census_cost_u8 dst, dst_dim, src1, src1_dim, src2, src2_dim, width, height, disparities
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_census_cost_u8 "%p, %d, %p, %d, %p, %d, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_census_cost_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_filter_census_cost_u32_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_filter_census_cost_u32_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_filter_census_cost_u32_u8 dst, dst_dim, src1, src1_dim, src2, src2_dim, width, height, disparities
+#define RAPP_LOG_ARGSFORMAT_rapp_filter_census_cost_u32_u8 "%p, %d, %p, %d, %p, %d, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_filter_census_cost_u32_u8 "%d"
+
 #define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_sum_bin(x) x
 #define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_sum_bin(x) x
 #define RAPP_LOG_ARGLIST_rapp_stat_sum_bin buf, dim, width, height
@@ -581,6 +875,108 @@
 #define RAPP_LOG_ARGSFORMAT_rapp_stat_max_u8 "%p, %d, %d, %d"
 #define RAPP_LOG_RETFORMAT_rapp_stat_max_u8 "%d"
 
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_sum_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_sum_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_sum_u16 buf, dim, width, height, sum
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_sum_u16 "%p, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_stat_sum_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_min_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_min_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_min_u16 buf, dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_min_u16 "%p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_stat_min_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_max_u16(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_max_u16(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_max_u16 buf, dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_max_u16 "%p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_stat_max_u16 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_hist_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_hist_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_hist_u8 buf, dim, map, map_dim, width, height, hist
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_hist_u8 "%p, %d, %p, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_stat_hist_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_hist_bins_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_hist_bins_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_hist_bins_u8 buf, dim, map, map_dim, width, height, hist, bins
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_hist_bins_u8 "%p, %d, %p, %d, %d, %d, %p, %d"
+#define RAPP_LOG_RETFORMAT_rapp_stat_hist_bins_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_sum_mask_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_sum_mask_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_sum_mask_u8 buf, dim, map, map_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_sum_mask_u8 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_stat_sum_mask_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_sum2_mask_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_sum2_mask_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_sum2_mask_u8 buf, dim, map, map_dim, width, height, sum
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_sum2_mask_u8 "%p, %d, %p, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_stat_sum2_mask_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_min_mask_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_min_mask_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_min_mask_u8 buf, dim, map, map_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_min_mask_u8 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_stat_min_mask_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_max_mask_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_max_mask_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_max_mask_u8 buf, dim, map, map_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_max_mask_u8 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_stat_max_mask_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_minmax_loc_bin(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_minmax_loc_bin(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_minmax_loc_bin buf, dim, width, height, minmax, pos
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_minmax_loc_bin "%p, %d, %d, %d, %p, %p"
+#define RAPP_LOG_RETFORMAT_rapp_stat_minmax_loc_bin "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_minmax_loc_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_minmax_loc_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_minmax_loc_u8 buf, dim, width, height, minmax, pos
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_minmax_loc_u8 "%p, %d, %d, %d, %p, %p"
+#define RAPP_LOG_RETFORMAT_rapp_stat_minmax_loc_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_max_k_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_max_k_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_max_k_u8 buf, dim, width, height, pos, k
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_max_k_u8 "%p, %d, %d, %d, %p, %d"
+#define RAPP_LOG_RETFORMAT_rapp_stat_max_k_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_tiles_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_tiles_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_tiles_u8 buf, dim, width, height, tile_w, tile_h, sum, min, max
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_tiles_u8 "%p, %d, %d, %d, %d, %d, %p, %p, %p"
+#define RAPP_LOG_RETFORMAT_rapp_stat_tiles_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_sad_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_sad_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_sad_u8 src1, src1_dim, src2, src2_dim, width, height, sad
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_sad_u8 "%p, %d, %p, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_stat_sad_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_ssd_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_ssd_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_ssd_u8 src1, src1_dim, src2, src2_dim, width, height, ssd
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_ssd_u8 "%p, %d, %p, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_stat_ssd_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_ssim_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_ssim_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_ssim_worksize_u8 width
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_ssim_worksize_u8 "%d"
+#define RAPP_LOG_RETFORMAT_rapp_stat_ssim_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_stat_ssim_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_stat_ssim_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_stat_ssim_u8 src1, src1_dim, src2, src2_dim, width, height, ssim, work
+#define RAPP_LOG_ARGSFORMAT_rapp_stat_ssim_u8 "%p, %d, %p, %d, %d, %d, %p, %p"
+#define RAPP_LOG_RETFORMAT_rapp_stat_ssim_u8 "%d"
+
 #define RAPP_LOG_IDENTITY_IF_RETURN_rapp_moment_order1_bin(x) x
 #define RAPP_LOG_IDENTITY_IF_ARGS_rapp_moment_order1_bin(x) x
 #define RAPP_LOG_ARGLIST_rapp_moment_order1_bin buf, dim, width, height, mom
@@ -821,5 +1217,119 @@
 #define RAPP_LOG_ARGSFORMAT_rapp_integral_sum_u8_u32 "%p, %d, %p, %d, %d, %d"
 #define RAPP_LOG_RETFORMAT_rapp_integral_sum_u8_u32 "%d"
 
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_integral_sum_u16_u32(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_integral_sum_u16_u32(x) x
+#define RAPP_LOG_ARGLIST_rapp_integral_sum_u16_u32 dst, dst_dim, src, src_dim, width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_integral_sum_u16_u32 "%p, %d, %p, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_integral_sum_u16_u32 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_morph_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_morph_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_morph_worksize_u8 width, height, wrect, hrect
+#define RAPP_LOG_ARGSFORMAT_rapp_morph_worksize_u8 "%d, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_morph_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_morph_erode_rect_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_morph_erode_rect_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_morph_erode_rect_u8 dst, dst_dim, src, src_dim, width, height, wrect, hrect, work
+#define RAPP_LOG_ARGSFORMAT_rapp_morph_erode_rect_u8 "%p, %d, %p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_morph_erode_rect_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_morph_dilate_rect_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_morph_dilate_rect_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_morph_dilate_rect_u8 dst, dst_dim, src, src_dim, width, height, wrect, hrect, work
+#define RAPP_LOG_ARGSFORMAT_rapp_morph_dilate_rect_u8 "%p, %d, %p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_morph_dilate_rect_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_morph_open_rect_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_morph_open_rect_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_morph_open_rect_u8 dst, dst_dim, src, src_dim, width, height, wrect, hrect, work
+#define RAPP_LOG_ARGSFORMAT_rapp_morph_open_rect_u8 "%p, %d, %p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_morph_open_rect_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_morph_close_rect_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_morph_close_rect_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_morph_close_rect_u8 dst, dst_dim, src, src_dim, width, height, wrect, hrect, work
+#define RAPP_LOG_ARGSFORMAT_rapp_morph_close_rect_u8 "%p, %d, %p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_morph_close_rect_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_morph_tophat_rect_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_morph_tophat_rect_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_morph_tophat_rect_u8 dst, dst_dim, src, src_dim, width, height, wrect, hrect, work
+#define RAPP_LOG_ARGSFORMAT_rapp_morph_tophat_rect_u8 "%p, %d, %p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_morph_tophat_rect_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_edge_canny_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_edge_canny_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_edge_canny_worksize_u8 width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_edge_canny_worksize_u8 "%d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_edge_canny_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_edge_canny_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_edge_canny_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_edge_canny_u8 dst, dst_dim, src, src_dim, width, height, low, high, work
+#define RAPP_LOG_ARGSFORMAT_rapp_edge_canny_u8 "%p, %d, %p, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_edge_canny_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_bgmodel_update_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_bgmodel_update_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_bgmodel_update_u8 fg, fg_dim, mean, mean_dim, dev, dev_dim, src, src_dim, width, height, alpha8, thresh
+#define RAPP_LOG_ARGSFORMAT_rapp_bgmodel_update_u8 "%p, %d, %p, %d, %p, %d, %p, %d, %d, %d, %u, %d"
+#define RAPP_LOG_RETFORMAT_rapp_bgmodel_update_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_motion_blockmatch_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_motion_blockmatch_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_motion_blockmatch_worksize_u8 width, height, block, levels
+#define RAPP_LOG_ARGSFORMAT_rapp_motion_blockmatch_worksize_u8 "%d, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_motion_blockmatch_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_motion_blockmatch_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_motion_blockmatch_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_motion_blockmatch_u8 vec, cost, cur, cur_dim, ref, ref_dim, width, height, block, range, levels, work
+#define RAPP_LOG_ARGSFORMAT_rapp_motion_blockmatch_u8 "%p, %p, %p, %d, %p, %d, %d, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_motion_blockmatch_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_match_template_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_match_template_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_match_template_worksize_u8 width, height, tpl_width, tpl_height, mode, levels
+#define RAPP_LOG_ARGSFORMAT_rapp_match_template_worksize_u8 "%d, %d, %d, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_match_template_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_match_template_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_match_template_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_match_template_u8 src, src_dim, width, height, tpl, tpl_dim, tpl_width, tpl_height, mode, levels, pos, score, work
+#define RAPP_LOG_ARGSFORMAT_rapp_match_template_u8 "%p, %d, %d, %d, %p, %d, %d, %d, %d, %d, %p, %p, %p"
+#define RAPP_LOG_RETFORMAT_rapp_match_template_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_feature_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_feature_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_feature_worksize_u8 width, height
+#define RAPP_LOG_ARGSFORMAT_rapp_feature_worksize_u8 "%d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_feature_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_feature_fast_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_feature_fast_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_feature_fast_u8 src, src_dim, width, height, thresh, nms, pos, max, work
+#define RAPP_LOG_ARGSFORMAT_rapp_feature_fast_u8 "%p, %d, %d, %d, %d, %d, %p, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_feature_fast_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_feature_harris_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_feature_harris_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_feature_harris_u8 src, src_dim, width, height, thresh, nms, pos, max, work
+#define RAPP_LOG_ARGSFORMAT_rapp_feature_harris_u8 "%p, %d, %d, %d, %d, %d, %p, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_feature_harris_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_resize_worksize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_resize_worksize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_resize_worksize_u8 dst_width, dst_height, src_width, src_height, mode
+#define RAPP_LOG_ARGSFORMAT_rapp_resize_worksize_u8 "%d, %d, %d, %d, %d"
+#define RAPP_LOG_RETFORMAT_rapp_resize_worksize_u8 "%d"
+
+#define RAPP_LOG_IDENTITY_IF_RETURN_rapp_resize_u8(x) x
+#define RAPP_LOG_IDENTITY_IF_ARGS_rapp_resize_u8(x) x
+#define RAPP_LOG_ARGLIST_rapp_resize_u8 dst, dst_dim, dst_width, dst_height, src, src_dim, src_width, src_height, mode, work
+#define RAPP_LOG_ARGSFORMAT_rapp_resize_u8 "%p, %d, %d, %d, %p, %d, %d, %d, %d, %p"
+#define RAPP_LOG_RETFORMAT_rapp_resize_u8 "%d"
+
 #define RAPP_LOG_MAX_RETURN_FORMAT_LENGTH 3
-#define RAPP_LOG_MAX_ARGS_FORMAT_LENGTH 38
+#define RAPP_LOG_MAX_ARGS_FORMAT_LENGTH 50
@@ -0,0 +1,486 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_match.c
+ *  @brief  RAPP template matching.
+ */
+
+#include <string.h>         /* memset()           */
+#include "rappcompute.h"    /* RAPP Compute API   */
+#include "rapp_api.h"       /* API symbol macro   */
+#include "rapp_util.h"      /* Validation         */
+#include "rapp_error.h"     /* Error codes        */
+#include "rapp_error_int.h" /* Error handling     */
+#include "rapp_match.h"     /* Matching API       */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The maximum number of coarse levels.
+ */
+#define RAPP_MATCH_MAX_LEVELS 3
+
+/**
+ *  The minimum template size at the coarsest level.
+ */
+#define RAPP_MATCH_MIN_SIZE 4
+
+/**
+ *  The maximum template size. It keeps all sums within 32 bits.
+ */
+#define RAPP_MATCH_MAX_SIZE 128
+
+/**
+ *  The search radius at the finer levels.
+ */
+#define RAPP_MATCH_REFINE 2
+
+/**
+ *  The NCC value of a perfect match.
+ */
+#define RAPP_MATCH_ONE 65536
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static bool
+rapp_match_valid(int tpl_width, int tpl_height, int mode, int levels);
+
+static int
+rapp_match_worksize(int width, int height, int tpl_width, int tpl_height,
+                    int mode, int levels);
+
+static void
+rapp_match_level(const uint8_t *src, int src_dim,
+                 const uint8_t *tpl, int tpl_dim,
+                 int tpl_width, int tpl_height, int mode,
+                 const int bounds[4], int pos[2], int32_t *score);
+
+static void
+rapp_match_level_ncc(const uint8_t *src, int src_dim,
+                     const uint8_t *tpl, int tpl_dim,
+                     int tpl_width, int tpl_height,
+                     const int bounds[4], int pos[2], int32_t *score,
+                     uint8_t *buf);
+
+static void
+rapp_match_integral(uint32_t *sum, uint32_t *sqr, int dim, uint16_t *row,
+                    const uint8_t *src, int src_dim,
+                    int width, int height);
+
+static uint32_t
+rapp_match_box(const uint32_t *img, int dim, int x, int y,
+               int width, int height);
+
+static uint32_t
+rapp_match_isqrt(uint64_t val);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  the template matching.
+ */
+RAPP_API(int, rapp_match_template_worksize_u8,
+         (int width, int height, int tpl_width, int tpl_height,
+          int mode, int levels))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (!rapp_match_valid(tpl_width, tpl_height, mode, levels)) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    if (width < tpl_width || height < tpl_height) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    return rapp_match_worksize(width, height, tpl_width, tpl_height,
+                               mode, levels);
+}
+
+/**
+ *  Template matching.
+ */
+RAPP_API(int, rapp_match_template_u8,
+         (const uint8_t *restrict src, int src_dim,
+          int width, int height,
+          const uint8_t *restrict tpl, int tpl_dim,
+          int tpl_width, int tpl_height,
+          int mode, int levels, int pos[2],
+          int32_t *score, void *restrict work))
+{
+    const uint8_t *simg[RAPP_MATCH_MAX_LEVELS + 1];
+    const uint8_t *timg[RAPP_MATCH_MAX_LEVELS + 1];
+    int            sdim[RAPP_MATCH_MAX_LEVELS + 1];
+    int            tdim[RAPP_MATCH_MAX_LEVELS + 1];
+    uint8_t       *buf = work;
+    int            bounds[4];
+    int            size;
+    int            lev;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    size = rapp_match_worksize(MAX(width, 1), MAX(height, 1),
+                               MAX(tpl_width, 1), MAX(tpl_height, 1), mode,
+                               MIN(MAX(levels, 0), RAPP_MATCH_MAX_LEVELS));
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(src, src_dim, work, 0, height,
+                                     rc_align(width), size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(tpl, tpl_dim, work, 0, tpl_height,
+                                     rc_align(tpl_width), size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+    if (!RAPP_VALIDATE_U8(src, src_dim, width, height) ||
+        !RAPP_VALIDATE_U8(tpl, tpl_dim, tpl_width, tpl_height))
+    {
+        return rapp_error_u8_u8(src, src_dim, width, height,
+                                tpl, tpl_dim, tpl_width, tpl_height);
+    }
+    if (!rapp_match_valid(tpl_width, tpl_height, mode, levels)) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    if (width < tpl_width || height < tpl_height) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+    if (!pos || !score || !work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Build the image pyramids at the start of the working buffer */
+    simg[0] = src;
+    timg[0] = tpl;
+    sdim[0] = src_dim;
+    tdim[0] = tpl_dim;
+    for (lev = 1; lev <= levels; lev++) {
+        int      sd   = rc_align(width >> lev);
+        int      td   = rc_align(tpl_width >> lev);
+        uint8_t *sbuf = buf;
+        uint8_t *tbuf = &buf[sd*(height >> lev)];
+
+        rc_reduce_2x2_u8(sbuf, sd, simg[lev - 1], sdim[lev - 1],
+                         width >> (lev - 1), height >> (lev - 1));
+        rc_reduce_2x2_u8(tbuf, td, timg[lev - 1], tdim[lev - 1],
+                         tpl_width >> (lev - 1), tpl_height >> (lev - 1));
+
+        simg[lev] = sbuf;
+        timg[lev] = tbuf;
+        sdim[lev] = sd;
+        tdim[lev] = td;
+        buf       = &tbuf[td*(tpl_height >> lev)];
+    }
+
+    /* Search all positions at the coarsest level */
+    bounds[0] = 0;
+    bounds[1] = (width  >> levels) - (tpl_width  >> levels);
+    bounds[2] = 0;
+    bounds[3] = (height >> levels) - (tpl_height >> levels);
+
+    for (lev = levels; lev >= 0; lev--) {
+        if (lev < levels) {
+            /* Search around the doubled position of the coarser level */
+            bounds[0] = MAX(2*pos[0] - RAPP_MATCH_REFINE, 0);
+            bounds[1] = MIN(2*pos[0] + RAPP_MATCH_REFINE,
+                            (width  >> lev) - (tpl_width  >> lev));
+            bounds[2] = MAX(2*pos[1] - RAPP_MATCH_REFINE, 0);
+            bounds[3] = MIN(2*pos[1] + RAPP_MATCH_REFINE,
+                            (height >> lev) - (tpl_height >> lev));
+        }
+
+        if (mode == RAPP_MATCH_NCC) {
+            rapp_match_level_ncc(simg[lev], sdim[lev],
+                                 timg[lev], tdim[lev],
+                                 tpl_width >> lev, tpl_height >> lev,
+                                 bounds, pos, score, buf);
+        }
+        else {
+            rapp_match_level(simg[lev], sdim[lev],
+                             timg[lev], tdim[lev],
+                             tpl_width >> lev, tpl_height >> lev,
+                             mode, bounds, pos, score);
+        }
+    }
+
+    return RAPP_OK;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Check the template size, the mode and the number of levels.
+ */
+static bool
+rapp_match_valid(int tpl_width, int tpl_height, int mode, int levels)
+{
+    return tpl_width  >= 1 && tpl_width  <= RAPP_MATCH_MAX_SIZE &&
+           tpl_height >= 1 && tpl_height <= RAPP_MATCH_MAX_SIZE &&
+           mode >= RAPP_MATCH_SAD && mode <= RAPP_MATCH_NCC &&
+           levels >= 0 && levels <= RAPP_MATCH_MAX_LEVELS &&
+           (levels == 0 ||
+            MIN(tpl_width, tpl_height) >> levels >= RAPP_MATCH_MIN_SIZE);
+}
+
+/**
+ *  Compute the size of the working buffer. It holds the reduced
+ *  source and template images of each coarse level. The NCC mode
+ *  also needs the integral images of the sums and squared sums of
+ *  the largest searched region, with a cleared extra first row and
+ *  column, followed by a row of 16-bit squares.
+ */
+static int
+rapp_match_worksize(int width, int height, int tpl_width, int tpl_height,
+                    int mode, int levels)
+{
+    int size = 0;
+    int lev;
+
+    for (lev = 1; lev <= levels; lev++) {
+        size += rc_align(width     >> lev)*(height     >> lev) +
+                rc_align(tpl_width >> lev)*(tpl_height >> lev);
+    }
+
+    if (mode == RAPP_MATCH_NCC) {
+        size += 2*rc_align(4*(width + 1))*(height + 1) +
+                rc_align(2*width);
+    }
+
+    return size;
+}
+
+/**
+ *  Search the positions inside the bounds with the SAD or SSD.
+ *  The computation terminates early if the partial sum exceeds
+ *  the best sum so far.
+ */
+static void
+rapp_match_level(const uint8_t *src, int src_dim,
+                 const uint8_t *tpl, int tpl_dim,
+                 int tpl_width, int tpl_height, int mode,
+                 const int bounds[4], int pos[2], int32_t *score)
+{
+    uint32_t best = UINT32_MAX;
+    int      x, y;
+
+    for (y = bounds[2]; y <= bounds[3]; y++) {
+        for (x = bounds[0]; x <= bounds[1]; x++) {
+            const uint8_t *win = &src[y*src_dim + x];
+            uint32_t       val;
+
+            if (mode == RAPP_MATCH_SAD) {
+                val = rc_motion_sad_u8(tpl, tpl_dim, win, src_dim,
+                                       tpl_width, tpl_height, best);
+            }
+            else {
+                val = rc_match_ssd_u8(tpl, tpl_dim, win, src_dim,
+                                      tpl_width, tpl_height, best);
+            }
+
+            if (val < best) {
+                best   = val;
+                pos[0] = x;
+                pos[1] = y;
+            }
+        }
+    }
+
+    *score = best;
+}
+
+/**
+ *  Search the positions inside the bounds with the NCC. The window
+ *  sums and squared sums are taken from integral images of the
+ *  searched region.
+ */
+static void
+rapp_match_level_ncc(const uint8_t *src, int src_dim,
+                     const uint8_t *tpl, int tpl_dim,
+                     int tpl_width, int tpl_height,
+                     const int bounds[4], int pos[2], int32_t *score,
+                     uint8_t *buf)
+{
+    const uint8_t *org  = &src[bounds[2]*src_dim + bounds[0]];
+    int            nx   = bounds[1] - bounds[0] + 1;
+    int            ny   = bounds[3] - bounds[2] + 1;
+    int            dim  = rc_align(4*(nx + tpl_width)) / 4;
+    uint32_t      *sum  = (uint32_t*)buf;
+    uint32_t      *sqr  = &sum[dim*(ny + tpl_height)];
+    uint16_t      *row  = (uint16_t*)&sqr[dim*(ny + tpl_height)];
+    int64_t        num  = tpl_width*tpl_height;
+    int64_t        tsum = 0;
+    int64_t        tsqr = 0;
+    int32_t        best = INT32_MIN;
+    uint32_t       tdev;
+    int            x, y;
+
+    /* Compute the template standard deviation, scaled by num */
+    for (y = 0; y < tpl_height; y++) {
+        for (x = 0; x < tpl_width; x++) {
+            int val = tpl[y*tpl_dim + x];
+            tsum += val;
+            tsqr += val*val;
+        }
+    }
+    tdev = rapp_match_isqrt(num*tsqr - tsum*tsum);
+
+    /* Compute the integral images of the searched region */
+    rapp_match_integral(sum, sqr, dim, row, org, src_dim,
+                        nx + tpl_width - 1, ny + tpl_height - 1);
+
+    for (y = 0; y < ny; y++) {
+        for (x = 0; x < nx; x++) {
+            const uint8_t *win = &org[y*src_dim + x];
+            uint32_t       s1  = rapp_match_box(sum, dim, x, y,
+                                                tpl_width, tpl_height);
+            uint32_t       s2  = rapp_match_box(sqr, dim, x, y,
+                                                tpl_width, tpl_height);
+            uint32_t       mac = rc_match_mac_u8(tpl, tpl_dim, win, src_dim,
+                                                 tpl_width, tpl_height);
+            int64_t        cov = num*mac - s1*tsum;
+            int64_t        den = (int64_t)tdev*
+                                 rapp_match_isqrt(num*s2 - (int64_t)s1*s1);
+            int32_t        ncc = 0;
+
+            if (den > 0) {
+                ncc = MIN(MAX(cov*RAPP_MATCH_ONE / den, -RAPP_MATCH_ONE),
+                          RAPP_MATCH_ONE);
+            }
+            if (ncc > best) {
+                best   = ncc;
+                pos[0] = bounds[0] + x;
+                pos[1] = bounds[2] + y;
+            }
+        }
+    }
+
+    *score = best;
+}
+
+/**
+ *  Compute the integral images of the pixel values and the squared
+ *  pixel values of a region. The integral images have an extra first
+ *  row and column that are cleared, and the squares are computed one
+ *  row at a time into the 16-bit row buffer.
+ */
+static void
+rapp_match_integral(uint32_t *sum, uint32_t *sqr, int dim, uint16_t *row,
+                    const uint8_t *src, int src_dim,
+                    int width, int height)
+{
+    int x, y;
+
+    memset(sum, 0, 4*dim);
+    memset(sqr, 0, 4*dim);
+    for (y = 1; y <= height; y++) {
+        sum[y*dim] = 0;
+        sqr[y*dim] = 0;
+    }
+
+    rc_integral_sum_u8_u32(&sum[dim + 1], 4*dim, src, src_dim,
+                           width, height);
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *line = &src[y*src_dim];
+        for (x = 0; x < width; x++) {
+            row[x] = line[x]*line[x];
+        }
+        rc_integral_sum_u16_u32(&sqr[(y + 1)*dim + 1], 4*dim, row, 0,
+                                width, 1);
+    }
+}
+
+/**
+ *  Compute the sum of a box from an integral image with a cleared
+ *  extra first row and column. The differences are exact modulo
+ *  2^32, so overflows of the integral image itself are harmless.
+ */
+static uint32_t
+rapp_match_box(const uint32_t *img, int dim, int x, int y,
+               int width, int height)
+{
+    const uint32_t *top = &img[y*dim + x];
+    const uint32_t *bot = &top[height*dim];
+
+    return bot[width] - bot[0] - top[width] + top[0];
+}
+
+/**
+ *  Compute the integer square root, rounded down.
+ */
+static uint32_t
+rapp_match_isqrt(uint64_t val)
+{
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > val) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (val >= res + bit) {
+            val -= res + bit;
+            res  = (res >> 1) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return res;
+}
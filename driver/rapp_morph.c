@@ -0,0 +1,365 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_morph.c
+ *  @brief  RAPP 8-bit morphology.
+ *
+ *  ALGORITHM
+ *  ---------
+ *  Rectangle operations are decomposed into a vertical and a horizontal
+ *  line, computed by the van Herk/Gil-Werman primitives in the RAPP
+ *  Compute layer. The vertical pass runs first on aligned source rows,
+ *  widened on both sides with the aligned horizontal padding, and writes
+ *  to a temporary image in the working buffer. The horizontal pass then
+ *  reads the temporary image at the unaligned window offset.
+ *
+ *  The opening and closing first compute the erosion or dilation over
+ *  the source image extended by the padding needed by the second
+ *  operation, and store it in the working buffer. The second operation
+ *  then uses this temporary image as its padded source.
+ */
+
+#include "rappcompute.h"    /* RAPP Compute API     */
+#include "rapp_api.h"       /* API symbol macro     */
+#include "rapp_util.h"      /* Validation           */
+#include "rapp_error.h"     /* Error codes          */
+#include "rapp_error_int.h" /* Error handling       */
+#include "rapp_morph.h"     /* 8-bit morphology API */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local data types
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Morphological operations.
+ */
+typedef enum rapp_morph_op_e {
+    RAPP_MORPH_ERODE,
+    RAPP_MORPH_DILATE,
+    RAPP_MORPH_OPEN,
+    RAPP_MORPH_CLOSE,
+    RAPP_MORPH_TOPHAT
+} rapp_morph_op_t;
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static int
+rapp_morph_worksize(int width, int height, int wrect, int hrect);
+
+static int
+rapp_morph_rect(uint8_t *dst, int dst_dim,
+                const uint8_t *src, int src_dim,
+                int width, int height, int wrect, int hrect,
+                rapp_morph_op_t op, void *work);
+
+static void
+rapp_morph_rect_unchecked(uint8_t *dst, int dst_dim,
+                          const uint8_t *src, int src_dim,
+                          int width, int height, int wrect, int hrect,
+                          bool erode, uint8_t *work);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by the
+ *  8-bit morphological functions.
+ */
+RAPP_API(int, rapp_morph_worksize_u8,
+         (int width, int height, int wrect, int hrect))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (width < 1 || height < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    if (wrect < 1 || hrect < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    return rapp_morph_worksize(width, height, wrect, hrect);
+}
+
+/**
+ *  Erosion with a rectangular SE.
+ */
+RAPP_API(int, rapp_morph_erode_rect_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int wrect, int hrect,
+          void *restrict work))
+{
+    return rapp_morph_rect(dst, dst_dim, src, src_dim, width, height,
+                           wrect, hrect, RAPP_MORPH_ERODE, work);
+}
+
+/**
+ *  Dilation with a rectangular SE.
+ */
+RAPP_API(int, rapp_morph_dilate_rect_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int wrect, int hrect,
+          void *restrict work))
+{
+    return rapp_morph_rect(dst, dst_dim, src, src_dim, width, height,
+                           wrect, hrect, RAPP_MORPH_DILATE, work);
+}
+
+/**
+ *  Opening with a rectangular SE.
+ */
+RAPP_API(int, rapp_morph_open_rect_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int wrect, int hrect,
+          void *restrict work))
+{
+    return rapp_morph_rect(dst, dst_dim, src, src_dim, width, height,
+                           wrect, hrect, RAPP_MORPH_OPEN, work);
+}
+
+/**
+ *  Closing with a rectangular SE.
+ */
+RAPP_API(int, rapp_morph_close_rect_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int wrect, int hrect,
+          void *restrict work))
+{
+    return rapp_morph_rect(dst, dst_dim, src, src_dim, width, height,
+                           wrect, hrect, RAPP_MORPH_CLOSE, work);
+}
+
+/**
+ *  Top-hat transform with a rectangular SE.
+ */
+RAPP_API(int, rapp_morph_tophat_rect_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int wrect, int hrect,
+          void *restrict work))
+{
+    return rapp_morph_rect(dst, dst_dim, src, src_dim, width, height,
+                           wrect, hrect, RAPP_MORPH_TOPHAT, work);
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the size of the working buffer. It holds the extended
+ *  temporary image of the opening and closing, followed by the
+ *  temporary image and the accumulator row of the line passes.
+ */
+static int
+rapp_morph_worksize(int width, int height, int wrect, int hrect)
+{
+    int xpad = rc_align(wrect / 2);
+    int dim  = rc_align(width) + 2*xpad;
+    int rows = height + 2*(hrect / 2);
+
+    return dim*rows + (dim + 2*xpad)*(rows + 1);
+}
+
+/**
+ *  Validate the arguments and perform a rectangle operation.
+ */
+static int
+rapp_morph_rect(uint8_t *dst, int dst_dim,
+                const uint8_t *src, int src_dim,
+                int width, int height, int wrect, int hrect,
+                rapp_morph_op_t op, void *work)
+{
+    int scale = op == RAPP_MORPH_ERODE || op == RAPP_MORPH_DILATE ? 1 : 2;
+    int xpad  = scale*rc_align(MAX(wrect, 1) / 2);
+    int ypad  = scale*(MAX(hrect, 1) / 2);
+    int size;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate the arguments */
+    size = rapp_morph_worksize(width, height, MAX(wrect, 1), MAX(hrect, 1));
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align(width),
+                                       -ypad*src_dim - xpad,
+                                       ypad*src_dim + rc_align(width) +
+                                       xpad))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(src, src_dim, work, 0, height,
+                                       -ypad*src_dim - xpad,
+                                       ypad*src_dim + rc_align(width) +
+                                       xpad, 0, size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, work, 0, height,
+                                     rc_align(width), size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, width,          height) ||
+        !RAPP_VALIDATE_U8(src, src_dim, width + 2*xpad, height))
+    {
+        return rapp_error_u8_u8(dst, dst_dim, width,          height,
+                                src, src_dim, width + 2*xpad, height);
+    }
+
+    if (wrect < 1 || hrect < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    else if (!work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    if (scale == 1) {
+        /* Run a single erosion or dilation */
+        rapp_morph_rect_unchecked(dst, dst_dim, src, src_dim, width, height,
+                                  wrect, hrect, op == RAPP_MORPH_ERODE,
+                                  work);
+    }
+    else {
+        int      xoff = xpad / 2;
+        int      yoff = ypad / 2;
+        int      dim  = rc_align(width) + 2*xoff;
+        int      rows = height + 2*yoff;
+        uint8_t *ext  = work;
+        uint8_t *tmp  = &ext[dim*rows];
+        bool     open = op != RAPP_MORPH_CLOSE;
+
+        /* Compute the first operation over the extended area */
+        rapp_morph_rect_unchecked(ext, dim,
+                                  &src[-yoff*src_dim - xoff], src_dim,
+                                  dim, rows, wrect, hrect, open, tmp);
+
+        /* Compute the second operation on the extended image */
+        rapp_morph_rect_unchecked(dst, dst_dim, &ext[yoff*dim + xoff], dim,
+                                  width, height, wrect, hrect, !open, tmp);
+
+        if (op == RAPP_MORPH_TOPHAT) {
+            /* Subtract the opening from the source */
+            rc_pixop_suba_u8(dst, dst_dim, src, src_dim, width, height);
+        }
+    }
+
+    return RAPP_OK;
+}
+
+/**
+ *  Perform an erosion or dilation without argument validation.
+ *  The working buffer must hold rc_align(width) + 2*rc_align(wrect / 2)
+ *  bytes for height + 1 rows.
+ */
+static void
+rapp_morph_rect_unchecked(uint8_t *dst, int dst_dim,
+                          const uint8_t *src, int src_dim,
+                          int width, int height, int wrect, int hrect,
+                          bool erode, uint8_t *work)
+{
+    /* The window offsets of the reflected SE used for dilation */
+    int left = erode ? wrect / 2 : (wrect - 1) / 2;
+    int top  = erode ? hrect / 2 : (hrect - 1) / 2;
+
+    if (hrect == 1) {
+        /* Run the horizontal pass only */
+        if (erode) {
+            rc_morph_erode_line_horz_u8(dst, dst_dim, &src[-left], src_dim,
+                                        width, height, wrect);
+        }
+        else {
+            rc_morph_dilate_line_horz_u8(dst, dst_dim, &src[-left], src_dim,
+                                         width, height, wrect);
+        }
+    }
+    else if (wrect == 1) {
+        const uint8_t *ptr = &src[-top*src_dim];
+
+        /* Run the vertical pass only */
+        if (erode) {
+            rc_morph_erode_line_vert_u8(dst, dst_dim, ptr, src_dim,
+                                        width, height, hrect, work);
+        }
+        else {
+            rc_morph_dilate_line_vert_u8(dst, dst_dim, ptr, src_dim,
+                                         width, height, hrect, work);
+        }
+    }
+    else {
+        int            xpad = rc_align(wrect / 2);
+        int            dim  = rc_align(width) + 2*xpad;
+        const uint8_t *ptr  = &src[-top*src_dim - xpad];
+        uint8_t       *buf  = &work[height*dim];
+
+        /* Run the vertical pass and then the horizontal pass */
+        if (erode) {
+            rc_morph_erode_line_vert_u8(work, dim, ptr, src_dim,
+                                        dim, height, hrect, buf);
+            rc_morph_erode_line_horz_u8(dst, dst_dim,
+                                        &work[xpad - left], dim,
+                                        width, height, wrect);
+        }
+        else {
+            rc_morph_dilate_line_vert_u8(work, dim, ptr, src_dim,
+                                         dim, height, hrect, buf);
+            rc_morph_dilate_line_horz_u8(dst, dst_dim,
+                                         &work[xpad - left], dim,
+                                         width, height, wrect);
+        }
+    }
+}
@@ -0,0 +1,422 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_motion.c
+ *  @brief  RAPP motion estimation.
+ */
+
+#include <string.h>         /* memcpy()           */
+#include "rappcompute.h"    /* RAPP Compute API   */
+#include "rapp_api.h"       /* API symbol macro   */
+#include "rapp_util.h"      /* Validation         */
+#include "rapp_error.h"     /* Error codes        */
+#include "rapp_error_int.h" /* Error handling     */
+#include "rapp_motion.h"    /* Motion API         */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The maximum number of coarse levels.
+ */
+#define RAPP_MOTION_MAX_LEVELS 4
+
+/**
+ *  The minimum block size at the coarsest level.
+ */
+#define RAPP_MOTION_MIN_BLOCK 4
+
+/**
+ *  The maximum block size.
+ */
+#define RAPP_MOTION_MAX_BLOCK 64
+
+/**
+ *  The maximum search range.
+ */
+#define RAPP_MOTION_MAX_RANGE 127
+
+
+/*
+ * -------------------------------------------------------------
+ *  Global variables
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The large diamond search pattern.
+ */
+static const int rapp_motion_ldsp[8][2] = {
+    { 0, -2}, {-1, -1}, { 1, -1}, {-2,  0},
+    { 2,  0}, {-1,  1}, { 1,  1}, { 0,  2}
+};
+
+/**
+ *  The small diamond search pattern.
+ */
+static const int rapp_motion_sdsp[4][2] = {
+    { 0, -1}, {-1,  0}, { 1,  0}, { 0,  1}
+};
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static bool
+rapp_motion_valid(int block, int levels);
+
+static int
+rapp_motion_worksize(int width, int height, int block, int levels);
+
+static void
+rapp_motion_level(int8_t *vec, uint32_t *cost,
+                  const uint8_t *cur, int cur_dim,
+                  const uint8_t *ref, int ref_dim,
+                  int width, int height, int block, int range,
+                  bool parent, uint8_t *blk);
+
+static void
+rapp_motion_search(int8_t *vec, uint32_t *cost,
+                   const uint8_t *blk, int blk_dim,
+                   const uint8_t *ref, int ref_dim, int block,
+                   const int bounds[4], int pred[][2], int npred);
+
+static void
+rapp_motion_try(int *u, int *v, uint32_t *best,
+                const uint8_t *blk, int blk_dim,
+                const uint8_t *ref, int ref_dim, int block,
+                const int bounds[4], int tu, int tv);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  the block-matching motion estimation.
+ */
+RAPP_API(int, rapp_motion_blockmatch_worksize_u8,
+         (int width, int height, int block, int levels))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (!rapp_motion_valid(block, levels)) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    if (width < block || height < block) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    return rapp_motion_worksize(width, height, block, levels);
+}
+
+/**
+ *  Block-matching motion estimation.
+ */
+RAPP_API(int, rapp_motion_blockmatch_u8,
+         (int8_t *restrict vec, uint32_t *restrict cost,
+          const uint8_t *restrict cur, int cur_dim,
+          const uint8_t *restrict ref, int ref_dim,
+          int width, int height, int block, int range,
+          int levels, void *restrict work))
+{
+    const uint8_t *cimg[RAPP_MOTION_MAX_LEVELS + 1];
+    const uint8_t *rimg[RAPP_MOTION_MAX_LEVELS + 1];
+    int            cdim[RAPP_MOTION_MAX_LEVELS + 1];
+    int            rdim[RAPP_MOTION_MAX_LEVELS + 1];
+    uint8_t       *blk = work;
+    uint8_t       *buf;
+    int            size;
+    int            lev;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    size = rapp_motion_worksize(MAX(width, 1), MAX(height, 1),
+                                MAX(block, 1),
+                                MIN(MAX(levels, 0), RAPP_MOTION_MAX_LEVELS));
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(cur, cur_dim, work, 0, height,
+                                     rc_align(width), size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(ref, ref_dim, work, 0, height,
+                                     rc_align(width), size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+    if (!RAPP_VALIDATE_U8(cur, cur_dim, width, height) ||
+        !RAPP_VALIDATE_U8(ref, ref_dim, width, height))
+    {
+        return rapp_error_u8_u8(cur, cur_dim, width, height,
+                                ref, ref_dim, width, height);
+    }
+    if (!rapp_motion_valid(block, levels) ||
+        range < 1 || range > RAPP_MOTION_MAX_RANGE)
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    if (width < block || height < block) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+    if (!vec || !cost || !work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Build the image pyramids after the block buffer */
+    cimg[0] = cur;
+    rimg[0] = ref;
+    cdim[0] = cur_dim;
+    rdim[0] = ref_dim;
+    buf     = &blk[rc_align(block)*block];
+    for (lev = 1; lev <= levels; lev++) {
+        int      dim = rc_align(width >> lev);
+        uint8_t *cbuf = buf;
+        uint8_t *rbuf = &buf[dim*(height >> lev)];
+
+        rc_reduce_2x2_u8(cbuf, dim, cimg[lev - 1], cdim[lev - 1],
+                         width >> (lev - 1), height >> (lev - 1));
+        rc_reduce_2x2_u8(rbuf, dim, rimg[lev - 1], rdim[lev - 1],
+                         width >> (lev - 1), height >> (lev - 1));
+
+        cimg[lev] = cbuf;
+        rimg[lev] = rbuf;
+        cdim[lev] = dim;
+        rdim[lev] = dim;
+        buf       = &rbuf[dim*(height >> lev)];
+    }
+
+    /* Search from the coarsest level to the finest */
+    for (lev = levels; lev >= 0; lev--) {
+        rapp_motion_level(vec, cost, cimg[lev], cdim[lev],
+                          rimg[lev], rdim[lev],
+                          width >> lev, height >> lev,
+                          block >> lev, range >> lev,
+                          lev < levels, blk);
+    }
+
+    return RAPP_OK;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Check the block size and the number of levels.
+ */
+static bool
+rapp_motion_valid(int block, int levels)
+{
+    return block >= RAPP_MOTION_MIN_BLOCK &&
+           block <= RAPP_MOTION_MAX_BLOCK &&
+           levels >= 0 && levels <= RAPP_MOTION_MAX_LEVELS &&
+           block % (1 << levels) == 0 &&
+           (block >> levels) >= RAPP_MOTION_MIN_BLOCK;
+}
+
+/**
+ *  Compute the size of the working buffer. It holds the aligned copy
+ *  of the current block, followed by the reduced current and reference
+ *  images of each coarse level.
+ */
+static int
+rapp_motion_worksize(int width, int height, int block, int levels)
+{
+    int size = rc_align(block)*block;
+    int lev;
+
+    for (lev = 1; lev <= levels; lev++) {
+        size += 2*rc_align(width >> lev)*(height >> lev);
+    }
+
+    return size;
+}
+
+/**
+ *  Search all blocks of one pyramid level. If parent is true, the
+ *  vector field holds the vectors of the next coarser level on input.
+ */
+static void
+rapp_motion_level(int8_t *vec, uint32_t *cost,
+                  const uint8_t *cur, int cur_dim,
+                  const uint8_t *ref, int ref_dim,
+                  int width, int height, int block, int range,
+                  bool parent, uint8_t *blk)
+{
+    int nx   = width  / block;
+    int ny   = height / block;
+    int bdim = rc_align(block);
+    int by;
+
+    for (by = 0; by < ny; by++) {
+        int bx;
+        for (bx = 0; bx < nx; bx++) {
+            int i = by*nx + bx;
+            int x = bx*block;
+            int y = by*block;
+            int bounds[4];
+            int pred[4][2];
+            int npred = 0;
+            int k;
+
+            /* Keep the displaced block inside the image */
+            bounds[0] = MAX(-range, -x);
+            bounds[1] = MIN(range, width - block - x);
+            bounds[2] = MAX(-range, -y);
+            bounds[3] = MIN(range, height - block - y);
+
+            /* Set up the predicted vectors, starting with zero */
+            pred[npred][0] = 0;
+            pred[npred][1] = 0;
+            npred++;
+            if (parent) {
+                pred[npred][0] = 2*vec[2*i];
+                pred[npred][1] = 2*vec[2*i + 1];
+                npred++;
+            }
+            if (bx > 0) {
+                pred[npred][0] = vec[2*(i - 1)];
+                pred[npred][1] = vec[2*(i - 1) + 1];
+                npred++;
+            }
+            if (by > 0) {
+                pred[npred][0] = vec[2*(i - nx)];
+                pred[npred][1] = vec[2*(i - nx) + 1];
+                npred++;
+            }
+
+            /* Copy the current block to the aligned block buffer */
+            for (k = 0; k < block; k++) {
+                memcpy(&blk[k*bdim], &cur[(y + k)*cur_dim + x], block);
+            }
+
+            rapp_motion_search(&vec[2*i], &cost[i], blk, bdim,
+                               &ref[y*ref_dim + x], ref_dim, block,
+                               bounds, pred, npred);
+        }
+    }
+}
+
+/**
+ *  Diamond search of one block. The reference pointer points to
+ *  the undisplaced block position.
+ */
+static void
+rapp_motion_search(int8_t *vec, uint32_t *cost,
+                   const uint8_t *blk, int blk_dim,
+                   const uint8_t *ref, int ref_dim, int block,
+                   const int bounds[4], int pred[][2], int npred)
+{
+    uint32_t best = UINT32_MAX;
+    int      u    = 0;
+    int      v    = 0;
+    int      cu, cv, k;
+
+    /* Start at the best predicted vector */
+    for (k = 0; k < npred; k++) {
+        rapp_motion_try(&u, &v, &best, blk, blk_dim, ref, ref_dim, block,
+                        bounds,
+                        MIN(MAX(pred[k][0], bounds[0]), bounds[1]),
+                        MIN(MAX(pred[k][1], bounds[2]), bounds[3]));
+    }
+
+    /* Move the large diamond until the centre is the best point */
+    do {
+        cu = u;
+        cv = v;
+        for (k = 0; k < 8 && best > 0; k++) {
+            rapp_motion_try(&u, &v, &best, blk, blk_dim, ref, ref_dim,
+                            block, bounds,
+                            cu + rapp_motion_ldsp[k][0],
+                            cv + rapp_motion_ldsp[k][1]);
+        }
+    } while (u != cu || v != cv);
+
+    /* Refine with the small diamond */
+    for (k = 0; k < 4 && best > 0; k++) {
+        rapp_motion_try(&u, &v, &best, blk, blk_dim, ref, ref_dim, block,
+                        bounds,
+                        cu + rapp_motion_sdsp[k][0],
+                        cv + rapp_motion_sdsp[k][1]);
+    }
+
+    vec[0] = u;
+    vec[1] = v;
+    *cost  = best;
+}
+
+/**
+ *  Evaluate a candidate vector, and make it the best one if its SAD
+ *  is smaller. The SAD computation terminates early if the partial
+ *  sum exceeds the best SAD so far.
+ */
+static void
+rapp_motion_try(int *u, int *v, uint32_t *best,
+                const uint8_t *blk, int blk_dim,
+                const uint8_t *ref, int ref_dim, int block,
+                const int bounds[4], int tu, int tv)
+{
+    uint32_t sad;
+
+    if (tu < bounds[0] || tu > bounds[1] ||
+        tv < bounds[2] || tv > bounds[3])
+    {
+        return;
+    }
+
+    sad = rc_motion_sad_u8(blk, blk_dim, &ref[tv*ref_dim + tu], ref_dim,
+                           block, block, *best);
+    if (sad < *best) {
+        *best = sad;
+        *u    = tu;
+        *v    = tv;
+    }
+}
@@ -31,6 +31,7 @@
  */
 
 #include <stdlib.h>         /* abs()            */
+#include <string.h>         /* memcpy()         */
 #include "rappcompute.h"    /* RAPP Compute API */
 #include "rapp_api.h"       /* API symbol macro */
 #include "rapp_util.h"      /* Validation       */
@@ -39,6 +40,41 @@
 #include "rapp_pixop.h"     /* Pixop API        */
 
 
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The maximum number of CLAHE tiles in each direction.
+ */
+#define RAPP_PIXOP_CLAHE_TILES 64
+
+/**
+ *  The CLAHE clip limit range, in units of 1/16 of the average bin count.
+ */
+#define RAPP_PIXOP_CLAHE_CLIP_MIN 16
+#define RAPP_PIXOP_CLAHE_CLIP_MAX 4096
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static int
+rapp_pixop_clahe_worksize(int width, int tiles);
+
+static int
+rapp_pixop_clahe_center(int tile, int len, int tiles);
+
+static void
+rapp_pixop_clahe_lut(uint8_t *lut, const uint8_t *buf, int dim,
+                     int width, int height, int clip);
+
+
 /*
  * -------------------------------------------------------------
  *  Single-operand functions
@@ -676,3 +712,436 @@ RAPP_API(int, rapp_pixop_norm_u8,
 
     return RAPP_OK;
 }
+
+
+/*
+ * -------------------------------------------------------------
+ *  16-bit functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Saturated addition, 16-bit.
+ */
+RAPP_API(int, rapp_pixop_add_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT(dst, dst_dim, src, src_dim,
+                                height, 2*width))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width, height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width, height))
+    {
+        /* Return the error code */
+        return rapp_error_u16_u16(dst, dst_dim, width, height,
+                                  src, src_dim, width, height);
+    }
+
+    /* Perform operation */
+    rc_pixop_add_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+
+/**
+ *  Saturated subtraction, 16-bit.
+ */
+RAPP_API(int, rapp_pixop_sub_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT(dst, dst_dim, src, src_dim,
+                                height, 2*width))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width, height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width, height))
+    {
+        /* Return the error code */
+        return rapp_error_u16_u16(dst, dst_dim, width, height,
+                                  src, src_dim, width, height);
+    }
+
+    /* Perform operation */
+    rc_pixop_sub_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+
+/**
+ *  Absolute-value subtraction, 16-bit.
+ */
+RAPP_API(int, rapp_pixop_suba_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT(dst, dst_dim, src, src_dim,
+                                height, 2*width))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width, height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width, height))
+    {
+        /* Return the error code */
+        return rapp_error_u16_u16(dst, dst_dim, width, height,
+                                  src, src_dim, width, height);
+    }
+
+    /* Perform operation */
+    rc_pixop_suba_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
+
+
+/**
+ *  Shifted lookup-table transformation from 16 to 8 bits.
+ */
+RAPP_API(int, rapp_pixop_lut_u16_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height,
+          const uint8_t *restrict lut, int shift))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT(dst, dst_dim, src, src_dim,
+                                height, 2*width))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, width, height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width, height))
+    {
+        /* Return the error code */
+        return rapp_error_u8_u16(dst, dst_dim, width, height,
+                                 src, src_dim, width, height);
+    }
+    if (!lut) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+    if (shift < 0 || shift > 15) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    /* Perform operation */
+    rc_pixop_lut_u16_u8(dst, dst_dim, src, src_dim,
+                        width, height, lut, shift);
+
+    return RAPP_OK;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Histogram equalization
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Histogram equalization.
+ */
+RAPP_API(int, rapp_pixop_equalize_u8,
+         (uint8_t *buf, int dim, int width, int height))
+{
+    uint32_t hist[256];
+    uint8_t  lut[256];
+    uint32_t cdf = 0;
+    uint32_t min, num;
+    int      k;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_U8(buf, dim, width, height)) {
+        return rapp_error_u8(buf, dim, width, height);
+    }
+
+    /* Compute the histogram */
+    rc_stat_hist_u8(buf, dim, width, height, hist);
+
+    /* Get the count of the minimum value */
+    for (k = 0; hist[k] == 0; k++) {
+        /* Empty bin */
+    }
+    min = hist[k];
+    num = (uint32_t)width*height - min;
+    if (num == 0) {
+        /* Leave a constant image unchanged */
+        return RAPP_OK;
+    }
+
+    /* Map the cumulative histogram to the full range */
+    for (k = 0; k < 256; k++) {
+        cdf   += hist[k];
+        lut[k] = cdf < min ? 0 :
+                 ((uint64_t)(cdf - min)*0xff + num / 2) / num;
+    }
+
+    /* Perform operation */
+    rc_pixop_lut_u8(buf, dim, width, height, lut);
+
+    return RAPP_OK;
+}
+
+/**
+ *  Compute the minimum size of the working buffer needed by CLAHE.
+ */
+RAPP_API(int, rapp_pixop_clahe_worksize_u8, (int width, int tiles))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (width < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    if (tiles < 1 || tiles > RAPP_PIXOP_CLAHE_TILES) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    return rapp_pixop_clahe_worksize(width, tiles);
+}
+
+/**
+ *  Contrast-limited adaptive histogram equalization.
+ */
+RAPP_API(int, rapp_pixop_clahe_u8,
+         (uint8_t *restrict buf, int dim, int width, int height,
+          int tiles, int clip, void *restrict work))
+{
+    int      size  = rapp_pixop_clahe_worksize(width, tiles);
+    int      jprev = -1;
+    int      aprev = -1;
+    uint8_t *lut, *row, *blend;
+    int      x, y, i, j;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(buf, dim, work, 0, height,
+                                     rc_align(width), size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(buf, dim, width, height)) {
+        return rapp_error_u8(buf, dim, width, height);
+    }
+
+    if (tiles < 1 || tiles > RAPP_PIXOP_CLAHE_TILES ||
+        tiles > width || tiles > height ||
+        clip < RAPP_PIXOP_CLAHE_CLIP_MIN || clip > RAPP_PIXOP_CLAHE_CLIP_MAX)
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    else if (!work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Partition the working buffer */
+    lut   = work;
+    row   = lut + tiles*tiles*256;
+    blend = row + tiles*256;
+
+    /* Compute the lookup table of each tile */
+    for (j = 0; j < tiles; j++) {
+        int y0 = j*height / tiles;
+        int y1 = (j + 1)*height / tiles;
+
+        for (i = 0; i < tiles; i++) {
+            int x0 = i*width / tiles;
+            int x1 = (i + 1)*width / tiles;
+
+            rapp_pixop_clahe_lut(&lut[(j*tiles + i)*256],
+                                 &buf[y0*dim + x0], dim,
+                                 x1 - x0, y1 - y0, clip);
+        }
+    }
+
+    /* Compute the horizontal blend factors, zero outside the centers */
+    for (x = 0; x < width; x++) {
+        blend[x] = 0;
+    }
+    for (i = 0; i < tiles - 1; i++) {
+        int c0 = rapp_pixop_clahe_center(i,     width, tiles);
+        int c1 = rapp_pixop_clahe_center(i + 1, width, tiles);
+
+        for (x = c0; x < c1; x++) {
+            blend[x] = ((x - c0) << 8) / (c1 - c0);
+        }
+    }
+
+    /* Map each row */
+    j = 0;
+    for (y = 0; y < height; y++) {
+        uint8_t *line = &buf[y*dim];
+        int      c0   = rapp_pixop_clahe_center(0, width, tiles);
+        int      alpha;
+
+        /* Find the nearest tile row center above, if any */
+        while (j < tiles - 1 &&
+               y >= rapp_pixop_clahe_center(j + 1, height, tiles))
+        {
+            j++;
+        }
+        if (j < tiles - 1 && y >= rapp_pixop_clahe_center(j, height, tiles)) {
+            int cy0 = rapp_pixop_clahe_center(j,     height, tiles);
+            int cy1 = rapp_pixop_clahe_center(j + 1, height, tiles);
+            alpha = ((y - cy0) << 8) / (cy1 - cy0);
+        }
+        else {
+            alpha = 0;
+        }
+
+        /* Interpolate the tables of the tile rows vertically */
+        if (j != jprev || alpha != aprev) {
+            memcpy(row, &lut[j*tiles*256], tiles*256);
+            if (alpha > 0) {
+                rc_pixop_lerp_u8(row, 256, &lut[(j + 1)*tiles*256], 256,
+                                 256, tiles, alpha);
+            }
+            jprev = j;
+            aprev = alpha;
+        }
+
+        /* Map the pixels, interpolating the tables horizontally */
+        rc_pixop_lerp_lut_u8(line, dim, c0, 1, row, row, blend);
+        for (i = 0; i < tiles; i++) {
+            int c1 = i < tiles - 1
+                     ? rapp_pixop_clahe_center(i + 1, width, tiles)
+                     : width;
+            int i1 = MIN(i + 1, tiles - 1);
+
+            rc_pixop_lerp_lut_u8(&line[c0], dim, c1 - c0, 1,
+                                 &row[i*256], &row[i1*256], &blend[c0]);
+            c0 = c1;
+        }
+    }
+
+    return RAPP_OK;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the size of the CLAHE working buffer. It holds the tile
+ *  lookup tables, the vertically interpolated tables of the current
+ *  row and the horizontal blend factors.
+ */
+static int
+rapp_pixop_clahe_worksize(int width, int tiles)
+{
+    return (tiles + 1)*tiles*256 + rc_align(width);
+}
+
+/**
+ *  Compute the center position of a tile.
+ */
+static int
+rapp_pixop_clahe_center(int tile, int len, int tiles)
+{
+    return (2*tile + 1)*len / (2*tiles);
+}
+
+/**
+ *  Compute the clipped equalization lookup table of one tile.
+ */
+static void
+rapp_pixop_clahe_lut(uint8_t *lut, const uint8_t *buf, int dim,
+                     int width, int height, int clip)
+{
+    uint32_t hist[256];
+    uint32_t num    = (uint32_t)width*height;
+    uint32_t limit  = (uint64_t)clip*num / (16*256);
+    uint32_t excess = 0;
+    uint32_t cdf    = 0;
+    unsigned rem;
+    int      k;
+
+    rc_stat_hist_u8(buf, dim, width, height, hist);
+
+    /* Clip the histogram */
+    limit = MAX(limit, 1);
+    for (k = 0; k < 256; k++) {
+        if (hist[k] > limit) {
+            excess += hist[k] - limit;
+            hist[k] = limit;
+        }
+    }
+
+    /* Redistribute the clipped counts evenly over all bins */
+    rem = excess % 256;
+    for (k = 0; k < 256; k++) {
+        hist[k] += excess / 256;
+    }
+    for (k = 0; k < (int)rem; k++) {
+        hist[k*256 / rem]++;
+    }
+
+    /* Map the cumulative histogram to the full range */
+    for (k = 0; k < 256; k++) {
+        cdf   += hist[k];
+        lut[k] = ((uint64_t)cdf*0xff + num / 2) / num;
+    }
+}
@@ -151,3 +151,40 @@ RAPP_API(int, rapp_reduce_2x2_u8,
 
     return RAPP_OK;
 }
+
+/**
+ *  16-bit 2x2 reduction.
+ */
+RAPP_API(int, rapp_reduce_2x2_u16,
+         (uint16_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(dst, 0, src, src_dim, height,
+                                     (dst_dim*(height/2 - 1) +
+                                      rc_align(2*(width/2))),
+                                     rc_align(2*width)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U16(dst, dst_dim, width/2, height/2) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width,   height))
+    {
+        /* Return the error code */
+        return rapp_error_u16_u16(dst, dst_dim, width/2, height/2,
+                                  src, src_dim, width,   height);
+    }
+
+    /* Perform operation */
+    rc_reduce_2x2_u16(dst, dst_dim, src, src_dim, width, height);
+
+    return RAPP_OK;
+}
@@ -0,0 +1,399 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_resize.c
+ *  @brief  RAPP 8-bit arbitrary-ratio resizing.
+ *
+ *  ALGORITHM
+ *  ---------
+ *  The resampling is separable. For each destination column and row,
+ *  the first source pixel and the weights of the following source
+ *  pixels are stored in a table. The number of weights, or taps, is
+ *  the same for all pixels in one direction. Near the right and
+ *  bottom borders, the first source pixel is moved back and the
+ *  weights are shifted with it, so that no pixels outside the image
+ *  are read.
+ *
+ *  The bilinear weights are computed from the mapped pixel center.
+ *  The area weights are computed from the cumulative covered area of
+ *  the source pixels, rounded to Q.7 at each step, so that the weights
+ *  of each destination pixel always sum to exactly one.
+ *
+ *  If the height is not increased, each destination row is first
+ *  resampled vertically from the source rows into a line buffer of
+ *  the source width, and then horizontally into the destination row.
+ *  Otherwise the source rows are first resampled horizontally into a
+ *  line cache, where each row is used for several destination rows.
+ *  Each row is stored twice in the cache, at slot k and slot k + taps,
+ *  so that the rows of any vertical window are consecutive in memory.
+ */
+
+#include <string.h>         /* memcpy(), memset() */
+#include "rappcompute.h"    /* RAPP Compute API   */
+#include "rapp_api.h"       /* API symbol macro   */
+#include "rapp_util.h"      /* Validation         */
+#include "rapp_error.h"     /* Error codes        */
+#include "rapp_error_int.h" /* Error handling     */
+#include "rapp_resize.h"    /* Resize API         */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The maximum downscaling factor of the area mode.
+ */
+#define RAPP_RESIZE_AREA_MAX 16
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static int
+rapp_resize_validate(int dst_width, int dst_height,
+                     int src_width, int src_height, int mode);
+
+static int
+rapp_resize_worksize(int dst_width, int dst_height,
+                     int src_width, int src_height, int mode);
+
+static int
+rapp_resize_taps(int dst_len, int src_len, int mode);
+
+static void
+rapp_resize_table(int *idx, uint8_t *coef, int dst_len, int src_len,
+                  int taps, int mode);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_resize_u8().
+ */
+RAPP_API(int, rapp_resize_worksize_u8,
+         (int dst_width, int dst_height,
+          int src_width, int src_height, int mode))
+{
+    int err;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (dst_width < 1 || dst_height < 1 ||
+        src_width < 1 || src_height < 1)
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    err = rapp_resize_validate(dst_width, dst_height,
+                               src_width, src_height, mode);
+    if (err < 0) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return err;
+    }
+
+    return rapp_resize_worksize(dst_width, dst_height,
+                                src_width, src_height, mode);
+}
+
+/**
+ *  8-bit resizing.
+ */
+RAPP_API(int, rapp_resize_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          int dst_width, int dst_height,
+          const uint8_t *restrict src, int src_dim,
+          int src_width, int src_height,
+          int mode, void *restrict work))
+{
+    int      dw    = dst_width;
+    int      dh    = dst_height;
+    int      sw    = src_width;
+    int      sh    = src_height;
+    int      dsize = dst_dim*(dh - 1) + rc_align(dw);
+    int      ssize = src_dim*(sh - 1) + rc_align(sw);
+    int      size;
+    int      xtaps, ytaps;
+    int     *xidx, *yidx;
+    uint8_t *xcoef, *ycoef, *buf;
+    int      err, y;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    size = rapp_resize_worksize(MAX(dw, 1), MAX(dh, 1),
+                                MAX(sw, 1), MAX(sh, 1), mode);
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(dst, 0, src, 0, 1, dsize, ssize) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(dst, 0, work, 0, 1, dsize, size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(src, 0, work, 0, 1, ssize, size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_U8(dst, dst_dim, dw, dh) ||
+        !RAPP_VALIDATE_U8(src, src_dim, sw, sh))
+    {
+        /* Return the error code */
+        return rapp_error_u8_u8(dst, dst_dim, dw, dh,
+                                src, src_dim, sw, sh);
+    }
+
+    err = rapp_resize_validate(dw, dh, sw, sh, mode);
+    if (err < 0) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return err;
+    }
+    else if (!work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Set up the tables */
+    xtaps = rapp_resize_taps(dw, sw, mode);
+    ytaps = rapp_resize_taps(dh, sh, mode);
+    xidx  = work;
+    yidx  = (int*)((uint8_t*)xidx + rc_align(dw*sizeof *xidx));
+    xcoef = (uint8_t*)yidx + rc_align(dh*sizeof *yidx);
+    ycoef = &xcoef[rc_align(dw*xtaps)];
+    buf   = &ycoef[rc_align(dh*ytaps)];
+    rapp_resize_table(xidx, xcoef, dw, sw, xtaps, mode);
+    rapp_resize_table(yidx, ycoef, dh, sh, ytaps, mode);
+
+    if (mode == RAPP_RESIZE_NEAREST) {
+        /* Copy the previous row if the source row is the same */
+        for (y = 0; y < dh; y++) {
+            uint8_t *row = &dst[y*dst_dim];
+
+            if (y > 0 && yidx[y] == yidx[y - 1]) {
+                memcpy(row, &row[-dst_dim], dw);
+            }
+            else {
+                rc_resize_horz_u8(row, dst_dim, &src[yidx[y]*src_dim],
+                                  src_dim, dw, 1, xidx, xcoef, 1);
+            }
+        }
+    }
+    else if (dh <= sh) {
+        /* Resample vertically to the line buffer, then horizontally */
+        for (y = 0; y < dh; y++) {
+            rc_resize_vert_u8(buf, 0, src, src_dim, sw, 1,
+                              &yidx[y], &ycoef[y*ytaps], ytaps);
+            rc_resize_horz_u8(&dst[y*dst_dim], dst_dim, buf, 0,
+                              dw, 1, xidx, xcoef, xtaps);
+        }
+    }
+    else {
+        int ldim = rc_align(dw);
+        int next = 0; /* The next source row to resample */
+
+        /* Resample horizontally to the line cache, then vertically */
+        for (y = 0; y < dh; y++) {
+            int slot = yidx[y] % ytaps;
+            int r;
+
+            for (r = MAX(next, yidx[y]); r < yidx[y] + ytaps; r++) {
+                uint8_t *row = &buf[(r % ytaps)*ldim];
+
+                rc_resize_horz_u8(row, ldim, &src[r*src_dim], src_dim,
+                                  dw, 1, xidx, xcoef, xtaps);
+                memcpy(&row[ytaps*ldim], row, ldim);
+            }
+            next = MAX(next, yidx[y] + ytaps);
+
+            rc_resize_vert_u8(&dst[y*dst_dim], dst_dim, buf, ldim,
+                              dw, 1, &slot, &ycoef[y*ytaps], ytaps);
+        }
+    }
+
+    return RAPP_OK;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Validate the resize mode and the downscaling factor.
+ */
+static int
+rapp_resize_validate(int dst_width, int dst_height,
+                     int src_width, int src_height, int mode)
+{
+    if (mode < RAPP_RESIZE_NEAREST || mode > RAPP_RESIZE_AREA) {
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    if (mode == RAPP_RESIZE_AREA &&
+        (src_width  > RAPP_RESIZE_AREA_MAX*dst_width ||
+         src_height > RAPP_RESIZE_AREA_MAX*dst_height))
+    {
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    return RAPP_OK;
+}
+
+/**
+ *  Compute the size of the working buffer, with the tables
+ *  and the line buffer or the line cache.
+ */
+static int
+rapp_resize_worksize(int dst_width, int dst_height,
+                     int src_width, int src_height, int mode)
+{
+    int xtaps = rapp_resize_taps(dst_width,  src_width,  mode);
+    int ytaps = rapp_resize_taps(dst_height, src_height, mode);
+    int size  = rc_align(dst_width*sizeof(int))  +
+                rc_align(dst_height*sizeof(int)) +
+                rc_align(dst_width*xtaps)        +
+                rc_align(dst_height*ytaps);
+
+    if (mode == RAPP_RESIZE_NEAREST) {
+        return size;
+    }
+    else if (dst_height <= src_height) {
+        return size + rc_align(src_width);
+    }
+
+    return size + 2*ytaps*rc_align(dst_width);
+}
+
+/**
+ *  Compute the number of taps in one direction. For the area mode it
+ *  is the largest number of source pixels covered by one destination
+ *  pixel. Destination pixel x covers [x*src_len, (x + 1)*src_len), and
+ *  source pixel i covers [i*dst_len, (i + 1)*dst_len).
+ */
+static int
+rapp_resize_taps(int dst_len, int src_len, int mode)
+{
+    int taps = 1;
+    int x;
+
+    if (mode == RAPP_RESIZE_BILINEAR) {
+        taps = MIN(src_len, 2);
+    }
+    else if (mode == RAPP_RESIZE_AREA) {
+        for (x = 0; x < dst_len; x++) {
+            int64_t beg = (int64_t)x*src_len;
+            int64_t end = beg + src_len;
+            int     num = (int)((end - 1) / dst_len - beg / dst_len) + 1;
+            taps = MAX(taps, num);
+        }
+    }
+
+    return taps;
+}
+
+/**
+ *  Compute the index and coefficient table in one direction.
+ */
+static void
+rapp_resize_table(int *idx, uint8_t *coef, int dst_len, int src_len,
+                  int taps, int mode)
+{
+    int x;
+
+    for (x = 0; x < dst_len; x++) {
+        uint8_t *cf = &coef[taps*x];
+        int      wgt[RC_RESIZE_TAPS_MAX];
+        int      pos, shift, k;
+
+        memset(wgt, 0, sizeof wgt);
+
+        if (mode == RAPP_RESIZE_NEAREST) {
+            /* The pixel containing the mapped center */
+            pos    = (int)(((int64_t)2*x + 1)*src_len / (2*dst_len));
+            wgt[0] = 128;
+        }
+        else if (mode == RAPP_RESIZE_BILINEAR) {
+            /* The mapped center is (2*x + 1)*src_len/(2*dst_len) - 1/2 */
+            int64_t num = ((int64_t)2*x + 1)*src_len - dst_len;
+            int64_t den = 2*(int64_t)dst_len;
+
+            pos = 0;
+            if (num > 0) {
+                pos    = (int)(num / den);
+                wgt[1] = (int)(((num - pos*den)*128 + dst_len) / den);
+            }
+            if (pos >= src_len - 1) {
+                /* Replicate the last pixel */
+                pos    = src_len - 1;
+                wgt[1] = 0;
+            }
+            wgt[0] = 128 - wgt[1];
+        }
+        else {
+            /* The cumulative covered area, rounded to Q.7 */
+            int64_t beg = (int64_t)x*src_len;
+            int64_t end = beg + src_len;
+            int64_t acc = 0;
+            int     sum = 0;
+
+            pos = (int)(beg / dst_len);
+            for (k = 0; (int64_t)(pos + k)*dst_len < end; k++) {
+                int64_t lo = MAX(beg, (int64_t)(pos + k)*dst_len);
+                int64_t hi = MIN(end, (int64_t)(pos + k + 1)*dst_len);
+                int     cum;
+
+                acc   += hi - lo;
+                cum    = (int)((acc*128 + src_len / 2) / src_len);
+                wgt[k] = cum - sum;
+                sum    = cum;
+            }
+        }
+
+        /* Move back the window at the border */
+        shift  = MAX(pos + taps - src_len, 0);
+        idx[x] = pos - shift;
+        for (k = 0; k < taps; k++) {
+            cf[k] = k < shift ? 0 : wgt[k - shift];
+        }
+    }
+}
@@ -38,6 +38,28 @@
 #include "rapp_stat.h"      /* Statistics API    */
 
 
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static int
+rapp_stat_hist_validate(const uint8_t *buf, int dim,
+                        const uint8_t *map, int map_dim,
+                        int width, int height, const uint32_t *hist);
+
+static void
+rapp_stat_hist(const uint8_t *buf, int dim,
+               const uint8_t *map, int map_dim,
+               int width, int height, uint32_t *hist);
+
+static int
+rapp_stat_mask_validate(const uint8_t *buf, int dim,
+                        const uint8_t *map, int map_dim,
+                        int width, int height);
+
+
 /*
  * -------------------------------------------------------------
  *  Exported functions
@@ -209,3 +231,552 @@ RAPP_API(int, rapp_stat_max_u8,
     /* Perform operation */
     return rc_stat_max_u8(buf, dim, width, height);
 }
+
+/**
+ *  16-bit pixel sum.
+ */
+RAPP_API(int, rapp_stat_sum_u16,
+         (const uint16_t *buf, int dim,
+          int width, int height, uintmax_t *sum))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_U16(buf, dim, width, height)) {
+        return rapp_error_u16(buf, dim, width, height);
+    }
+    if (!sum) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Perform operation */
+    *sum = rc_stat_sum_u16(buf, dim, width, height);
+
+    return RAPP_OK;
+}
+
+/**
+ *  16-bit pixel min.
+ */
+RAPP_API(int, rapp_stat_min_u16,
+         (const uint16_t *buf, int dim, int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_U16(buf, dim, width, height)) {
+        return rapp_error_u16(buf, dim, width, height);
+    }
+
+    /* Perform operation */
+    return rc_stat_min_u16(buf, dim, width, height);
+}
+
+/**
+ *  16-bit pixel max.
+ */
+RAPP_API(int, rapp_stat_max_u16,
+         (const uint16_t *buf, int dim, int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_U16(buf, dim, width, height)) {
+        return rapp_error_u16(buf, dim, width, height);
+    }
+
+    /* Perform operation */
+    return rc_stat_max_u16(buf, dim, width, height);
+}
+
+/**
+ *  8-bit pixel histogram.
+ */
+RAPP_API(int, rapp_stat_hist_u8,
+         (const uint8_t *buf, int dim,
+          const uint8_t *map, int map_dim,
+          int width, int height, uint32_t *hist))
+{
+    int err;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    err = rapp_stat_hist_validate(buf, dim, map, map_dim,
+                                  width, height, hist);
+    if (err < 0) {
+        return err;
+    }
+
+    /* Perform operation */
+    rapp_stat_hist(buf, dim, map, map_dim, width, height, hist);
+
+    return RAPP_OK;
+}
+
+/**
+ *  8-bit pixel histogram with fewer bins.
+ */
+RAPP_API(int, rapp_stat_hist_bins_u8,
+         (const uint8_t *buf, int dim,
+          const uint8_t *map, int map_dim,
+          int width, int height, uint32_t *hist, int bins))
+{
+    uint32_t full[256];
+    int      err, k;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    err = rapp_stat_hist_validate(buf, dim, map, map_dim,
+                                  width, height, hist);
+    if (err < 0) {
+        return err;
+    }
+    if (bins < 1 || bins > 256 || (bins & (bins - 1)) != 0) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    /* Compute the full histogram */
+    rapp_stat_hist(buf, dim, map, map_dim, width, height, full);
+
+    /* Fold it into the requested number of bins */
+    for (k = 0; k < bins; k++) {
+        hist[k] = 0;
+    }
+    for (k = 0; k < 256; k++) {
+        hist[(k*bins) >> 8] += full[k];
+    }
+
+    return RAPP_OK;
+}
+
+/**
+ *  8-bit pixel sum with a binary mask.
+ */
+RAPP_API(int32_t, rapp_stat_sum_mask_u8,
+         (const uint8_t *buf, int dim,
+          const uint8_t *map, int map_dim,
+          int width, int height))
+{
+    int err;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    err = rapp_stat_mask_validate(buf, dim, map, map_dim, width, height);
+    if (err < 0) {
+        return err;
+    }
+
+    /* Perform operation */
+    return (int32_t)rc_stat_sum_mask_u8(buf, dim, map, map_dim,
+                                        width, height);
+}
+
+/**
+ *  8-bit pixel sum, squared sum and count with a binary mask.
+ */
+RAPP_API(int, rapp_stat_sum2_mask_u8,
+         (const uint8_t *buf, int dim,
+          const uint8_t *map, int map_dim,
+          int width, int height, uintmax_t sum[3]))
+{
+    int err;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    err = rapp_stat_mask_validate(buf, dim, map, map_dim, width, height);
+    if (err < 0) {
+        return err;
+    }
+    if (!sum) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Perform operation */
+    rc_stat_sum2_mask_u8(buf, dim, map, map_dim, width, height, sum);
+    sum[2] = rc_stat_sum_bin(map, map_dim, width, height);
+
+    return RAPP_OK;
+}
+
+/**
+ *  8-bit pixel min with a binary mask.
+ */
+RAPP_API(int, rapp_stat_min_mask_u8,
+         (const uint8_t *buf, int dim,
+          const uint8_t *map, int map_dim,
+          int width, int height))
+{
+    int err;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    err = rapp_stat_mask_validate(buf, dim, map, map_dim, width, height);
+    if (err < 0) {
+        return err;
+    }
+
+    /* Perform operation */
+    return rc_stat_min_mask_u8(buf, dim, map, map_dim, width, height);
+}
+
+/**
+ *  8-bit pixel max with a binary mask.
+ */
+RAPP_API(int, rapp_stat_max_mask_u8,
+         (const uint8_t *buf, int dim,
+          const uint8_t *map, int map_dim,
+          int width, int height))
+{
+    int err;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    err = rapp_stat_mask_validate(buf, dim, map, map_dim, width, height);
+    if (err < 0) {
+        return err;
+    }
+
+    /* Perform operation */
+    return rc_stat_max_mask_u8(buf, dim, map, map_dim, width, height);
+}
+
+/**
+ *  Binary pixel min and max with location.
+ */
+RAPP_API(int, rapp_stat_minmax_loc_bin,
+         (const uint8_t *buf, int dim, int width, int height,
+          int minmax[2], unsigned pos[4]))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_BIN(buf, dim, width, height)) {
+        return rapp_error_bin(buf, dim, width, height);
+    }
+    if (!minmax || !pos) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Perform operation */
+    rc_stat_minmax_loc_bin(buf, dim, width, height, minmax, pos);
+
+    return RAPP_OK;
+}
+
+/**
+ *  8-bit pixel min and max with location.
+ */
+RAPP_API(int, rapp_stat_minmax_loc_u8,
+         (const uint8_t *buf, int dim, int width, int height,
+          int minmax[2], unsigned pos[4]))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_U8(buf, dim, width, height)) {
+        return rapp_error_u8(buf, dim, width, height);
+    }
+    if (!minmax || !pos) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Perform operation */
+    rc_stat_minmax_loc_u8(buf, dim, width, height, minmax, pos);
+
+    return RAPP_OK;
+}
+
+/**
+ *  8-bit top-K pixel locations.
+ */
+RAPP_API(int, rapp_stat_max_k_u8,
+         (const uint8_t *buf, int dim, int width, int height,
+          unsigned *pos, int k))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_U8(buf, dim, width, height)) {
+        return rapp_error_u8(buf, dim, width, height);
+    }
+    if (!pos) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+    if (k < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    /* Perform operation */
+    return rc_stat_max_k_u8(buf, dim, width, height, pos, k);
+}
+
+/**
+ *  8-bit pixel sum, min and max per tile.
+ */
+RAPP_API(int, rapp_stat_tiles_u8,
+         (const uint8_t *buf, int dim, int width, int height,
+          int tile_w, int tile_h, uint32_t *sum,
+          uint8_t *min, uint8_t *max))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_U8(buf, dim, width, height)) {
+        return rapp_error_u8(buf, dim, width, height);
+    }
+    if (!sum || !min || !max) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+    if (tile_w < 1 || tile_h < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    /* Perform operation */
+    rc_stat_tiles_u8(buf, dim, width, height,
+                     tile_w, tile_h, sum, min, max);
+
+    return RAPP_OK;
+}
+
+/**
+ *  8-bit sum of absolute differences.
+ */
+RAPP_API(int, rapp_stat_sad_u8,
+         (const uint8_t *restrict src1, int src1_dim,
+          const uint8_t *restrict src2, int src2_dim,
+          int width, int height, uintmax_t *sad))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_U8(src1, src1_dim, width, height) ||
+        !RAPP_VALIDATE_U8(src2, src2_dim, width, height))
+    {
+        return rapp_error_u8_u8(src1, src1_dim, width, height,
+                                src2, src2_dim, width, height);
+    }
+    if (!sad) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Perform operation */
+    *sad = rc_stat_sad_u8(src1, src1_dim, src2, src2_dim, width, height);
+
+    return RAPP_OK;
+}
+
+/**
+ *  8-bit sum of squared differences.
+ */
+RAPP_API(int, rapp_stat_ssd_u8,
+         (const uint8_t *restrict src1, int src1_dim,
+          const uint8_t *restrict src2, int src2_dim,
+          int width, int height, uintmax_t *ssd))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_U8(src1, src1_dim, width, height) ||
+        !RAPP_VALIDATE_U8(src2, src2_dim, width, height))
+    {
+        return rapp_error_u8_u8(src1, src1_dim, width, height,
+                                src2, src2_dim, width, height);
+    }
+    if (!ssd) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Perform operation */
+    *ssd = rc_stat_ssd_u8(src1, src1_dim, src2, src2_dim, width, height);
+
+    return RAPP_OK;
+}
+
+/**
+ *  The working buffer size of rapp_stat_ssim_u8().
+ */
+RAPP_API(int, rapp_stat_ssim_worksize_u8, (int width))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (width < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    return rc_align(5*sizeof(uint32_t)*width);
+}
+
+/**
+ *  8-bit mean structural similarity.
+ */
+RAPP_API(int, rapp_stat_ssim_u8,
+         (const uint8_t *restrict src1, int src1_dim,
+          const uint8_t *restrict src2, int src2_dim,
+          int width, int height, int32_t *ssim,
+          void *restrict work))
+{
+    int size = rc_align(5*sizeof(uint32_t)*width);
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(src1, src1_dim, work, 0, height,
+                                     rc_align(width), size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(src2, src2_dim, work, 0, height,
+                                     rc_align(width), size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+    if (!RAPP_VALIDATE_U8(src1, src1_dim, width, height) ||
+        !RAPP_VALIDATE_U8(src2, src2_dim, width, height))
+    {
+        return rapp_error_u8_u8(src1, src1_dim, width, height,
+                                src2, src2_dim, width, height);
+    }
+    if (width < RC_STAT_SSIM_WIN || height < RC_STAT_SSIM_WIN) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+    if (!ssim || !work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Perform operation */
+    *ssim = rc_stat_ssim_u8(src1, src1_dim, src2, src2_dim,
+                            width, height, work);
+
+    return RAPP_OK;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Validate the histogram arguments. The mask is optional.
+ */
+static int
+rapp_stat_hist_validate(const uint8_t *buf, int dim,
+                        const uint8_t *map, int map_dim,
+                        int width, int height, const uint32_t *hist)
+{
+    if (!RAPP_VALIDATE_U8(buf, dim, width, height)) {
+        return rapp_error_u8(buf, dim, width, height);
+    }
+    if (map && !RAPP_VALIDATE_BIN(map, map_dim, width, height)) {
+        return rapp_error_bin_u8(map, map_dim, buf, dim, width, height);
+    }
+    if (!hist) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    return RAPP_OK;
+}
+
+/**
+ *  Compute the 256-bin histogram, with or without the mask.
+ */
+static void
+rapp_stat_hist(const uint8_t *buf, int dim,
+               const uint8_t *map, int map_dim,
+               int width, int height, uint32_t *hist)
+{
+    if (map) {
+        rc_stat_hist_mask_u8(buf, dim, map, map_dim, width, height, hist);
+    }
+    else {
+        rc_stat_hist_u8(buf, dim, width, height, hist);
+    }
+}
+
+/**
+ *  Validate the image and the mandatory mask of the masked statistics.
+ */
+static int
+rapp_stat_mask_validate(const uint8_t *buf, int dim,
+                        const uint8_t *map, int map_dim,
+                        int width, int height)
+{
+    if (!RAPP_VALIDATE_U8(buf, dim, width, height) ||
+        !RAPP_VALIDATE_BIN(map, map_dim, width, height))
+    {
+        return rapp_error_u8_bin(buf, dim, map, map_dim, width, height);
+    }
+
+    return RAPP_OK;
+}
@@ -30,6 +30,8 @@
  *  @brief  RAPP thresholding to binary.
  */
 
+#include <stdlib.h>         /* abs()               */
+#include <string.h>         /* memset()            */
 #include "rappcompute.h"    /* RAPP Compute API    */
 #include "rapp_api.h"       /* API symbol macro    */
 #include "rapp_util.h"      /* Validation, CLAMP() */
@@ -37,6 +39,70 @@
 #include "rapp_error_int.h" /* Error handling      */
 #include "rapp_thresh.h"    /* Thresholding API    */
 
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The approximate number of source bytes in each row strip of
+ *  the fused automatic thresholding and histogram pass. The strip
+ *  should stay in the cache between the two operations.
+ */
+#define RAPP_THRESH_AUTO_BYTES 32768
+
+/**
+ *  The maximum adaptive thresholding radius, limited by the
+ *  maximum box filter size.
+ */
+#define RAPP_THRESH_ADAPTIVE_MAX 127
+
+/**
+ *  The minimum number of rows in each strip of the adaptive
+ *  thresholding. Larger radii use longer strips, to keep the
+ *  cost of the vertical strip borders down.
+ */
+#define RAPP_THRESH_ADAPTIVE_ROWS 32
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static void
+rapp_thresh_gt(uint8_t *restrict dst, int dst_dim,
+               const uint8_t *restrict src, int src_dim,
+               int width, int height, int thresh);
+
+static int
+rapp_thresh_otsu(const uint32_t *hist);
+
+static int
+rapp_thresh_triangle(const uint32_t *hist);
+
+static int
+rapp_thresh_percentile(const uint32_t *hist, int percent);
+
+static int
+rapp_thresh_adaptive_rows(int radius);
+
+static int
+rapp_thresh_adaptive_worksize(int width, int radius);
+
+static void
+rapp_thresh_absdiff_gt(uint8_t *restrict dst, int dst_dim,
+                       const uint8_t *restrict src1, int src1_dim,
+                       const uint8_t *restrict src2, int src2_dim,
+                       int width, int height, int thresh);
+
+static int
+rapp_thresh_absdiff_hyst_worksize(int width, int height);
+
+
 /*
  * -------------------------------------------------------------
  *  Exported functions
@@ -72,31 +138,8 @@ RAPP_API(int, rapp_thresh_gt_u8,
         return rapp_error_bin_u8(dst, dst_dim, src, src_dim, width, height);
     }
 
-    /* Reduce threshold range */
-    thresh = CLAMP(thresh, -1, 0xff);
-
     /* Perform operation */
-    switch (thresh) {
-        case -1:
-            /* Handle the always-true case */
-            rc_pixop_set_u8(dst, dst_dim, (width + 7)/8, height, 0xff);
-            break;
-
-        case 0x7f:
-            /* Use the faster type conversion */
-            rc_type_u8_to_bin(dst, dst_dim, src, src_dim, width, height);
-            break;
-
-        case 0xff:
-            /* Handle the always-false case */
-            rc_pixop_set_u8(dst, dst_dim, (width + 7)/8, height, 0);
-            break;
-
-        default:
-            /* Perform thresholding */
-            rc_thresh_gt_u8(dst, dst_dim, src, src_dim,
-                            width, height, thresh);
-    }
+    rapp_thresh_gt(dst, dst_dim, src, src_dim, width, height, thresh);
 
     return RAPP_OK;
 }
@@ -516,3 +559,682 @@ RAPP_API(int, rapp_thresh_ltgt_pixel_u8,
 
     return RAPP_OK;
 }
+
+
+/**
+ *  Single thresholding greater-than, 16-bit.
+ */
+RAPP_API(int, rapp_thresh_gt_u16,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height, int thresh))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments. Remember these are different-typed objects. */
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, src, src_dim, height,
+                                     rc_align((width + 7) / 8),
+                                     rc_align(2*width)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_BIN(dst, dst_dim, width, height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width, height))
+    {
+        /* Return the error code */
+        return rapp_error_bin_u16(dst, dst_dim, src, src_dim, width, height);
+    }
+
+    /* Reduce threshold range */
+    thresh = CLAMP(thresh, -1, 0xffff);
+
+    /* Perform operation */
+    switch (thresh) {
+        case -1:
+            /* Handle the always-true case */
+            rc_pixop_set_u8(dst, dst_dim, (width + 7)/8, height, 0xff);
+            break;
+
+        case 0xffff:
+            /* Handle the always-false case */
+            rc_pixop_set_u8(dst, dst_dim, (width + 7)/8, height, 0);
+            break;
+
+        default:
+            /* Perform thresholding */
+            rc_thresh_gt_u16(dst, dst_dim, src, src_dim,
+                             width, height, thresh);
+    }
+
+    return RAPP_OK;
+}
+
+
+/**
+ *  Single thresholding less-than, 16-bit.
+ */
+RAPP_API(int, rapp_thresh_lt_u16,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint16_t *restrict src, int src_dim,
+          int width, int height, int thresh))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments. Remember these are different-typed objects. */
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, src, src_dim, height,
+                                     rc_align((width + 7) / 8),
+                                     rc_align(2*width)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_BIN(dst, dst_dim, width, height) ||
+        !RAPP_VALIDATE_U16(src, src_dim, width, height))
+    {
+        /* Return the error code */
+        return rapp_error_bin_u16(dst, dst_dim, src, src_dim, width, height);
+    }
+
+    /* Reduce threshold range */
+    thresh = CLAMP(thresh, 0, 0x10000);
+
+    /* Perform operation */
+    switch (thresh) {
+        case 0:
+            /* Handle the always-false case */
+            rc_pixop_set_u8(dst, dst_dim, (width + 7)/8, height, 0);
+            break;
+
+        case 0x10000:
+            /* Handle the always-true case */
+            rc_pixop_set_u8(dst, dst_dim, (width + 7)/8, height, 0xff);
+            break;
+
+        default:
+            /* Perform thresholding */
+            rc_thresh_lt_u16(dst, dst_dim, src, src_dim,
+                             width, height, thresh);
+    }
+
+    return RAPP_OK;
+}
+
+
+/**
+ *  Automatic single thresholding greater-than.
+ */
+RAPP_API(int, rapp_thresh_auto_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int method, int percent,
+          uint32_t *hist))
+{
+    uint32_t local[256];
+    uint32_t part[256];
+    int      level, rows, y, k;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments. Remember these are different-typed objects. */
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, src, src_dim, height,
+                                     rc_align((width + 7) / 8),
+                                     rc_align(width)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_BIN(dst, dst_dim, width, height) ||
+        !RAPP_VALIDATE_U8 (src, src_dim, width, height))
+    {
+        /* Return the error code */
+        return rapp_error_bin_u8(dst, dst_dim, src, src_dim, width, height);
+    }
+
+    if (method < RAPP_THRESH_OTSU || method > RAPP_THRESH_PERCENTILE ||
+        (method == RAPP_THRESH_PERCENTILE && (percent < 0 || percent > 100)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    /* Compute the histogram of the source image if none is given */
+    if (hist) {
+        for (k = 0; k < 256 && hist[k] == 0; k++) {
+            /* Find the first non-empty bin */
+        }
+        if (k == 256) {
+            rc_stat_hist_u8(src, src_dim, width, height, hist);
+        }
+    }
+    else {
+        rc_stat_hist_u8(src, src_dim, width, height, local);
+    }
+
+    /* Select the threshold level */
+    switch (method) {
+        case RAPP_THRESH_OTSU:
+            level = rapp_thresh_otsu(hist ? hist : local);
+            break;
+
+        case RAPP_THRESH_TRIANGLE:
+            level = rapp_thresh_triangle(hist ? hist : local);
+            break;
+
+        default:
+            level = rapp_thresh_percentile(hist ? hist : local, percent);
+    }
+
+    if (!hist) {
+        /* Perform thresholding */
+        rapp_thresh_gt(dst, dst_dim, src, src_dim, width, height, level);
+        return level;
+    }
+
+    /* Threshold and compute the new histogram in cached row strips */
+    memset(hist, 0, 256*sizeof *hist);
+    rows = MAX(RAPP_THRESH_AUTO_BYTES / src_dim, 1);
+    for (y = 0; y < height; y += rows) {
+        int len = MIN(rows, height - y);
+
+        rapp_thresh_gt(&dst[y*dst_dim], dst_dim,
+                       &src[y*src_dim], src_dim, width, len, level);
+        rc_stat_hist_u8(&src[y*src_dim], src_dim, width, len, part);
+        for (k = 0; k < 256; k++) {
+            hist[k] += part[k];
+        }
+    }
+
+    return level;
+}
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  the adaptive thresholding.
+ */
+RAPP_API(int, rapp_thresh_adaptive_worksize_u8, (int width, int radius))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (width < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    if (radius < 1 || radius > RAPP_THRESH_ADAPTIVE_MAX) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+
+    return rapp_thresh_adaptive_worksize(width, radius);
+}
+
+/**
+ *  Adaptive single thresholding greater-than.
+ */
+RAPP_API(int, rapp_thresh_adaptive_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src, int src_dim,
+          int width, int height, int radius, int offset,
+          void *restrict work))
+{
+    int       xpad = rc_align(radius);
+    int       size = rapp_thresh_adaptive_worksize(width, radius);
+    int       rows = rapp_thresh_adaptive_rows(radius);
+    int       dim  = rc_align(width);
+    uint8_t  *hbuf, *mean;
+    uint16_t *sum;
+    int       y;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(dst, dst_dim, src, src_dim, height,
+                                       0, rc_align((width + 7) / 8),
+                                       -radius*src_dim - xpad,
+                                       radius*src_dim + rc_align(width) +
+                                       xpad))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_RESTRICT_OFFSET(src, src_dim, work, 0, height,
+                                       -radius*src_dim - xpad,
+                                       radius*src_dim + rc_align(width) +
+                                       xpad, 0, size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, work, 0, height,
+                                     rc_align((width + 7) / 8), size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_BIN(dst, dst_dim, width, height)) {
+        return rapp_error_bin(dst, dst_dim, width, height);
+    }
+    if (!RAPP_VALIDATE_U8(src, src_dim, width + 2*xpad, height)) {
+        return rapp_error_u8(src, src_dim, width + 2*xpad, height);
+    }
+
+    if (radius < 1 || radius > RAPP_THRESH_ADAPTIVE_MAX ||
+        abs(offset) > 0xff)
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    else if (!work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Partition the working buffer */
+    hbuf = work;
+    mean = hbuf + (rows + 2*radius)*dim;
+    sum  = (uint16_t*)(mean + rows*dim);
+
+    /* Threshold against the local mean, one row strip at a time */
+    for (y = 0; y < height; y += rows) {
+        const uint8_t *row = &src[y*src_dim];
+        int            len = MIN(rows, height - y);
+
+        /* Horizontal box filter over the strip and its vertical border */
+        rc_filter_box_horz_u8(hbuf, dim, &row[-radius*src_dim], src_dim,
+                              width, len + 2*radius, 2*radius + 1);
+
+        /* Vertical box filter to the local mean */
+        rc_filter_box_vert_u8(mean, dim, &hbuf[radius*dim], dim,
+                              width, len, 2*radius + 1, sum);
+
+        /* Add the offset and threshold */
+        rc_pixop_addc_u8(mean, dim, width, len, offset);
+        rc_thresh_gt_pixel_u8(&dst[y*dst_dim], dst_dim, row, src_dim,
+                              mean, dim, width, len);
+    }
+
+    return RAPP_OK;
+}
+
+
+/**
+ *  Absolute-difference thresholding greater-than.
+ */
+RAPP_API(int, rapp_thresh_absdiff_gt_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src1, int src1_dim,
+          const uint8_t *restrict src2, int src2_dim,
+          int width, int height, int thresh))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, src1, src1_dim, height,
+                                     rc_align((width + 7) / 8),
+                                     rc_align(width)) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, src2, src2_dim, height,
+                                     rc_align((width + 7) / 8),
+                                     rc_align(width)))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_BIN(dst, dst_dim, width, height) ||
+        !RAPP_VALIDATE_U8(src1, src1_dim, width, height))
+    {
+        return rapp_error_bin_u8(dst, dst_dim, src1, src1_dim,
+                                 width, height);
+    }
+    if (!RAPP_VALIDATE_U8(src2, src2_dim, width, height)) {
+        return rapp_error_u8(src2, src2_dim, width, height);
+    }
+
+    /* Perform operation */
+    rapp_thresh_absdiff_gt(dst, dst_dim, src1, src1_dim, src2, src2_dim,
+                           width, height, thresh);
+
+    return RAPP_OK;
+}
+
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  absolute-difference thresholding with hysteresis.
+ */
+RAPP_API(int, rapp_thresh_absdiff_hyst_worksize_u8, (int width, int height))
+{
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    if (width < 1 || height < 1) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_IMG_SIZE;
+    }
+
+    return rapp_thresh_absdiff_hyst_worksize(width, height);
+}
+
+
+/**
+ *  Absolute-difference thresholding with hysteresis.
+ */
+RAPP_API(int, rapp_thresh_absdiff_hyst_u8,
+         (uint8_t *restrict dst, int dst_dim,
+          const uint8_t *restrict src1, int src1_dim,
+          const uint8_t *restrict src2, int src2_dim,
+          int width, int height, int low, int high,
+          void *restrict work))
+{
+    int      size = rapp_thresh_absdiff_hyst_worksize(width, height);
+    int      bdim = rc_align((width + 7) / 8);
+    uint8_t *weak = work;
+
+    if (!RAPP_INITIALIZED()) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_UNINITIALIZED;
+    }
+
+    /* Validate arguments */
+    if (!RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, src1, src1_dim, height,
+                                     bdim, rc_align(width)) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, src2, src2_dim, height,
+                                     bdim, rc_align(width)) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(dst, dst_dim, work, 0, height,
+                                     bdim, size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(src1, src1_dim, work, 0, height,
+                                     rc_align(width), size) ||
+        !RAPP_VALIDATE_RESTRICT_PLUS(src2, src2_dim, work, 0, height,
+                                     rc_align(width), size))
+    {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_OVERLAP;
+    }
+
+    if (!RAPP_VALIDATE_BIN(dst, dst_dim, width, height) ||
+        !RAPP_VALIDATE_U8(src1, src1_dim, width, height))
+    {
+        return rapp_error_bin_u8(dst, dst_dim, src1, src1_dim,
+                                 width, height);
+    }
+    if (!RAPP_VALIDATE_U8(src2, src2_dim, width, height)) {
+        return rapp_error_u8(src2, src2_dim, width, height);
+    }
+
+    if (low < 0 || high > 0xff || low > high) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_RANGE;
+    }
+    else if (!work) {
+        RAPP_ABORT_FOR_ASSERTED_RETURNS();
+        return RAPP_ERR_PARM_NULL;
+    }
+
+    /* Threshold the weak and strong pixels */
+    rapp_thresh_absdiff_gt(weak, bdim, src1, src1_dim, src2, src2_dim,
+                           width, height, low);
+    rapp_thresh_absdiff_gt(dst, dst_dim, src1, src1_dim, src2, src2_dim,
+                           width, height, high);
+
+    /* Clear the row padding, which the word-based fill also processes */
+    if (8*bdim > width) {
+        rc_pad_const_right_bin(weak, bdim, 0, width, height,
+                               8*bdim - width, 0);
+        rc_pad_const_right_bin(dst, dst_dim, 0, width, height,
+                               8*bdim - width, 0);
+    }
+
+    /* Connect the weak pixels to the strong ones */
+    do {
+        rc_fill_8conn_seed_fwd_bin(dst, dst_dim, weak, bdim, width, height);
+    } while (rc_fill_8conn_seed_rev_bin(dst, dst_dim, weak, bdim,
+                                        width, height));
+
+    return RAPP_OK;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Single thresholding greater-than, with the special cases
+ *  for constant output and the signed conversion threshold.
+ */
+static void
+rapp_thresh_gt(uint8_t *restrict dst, int dst_dim,
+               const uint8_t *restrict src, int src_dim,
+               int width, int height, int thresh)
+{
+    /* Reduce threshold range */
+    thresh = CLAMP(thresh, -1, 0xff);
+
+    /* Perform operation */
+    switch (thresh) {
+        case -1:
+            /* Handle the always-true case */
+            rc_pixop_set_u8(dst, dst_dim, (width + 7)/8, height, 0xff);
+            break;
+
+        case 0x7f:
+            /* Use the faster type conversion */
+            rc_type_u8_to_bin(dst, dst_dim, src, src_dim, width, height);
+            break;
+
+        case 0xff:
+            /* Handle the always-false case */
+            rc_pixop_set_u8(dst, dst_dim, (width + 7)/8, height, 0);
+            break;
+
+        default:
+            /* Perform thresholding */
+            rc_thresh_gt_u8(dst, dst_dim, src, src_dim,
+                            width, height, thresh);
+    }
+}
+
+/**
+ *  Select the threshold level with Otsu's method. The level
+ *  maximizes the between-class variance w0*w1*(m0 - m1)^2, where
+ *  w0, m0 and w1, m1 are the pixel counts and means of the classes
+ *  below and above the level. For a constant image the pixel
+ *  value is returned, giving an empty output image.
+ */
+static int
+rapp_thresh_otsu(const uint32_t *hist)
+{
+    double   best  = -1.0;
+    double   sum   = 0;
+    double   sum0  = 0;
+    uint32_t total = 0;
+    uint32_t w0    = 0;
+    int      level = 0;
+    int      k;
+
+    for (k = 0; k < 256; k++) {
+        total += hist[k];
+        sum   += (double)k*hist[k];
+    }
+
+    for (k = 0; k < 255; k++) {
+        uint32_t w1;
+        double   diff, var;
+
+        w0   += hist[k];
+        sum0 += (double)k*hist[k];
+        w1    = total - w0;
+        if (w0 == 0) {
+            continue;
+        }
+        if (w1 == 0) {
+            break;
+        }
+
+        /* Same as w0*w1*(m0 - m1)^2 scaled by total^2 */
+        diff = sum0*total - sum*w0;
+        var  = diff*diff / ((double)w0*w1);
+        if (var > best) {
+            best  = var;
+            level = k;
+        }
+    }
+
+    /* Handle the constant image */
+    if (best < 0 && total > 0) {
+        level = (int)(sum / total);
+    }
+
+    return level;
+}
+
+/**
+ *  Select the threshold level with the triangle method. The line
+ *  goes from the peak bin to the outermost non-empty bin on the
+ *  side of the longest tail. The selected level is the bin in
+ *  between with the largest vertical distance below the line,
+ *  scaled by the horizontal line length to stay in integers.
+ *  A single-valued histogram gives the level of that value.
+ */
+static int
+rapp_thresh_triangle(const uint32_t *hist)
+{
+    int64_t best = -1;
+    int     peak = 0;
+    int     lo, hi, end, dir, level, k;
+
+    /* Find the peak and the non-empty range */
+    for (lo = 0; lo < 255 && hist[lo] == 0; lo++) {
+        /* Empty bin */
+    }
+    for (hi = 255; hi > lo && hist[hi] == 0; hi--) {
+        /* Empty bin */
+    }
+    for (k = lo; k <= hi; k++) {
+        if (hist[k] > hist[peak]) {
+            peak = k;
+        }
+    }
+
+    /* Follow the longest tail */
+    end   = hi - peak >= peak - lo ? hi : lo;
+    dir   = end >= peak ? 1 : -1;
+    level = peak;
+    for (k = peak; k != end; k += dir) {
+        int64_t dist = (int64_t)hist[peak]*(end - k)*dir -
+                       (int64_t)hist[k]*(end - peak)*dir;
+        if (dist > best) {
+            best  = dist;
+            level = k;
+        }
+    }
+
+    /* Keep the selected bin on the peak side of the level */
+    return dir > 0 ? level : level - 1;
+}
+
+/**
+ *  Select the lowest level that at least the given percentage
+ *  of the pixels are less than or equal to.
+ */
+static int
+rapp_thresh_percentile(const uint32_t *hist, int percent)
+{
+    uint64_t total = 0;
+    uint64_t cnt   = 0;
+    int      k;
+
+    for (k = 0; k < 256; k++) {
+        total += hist[k];
+    }
+    for (k = 0; k < 255; k++) {
+        cnt += hist[k];
+        if (100*cnt >= (uint64_t)percent*total) {
+            break;
+        }
+    }
+
+    return k;
+}
+
+/**
+ *  Compute the number of rows in each adaptive thresholding strip.
+ */
+static int
+rapp_thresh_adaptive_rows(int radius)
+{
+    return MAX(RAPP_THRESH_ADAPTIVE_ROWS, 2*radius);
+}
+
+/**
+ *  Compute the size of the adaptive thresholding working buffer.
+ *  It holds the horizontally filtered strip with its vertical
+ *  border, the local mean strip and the vertical column sums.
+ */
+static int
+rapp_thresh_adaptive_worksize(int width, int radius)
+{
+    int rows = rapp_thresh_adaptive_rows(radius);
+
+    return (2*rows + 2*radius)*rc_align(width) +
+           rc_align(width)*sizeof(uint16_t);
+}
+
+/**
+ *  Absolute-difference thresholding greater-than,
+ *  with the always-true and always-false cases handled.
+ */
+static void
+rapp_thresh_absdiff_gt(uint8_t *restrict dst, int dst_dim,
+                       const uint8_t *restrict src1, int src1_dim,
+                       const uint8_t *restrict src2, int src2_dim,
+                       int width, int height, int thresh)
+{
+    if (thresh < 0) {
+        /* Handle the always-true case */
+        rc_pixop_set_u8(dst, dst_dim, (width + 7)/8, height, 0xff);
+    }
+    else if (thresh >= 0xff) {
+        /* Handle the always-false case */
+        rc_pixop_set_u8(dst, dst_dim, (width + 7)/8, height, 0);
+    }
+    else {
+        /* Perform thresholding */
+        rc_thresh_absdiff_gt_u8(dst, dst_dim, src1, src1_dim,
+                                src2, src2_dim, width, height, thresh);
+    }
+}
+
+/**
+ *  Compute the size of the hysteresis working buffer.
+ *  It holds the binary map of the weak pixels.
+ */
+static int
+rapp_thresh_absdiff_hyst_worksize(int width, int height)
+{
+    return height*rc_align((width + 7) / 8);
+}
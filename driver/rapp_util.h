@@ -95,6 +95,12 @@
 #define RAPP_VALIDATE_U16(ptr, dim, width, height) \
     RAPP_VALIDATE_U(ptr, dim, width, height)
 
+/**
+ *  Validate parameters for an aligned s16 image.
+ */
+#define RAPP_VALIDATE_S16(ptr, dim, width, height) \
+    RAPP_VALIDATE_U(ptr, dim, width, height)
+
 /**
  *  Validate parameters for an aligned u32 image.
  */
@@ -416,6 +416,7 @@
  *  - @ref grp_bitblt
  *  - @ref grp_pixop
  *  - @ref grp_thresh
+ *  - @ref grp_bgmodel
  *  - @ref grp_type
  *
  *  <p>@ref grp_bitblt "Next section: Bitblit Operations"</p>
@@ -425,13 +426,16 @@
  *  @page statistics Statistical Operations
  *  @section Overview
  *  The statistical operations compute image-global statistical measures
- *  for one or two source images.
+ *  for one or two source images, the motion between two images and the
+ *  position of a template in an image.
  *
  *  @section Contents
  *  - @ref grp_stat
  *  - @ref grp_moment
+ *  - @ref grp_motion
+ *  - @ref grp_match
  *
- *  <p>@ref grp_stat "Next section: Sum, Sum-of-Squares, Min and Max Statistics"</p>
+ *  <p>@ref grp_stat "Next section: Sum, Sum-of-Squares, Min, Max and Histogram Statistics"</p>
  */
 
 /**
@@ -449,6 +453,9 @@
  *
  *  @section Contents
  *  - @ref grp_filter
+ *  - @ref grp_edge
+ *  - @ref grp_feature
+ *  - @ref grp_morph
  *  - @ref grp_binmorph
  *
  *  <p>@ref grp_filter "Next section: Fixed-Filter Convolutions"</p>
@@ -485,10 +492,12 @@
  *  @page geometry Geometrical Transformations
  *  @section Overview
  *  These functions alter the geometry of an image. The image width
- *  and height given always refer to the source image.
+ *  and height given always refer to the source image, except for the
+ *  resizing, which takes both the source and the destination size.
  *
  *  @section Contents
  *  - @ref grp_reduce
+ *  - @ref grp_resize
  *  - @ref grp_expand
  *  - @ref grp_rotate
  *  - @ref grp_margin
@@ -893,17 +902,24 @@
 #include "rapp_pixop.h"       /* Pixelwise operations          */
 #include "rapp_type.h"        /* Type conversions              */
 #include "rapp_thresh.h"      /* Thresholding to binary        */
+#include "rapp_bgmodel.h"     /* Background modelling          */
 #include "rapp_reduce.h"      /* 8-bit 2x reduction            */
 #include "rapp_reduce_bin.h"  /* Binary 2x reduction           */
+#include "rapp_resize.h"      /* 8-bit resizing                */
 #include "rapp_expand_bin.h"  /* Binary 2x expansion           */
 #include "rapp_rotate.h"      /* 8-bit image rotation          */
 #include "rapp_rotate_bin.h"  /* Binary image rotation         */
 #include "rapp_stat.h"        /* Statistical operations        */
 #include "rapp_moment_bin.h"  /* Binary image moments          */
+#include "rapp_motion.h"      /* Motion estimation             */
+#include "rapp_match.h"       /* Template matching             */
 #include "rapp_filter.h"      /* Fixed-filter convolutions     */
+#include "rapp_edge.h"        /* Edge detection                */
+#include "rapp_feature.h"     /* Feature detection             */
 #include "rapp_fill.h"        /* Connected-components fill     */
 #include "rapp_pad.h"         /* 8-bit image padding           */
 #include "rapp_pad_bin.h"     /* Binary image padding          */
+#include "rapp_morph.h"       /* 8-bit morphology              */
 #include "rapp_morph_bin.h"   /* Binary morphology             */
 #include "rapp_margin.h"      /* Binary image logical margins  */
 #include "rapp_crop.h"        /* Binary image cropping         */
@@ -0,0 +1,123 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_bgmodel.h
+ *  @brief  RAPP background modelling.
+ */
+
+/**
+ *  @defgroup grp_bgmodel Background Modelling
+ *  @brief Running-average background model with foreground detection.
+ *
+ *  @section Overview
+ *  The function rapp_bgmodel_update_u8() maintains a background model
+ *  of an 8-bit image sequence and detects the foreground pixels of each
+ *  new image. The model consists of a running mean image and optionally
+ *  a running mean absolute deviation image, both 8-bit. A pixel is
+ *  foreground if its absolute difference to the mean is larger than
+ *  the threshold, plus two times the deviation if present. Both images
+ *  are then updated towards the new image by linear interpolation with
+ *  the learning rate, but only where the pixel was background in the
+ *  @e previous foreground mask. This keeps moving objects from being
+ *  blended into the background, in the same way as for the
+ *  @ref grp_cond "conditional operations" with a map image.
+ *  The mean image is updated as with rapp_pixop_lerpn_u8(), i.e. the
+ *  update is rounded away from zero, so that the mean always converges
+ *  to a stationary image. The deviation image is updated in the same
+ *  way towards the absolute difference.
+ *
+ *  @section Performance
+ *  All operations are fused into a single pass over the images. The
+ *  previous foreground mask is read and replaced by the new one in
+ *  place, one word at a time. This avoids the intermediate images and
+ *  the extra passes needed to compute the difference, the thresholding
+ *  and the conditional updates with separate calls.
+ *
+ *  @section Usage
+ *  The mean image is typically initialized with the first image of the
+ *  sequence, the deviation image with a small constant value, and the
+ *  foreground mask with zeros. The foreground mask buffer is then both
+ *  input and output for each new image.
+ *
+ *  <p>@ref grp_type "Next section: Type Conversions"</p>
+ *
+ *  @{
+ */
+
+#ifndef RAPP_BGMODEL_H
+#define RAPP_BGMODEL_H
+
+#include <stdint.h>
+#include "rapp_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Background model update with foreground detection.
+ *  The deviation buffer may be NULL, in which case only the mean is
+ *  used and updated.
+ *
+ *  @param[in,out] fg        Binary foreground mask buffer. On input the
+ *                           previous mask, on output the new mask.
+ *  @param         fg_dim    Foreground mask buffer row dimension.
+ *  @param[in,out] mean      Background mean pixel buffer.
+ *  @param         mean_dim  Mean buffer row dimension.
+ *  @param[in,out] dev       Background deviation pixel buffer, or NULL.
+ *  @param         dev_dim   Deviation buffer row dimension.
+ *  @param[in]     src       Source pixel buffer.
+ *  @param         src_dim   Source buffer row dimension.
+ *  @param         width     The image width in pixels.
+ *  @param         height    The image height in pixels.
+ *  @param         alpha8    The Q.8 fixed-point learning rate, 1-127.
+ *  @param         thresh    The foreground threshold, 0-255.
+ *  @return                  A negative error code on error,
+ *                           zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_bgmodel_update_u8(uint8_t *restrict fg, int fg_dim,
+                       uint8_t *restrict mean, int mean_dim,
+                       uint8_t *restrict dev, int dev_dim,
+                       const uint8_t *restrict src, int src_dim,
+                       int width, int height, unsigned alpha8,
+                       int thresh);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RAPP_BGMODEL_H */
+/** @} */
@@ -0,0 +1,138 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_edge.h
+ *  @brief  RAPP edge detection.
+ */
+
+/**
+ *  @defgroup grp_edge Edge Detection
+ *
+ *  @section Overview
+ *  The function rapp_edge_canny_u8() finds the edges of an 8-bit image
+ *  with the Canny edge detector and returns them as a binary image.
+ *  The image is first smoothed with the 3x3 Gaussian filter
+ *  rapp_filter_gauss_3x3_u8(). The Sobel gradient magnitude and
+ *  orientation are then computed as with
+ *  rapp_filter_sobel_3x3_magn_dir_u8() using four orientation bins.
+ *  The smoothed image is extended by replication at the image border
+ *  for this step, so the user padding only affects the smoothing.
+ *
+ *  Next, all pixels that are not a local maximum of the magnitude along
+ *  the gradient orientation are suppressed. A pixel is a local maximum
+ *  if it is larger than the neighbour before it and not smaller than
+ *  the neighbour after it, where the neighbour before is the left, the
+ *  upper-left, the upper and the upper-right neighbour for the
+ *  orientation codes 0, 1, 2 and 3, respectively. The magnitude outside
+ *  the image is zero. The remaining pixels with a magnitude larger than
+ *  the high threshold are strong edge pixels, and the ones with a
+ *  magnitude larger than the low threshold are weak edge pixels.
+ *  Finally, the result is the set of weak edge pixels that are
+ *  8-connected to a strong edge pixel through other weak edge pixels.
+ *  The thresholds are given in the same units as the magnitude of
+ *  rapp_filter_sobel_3x3_magn_u8().
+ *
+ *  @section Performance
+ *  The smoothing, the gradient computation and the non-maximum
+ *  suppression are performed in strips of rows, so that all the
+ *  intermediate images stay in the cache. The connectivity analysis
+ *  then uses the word-parallel @ref grp_fill "seed fill" iterations on
+ *  the binary images, seeded with all strong edge pixels at once.
+ *
+ *  @section Usage
+ *  The function needs a user-allocated working buffer. The minimum size
+ *  in bytes of the buffer is given by rapp_edge_canny_worksize_u8(),
+ *  and it must be aligned on #rapp_alignment boundaries. As with most
+ *  other RAPP functions, the images must also be aligned.
+ *
+ *  @section Padding
+ *  The source image must be @ref padding "padded" in the same way as for
+ *  the 3x3 filters, i.e. with one row above and below, and with
+ *  rapp_align(1) bytes to the left and right.
+ *
+ *  <p>@ref grp_feature "Next section: Feature Detection"</p>
+ *
+ *  @{
+ */
+
+#ifndef RAPP_EDGE_H
+#define RAPP_EDGE_H
+
+#include <stdint.h>
+#include "rapp_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_edge_canny_u8().
+ *
+ *  @param width  The image width in pixels.
+ *  @param height The image height in pixels.
+ *  @return       The minimum buffer size in bytes,
+ *                or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_edge_canny_worksize_u8(int width, int height);
+
+/**
+ *  Canny edge detection.
+ *  The low threshold must not be larger than the high threshold.
+ *
+ *  @param[out] dst      Destination binary pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension.
+ *  @param[in]  src      Source pixel buffer with padding.
+ *  @param      src_dim  Source buffer row dimension.
+ *  @param      width    The image width in pixels.
+ *  @param      height   The image height in pixels.
+ *  @param      low      The low magnitude threshold, 0-255.
+ *  @param      high     The high magnitude threshold, 0-255.
+ *  @param      work     Internal working buffer.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_edge_canny_u8(uint8_t *restrict dst, int dst_dim,
+                   const uint8_t *restrict src, int src_dim,
+                   int width, int height, int low, int high,
+                   void *restrict work);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RAPP_EDGE_H */
+/** @} */
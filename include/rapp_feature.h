@@ -0,0 +1,176 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_feature.h
+ *  @brief  RAPP feature detection.
+ */
+
+/**
+ *  @defgroup grp_feature Feature Detection
+ *  @brief Corner detection with coordinate list output.
+ *
+ *  @section Overview
+ *  The feature detectors find the corners of an 8-bit image and return
+ *  their positions as a list of x, y coordinate pairs in raster order.
+ *  At most a given number of corners are stored, and the ones after
+ *  the list is full are ignored. Both detectors compute a corner score
+ *  for each pixel. The pixels with a score above zero are corners. If
+ *  non-maximum suppression is enabled, a corner is only kept if its
+ *  score is larger than the scores of the left and the three upper
+ *  neighbours, and not smaller than the scores of the right and the
+ *  three lower neighbours. The score outside the image is zero.
+ *
+ *  @section FAST
+ *  The function rapp_feature_fast_u8() uses the FAST segment test
+ *  on the Bresenham circle of 16 pixels at the radius 3. A pixel is
+ *  a corner if there are nine contiguous circle pixels that are all
+ *  brighter than the center pixel plus the threshold, or all darker
+ *  than the center pixel minus the threshold. The score is the
+ *  largest threshold for which the pixel is a corner, plus one, minus
+ *  the threshold used.
+ *
+ *  @section Harris
+ *  The function rapp_feature_harris_u8() computes the Harris corner
+ *  response det(M) - k*trace(M)^2 with k = 3/64, where M is the sum
+ *  of the gradient products [gx*gx gx*gy; gx*gy gy*gy] over the 3x3
+ *  neighbourhood. The gradients are the exact Sobel gradients of
+ *  rapp_filter_sobel_3x3_grad_u8_s16(), and they are zero outside the
+ *  image. The response is divided by 65536, and the score is the
+ *  response minus the threshold. The response is always below 2^31.
+ *
+ *  @section Performance
+ *  The detectors work in strips of rows, so that the intermediate
+ *  images stay in the cache. The FAST segment test is vectorized on
+ *  x86_64 SSE2. It first tests the four compass pixels, which rejects
+ *  most pixels of a typical image, and only completes the test for the
+ *  vectors where some pixel may be a corner. The Harris gradients are
+ *  computed by rapp_filter_sobel_3x3_grad_u8_s16(), which is vectorized
+ *  on x86 SSE2. The response needs 64-bit arithmetic and is computed
+ *  with scalar code.
+ *
+ *  @section Usage
+ *  The functions need a user-allocated working buffer. The minimum size
+ *  in bytes of the buffer is given by rapp_feature_worksize_u8(),
+ *  and it must be aligned on #rapp_alignment boundaries.
+ *
+ *  @section Padding
+ *  The source image of rapp_feature_fast_u8() must be @ref padding
+ *  "padded" with three rows above and below, and with rapp_align(3)
+ *  bytes to the left and right. The source image of
+ *  rapp_feature_harris_u8() must be padded in the same way as for the
+ *  3x3 filters, i.e. with one row above and below, and with
+ *  rapp_align(1) bytes to the left and right.
+ *
+ *  <p>@ref grp_morph "Next section: 8-bit Morphology"</p>
+ *
+ *  @{
+ */
+
+#ifndef RAPP_FEATURE_H
+#define RAPP_FEATURE_H
+
+#include <stdint.h>
+#include "rapp_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_feature_fast_u8() and rapp_feature_harris_u8().
+ *
+ *  @param width  The image width in pixels.
+ *  @param height The image height in pixels.
+ *  @return       The minimum buffer size in bytes,
+ *                or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_feature_worksize_u8(int width, int height);
+
+/**
+ *  FAST corner detection.
+ *
+ *  @param[in]  src      Source pixel buffer with padding.
+ *  @param      src_dim  Source buffer row dimension.
+ *  @param      width    The image width in pixels.
+ *  @param      height   The image height in pixels.
+ *  @param      thresh   The intensity difference threshold, 0-255.
+ *  @param      nms      Nonzero to enable non-maximum suppression.
+ *  @param[out] pos      Output position array with at least 2*max
+ *                       elements, filled in with x, y coordinate pairs.
+ *  @param      max      The maximum number of corners, at least one.
+ *  @param      work     Working buffer of at least
+ *                       rapp_feature_worksize_u8() bytes, aligned on
+ *                       #rapp_alignment boundaries.
+ *  @return              The number of corners stored,
+ *                       or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_feature_fast_u8(const uint8_t *restrict src, int src_dim,
+                     int width, int height, int thresh, int nms,
+                     unsigned *restrict pos, int max,
+                     void *restrict work);
+
+/**
+ *  Harris corner detection.
+ *
+ *  @param[in]  src      Source pixel buffer with padding.
+ *  @param      src_dim  Source buffer row dimension.
+ *  @param      width    The image width in pixels.
+ *  @param      height   The image height in pixels.
+ *  @param      thresh   The response threshold, at least zero.
+ *  @param      nms      Nonzero to enable non-maximum suppression.
+ *  @param[out] pos      Output position array with at least 2*max
+ *                       elements, filled in with x, y coordinate pairs.
+ *  @param      max      The maximum number of corners, at least one.
+ *  @param      work     Working buffer of at least
+ *                       rapp_feature_worksize_u8() bytes, aligned on
+ *                       #rapp_alignment boundaries.
+ *  @return              The number of corners stored,
+ *                       or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_feature_harris_u8(const uint8_t *restrict src, int src_dim,
+                       int width, int height, int thresh, int nms,
+                       unsigned *restrict pos, int max,
+                       void *restrict work);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RAPP_FEATURE_H */
+/** @} */
@@ -35,9 +35,9 @@
  *
  *  @section Overview
  *  These functions perform convolutions with common filter kernels
- *  up to size 3x3. In some cases there are a few variants that perform
- *  additional operations such as absolute-value and magnitude after
- *  the actual convolution.
+ *  up to size 3x3, and with user-supplied kernels. In some cases there
+ *  are a few variants that perform additional operations such as
+ *  absolute-value and magnitude after the actual convolution.
  *
  *  @section Precision
  *  For this family of functions, there is a performance/precision
@@ -55,9 +55,110 @@
  *  Sobel gradient and an absolute value operation, given that the intermediate
  *  result is 8 bits.
  *
+ *  @section filter_user User Kernels
+ *  The functions rapp_filter_conv_u8() and rapp_filter_sep_u8() perform
+ *  convolutions with user-supplied integer kernels of odd sizes up to
+ *  15 taps in each direction. The filter response is computed exactly,
+ *  then scaled by a power of two, rounded and saturated to 8 bits.
+ *  The sum of the positive coefficients and the negated sum of the
+ *  negative coefficients must both be at most 128. For the separable
+ *  case, this applies to each of the one-dimensional kernels.
+ *
+ *  The kernel is applied as a correlation, i.e. the first
+ *  coefficient is applied to the top-left pixel in the neighbourhood.
+ *  The source image must be @ref padding "padded" with kernel_height / 2
+ *  rows above and below, and with rapp_align(kernel_width / 2) bytes
+ *  to the left and right.
+ *
+ *  @section filter_orient Gradient Orientation
+ *  The function rapp_filter_sobel_3x3_magn_dir_u8() computes the Sobel
+ *  gradient magnitude together with a quantized gradient orientation,
+ *  in a single pass over the source image. The orientation code is the
+ *  direction of the gradient (gx, gy) rounded to the nearest multiple
+ *  of 45 degrees, counted from the positive x axis towards the positive
+ *  y axis, i.e. downwards in the image. With 8 bins the codes are
+ *  0 = right, 1 = down-right, 2 = down, 3 = down-left, 4 = left,
+ *  5 = up-left, 6 = up and 7 = up-right. With 4 bins opposite directions
+ *  are merged, and the code is the 8-bin code modulo 4. A zero gradient
+ *  gets the code 0. The edge direction is perpendicular to the gradient.
+ *
+ *  The function rapp_filter_sobel_3x3_grad_u8_s16() instead returns the
+ *  exact, signed horizontal and vertical Sobel gradients as 16-bit values
+ *  in the range [-1020, 1020]. Both functions have the same padding
+ *  requirements as the other 3x3 filters.
+ *
+ *  @section filter_s16 Signed Outputs
+ *  The 8-bit difference, Sobel, laplacian and highpass filters return
+ *  biased and scaled values, which loses precision. The functions with
+ *  the suffix _u8_s16 instead return the exact, signed filter responses
+ *  as 16-bit values. They have the same padding requirements as the
+ *  corresponding 8-bit filters.
+ *
+ *  @section filter_gauss Gaussian Smoothing
+ *  The function rapp_filter_gauss_u8() smooths an image with a Gaussian
+ *  of arbitrary standard deviation sigma in the range 1 to 20 pixels.
+ *  For sigma below 3 pixels, the filter is a separable convolution
+ *  with a tabulated 7-bit kernel. Larger sigma values are approximated
+ *  by three passes of box filters in each direction, computed with
+ *  running sums. The cost per pixel is then independent of sigma.
+ *  The required source padding is given by rapp_filter_gauss_padding_u8(),
+ *  and the size of the working buffer by rapp_filter_gauss_worksize_u8().
+ *
+ *  @section filter_median Median Filters
+ *  The functions rapp_filter_median_3x3_u8() and rapp_filter_median_5x5_u8()
+ *  compute the median of the 3x3 and 5x5 neighbourhoods. The result is
+ *  exact. The source image must be @ref padding "padded" with one or two
+ *  rows above and below, respectively, and with rapp_align(1) bytes to the
+ *  left and right for the 3x3 median and rapp_align(2) bytes for the 5x5
+ *  median.
+ *
+ *  @section filter_u16 16-bit Images
+ *  The functions rapp_filter_gauss_3x3_u16() and rapp_filter_median_3x3_u16()
+ *  filter 16-bit images. The Sobel gradients, laplacian and highpass
+ *  filters rapp_filter_*_3x3_u16(), and their absolute-value variants,
+ *  are also available. These filters are computed exactly, scaled to
+ *  16 bits and rounded, and the signed variants are biased by 0x8000.
+ *  The source image must be @ref padding "padded" with one row above
+ *  and below, and with rapp_align(2) bytes to the left and right.
+ *
+ *  @section filter_rank Rank Filters
+ *  The function rapp_filter_rank_u8() computes the pixel value of a given
+ *  rank in the square neighbourhood of radius 1 to 127 pixels, e.g. the
+ *  minimum, the median, the maximum or any other percentile. It uses
+ *  sliding column histograms, and the cost per pixel is independent of
+ *  the radius. For the small 3x3 and 5x5 medians, the dedicated median
+ *  filters are faster. The source image must be @ref padding "padded"
+ *  with radius rows above and below, and with rapp_align(radius) bytes
+ *  to the left and right. The size of the working buffer is given by
+ *  rapp_filter_rank_worksize_u8().
+ *
+ *  @section filter_census Census Transforms
+ *  The census transform replaces each pixel by a code with one bit per
+ *  neighbour, set if the neighbour is less than the center pixel. The
+ *  neighbours are numbered in raster order, skipping the center, so
+ *  that the top-left neighbour gives the least significant bit. The
+ *  function rapp_filter_census_3x3_u8() produces 8-bit codes, and
+ *  rapp_filter_census_5x5_u8_u32() produces 24-bit codes stored as
+ *  32-bit values. The function rapp_filter_lbp_3x3_u8() computes the
+ *  8-bit local binary pattern, where a bit is set if the neighbour is
+ *  greater than or equal to the center pixel. Here the neighbours are
+ *  numbered clockwise from the top-left corner, so that rotations of
+ *  the neighbourhood are rotations of the code. The source image must
+ *  be @ref padding "padded" as for the median filter of the same size.
+ *
+ *  The census codes are compared with the Hamming distance, i.e. the
+ *  number of differing bits. The functions rapp_filter_census_cost_u8()
+ *  and rapp_filter_census_cost_u32_u8() build a cost volume for stereo
+ *  matching from the codes of a left and a right image. The volume is
+ *  stored as one cost image per disparity, each of the same height as
+ *  the source images. The cost at disparity d of the pixel x in the
+ *  left image is the Hamming distance to the pixel x &ndash; d in the
+ *  right image. Pixels where x &ndash; d is outside the image get the
+ *  maximum distance 8 or 32. The code images need no padding.
+ *
  *  All images must be aligned.
  *
- *  <p>@ref grp_binmorph "Next section: Binary Morphology"</p>
+ *  <p>@ref grp_edge "Next section: Edge Detection"</p>
  *
  *  @{
  */
@@ -258,6 +359,52 @@ rapp_filter_sobel_3x3_magn_u8(uint8_t *restrict dst, int dst_dim,
                               const uint8_t *restrict src, int src_dim,
                               int width, int height);
 
+/**
+ *  3x3 Sobel gradient magnitude and orientation.
+ *  Computes the 1-norm of the horizontal and vertical Sobel gradients
+ *  and the quantized gradient orientation, as described in
+ *  @ref filter_orient "Gradient Orientation". The magnitude is scaled
+ *  as for rapp_filter_sobel_3x3_magn_u8(), and is correctly rounded.
+ *
+ *  @param[out] mag      Magnitude pixel buffer.
+ *  @param      mag_dim  Magnitude buffer row dimension in bytes.
+ *  @param[out] dir      Orientation code pixel buffer.
+ *  @param      dir_dim  Orientation buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param      bins     The number of orientation bins, 4 or 8.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_sobel_3x3_magn_dir_u8(uint8_t *restrict mag, int mag_dim,
+                                  uint8_t *restrict dir, int dir_dim,
+                                  const uint8_t *restrict src, int src_dim,
+                                  int width, int height, int bins);
+
+/**
+ *  3x3 Sobel gradient components, signed 16-bit.
+ *  Computes the horizontal and vertical Sobel gradients with the masks
+ *  [1 0 -1; 2 0 -2; 1 0 -1] and [1 2 1; 0 0 0; -1 -2 -1], without
+ *  scaling. The result is exact.
+ *
+ *  @param[out] gx       Horizontal gradient buffer.
+ *  @param      gx_dim   Horizontal gradient row dimension in bytes.
+ *  @param[out] gy       Vertical gradient buffer.
+ *  @param      gy_dim   Vertical gradient row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_sobel_3x3_grad_u8_s16(int16_t *restrict gx, int gx_dim,
+                                  int16_t *restrict gy, int gy_dim,
+                                  const uint8_t *restrict src, int src_dim,
+                                  int width, int height);
+
 /**
  *  3x3 gaussian smoothing.
  *  Computes convolution with the mask [1 2 1; 2 4 2; 1 2 1].
@@ -348,6 +495,604 @@ rapp_filter_highpass_3x3_abs_u8(uint8_t *restrict dst, int dst_dim,
                                 const uint8_t *restrict src, int src_dim,
                                 int width, int height);
 
+/**
+ *  1x2 horizontal difference, full precision.
+ *  Computes the convolution with the mask [1 -1],
+ *  without bias or scaling. The result is exact, in the range [-255, 255].
+ *
+ *  @param[out] dst      Destination buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_diff_1x2_horz_u8_s16(int16_t *restrict dst, int dst_dim,
+                                 const uint8_t *restrict src, int src_dim,
+                                 int width, int height);
+
+/**
+ *  2x1 vertical difference, full precision.
+ *  Computes the convolution with the mask [1; -1],
+ *  without bias or scaling. The result is exact, in the range [-255, 255].
+ *
+ *  @param[out] dst      Destination buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_diff_2x1_vert_u8_s16(int16_t *restrict dst, int dst_dim,
+                                 const uint8_t *restrict src, int src_dim,
+                                 int width, int height);
+
+/**
+ *  3x3 horizontal Sobel gradient, full precision.
+ *  Computes the convolution with the mask [1 0 -1; 2 0 -2; 1 0 -1],
+ *  without bias or scaling. The result is exact, in the range [-1020, 1020].
+ *
+ *  @param[out] dst      Destination buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_sobel_3x3_horz_u8_s16(int16_t *restrict dst, int dst_dim,
+                                  const uint8_t *restrict src, int src_dim,
+                                  int width, int height);
+
+/**
+ *  3x3 vertical Sobel gradient, full precision.
+ *  Computes the convolution with the mask [1 2 1; 0 0 0; -1 -2 -1],
+ *  without bias or scaling. The result is exact, in the range [-1020, 1020].
+ *
+ *  @param[out] dst      Destination buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_sobel_3x3_vert_u8_s16(int16_t *restrict dst, int dst_dim,
+                                  const uint8_t *restrict src, int src_dim,
+                                  int width, int height);
+
+/**
+ *  3x3 laplacian, full precision.
+ *  Computes the convolution with the mask [0 -1 0; -1 4 -1; 0 -1 0],
+ *  without bias or scaling. The result is exact, in the range [-1020, 1020].
+ *
+ *  @param[out] dst      Destination buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_laplace_3x3_u8_s16(int16_t *restrict dst, int dst_dim,
+                               const uint8_t *restrict src, int src_dim,
+                               int width, int height);
+
+/**
+ *  3x3 highpass filter, full precision.
+ *  Computes the convolution with the mask [-1 -1 -1; -1 8 -1; -1 -1 -1],
+ *  without bias or scaling. The result is exact, in the range [-2040, 2040].
+ *
+ *  @param[out] dst      Destination buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_highpass_3x3_u8_s16(int16_t *restrict dst, int dst_dim,
+                                const uint8_t *restrict src, int src_dim,
+                                int width, int height);
+
+/**
+ *  General 2D convolution with a user-supplied kernel.
+ *  Computes (sum(kern*src) + (1 << shift) / 2) >> shift, saturated
+ *  to the range [0, 0xff]. The result is exact.
+ *
+ *  @param[out] dst          Destination pixel buffer.
+ *  @param      dst_dim      Destination buffer row dimension in bytes.
+ *  @param[in]  src          Source pixel buffer.
+ *  @param      src_dim      Source buffer row dimension in bytes.
+ *  @param      width        Image width in pixels.
+ *  @param      height       Image height in pixels.
+ *  @param[in]  kern         Kernel coefficients in row-major order.
+ *  @param      kern_width   Kernel width, an odd number in the range [1, 15].
+ *  @param      kern_height  Kernel height, an odd number in the range [1, 15].
+ *  @param      shift        Right shift of the result, in the range [0, 15].
+ *  @return                  A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_conv_u8(uint8_t *restrict dst, int dst_dim,
+                    const uint8_t *restrict src, int src_dim,
+                    int width, int height,
+                    const int8_t *kern, int kern_width, int kern_height,
+                    int shift);
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_filter_sep_u8().
+ *
+ *  @param width  The image width in pixels.
+ *  @return       The minimum buffer size in bytes,
+ *                or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_filter_sep_worksize_u8(int width);
+
+/**
+ *  Separable convolution with user-supplied kernels.
+ *  The vertical kernel is applied first, and the intermediate result is
+ *  scaled by yshift, rounded and saturated to 8 bits as in
+ *  rapp_filter_conv_u8(). The horizontal kernel is then applied to the
+ *  intermediate result in the same way, using xshift. The result is exact
+ *  with respect to the 8-bit intermediate.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param[in]  xkern    Horizontal kernel coefficients.
+ *  @param      xlen     Horizontal kernel size, an odd number in [1, 15].
+ *  @param      xshift   Right shift of the horizontal pass, in [0, 15].
+ *  @param[in]  ykern    Vertical kernel coefficients.
+ *  @param      ylen     Vertical kernel size, an odd number in [1, 15].
+ *  @param      yshift   Right shift of the vertical pass, in [0, 15].
+ *  @param      work     Working buffer of at least
+ *                       rapp_filter_sep_worksize_u8() bytes,
+ *                       aligned on #rapp_alignment boundaries.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_sep_u8(uint8_t *restrict dst, int dst_dim,
+                   const uint8_t *restrict src, int src_dim,
+                   int width, int height,
+                   const int8_t *xkern, int xlen, int xshift,
+                   const int8_t *ykern, int ylen, int yshift,
+                   void *restrict work);
+
+/**
+ *  Compute the padding needed by rapp_filter_gauss_u8().
+ *  The source image must be padded with this number of rows above
+ *  and below, and with rapp_align() of this number of bytes to the
+ *  left and right.
+ *
+ *  @param sigma  The standard deviation in units of 1/16 pixel,
+ *                in the range [16, 320].
+ *  @return       The padding in pixels, or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_filter_gauss_padding_u8(int sigma);
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_filter_gauss_u8().
+ *
+ *  @param width   The image width in pixels.
+ *  @param height  The image height in pixels.
+ *  @param sigma   The standard deviation in units of 1/16 pixel,
+ *                 in the range [16, 320].
+ *  @return        The minimum buffer size in bytes,
+ *                 or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_filter_gauss_worksize_u8(int width, int height, int sigma);
+
+/**
+ *  Gaussian smoothing with a variable standard deviation.
+ *  The error compared to an exact Gaussian is at most a few ulp
+ *  for natural images. Step edges give larger errors for sigma
+ *  values where the box approximation is used.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param      sigma    The standard deviation in units of 1/16 pixel,
+ *                       in the range [16, 320].
+ *  @param      work     Working buffer of at least
+ *                       rapp_filter_gauss_worksize_u8() bytes,
+ *                       aligned on #rapp_alignment boundaries.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_gauss_u8(uint8_t *restrict dst, int dst_dim,
+                     const uint8_t *restrict src, int src_dim,
+                     int width, int height, int sigma,
+                     void *restrict work);
+
+/**
+ *  3x3 median filter.
+ *  The result is exact.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_median_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                          const uint8_t *restrict src, int src_dim,
+                          int width, int height);
+
+/**
+ *  5x5 median filter.
+ *  The result is exact.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_median_5x5_u8(uint8_t *restrict dst, int dst_dim,
+                          const uint8_t *restrict src, int src_dim,
+                          int width, int height);
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_filter_rank_u8().
+ *
+ *  @param width   The image width in pixels.
+ *  @param radius  The neighbourhood radius, in the range [1, 127].
+ *  @return        The minimum buffer size in bytes,
+ *                 or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_filter_rank_worksize_u8(int width, int radius);
+
+/**
+ *  Rank filter over a square neighbourhood.
+ *  The neighbourhood of each pixel is the square of (2*radius + 1)^2
+ *  pixels centered on it. The result is the neighbourhood pixel value of
+ *  the given rank, where rank 0 gives the minimum value, rank
+ *  2*radius*(radius + 1) gives the median value and rank
+ *  (2*radius + 1)^2 - 1 gives the maximum value. The result is exact.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param      radius   The neighbourhood radius, in the range [1, 127].
+ *  @param      rank     The rank of the result value,
+ *                       in the range [0, (2*radius + 1)^2 - 1].
+ *  @param      work     Working buffer of at least
+ *                       rapp_filter_rank_worksize_u8() bytes,
+ *                       aligned on #rapp_alignment boundaries.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_rank_u8(uint8_t *restrict dst, int dst_dim,
+                    const uint8_t *restrict src, int src_dim,
+                    int width, int height, int radius, int rank,
+                    void *restrict work);
+
+/**
+ *  3x3 Gaussian filter, 16-bit.
+ *  The result is exact and rounded.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_gauss_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                          const uint16_t *restrict src, int src_dim,
+                          int width, int height);
+
+/**
+ *  3x3 median filter, 16-bit.
+ *  The result is exact.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_median_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                           const uint16_t *restrict src, int src_dim,
+                           int width, int height);
+
+/**
+ *  3x3 horizontal Sobel gradient, 16-bit.
+ *  Computes the convolution with the mask [1 0 -1; 2 0 -2; 1 0 -1],
+ *  scaled by 1/8 and biased by 0x8000.
+ *  The result is exact, with ties rounded down.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_sobel_3x3_horz_u16(uint16_t *restrict dst, int dst_dim,
+                               const uint16_t *restrict src, int src_dim,
+                               int width, int height);
+
+/**
+ *  3x3 horizontal Sobel gradient, 16-bit, absolute value.
+ *  Computes the absolute value of the horizontal Sobel gradient,
+ *  scaled by 1/4.
+ *  The result is exact, with ties rounded down.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_sobel_3x3_horz_abs_u16(uint16_t *restrict dst, int dst_dim,
+                                   const uint16_t *restrict src, int src_dim,
+                                   int width, int height);
+
+/**
+ *  3x3 vertical Sobel gradient, 16-bit.
+ *  Computes the convolution with the mask [1 2 1; 0 0 0; -1 -2 -1],
+ *  scaled by 1/8 and biased by 0x8000.
+ *  The result is exact, with ties rounded down.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_sobel_3x3_vert_u16(uint16_t *restrict dst, int dst_dim,
+                               const uint16_t *restrict src, int src_dim,
+                               int width, int height);
+
+/**
+ *  3x3 vertical Sobel gradient, 16-bit, absolute value.
+ *  Computes the absolute value of the vertical Sobel gradient,
+ *  scaled by 1/4.
+ *  The result is exact, with ties rounded down.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_sobel_3x3_vert_abs_u16(uint16_t *restrict dst, int dst_dim,
+                                   const uint16_t *restrict src, int src_dim,
+                                   int width, int height);
+
+/**
+ *  3x3 laplacian, 16-bit.
+ *  Computes the convolution with the mask [0 -1 0; -1 4 -1; 0 -1 0],
+ *  scaled by 1/8 and biased by 0x8000.
+ *  The result is exact, with ties rounded down.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_laplace_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                            const uint16_t *restrict src, int src_dim,
+                            int width, int height);
+
+/**
+ *  3x3 laplacian, 16-bit, absolute value.
+ *  Computes the absolute value of the laplacian,
+ *  scaled by 1/4.
+ *  The result is exact, with ties rounded down.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_laplace_3x3_abs_u16(uint16_t *restrict dst, int dst_dim,
+                                const uint16_t *restrict src, int src_dim,
+                                int width, int height);
+
+/**
+ *  3x3 highpass filter, 16-bit.
+ *  Computes the convolution with the mask [-1 -1 -1; -1 8 -1; -1 -1 -1],
+ *  scaled by 1/16 and biased by 0x8000.
+ *  The result is exact, with ties rounded down.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_highpass_3x3_u16(uint16_t *restrict dst, int dst_dim,
+                             const uint16_t *restrict src, int src_dim,
+                             int width, int height);
+
+/**
+ *  3x3 highpass filter, 16-bit, absolute value.
+ *  Computes the absolute value of the highpass filter,
+ *  scaled by 1/8.
+ *  The result is exact, with ties rounded down.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_highpass_3x3_abs_u16(uint16_t *restrict dst, int dst_dim,
+                                 const uint16_t *restrict src, int src_dim,
+                                 int width, int height);
+
+/**
+ *  3x3 census transform.
+ *  Bit k of the code is set if neighbour k in raster order,
+ *  skipping the center pixel, is less than the center pixel.
+ *
+ *  @param[out] dst      Destination code buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_census_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                          const uint8_t *restrict src, int src_dim,
+                          int width, int height);
+
+/**
+ *  5x5 census transform.
+ *  Bit k of the code is set if neighbour k in raster order,
+ *  skipping the center pixel, is less than the center pixel.
+ *  The eight most significant bits are zero.
+ *
+ *  @param[out] dst      Destination code buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_census_5x5_u8_u32(uint32_t *restrict dst, int dst_dim,
+                              const uint8_t *restrict src, int src_dim,
+                              int width, int height);
+
+/**
+ *  3x3 local binary patterns.
+ *  Bit k of the code is set if neighbour k, counted clockwise
+ *  from the top-left corner, is greater than or equal to the
+ *  center pixel.
+ *
+ *  @param[out] dst      Destination code buffer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_lbp_3x3_u8(uint8_t *restrict dst, int dst_dim,
+                       const uint8_t *restrict src, int src_dim,
+                       int width, int height);
+
+/**
+ *  Hamming-distance cost volume of 8-bit codes.
+ *  The cost image for disparity d starts at dst + d*height*dst_dim,
+ *  and the cost of pixel x is the number of differing bits between
+ *  src1[x] and src2[x - d], or 8 if x < d.
+ *
+ *  @param[out] dst          Destination cost volume buffer,
+ *                           of disparities*height rows.
+ *  @param      dst_dim      Destination buffer row dimension in bytes.
+ *  @param[in]  src1         Left code buffer.
+ *  @param      src1_dim     Left code buffer row dimension in bytes.
+ *  @param[in]  src2         Right code buffer.
+ *  @param      src2_dim     Right code buffer row dimension in bytes.
+ *  @param      width        Image width in pixels.
+ *  @param      height       Image height in pixels.
+ *  @param      disparities  The number of disparities, at least one.
+ *                           The size of the cost volume in bytes
+ *                           must fit in an int.
+ *  @return                  A negative error code on error,
+ *                           zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_census_cost_u8(uint8_t *restrict dst, int dst_dim,
+                           const uint8_t *restrict src1, int src1_dim,
+                           const uint8_t *restrict src2, int src2_dim,
+                           int width, int height, int disparities);
+
+/**
+ *  Hamming-distance cost volume of 32-bit codes.
+ *  The cost image for disparity d starts at dst + d*height*dst_dim,
+ *  and the cost of pixel x is the number of differing bits between
+ *  src1[x] and src2[x - d], or 32 if x < d.
+ *
+ *  @param[out] dst          Destination cost volume buffer,
+ *                           of disparities*height rows.
+ *  @param      dst_dim      Destination buffer row dimension in bytes.
+ *  @param[in]  src1         Left code buffer.
+ *  @param      src1_dim     Left code buffer row dimension in bytes.
+ *  @param[in]  src2         Right code buffer.
+ *  @param      src2_dim     Right code buffer row dimension in bytes.
+ *  @param      width        Image width in pixels.
+ *  @param      height       Image height in pixels.
+ *  @param      disparities  The number of disparities, at least one.
+ *                           The size of the cost volume in bytes
+ *                           must fit in an int.
+ *  @return                  A negative error code on error,
+ *                           zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_filter_census_cost_u32_u8(uint8_t *restrict dst, int dst_dim,
+                               const uint32_t *restrict src1, int src1_dim,
+                               const uint32_t *restrict src2, int src2_dim,
+                               int width, int height, int disparities);
+
 #ifdef __cplusplus
 };
 #endif
@@ -32,7 +32,7 @@
 
 /**
  *  @defgroup grp_integral Integral Images
- *  @brief Integral image calculations for binary and 8-bit images.
+ *  @brief Integral image calculations for binary, 8-bit and 16-bit images.
  *
  *  The functions may read data up to the nearest alignment boundary,
  *  so if those pixels are not properly cleared the output may be invalid.
@@ -144,6 +144,27 @@ rapp_integral_sum_u8_u32(uint32_t *restrict dst, int dst_dim,
                          const uint8_t *restrict src, int src_dim,
                          int width, int height);
 
+/**
+ *  Integral image.
+ *  Compute the 32-bit integral image from a 16-bit source.
+ *  The result wraps around if the sum exceeds 2<sup>32</sup> &ndash; 1,
+ *  which may happen for images larger than 2<sup>16</sup> pixels.
+ *  Differences of integral values over rectangles of at most
+ *  2<sup>16</sup> pixels are still exact with unsigned arithmetic.
+ *
+ *  @param[out] dst       Integral image buffer.
+ *  @param      dst_dim   Row dimension of the integral image.
+ *  @param[in]  src       Source image buffer.
+ *  @param      src_dim   Row dimension of the source image.
+ *  @param      width     Image width in pixels.
+ *  @param      height    Image height in pixels.
+ *  @return               A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_integral_sum_u16_u32(uint32_t *restrict dst, int dst_dim,
+                          const uint16_t *restrict src, int src_dim,
+                          int width, int height);
+
 #ifdef __cplusplus
 };
 #endif
@@ -0,0 +1,180 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_match.h
+ *  @brief  RAPP template matching.
+ */
+
+/**
+ *  @defgroup grp_match Template Matching
+ *  @brief Locating a template image in a larger image.
+ *
+ *  @section Overview
+ *  The function rapp_match_template_u8() slides a small 8-bit template
+ *  image over a larger 8-bit source image, and finds the position where
+ *  the template matches best. All positions where the template lies
+ *  completely inside the source image are candidates. The position
+ *  (x, y) is that of the upper-left template pixel in the source image.
+ *  Ties are resolved in raster order.
+ *
+ *  @section Modes
+ *  The match is measured with one of three modes:
+ *  - #RAPP_MATCH_SAD: The sum of absolute differences. Lower is better.
+ *  - #RAPP_MATCH_SSD: The sum of squared differences. Lower is better.
+ *  - #RAPP_MATCH_NCC: The normalized cross-correlation, i.e. the
+ *    correlation coefficient of the template and the source window,
+ *    in units of 1/65536 in the range [-65536, 65536]. Higher is
+ *    better. It is insensitive to changes in brightness and contrast.
+ *    A window or template with all pixels equal has the score zero.
+ *
+ *  @section Performance
+ *  The SAD and SSD of a candidate are computed with vector operations,
+ *  also for misaligned source windows, and the computation is
+ *  terminated as soon as the partial sum exceeds the best one so far.
+ *  In the NCC mode, the sums and the squared sums of the source
+ *  windows are taken from integral images, so that normalization costs
+ *  a constant time per position, and only the correlation term is
+ *  computed with vector multiply-accumulate operations. No floating
+ *  point is used.
+ *
+ *  The search can be pruned with a coarse-to-fine search. The source
+ *  and template images are then reduced by a factor two the given
+ *  number of times with 2x2 averaging, as with rapp_reduce_2x2_u8().
+ *  All positions are only searched at the coarsest level, and at each
+ *  finer level only the positions within two pixels of the doubled
+ *  best position are searched. This is much faster, but may miss the
+ *  best position if the template has significant detail that
+ *  disappears in the reduction.
+ *
+ *  @section Usage
+ *  The function needs a user-allocated working buffer. The minimum size
+ *  in bytes of the buffer is given by rapp_match_template_worksize_u8(),
+ *  and it must be aligned on #rapp_alignment boundaries.
+ *
+ *  <p>@ref filter "Next section: Spatial Filtering"</p>
+ *
+ *  @{
+ */
+
+#ifndef RAPP_MATCH_H
+#define RAPP_MATCH_H
+
+#include <stdint.h>
+#include "rapp_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Match with the sum of absolute differences.
+ */
+#define RAPP_MATCH_SAD 0
+
+/**
+ *  Match with the sum of squared differences.
+ */
+#define RAPP_MATCH_SSD 1
+
+/**
+ *  Match with the normalized cross-correlation.
+ */
+#define RAPP_MATCH_NCC 2
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_match_template_u8().
+ *
+ *  @param width       The source image width in pixels.
+ *  @param height      The source image height in pixels.
+ *  @param tpl_width   The template width in pixels, 1-128.
+ *  @param tpl_height  The template height in pixels, 1-128.
+ *  @param mode        The match mode, one of the RAPP_MATCH_* constants.
+ *  @param levels      The number of coarse levels, 0-3.
+ *  @return            The minimum buffer size in bytes,
+ *                     or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_match_template_worksize_u8(int width, int height,
+                                int tpl_width, int tpl_height,
+                                int mode, int levels);
+
+/**
+ *  Template matching.
+ *  Find the position where the template matches the source image best.
+ *  The template must not be larger than the source image. If levels is
+ *  nonzero, the template width and height reduced by 2^levels must both
+ *  be at least 4. The padding of the images is ignored.
+ *  Image buffers and dimensions must be aligned.
+ *
+ *  @param[in]  src         Source image pixel buffer.
+ *  @param      src_dim     Row dimension of the source image.
+ *  @param      width       The source image width in pixels.
+ *  @param      height      The source image height in pixels.
+ *  @param[in]  tpl         Template image pixel buffer.
+ *  @param      tpl_dim     Row dimension of the template image.
+ *  @param      tpl_width   The template width in pixels, 1-128.
+ *  @param      tpl_height  The template height in pixels, 1-128.
+ *  @param      mode        The match mode, one of the RAPP_MATCH_*
+ *                          constants.
+ *  @param      levels      The number of coarse levels, 0-3.
+ *  @param[out] pos         The x and y coordinates of the best position.
+ *  @param[out] score       The score of the best position.
+ *  @param      work        Working buffer of at least
+ *                          rapp_match_template_worksize_u8() bytes,
+ *                          aligned on #rapp_alignment boundaries.
+ *  @return                 A negative error code on error,
+ *                          zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_match_template_u8(const uint8_t *restrict src, int src_dim,
+                       int width, int height,
+                       const uint8_t *restrict tpl, int tpl_dim,
+                       int tpl_width, int tpl_height,
+                       int mode, int levels, int pos[2],
+                       int32_t *score, void *restrict work);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RAPP_MATCH_H */
+/** @} */
@@ -45,7 +45,7 @@
  *
  *  All images must be aligned.
  *
- *  <p>@ref filter "Next section: Spatial Filtering"</p>
+ *  <p>@ref grp_motion "Next section: Motion Estimation"</p>
  *
  *  @{
  */
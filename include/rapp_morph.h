@@ -0,0 +1,226 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_morph.h
+ *  @brief  RAPP 8-bit morphology.
+ */
+
+/**
+ *  @defgroup grp_morph 8-bit Morphology
+ *
+ *  @section Overview
+ *  These functions perform grayscale erosion, dilation, opening,
+ *  closing and top-hat transforms on 8-bit images using rectangular
+ *  structuring elements (SEs for short) of any size. Erosion replaces
+ *  each pixel with the minimum value under the SE, and dilation with
+ *  the maximum value. For an SE of size w x h, the erosion at position
+ *  (x, y) covers the pixels
+ *
+ *    x - w / 2 <= x' <= x + (w - 1) / 2,
+ *    y - h / 2 <= y' <= y + (h - 1) / 2,
+ *
+ *  and dilation uses the reflected SE. This is the same convention as
+ *  for the @ref grp_binmorph "binary morphology" functions, and it
+ *  only matters for even SE sizes. The opening is the dilation of the
+ *  erosion, the closing is the erosion of the dilation, and the
+ *  top-hat transform is the difference between the source image and
+ *  its opening. A black top-hat transform can be computed with
+ *  rapp_pixop_suba_u8() on the closing.
+ *
+ *  @section Performance
+ *  The rectangles are separated into one horizontal and one vertical
+ *  line, and each line is computed with the van Herk/Gil-Werman
+ *  algorithm. It uses three comparisons per pixel and direction
+ *  regardless of the size of the SE, so the execution time is
+ *  essentially constant with respect to the SE size.
+ *
+ *  @section Usage
+ *  All functions need a user-allocated working buffer.
+ *  The minimum size in bytes of the buffer is given by
+ *  rapp_morph_worksize_u8(), and must be aligned on #rapp_alignment
+ *  boundaries. As with most other RAPP functions, the images must
+ *  also be aligned.
+ *
+ *  @section Padding
+ *  The user is responsible for @ref padding "padding" the source buffer.
+ *  Erosion and dilation need wrect / 2 pixels of padding horizontally
+ *  and hrect / 2 pixels vertically, where the sizes are rounded
+ *  <em>down</em> to the nearest integer. The horizontal padding is read
+ *  in whole alignment units, so the source buffer must be allocated
+ *  with rapp_align(wrect / 2) bytes of padding on each side of the rows.
+ *  Opening, closing and top-hat need twice the padding of erosion and
+ *  dilation in both directions. The padding pixels are treated as
+ *  ordinary image data, so a clamped padding gives the usual flat
+ *  image border behaviour.
+ *
+ *  <p>@ref grp_binmorph "Next section: Binary Morphology"</p>
+ *
+ *  @{
+ */
+
+#ifndef RAPP_MORPH_H
+#define RAPP_MORPH_H
+
+#include <stdint.h>
+#include "rapp_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by the
+ *  8-bit morphological functions.
+ *
+ *  @param width  The image width in pixels.
+ *  @param height The image height in pixels.
+ *  @param wrect  The width of the SE rectangle.
+ *  @param hrect  The height of the SE rectangle.
+ *  @return       The minimum buffer size in bytes,
+ *                or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_morph_worksize_u8(int width, int height, int wrect, int hrect);
+
+/**
+ *  Erosion with a rectangular structuring element.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension.
+ *  @param[in]  src      Source pixel buffer with padding.
+ *  @param      src_dim  Source buffer row dimension.
+ *  @param      width    The image width in pixels.
+ *  @param      height   The image height in pixels.
+ *  @param      wrect    The width of the SE rectangle, at least 1.
+ *  @param      hrect    The height of the SE rectangle, at least 1.
+ *  @param      work     Internal working buffer.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_morph_erode_rect_u8(uint8_t *restrict dst, int dst_dim,
+                         const uint8_t *restrict src, int src_dim,
+                         int width, int height, int wrect, int hrect,
+                         void *restrict work);
+
+/**
+ *  Dilation with a rectangular structuring element.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension.
+ *  @param[in]  src      Source pixel buffer with padding.
+ *  @param      src_dim  Source buffer row dimension.
+ *  @param      width    The image width in pixels.
+ *  @param      height   The image height in pixels.
+ *  @param      wrect    The width of the SE rectangle, at least 1.
+ *  @param      hrect    The height of the SE rectangle, at least 1.
+ *  @param      work     Internal working buffer.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_morph_dilate_rect_u8(uint8_t *restrict dst, int dst_dim,
+                          const uint8_t *restrict src, int src_dim,
+                          int width, int height, int wrect, int hrect,
+                          void *restrict work);
+
+/**
+ *  Opening with a rectangular structuring element.
+ *  The source buffer needs twice the padding of the erosion.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension.
+ *  @param[in]  src      Source pixel buffer with padding.
+ *  @param      src_dim  Source buffer row dimension.
+ *  @param      width    The image width in pixels.
+ *  @param      height   The image height in pixels.
+ *  @param      wrect    The width of the SE rectangle, at least 1.
+ *  @param      hrect    The height of the SE rectangle, at least 1.
+ *  @param      work     Internal working buffer.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_morph_open_rect_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height, int wrect, int hrect,
+                        void *restrict work);
+
+/**
+ *  Closing with a rectangular structuring element.
+ *  The source buffer needs twice the padding of the dilation.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension.
+ *  @param[in]  src      Source pixel buffer with padding.
+ *  @param      src_dim  Source buffer row dimension.
+ *  @param      width    The image width in pixels.
+ *  @param      height   The image height in pixels.
+ *  @param      wrect    The width of the SE rectangle, at least 1.
+ *  @param      hrect    The height of the SE rectangle, at least 1.
+ *  @param      work     Internal working buffer.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_morph_close_rect_u8(uint8_t *restrict dst, int dst_dim,
+                         const uint8_t *restrict src, int src_dim,
+                         int width, int height, int wrect, int hrect,
+                         void *restrict work);
+
+/**
+ *  Top-hat transform with a rectangular structuring element.
+ *  Computes the difference between the source image and its opening.
+ *  The source buffer needs twice the padding of the erosion.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Destination buffer row dimension.
+ *  @param[in]  src      Source pixel buffer with padding.
+ *  @param      src_dim  Source buffer row dimension.
+ *  @param      width    The image width in pixels.
+ *  @param      height   The image height in pixels.
+ *  @param      wrect    The width of the SE rectangle, at least 1.
+ *  @param      hrect    The height of the SE rectangle, at least 1.
+ *  @param      work     Internal working buffer.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_morph_tophat_rect_u8(uint8_t *restrict dst, int dst_dim,
+                          const uint8_t *restrict src, int src_dim,
+                          int width, int height, int wrect, int hrect,
+                          void *restrict work);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RAPP_MORPH_H */
+/** @} */
@@ -0,0 +1,155 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_motion.h
+ *  @brief  RAPP motion estimation.
+ */
+
+/**
+ *  @defgroup grp_motion Motion Estimation
+ *  @brief Block-matching motion estimation.
+ *
+ *  @section Overview
+ *  The function rapp_motion_blockmatch_u8() estimates the motion between
+ *  two 8-bit images, e.g. two consecutive frames of a video sequence.
+ *  The current image is divided into square blocks, and for each block
+ *  the displacement into the reference image with the smallest sum of
+ *  absolute differences (SAD) is searched for. Only whole blocks are
+ *  processed, so any partial blocks at the right and bottom edges of
+ *  the image are ignored. A displaced block must lie completely inside
+ *  the reference image.
+ *
+ *  The result is a motion vector field with one (dx, dy) pair per
+ *  block, stored in row-major block order, and the SAD of each block at
+ *  its motion vector. A block at (x, y) in the current image matches
+ *  the block at (x + dx, y + dy) in the reference image.
+ *
+ *  @section Search
+ *  The displacements are searched with a diamond search. It starts at
+ *  the best of a set of predicted vectors: the zero vector, and the
+ *  vectors of the left and upper neighbour blocks. From there, the
+ *  large diamond pattern of eight points around the current best
+ *  vector is evaluated until the centre is best, followed by one step
+ *  of the small diamond pattern of four points. The search stops as
+ *  soon as a perfect match is found.
+ *
+ *  The diamond search can be trapped in a local minimum for large or
+ *  noisy displacements. For such sequences, a coarse-to-fine search
+ *  can be used instead. The images are then reduced by a factor two
+ *  the given number of times with 2x2 averaging, as with
+ *  rapp_reduce_2x2_u8(). The search starts at the coarsest level with
+ *  a correspondingly smaller block size and range, and the doubled
+ *  vector of each block is used as an additional prediction at the
+ *  next finer level.
+ *
+ *  @section Performance
+ *  The SAD of a block is computed with vector operations, also for
+ *  misaligned reference blocks, and the computation of a candidate is
+ *  terminated as soon as its partial sum exceeds the best one so far.
+ *  The number of candidates evaluated depends on the image content.
+ *  The worst case is a full search of all (2*range + 1)^2 vectors,
+ *  but a block with small motion typically needs a few tens at most.
+ *
+ *  @section Usage
+ *  The function needs a user-allocated working buffer. The minimum size
+ *  in bytes of the buffer is given by rapp_motion_blockmatch_worksize_u8(),
+ *  and it must be aligned on #rapp_alignment boundaries.
+ *
+ *  <p>@ref grp_match "Next section: Template Matching"</p>
+ *
+ *  @{
+ */
+
+#ifndef RAPP_MOTION_H
+#define RAPP_MOTION_H
+
+#include <stdint.h>
+#include "rapp_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_motion_blockmatch_u8().
+ *
+ *  @param width   The image width in pixels.
+ *  @param height  The image height in pixels.
+ *  @param block   The block size in pixels, 4-64.
+ *  @param levels  The number of coarse levels, 0-4.
+ *  @return        The minimum buffer size in bytes,
+ *                 or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_motion_blockmatch_worksize_u8(int width, int height,
+                                   int block, int levels);
+
+/**
+ *  Block-matching motion estimation.
+ *  The block size must be divisible by 2^levels, and the block size
+ *  at the coarsest level must be at least 4. The vector buffer holds
+ *  2*(width/block)*(height/block) elements and the cost buffer
+ *  (width/block)*(height/block) elements.
+ *
+ *  @param[out] vec      The motion vectors, as (dx, dy) pairs.
+ *  @param[out] cost     The SAD of each block at its motion vector.
+ *  @param[in]  cur      Current image pixel buffer.
+ *  @param      cur_dim  Current image row dimension.
+ *  @param[in]  ref      Reference image pixel buffer.
+ *  @param      ref_dim  Reference image row dimension.
+ *  @param      width    The image width in pixels.
+ *  @param      height   The image height in pixels.
+ *  @param      block    The block size in pixels, 4-64.
+ *  @param      range    The maximum displacement in pixels, 1-127.
+ *  @param      levels   The number of coarse levels, 0-4.
+ *  @param      work     Working buffer of at least
+ *                       rapp_motion_blockmatch_worksize_u8() bytes,
+ *                       aligned on #rapp_alignment boundaries.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_motion_blockmatch_u8(int8_t *restrict vec, uint32_t *restrict cost,
+                          const uint8_t *restrict cur, int cur_dim,
+                          const uint8_t *restrict ref, int ref_dim,
+                          int width, int height, int block, int range,
+                          int levels, void *restrict work);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RAPP_MOTION_H */
+/** @} */
@@ -32,11 +32,30 @@
 
 /**
  *  @defgroup grp_pixop Pixelwise Arithmetic Operations
- *  @brief Pixelwise arithmetic operations on 8-bit images.
+ *  @brief Pixelwise arithmetic operations on 8-bit and 16-bit images.
  *
  *  These functions operate in-place, i.e. the first operand is also
  *  the destination. All images must be aligned.
  *
+ *  @section pixop_u16 16-bit Images
+ *  The functions with the suffix _u16 operate on 16-bit images, e.g.
+ *  from 10 to 16-bit thermal and HDR sensors. The pixel values are
+ *  unsigned and use the full 16-bit range, and the buffer row dimensions
+ *  are given in bytes as for 8-bit images. The function
+ *  rapp_pixop_lut_u16_u8() maps a 16-bit image to an 8-bit image.
+ *
+ *  @section pixop_equalize Histogram Equalization
+ *  The function rapp_pixop_equalize_u8() maps an 8-bit image through
+ *  its cumulative histogram, spreading the pixel values over the full
+ *  range. The function rapp_pixop_clahe_u8() performs contrast-limited
+ *  adaptive histogram equalization (CLAHE). The image is divided into
+ *  tiles, and each tile gets its own equalization lookup table from a
+ *  histogram clipped at a multiple of the average bin count. The clipped
+ *  counts are redistributed over all bins. Each pixel is then mapped
+ *  through the tables of the four nearest tile centers, bilinearly
+ *  interpolated. The size of the working buffer is given by
+ *  rapp_pixop_clahe_worksize_u8().
+ *
  *  <p>@ref grp_thresh "Next section: Thresholding"</p>
  *
  *  @{
@@ -363,6 +382,136 @@ rapp_pixop_norm_u8(uint8_t *restrict dst, int dst_dim,
                    const uint8_t *restrict src, int src_dim,
                    int width, int height);
 
+/**
+ *  Saturated addition, 16-bit.
+ *  Computes dst[i] += src[i]. The result is saturated to 0xffff.
+ *
+ *  @param[in,out]  dst      Destination buffer pointer.
+ *  @param          dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]      src      Source buffer pointer.
+ *  @param          src_dim  Source buffer row dimension in bytes.
+ *  @param          width    Image width in pixels.
+ *  @param          height   Image height in pixels.
+ *  @return                  A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_pixop_add_u16(uint16_t *restrict dst, int dst_dim,
+                   const uint16_t *restrict src, int src_dim,
+                   int width, int height);
+
+/**
+ *  Saturated subtraction, 16-bit.
+ *  Computes dst[i] -= src[i]. The result is saturated to zero.
+ *
+ *  @param[in,out]  dst      Destination buffer pointer.
+ *  @param          dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]      src      Source buffer pointer.
+ *  @param          src_dim  Source buffer row dimension in bytes.
+ *  @param          width    Image width in pixels.
+ *  @param          height   Image height in pixels.
+ *  @return                  A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_pixop_sub_u16(uint16_t *restrict dst, int dst_dim,
+                   const uint16_t *restrict src, int src_dim,
+                   int width, int height);
+
+/**
+ *  Absolute-value subtraction, 16-bit.
+ *  Computes dst[i] = abs(dst[i] - src[i]).
+ *
+ *  @param[in,out]  dst      Destination buffer pointer.
+ *  @param          dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]      src      Source buffer pointer.
+ *  @param          src_dim  Source buffer row dimension in bytes.
+ *  @param          width    Image width in pixels.
+ *  @param          height   Image height in pixels.
+ *  @return                  A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_pixop_suba_u16(uint16_t *restrict dst, int dst_dim,
+                    const uint16_t *restrict src, int src_dim,
+                    int width, int height);
+
+/**
+ *  Shifted lookup-table transformation from 16 to 8 bits.
+ *  Computes dst[i] = lut[src[i] >> shift]. With a shift value of 8 and
+ *  the identity table this keeps the eight most significant bits, and
+ *  with a smaller shift value the table can also clip the range or
+ *  apply a tone-mapping curve.
+ *
+ *  @param[out] dst      Destination buffer pointer.
+ *  @param      dst_dim  Destination buffer row dimension in bytes.
+ *  @param[in]  src      Source buffer pointer.
+ *  @param      src_dim  Source buffer row dimension in bytes.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param      lut      The 8-bit lookup table to use, with at least
+ *                       (0xffff >> shift) + 1 bytes. It may be misaligned.
+ *  @param      shift    The right-shift value, in the range 0 &ndash; 15.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_pixop_lut_u16_u8(uint8_t *restrict dst, int dst_dim,
+                      const uint16_t *restrict src, int src_dim,
+                      int width, int height,
+                      const uint8_t *restrict lut, int shift);
+
+/**
+ *  Histogram equalization.
+ *  Maps each pixel value v to the value
+ *  255*(cdf[v] - cdf[min])/(N - cdf[min]), rounded, where cdf[v] is the
+ *  number of pixels less than or equal to v, min is the minimum pixel
+ *  value and N is the number of pixels. A constant image is left
+ *  unchanged.
+ *
+ *  @param[in,out]  buf     Pixel buffer.
+ *  @param          dim     Row dimension in bytes of the pixel buffer.
+ *  @param          width   Image width in pixels.
+ *  @param          height  Image height in pixels.
+ *  @return                 A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_pixop_equalize_u8(uint8_t *buf, int dim, int width, int height);
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_pixop_clahe_u8().
+ *
+ *  @param width   The image width in pixels.
+ *  @param tiles   The number of tiles in each direction, in the
+ *                 range [1, 64].
+ *  @return        The minimum buffer size in bytes,
+ *                 or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_pixop_clahe_worksize_u8(int width, int tiles);
+
+/**
+ *  Contrast-limited adaptive histogram equalization.
+ *  The image is divided into tiles x tiles tiles of nearly equal size.
+ *  The histogram of each tile is clipped at clip/16 times the average
+ *  bin count, and the lookup table of the tile maps v to
+ *  255*cdf[v]/N, rounded. Between the tile centers the lookup tables
+ *  are bilinearly interpolated with 8-bit fixed-point weights.
+ *
+ *  @param[in,out]  buf     Pixel buffer.
+ *  @param          dim     Row dimension in bytes of the pixel buffer.
+ *  @param          width   Image width in pixels.
+ *  @param          height  Image height in pixels.
+ *  @param          tiles   The number of tiles in each direction, in the
+ *                          range [1, 64] and at most the width and height.
+ *  @param          clip    The clip limit in units of 1/16 of the average
+ *                          bin count, in the range [16, 4096].
+ *  @param          work    Working buffer of at least
+ *                          rapp_pixop_clahe_worksize_u8() bytes,
+ *                          aligned on #rapp_alignment boundaries.
+ *  @return                 A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_pixop_clahe_u8(uint8_t *restrict buf, int dim, int width, int height,
+                    int tiles, int clip, void *restrict work);
+
 #ifdef __cplusplus
 };
 #endif
@@ -35,7 +35,7 @@
  *  Perform 2x spatial reductions.
  *  All images must be aligned.
  *
- *  <p>@ref grp_expand "Next section: Spatial Expansion"</p>
+ *  <p>@ref grp_resize "Next section: Resizing"</p>
  */
 
 /**
@@ -113,6 +113,24 @@ rapp_reduce_2x2_u8(uint8_t *restrict dst, int dst_dim,
                    const uint8_t *restrict src, int src_dim,
                    int width, int height);
 
+/**
+ *  16-bit 2x2 reduction.
+ *  Downscaling to half size by averaging.
+ *  The size of the reduced image is width/2, height/2, rounded down.
+ *
+ *  @param[out]  dst      Destination pixel buffer.
+ *  @param       dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]   src      Source pixel buffer.
+ *  @param       src_dim  Row dimension in bytes of the source buffer.
+ *  @param       width    Source image width in pixels.
+ *  @param       height   Source image height in pixels.
+ *  @return               A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_reduce_2x2_u16(uint16_t *restrict dst, int dst_dim,
+                    const uint16_t *restrict src, int src_dim,
+                    int width, int height);
+
 #ifdef __cplusplus
 };
 #endif
@@ -0,0 +1,175 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_resize.h
+ *  @brief  RAPP 8-bit arbitrary-ratio resizing.
+ */
+
+/**
+ *  @defgroup grp_resize Resizing
+ *  @brief Arbitrary-ratio resizing of 8-bit images.
+ *
+ *  @section Overview
+ *  The function rapp_resize_u8() resamples an 8-bit image to any
+ *  destination size, both smaller and larger than the source image.
+ *  The source and destination sizes are given separately. The pixel
+ *  centers are aligned, i.e. the center of destination pixel x maps
+ *  to the source position (x + 1/2)*src_width/dst_width - 1/2, and
+ *  correspondingly in the vertical direction.
+ *
+ *  @section Modes
+ *  The source image is resampled with one of three modes:
+ *  - #RAPP_RESIZE_NEAREST: Nearest neighbour, i.e. the source pixel
+ *    that contains the mapped pixel center. The pixel values are
+ *    copied exactly.
+ *  - #RAPP_RESIZE_BILINEAR: Bilinear interpolation between the four
+ *    source pixels closest to the mapped pixel center. The pixels
+ *    outside the image are replicated from the border.
+ *  - #RAPP_RESIZE_AREA: The average of the source pixels covered by
+ *    the destination pixel, weighted by the covered area. It does not
+ *    alias when downscaling, unlike the other two modes. The source
+ *    image can be at most 16 times larger than the destination image
+ *    in each direction.
+ *
+ *  The interpolation weights are computed in fixed point with seven
+ *  fractional bits, separately for the horizontal and the vertical
+ *  direction, and the intermediate values are rounded to 8 bits.
+ *
+ *  @section Performance
+ *  The weights and the source positions are computed once per call
+ *  and stored in tables in the working buffer. The image is then
+ *  resampled with two passes for each destination row. The vertical
+ *  pass sums whole rows with vector operations, and the horizontal
+ *  pass gathers the source pixels from the position table. When the
+ *  height is reduced, the vertical pass runs first, directly on the
+ *  source rows. Otherwise the horizontal pass runs first, and each
+ *  resampled source row is kept in a small line cache for the next
+ *  destination rows. The horizontal pass is thus always done on the
+ *  smallest number of rows.
+ *
+ *  @section Usage
+ *  The function needs a user-allocated working buffer. The minimum size
+ *  in bytes of the buffer is given by rapp_resize_worksize_u8(), and it
+ *  must be aligned on #rapp_alignment boundaries. The images need no
+ *  padding.
+ *
+ *  <p>@ref grp_expand "Next section: Spatial Expansion"</p>
+ *
+ *  @{
+ */
+
+#ifndef RAPP_RESIZE_H
+#define RAPP_RESIZE_H
+
+#include <stdint.h>
+#include "rapp_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Resize with nearest-neighbour sampling.
+ */
+#define RAPP_RESIZE_NEAREST 0
+
+/**
+ *  Resize with bilinear interpolation.
+ */
+#define RAPP_RESIZE_BILINEAR 1
+
+/**
+ *  Resize with area averaging.
+ */
+#define RAPP_RESIZE_AREA 2
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_resize_u8().
+ *
+ *  @param dst_width   The destination image width in pixels.
+ *  @param dst_height  The destination image height in pixels.
+ *  @param src_width   The source image width in pixels.
+ *  @param src_height  The source image height in pixels.
+ *  @param mode        The resize mode, one of the RAPP_RESIZE_*
+ *                     constants.
+ *  @return            The minimum buffer size in bytes,
+ *                     or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_resize_worksize_u8(int dst_width, int dst_height,
+                        int src_width, int src_height, int mode);
+
+/**
+ *  8-bit resizing.
+ *  Resample the source image to the destination image size.
+ *  Image buffers and dimensions must be aligned.
+ *
+ *  @param[out] dst         Destination pixel buffer.
+ *  @param      dst_dim     Row dimension of the destination buffer.
+ *  @param      dst_width   The destination image width in pixels.
+ *  @param      dst_height  The destination image height in pixels.
+ *  @param[in]  src         Source pixel buffer.
+ *  @param      src_dim     Row dimension of the source buffer.
+ *  @param      src_width   The source image width in pixels.
+ *  @param      src_height  The source image height in pixels.
+ *  @param      mode        The resize mode, one of the RAPP_RESIZE_*
+ *                          constants.
+ *  @param      work        Working buffer of at least
+ *                          rapp_resize_worksize_u8() bytes,
+ *                          aligned on #rapp_alignment boundaries.
+ *  @return                 A negative error code on error,
+ *                          zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_resize_u8(uint8_t *restrict dst, int dst_dim,
+               int dst_width, int dst_height,
+               const uint8_t *restrict src, int src_dim,
+               int src_width, int src_height,
+               int mode, void *restrict work);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* RAPP_RESIZE_H */
+/** @} */
@@ -31,12 +31,44 @@
  */
 
 /**
- *  @defgroup grp_stat Sum, Sum-of-Squares, Min and Max Statistics
- *  @brief Image sum, sum-of-squares, cross-sum, min and max statistics.
+ *  @defgroup grp_stat Sum, Sum-of-Squares, Min, Max and Histogram Statistics
+ *  @brief Image sum, sum-of-squares, cross-sum, min, max and histogram
+ *  statistics.
  *
- *  All measures are image-global. The functions may read data up to
- *  the nearest alignment boundary, so if those pixels are not properly
- *  cleared the output may be invalid.
+ *  All measures are image-global, except for the tile statistics.
+ *  The functions may read data up to the nearest alignment boundary,
+ *  so if those pixels are not properly cleared the output may be
+ *  invalid. The histogram functions are exceptions; they only count
+ *  the pixels inside the image.
+ *
+ *  <h2>Masked Statistics</h2>
+ *  The sum, sum-of-squares, min, max and histogram of an 8-bit image
+ *  can be restricted to the pixels where a binary mask is set, e.g.
+ *  to get the intensity statistics of a single object without first
+ *  gathering its pixels. The padding of the mask must be cleared,
+ *  but the padding of the 8-bit image is ignored. Parts of the mask
+ *  that are all zero are skipped, so sparse masks are cheap.
+ *
+ *  <h2>Tile Statistics</h2>
+ *  The sum, min and max of all tiles in a grid are computed in a
+ *  single pass with rapp_stat_tiles_u8(). This is much cheaper than
+ *  calling the image-global functions once per tile when the tiles
+ *  are small. The mean of a tile is its sum divided by its area.
+ *
+ *  <h2>Image Quality</h2>
+ *  The sum of absolute differences (SAD) and the sum of squared
+ *  differences (SSD) compare two 8-bit images of the same size.
+ *  The PSNR in decibels is 10*log10(255*255*width*height / SSD),
+ *  which is left to the caller since no floating-point processing
+ *  is done in the library. The mean structural similarity (SSIM)
+ *  is computed over all 8x8 windows with a fixed-point result.
+ *
+ *  <h2>Histograms</h2>
+ *  The histogram functions overwrite the output histogram, i.e. they
+ *  do not accumulate into it. To compute the histogram of a large
+ *  image in parallel, split the image into bands of rows, compute
+ *  one histogram per band and add the bins together afterwards.
+ *  The pixel buffer address of a band is the address of its first row.
  *
  *  All images must be aligned.
  *
@@ -199,6 +231,365 @@ rapp_stat_min_u8(const uint8_t *buf, int dim, int width, int height);
 RAPP_EXPORT int
 rapp_stat_max_u8(const uint8_t *buf, int dim, int width, int height);
 
+/**
+ *  16-bit pixel sum.
+ *  Compute the sum of all pixels in a 16-bit image.
+ *  Image buffer and dimension must be aligned.
+ *
+ *  @param[in]  buf     Image pixel buffer.
+ *  @param      dim     Row dimension in bytes of the pixel buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @param[out] sum     The location where to store the sum of the image.
+ *  @return             A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_stat_sum_u16(const uint16_t *buf, int dim,
+                  int width, int height, uintmax_t *sum);
+
+/**
+ *  16-bit pixel min.
+ *  Finds the minimum pixel value in a 16-bit image.
+ *  Image buffer and dimension must be aligned.
+ *
+ *  @param[in] buf     Image pixel buffer.
+ *  @param     dim     Row dimension in bytes of the pixel buffer.
+ *  @param     width   Image width in pixels.
+ *  @param     height  Image height in pixels.
+ *  @return            The minimum pixel value in the image,
+ *                     or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_stat_min_u16(const uint16_t *buf, int dim, int width, int height);
+
+/**
+ *  16-bit pixel max.
+ *  Finds the maximum pixel value in a 16-bit image.
+ *  Image buffer and dimension must be aligned.
+ *
+ *  @param[in] buf     Image pixel buffer.
+ *  @param     dim     Row dimension in bytes of the pixel buffer.
+ *  @param     width   Image width in pixels.
+ *  @param     height  Image height in pixels.
+ *  @return            The maximum pixel value in the image,
+ *                     or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_stat_max_u16(const uint16_t *buf, int dim, int width, int height);
+
+/**
+ *  8-bit pixel histogram.
+ *  Counts the number of pixels of each value 0 - 255 in an 8-bit image.
+ *  If a binary mask is given, only the pixels where the mask is set
+ *  are counted. All buffers and dimensions must be aligned.
+ *
+ *  @param[in]  buf      Image pixel buffer.
+ *  @param      dim      Row dimension in bytes of the pixel buffer.
+ *  @param[in]  map      Binary mask buffer, or NULL for no mask.
+ *  @param      map_dim  Row dimension in bytes of the mask buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param[out] hist     The histogram, 256 bins.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_stat_hist_u8(const uint8_t *buf, int dim,
+                  const uint8_t *map, int map_dim,
+                  int width, int height, uint32_t *hist);
+
+/**
+ *  8-bit pixel histogram with fewer bins.
+ *  Counts the pixels of an 8-bit image in @e bins bins of equal width.
+ *  The number of bins must be a power of two, so that every bin holds
+ *  256/bins pixel values. A pixel value @e v is counted in the bin
+ *  <code>(v*bins)/256</code>.
+ *  If a binary mask is given, only the pixels where the mask is set
+ *  are counted. All buffers and dimensions must be aligned.
+ *
+ *  @param[in]  buf      Image pixel buffer.
+ *  @param      dim      Row dimension in bytes of the pixel buffer.
+ *  @param[in]  map      Binary mask buffer, or NULL for no mask.
+ *  @param      map_dim  Row dimension in bytes of the mask buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param[out] hist     The histogram.
+ *  @param      bins     The number of bins, a power of two 1 - 256.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_stat_hist_bins_u8(const uint8_t *buf, int dim,
+                       const uint8_t *map, int map_dim,
+                       int width, int height, uint32_t *hist, int bins);
+
+/**
+ *  8-bit pixel sum with a binary mask.
+ *  Compute the sum of the pixels in an 8-bit image where the binary
+ *  mask is set. The number of pixels in the mask is given by
+ *  rapp_stat_sum_bin(). The result may be invalid if the image is
+ *  larger than 2<sup>8*(sizeof(int) - 1)</sup> pixels.
+ *  All buffers and dimensions must be aligned.
+ *
+ *  @param[in] buf      Image pixel buffer.
+ *  @param     dim      Row dimension in bytes of the pixel buffer.
+ *  @param[in] map      Binary mask buffer.
+ *  @param     map_dim  Row dimension in bytes of the mask buffer.
+ *  @param     width    Image width in pixels.
+ *  @param     height   Image height in pixels.
+ *  @return             The sum of the pixels where the mask is set,
+ *                      or a negative error code on error.
+ */
+RAPP_EXPORT int32_t
+rapp_stat_sum_mask_u8(const uint8_t *buf, int dim,
+                      const uint8_t *map, int map_dim,
+                      int width, int height);
+
+/**
+ *  8-bit pixel squared sum with a binary mask.
+ *  Compute the sum, the sum-of-squares and the number of the pixels
+ *  in an 8-bit image where the binary mask is set. The result may
+ *  be invalid if the image is larger than
+ *  2<sup>8*(sizeof(int) - 1)</sup> pixels.
+ *  All buffers and dimensions must be aligned.
+ *
+ *  @param[in]  buf      Image pixel buffer.
+ *  @param      dim      Row dimension in bytes of the pixel buffer.
+ *  @param[in]  map      Binary mask buffer.
+ *  @param      map_dim  Row dimension in bytes of the mask buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param[out] sum      Output sum storage array with at least three
+ *                       elements. It is filled in as follows:
+ *                         - sum[0] = sum(buf)
+ *                         - sum[1] = sum(buf*buf)
+ *                         - sum[2] = sum(map)
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_stat_sum2_mask_u8(const uint8_t *buf, int dim,
+                       const uint8_t *map, int map_dim,
+                       int width, int height, uintmax_t sum[3]);
+
+/**
+ *  8-bit pixel min with a binary mask.
+ *  Finds the minimum pixel value in an 8-bit image where the binary
+ *  mask is set. If the mask is empty the result is 0xff.
+ *  All buffers and dimensions must be aligned.
+ *
+ *  @param[in] buf      Image pixel buffer.
+ *  @param     dim      Row dimension in bytes of the pixel buffer.
+ *  @param[in] map      Binary mask buffer.
+ *  @param     map_dim  Row dimension in bytes of the mask buffer.
+ *  @param     width    Image width in pixels.
+ *  @param     height   Image height in pixels.
+ *  @return             The minimum pixel value where the mask is set,
+ *                      or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_stat_min_mask_u8(const uint8_t *buf, int dim,
+                      const uint8_t *map, int map_dim,
+                      int width, int height);
+
+/**
+ *  8-bit pixel max with a binary mask.
+ *  Finds the maximum pixel value in an 8-bit image where the binary
+ *  mask is set. If the mask is empty the result is zero.
+ *  All buffers and dimensions must be aligned.
+ *
+ *  @param[in] buf      Image pixel buffer.
+ *  @param     dim      Row dimension in bytes of the pixel buffer.
+ *  @param[in] map      Binary mask buffer.
+ *  @param     map_dim  Row dimension in bytes of the mask buffer.
+ *  @param     width    Image width in pixels.
+ *  @param     height   Image height in pixels.
+ *  @return             The maximum pixel value where the mask is set,
+ *                      or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_stat_max_mask_u8(const uint8_t *buf, int dim,
+                      const uint8_t *map, int map_dim,
+                      int width, int height);
+
+/**
+ *  Binary pixel min and max with location.
+ *  Finds the minimum and maximum pixel values in a binary image,
+ *  and the positions of their first occurrences in raster order.
+ *  Image buffer and dimension must be aligned.
+ *
+ *  @param[in]  buf     Image pixel buffer.
+ *  @param      dim     Row dimension in bytes of the pixel buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @param[out] minmax  The minimum and the maximum pixel values.
+ *  @param[out] pos     Output position array with at least four elements.
+ *                      It is filled in as follows:
+ *                        - pos[0]: x coordinate of the minimum
+ *                        - pos[1]: y coordinate of the minimum
+ *                        - pos[2]: x coordinate of the maximum
+ *                        - pos[3]: y coordinate of the maximum
+ *  @return             A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_stat_minmax_loc_bin(const uint8_t *buf, int dim, int width, int height,
+                         int minmax[2], unsigned pos[4]);
+
+/**
+ *  8-bit pixel min and max with location.
+ *  Finds the minimum and maximum pixel values in an 8-bit image,
+ *  and the positions of their first occurrences in raster order,
+ *  in a single pass. The padding of the image is ignored.
+ *  Image buffer and dimension must be aligned.
+ *
+ *  @param[in]  buf     Image pixel buffer.
+ *  @param      dim     Row dimension in bytes of the pixel buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @param[out] minmax  The minimum and the maximum pixel values.
+ *  @param[out] pos     Output position array with at least four elements.
+ *                      It is filled in as follows:
+ *                        - pos[0]: x coordinate of the minimum
+ *                        - pos[1]: y coordinate of the minimum
+ *                        - pos[2]: x coordinate of the maximum
+ *                        - pos[3]: y coordinate of the maximum
+ *  @return             A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_stat_minmax_loc_u8(const uint8_t *buf, int dim, int width, int height,
+                        int minmax[2], unsigned pos[4]);
+
+/**
+ *  8-bit top-K pixel locations.
+ *  Finds the positions of the @e k largest pixel values in an 8-bit
+ *  image, e.g. the strongest peaks of a correlation map. The positions
+ *  are sorted in decreasing pixel value order, and pixels of equal
+ *  value in raster order. Blocks of pixels that cannot contain any
+ *  of the @e k largest values are skipped after a vectorized max,
+ *  so the image is only searched once. The padding of the image is ignored.
+ *  Image buffer and dimension must be aligned.
+ *
+ *  @param[in]  buf     Image pixel buffer.
+ *  @param      dim     Row dimension in bytes of the pixel buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @param[out] pos     Output position array with at least 2*k elements,
+ *                      filled in with x, y coordinate pairs.
+ *  @param      k       The number of positions to find, at least one.
+ *  @return             The number of positions found, which is @e k
+ *                      unless the image is smaller, or a negative
+ *                      error code on error.
+ */
+RAPP_EXPORT int
+rapp_stat_max_k_u8(const uint8_t *buf, int dim, int width, int height,
+                   unsigned *pos, int k);
+
+/**
+ *  8-bit pixel sum, min and max per tile.
+ *  Divides an 8-bit image into a grid of tiles, e.g. for exposure
+ *  control or for finding the regions that changed between two
+ *  frames, and computes the pixel sum, min and max of every tile in
+ *  a single pass. The grid has ceil(width / tile_w) columns and
+ *  ceil(height / tile_h) rows, and the tiles are stored in raster
+ *  order. The tiles in the last column and row cover the remaining
+ *  pixels, and may be smaller than the others. The padding of the
+ *  image is ignored. The sum of a tile may be invalid if the tile
+ *  is larger than 2<sup>24</sup> pixels.
+ *  Image buffer and dimension must be aligned.
+ *
+ *  @param[in]  buf     Image pixel buffer.
+ *  @param      dim     Row dimension in bytes of the pixel buffer.
+ *  @param      width   Image width in pixels.
+ *  @param      height  Image height in pixels.
+ *  @param      tile_w  Tile width in pixels, at least one.
+ *  @param      tile_h  Tile height in pixels, at least one.
+ *  @param[out] sum     The pixel sum of each tile.
+ *  @param[out] min     The minimum pixel value of each tile.
+ *  @param[out] max     The maximum pixel value of each tile.
+ *  @return             A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_stat_tiles_u8(const uint8_t *buf, int dim, int width, int height,
+                   int tile_w, int tile_h, uint32_t *sum,
+                   uint8_t *min, uint8_t *max);
+
+/**
+ *  8-bit sum of absolute differences.
+ *  Compute the sum of the absolute pixel differences of two 8-bit
+ *  images.
+ *  Image buffers and dimensions must be aligned.
+ *
+ *  @param[in]  src1      First image pixel buffer.
+ *  @param      src1_dim  Row dimension in bytes of the first buffer.
+ *  @param[in]  src2      Second image pixel buffer.
+ *  @param      src2_dim  Row dimension in bytes of the second buffer.
+ *  @param      width     Image width in pixels.
+ *  @param      height    Image height in pixels.
+ *  @param[out] sad       The sum of absolute differences.
+ *  @return               A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_stat_sad_u8(const uint8_t *restrict src1, int src1_dim,
+                 const uint8_t *restrict src2, int src2_dim,
+                 int width, int height, uintmax_t *sad);
+
+/**
+ *  8-bit sum of squared differences.
+ *  Compute the sum of the squared pixel differences of two 8-bit
+ *  images.
+ *  Image buffers and dimensions must be aligned.
+ *
+ *  @param[in]  src1      First image pixel buffer.
+ *  @param      src1_dim  Row dimension in bytes of the first buffer.
+ *  @param[in]  src2      Second image pixel buffer.
+ *  @param      src2_dim  Row dimension in bytes of the second buffer.
+ *  @param      width     Image width in pixels.
+ *  @param      height    Image height in pixels.
+ *  @param[out] ssd       The sum of squared differences.
+ *  @return               A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_stat_ssd_u8(const uint8_t *restrict src1, int src1_dim,
+                 const uint8_t *restrict src2, int src2_dim,
+                 int width, int height, uintmax_t *ssd);
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_stat_ssim_u8().
+ *
+ *  @param width  The image width in pixels.
+ *  @return       The minimum buffer size in bytes,
+ *                or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_stat_ssim_worksize_u8(int width);
+
+/**
+ *  8-bit mean structural similarity.
+ *  Compute the mean SSIM index of two 8-bit images, using the
+ *  means, variances and covariance of all 8x8 windows that are
+ *  inside the images, and the standard constants C1 = (0.01*255)^2
+ *  and C2 = (0.03*255)^2. The window sums are computed with sliding
+ *  box sums, one row at a time. The padding of the images is ignored.
+ *  The images must be at least 8x8 pixels.
+ *  Image buffers and dimensions must be aligned.
+ *
+ *  @param[in]  src1      First image pixel buffer.
+ *  @param      src1_dim  Row dimension in bytes of the first buffer.
+ *  @param[in]  src2      Second image pixel buffer.
+ *  @param      src2_dim  Row dimension in bytes of the second buffer.
+ *  @param      width     Image width in pixels.
+ *  @param      height    Image height in pixels.
+ *  @param[out] ssim      The mean SSIM in units of 1/65536, i.e.
+ *                        65536 for identical images.
+ *  @param      work      Working buffer of at least
+ *                        rapp_stat_ssim_worksize_u8() bytes,
+ *                        aligned on #rapp_alignment boundaries.
+ *  @return               A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_stat_ssim_u8(const uint8_t *restrict src1, int src1_dim,
+                  const uint8_t *restrict src2, int src2_dim,
+                  int width, int height, int32_t *ssim,
+                  void *restrict work);
+
 #ifdef __cplusplus
 };
 #endif
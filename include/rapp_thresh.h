@@ -32,13 +32,52 @@
 
 /**
  *  @defgroup grp_thresh Thresholding
- *  @brief Thresholding 8-bit to binary.
+ *  @brief Thresholding 8-bit and 16-bit to binary.
  *
  *  The thresholding functions convert 8-bit images to binary images,
  *  using one or two thresholds, which can be constants or per-pixel
- *  8-bit "images". All images must be aligned.
+ *  8-bit "images". The single-threshold functions are also available
+ *  for 16-bit source images. All images must be aligned.
  *
- *  <p>@ref grp_type "Next section: Type Conversions"</p>
+ *  <h2>Automatic Thresholding</h2>
+ *  The function rapp_thresh_auto_u8() selects the threshold level
+ *  from the image histogram, using one of the methods below, and
+ *  thresholds the image greater-than the selected level.
+ *  - #RAPP_THRESH_OTSU selects the level that maximizes the
+ *    between-class variance of the pixels below and above it.
+ *  - #RAPP_THRESH_TRIANGLE draws a line from the histogram peak to
+ *    the far end of the longest tail, and selects the level where
+ *    the histogram is furthest below that line.
+ *  - #RAPP_THRESH_PERCENTILE selects the lowest level that at least
+ *    a given percentage of the pixels are less than or equal to.
+ *
+ *  When processing a video stream, the histogram of the previous
+ *  frame can be used for selecting the level. The current frame is
+ *  then thresholded and histogrammed in the same pass, in row strips
+ *  that stay in the cache, so that each frame is read from memory
+ *  only once.
+ *
+ *  <h2>Adaptive Thresholding</h2>
+ *  The function rapp_thresh_adaptive_u8() thresholds each pixel
+ *  against the mean value of its square neighbourhood plus a constant
+ *  offset, which handles uneven lighting. The local mean is computed
+ *  with horizontal and vertical box filters, in row strips, so that
+ *  the mean image is never stored at full size. The source image must
+ *  be @ref padding "padded" with radius rows above and below, and with
+ *  rapp_align(radius) bytes to the left and right. The size of the
+ *  working buffer is given by rapp_thresh_adaptive_worksize_u8().
+ *
+ *  <h2>Frame Differencing</h2>
+ *  The function rapp_thresh_absdiff_gt_u8() thresholds the absolute
+ *  difference of two images, e.g. consecutive video frames, directly
+ *  to binary. It gives the same result as rapp_pixop_suba_u8() followed
+ *  by rapp_thresh_gt_u8(), but without storing the difference image,
+ *  so each source image is read only once. The function
+ *  rapp_thresh_absdiff_hyst_u8() uses two thresholds with hysteresis:
+ *  the pixels above the high threshold are kept, together with all
+ *  pixels above the low threshold that are 8-connected to them.
+ *
+ *  <p>@ref grp_bgmodel "Next section: Background Modelling"</p>
  *
  *  @{
  */
@@ -53,6 +92,27 @@
 extern "C" {
 #endif
 
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Automatic threshold selection with Otsu's method.
+ */
+#define RAPP_THRESH_OTSU       0
+
+/**
+ *  Automatic threshold selection with the triangle method.
+ */
+#define RAPP_THRESH_TRIANGLE   1
+
+/**
+ *  Automatic threshold selection at a percentile.
+ */
+#define RAPP_THRESH_PERCENTILE 2
+
 /*
  * -------------------------------------------------------------
  *  Exported functions
@@ -219,6 +279,176 @@ rapp_thresh_ltgt_pixel_u8(uint8_t *restrict dst, int dst_dim,
                           const uint8_t *restrict high, int high_dim,
                           int width, int height);
 
+/**
+ *  Single thresholding greater-than, 16-bit.
+ *  Computes dst[i] = src[i] > thresh.
+ *
+ *  @param[out]  dst       Destination pixel buffer.
+ *  @param       dst_dim   Row dimension in bytes of the destination buffer.
+ *  @param[in]   src       Source pixel buffer.
+ *  @param       src_dim   Row dimension in bytes of the source buffer.
+ *  @param       width     Image width in pixels.
+ *  @param       height    Image height in pixels.
+ *  @param       thresh    The threshold value to use.
+ *  @return                A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_thresh_gt_u16(uint8_t *restrict dst, int dst_dim,
+                   const uint16_t *restrict src, int src_dim,
+                   int width, int height, int thresh);
+
+/**
+ *  Single thresholding less-than, 16-bit.
+ *  Computes dst[i] = src[i] < thresh.
+ *
+ *  @param[out]  dst       Destination pixel buffer.
+ *  @param       dst_dim   Row dimension in bytes of the destination buffer.
+ *  @param[in]   src       Source pixel buffer.
+ *  @param       src_dim   Row dimension in bytes of the source buffer.
+ *  @param       width     Image width in pixels.
+ *  @param       height    Image height in pixels.
+ *  @param       thresh    The threshold value to use.
+ *  @return                A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_thresh_lt_u16(uint8_t *restrict dst, int dst_dim,
+                   const uint16_t *restrict src, int src_dim,
+                   int width, int height, int thresh);
+
+/**
+ *  Automatic single thresholding greater-than.
+ *  Selects the threshold level from a histogram and computes
+ *  dst[i] = src[i] > level.
+ *
+ *  If the histogram argument is NULL, the histogram of the source
+ *  image is used. Otherwise it is an input/output argument: the level
+ *  is selected from the histogram passed, e.g. the one of the previous
+ *  frame, and it is then overwritten with the histogram of the source
+ *  image, computed in the same pass as the thresholding. If all bins
+ *  are zero on input, e.g. for the first frame, the histogram of the
+ *  source image is computed first and used for the selection.
+ *
+ *  @param[out]   dst       Destination pixel buffer.
+ *  @param        dst_dim   Row dimension in bytes of the destination buffer.
+ *  @param[in]    src       Source pixel buffer.
+ *  @param        src_dim   Row dimension in bytes of the source buffer.
+ *  @param        width     Image width in pixels.
+ *  @param        height    Image height in pixels.
+ *  @param        method    The selection method, #RAPP_THRESH_OTSU,
+ *                          #RAPP_THRESH_TRIANGLE or #RAPP_THRESH_PERCENTILE.
+ *  @param        percent   The percentile 0 - 100, only used with
+ *                          #RAPP_THRESH_PERCENTILE.
+ *  @param[in,out] hist     A 256-bin histogram, or NULL.
+ *  @return                 The selected level 0 - 255,
+ *                          or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_thresh_auto_u8(uint8_t *restrict dst, int dst_dim,
+                    const uint8_t *restrict src, int src_dim,
+                    int width, int height, int method, int percent,
+                    uint32_t *hist);
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_thresh_adaptive_u8().
+ *
+ *  @param width   The image width in pixels.
+ *  @param radius  The neighbourhood radius, in the range [1, 127].
+ *  @return        The minimum buffer size in bytes,
+ *                 or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_thresh_adaptive_worksize_u8(int width, int radius);
+
+/**
+ *  Adaptive single thresholding greater-than.
+ *  Computes dst[i] = src[i] > level[i], where the level is the
+ *  rounded mean value of the (2*radius + 1)^2 pixels centered on
+ *  the pixel plus the offset, clamped to the range 0 - 255.
+ *  The mean is computed with separable box filters. It is rounded in
+ *  each direction, and may differ by one from the exact rounded mean.
+ *
+ *  @param[out] dst      Destination pixel buffer.
+ *  @param      dst_dim  Row dimension in bytes of the destination buffer.
+ *  @param[in]  src      Source pixel buffer.
+ *  @param      src_dim  Row dimension in bytes of the source buffer.
+ *  @param      width    Image width in pixels.
+ *  @param      height   Image height in pixels.
+ *  @param      radius   The neighbourhood radius, in the range [1, 127].
+ *  @param      offset   The signed offset added to the local mean,
+ *                       in the range [-255, 255].
+ *  @param      work     Working buffer of at least
+ *                       rapp_thresh_adaptive_worksize_u8() bytes,
+ *                       aligned on #rapp_alignment boundaries.
+ *  @return              A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_thresh_adaptive_u8(uint8_t *restrict dst, int dst_dim,
+                        const uint8_t *restrict src, int src_dim,
+                        int width, int height, int radius, int offset,
+                        void *restrict work);
+
+/**
+ *  Absolute-difference thresholding greater-than.
+ *  Computes dst[i] = abs(src1[i] - src2[i]) > thresh.
+ *
+ *  @param[out] dst       Destination pixel buffer.
+ *  @param      dst_dim   Row dimension in bytes of the destination buffer.
+ *  @param[in]  src1      First source pixel buffer.
+ *  @param      src1_dim  Row dimension in bytes of the first source buffer.
+ *  @param[in]  src2      Second source pixel buffer.
+ *  @param      src2_dim  Row dimension in bytes of the second source buffer.
+ *  @param      width     Image width in pixels.
+ *  @param      height    Image height in pixels.
+ *  @param      thresh    The threshold value to use.
+ *  @return               A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_thresh_absdiff_gt_u8(uint8_t *restrict dst, int dst_dim,
+                          const uint8_t *restrict src1, int src1_dim,
+                          const uint8_t *restrict src2, int src2_dim,
+                          int width, int height, int thresh);
+
+/**
+ *  Compute the minimum size of the working buffer needed by
+ *  rapp_thresh_absdiff_hyst_u8().
+ *
+ *  @param width   The image width in pixels.
+ *  @param height  The image height in pixels.
+ *  @return        The minimum buffer size in bytes,
+ *                 or a negative error code on error.
+ */
+RAPP_EXPORT int
+rapp_thresh_absdiff_hyst_worksize_u8(int width, int height);
+
+/**
+ *  Absolute-difference thresholding with hysteresis.
+ *  Sets the pixels where abs(src1[i] - src2[i]) > high, and the
+ *  pixels where abs(src1[i] - src2[i]) > low that are 8-connected
+ *  to them.
+ *
+ *  @param[out] dst       Destination pixel buffer.
+ *  @param      dst_dim   Row dimension in bytes of the destination buffer.
+ *  @param[in]  src1      First source pixel buffer.
+ *  @param      src1_dim  Row dimension in bytes of the first source buffer.
+ *  @param[in]  src2      Second source pixel buffer.
+ *  @param      src2_dim  Row dimension in bytes of the second source buffer.
+ *  @param      width     Image width in pixels.
+ *  @param      height    Image height in pixels.
+ *  @param      low       The low threshold value, in the range [0, high].
+ *  @param      high      The high threshold value, in the range [low, 255].
+ *  @param      work      Working buffer of at least
+ *                        rapp_thresh_absdiff_hyst_worksize_u8() bytes,
+ *                        aligned on #rapp_alignment boundaries.
+ *  @return               A negative error code on error, zero otherwise.
+ */
+RAPP_EXPORT int
+rapp_thresh_absdiff_hyst_u8(uint8_t *restrict dst, int dst_dim,
+                            const uint8_t *restrict src1, int src1_dim,
+                            const uint8_t *restrict src2, int src2_dim,
+                            int width, int height, int low, int high,
+                            void *restrict work);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,191 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_test_bgmodel.c
+ *  @brief  Correctness tests for background modelling.
+ */
+
+#include <string.h>            /* memcpy()      */
+#include "rapp.h"              /* RAPP API      */
+#include "rapp_ref_bgmodel.h"  /* Reference API */
+#include "rapp_test_util.h"    /* Test utils    */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The number of test iterations.
+ */
+#define RAPP_TEST_ITER 64
+
+/**
+ *  The number of consecutive frames in each test iteration.
+ */
+#define RAPP_TEST_FRAMES 4
+
+/**
+ *  Test image maximum width.
+ */
+#define RAPP_TEST_WIDTH 300
+
+/**
+ *  Test image maximum height.
+ */
+#define RAPP_TEST_HEIGHT 20
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+bool
+rapp_test_bgmodel_update_u8(void)
+{
+    int      dim      = rapp_align(RAPP_TEST_WIDTH);
+    int      bin_dim  = rapp_align((RAPP_TEST_WIDTH + 7) / 8);
+    int      size     = dim*RAPP_TEST_HEIGHT;
+    int      bin_size = bin_dim*RAPP_TEST_HEIGHT;
+    uint8_t *src_buf  = rapp_malloc(size, 0);
+    uint8_t *mean_buf = rapp_malloc(size, 0);
+    uint8_t *dev_buf  = rapp_malloc(size, 0);
+    uint8_t *fg_buf   = rapp_malloc(bin_size, 0);
+    uint8_t *mean_ref = rapp_malloc(size, 0);
+    uint8_t *dev_ref  = rapp_malloc(size, 0);
+    uint8_t *fg_ref   = rapp_malloc(bin_size, 0);
+    int    (*func)()  = &rapp_bgmodel_update_u8; /* For overlap */
+    int      k;
+    bool     ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int      w      = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int      h      = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        unsigned alpha8 = rapp_test_rand(1, 0x7f);
+        int      thresh = rapp_test_rand(0, 48);
+        bool     dev    = k % 2 != 0;
+        int      f, i;
+
+        /* Initialize the model and the previous foreground mask */
+        rapp_test_init(mean_buf, 0, size, 1, true);
+        for (i = 0; i < size; i++) {
+            dev_buf[i] = rapp_test_rand(0, 24);
+        }
+        rapp_test_init_mask(fg_buf, bin_size, rapp_test_rand(1, 64));
+        memcpy(mean_ref, mean_buf, size);
+        memcpy(dev_ref,  dev_buf,  size);
+        memcpy(fg_ref,   fg_buf,   bin_size);
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(fg_buf, bin_dim, fg_buf, dim, NULL, 0, src_buf, dim,
+                    w, h, alpha8, thresh) != RAPP_ERR_OVERLAP ||
+            (*func)(fg_buf, bin_dim, mean_buf, dim, NULL, 0, mean_buf, dim,
+                    w, h, alpha8, thresh) != RAPP_ERR_OVERLAP ||
+            (*func)(fg_buf, bin_dim, mean_buf, dim, mean_buf, dim,
+                    src_buf, dim, w, h, alpha8, thresh) != RAPP_ERR_OVERLAP ||
+            (*func)(fg_buf, bin_dim, mean_buf, dim, src_buf, dim,
+                    src_buf, dim, w, h, alpha8, thresh) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Update the model with a sequence of frames near the mean */
+        for (f = 0; f < RAPP_TEST_FRAMES; f++) {
+            for (i = 0; i < size; i++) {
+                int pix = mean_ref[i] + rapp_test_rand(-64, 64);
+                src_buf[i] = MAX(MIN(pix, 0xff), 0);
+            }
+
+            if (rapp_bgmodel_update_u8(fg_buf, bin_dim, mean_buf, dim,
+                                       dev ? dev_buf : NULL, dim,
+                                       src_buf, dim, w, h,
+                                       alpha8, thresh) < 0)
+            {
+                DBG("Got FAIL return value\n");
+                goto Done;
+            }
+            rapp_ref_bgmodel_update_u8(fg_ref, bin_dim, mean_ref, dim,
+                                       dev ? dev_ref : NULL, dim,
+                                       src_buf, dim, w, h,
+                                       alpha8, thresh);
+
+            /* Compare the results */
+            if (!rapp_test_compare_bin(fg_buf, bin_dim, fg_ref, bin_dim,
+                                       0, w, h) ||
+                !rapp_test_compare_u8(mean_buf, dim, mean_ref, dim, w, h) ||
+                (dev && !rapp_test_compare_u8(dev_buf, dim, dev_ref, dim,
+                                              w, h)))
+            {
+                DBG("Invalid result in frame %d, alpha8=0x%x thresh=%d "
+                    "dev=%d\n", f, alpha8, thresh, (int)dev);
+                DBG("fg=\n");
+                rapp_test_dump_bin(fg_buf, bin_dim, 0, w, h);
+                DBG("ref=\n");
+                rapp_test_dump_bin(fg_ref, bin_dim, 0, w, h);
+                goto Done;
+            }
+        }
+    }
+
+    /* Verify that invalid parameters are rejected */
+    if (rapp_bgmodel_update_u8(fg_buf, bin_dim, mean_buf, dim, NULL, 0,
+                               src_buf, dim, 1, 1, 0, 10)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_bgmodel_update_u8(fg_buf, bin_dim, mean_buf, dim, NULL, 0,
+                               src_buf, dim, 1, 1, 0x80, 10)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_bgmodel_update_u8(fg_buf, bin_dim, mean_buf, dim, NULL, 0,
+                               src_buf, dim, 1, 1, 0x10, -1)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_bgmodel_update_u8(fg_buf, bin_dim, mean_buf, dim, NULL, 0,
+                               src_buf, dim, 1, 1, 0x10, 256)
+        != RAPP_ERR_PARM_RANGE)
+    {
+        DBG("Invalid parameters accepted\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(src_buf);
+    rapp_free(mean_buf);
+    rapp_free(dev_buf);
+    rapp_free(fg_buf);
+    rapp_free(mean_ref);
+    rapp_free(dev_ref);
+    rapp_free(fg_ref);
+
+    return ok;
+}
@@ -0,0 +1,177 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_test_edge.c
+ *  @brief  Correctness tests for edge detection.
+ */
+
+#include "rapp.h"             /* RAPP API      */
+#include "rapp_ref_edge.h"    /* Reference API */
+#include "rapp_test_util.h"   /* Test utils    */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The number of test iterations.
+ */
+#define RAPP_TEST_ITER 64
+
+/**
+ *  Test image maximum width.
+ */
+#define RAPP_TEST_WIDTH 160
+
+/**
+ *  Test image maximum height.
+ */
+#define RAPP_TEST_HEIGHT 100
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+bool
+rapp_test_edge_canny_u8(void)
+{
+    int      pad     = rapp_align(1);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int      dst_dim = rapp_align((RAPP_TEST_WIDTH + 7) / 8);
+    int      tmp_dim = rapp_align(RAPP_TEST_WIDTH);
+    int      size    = src_dim*(RAPP_TEST_HEIGHT + 2);
+    uint8_t *pad_buf = rapp_malloc(size, 0);
+    uint8_t *src_buf = &pad_buf[src_dim + pad];
+    uint8_t *tmp_buf = rapp_malloc(tmp_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *ref_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int      wsize   = rapp_edge_canny_worksize_u8(RAPP_TEST_WIDTH,
+                                                   RAPP_TEST_HEIGHT);
+    void    *work    = rapp_malloc(wsize, 0);
+    int    (*func)() = &rapp_edge_canny_u8; /* For overlap */
+    int      k;
+    bool     ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int     w    = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int     h    = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int     low  = rapp_test_rand(0, 40);
+        int     high = rapp_test_rand(low, 80);
+        uint8_t val[16];
+        int     i;
+
+        /* Initialize the source buffer with noise or noisy blocks */
+        for (i = 0; i < 16; i++) {
+            val[i] = rapp_test_rand(0, 0xff);
+        }
+        for (i = 0; i < size; i++) {
+            int x = i % src_dim;
+            int y = i / src_dim;
+
+            if (k % 4 == 0) {
+                pad_buf[i] = rapp_test_rand(0, 0xff);
+            }
+            else {
+                pad_buf[i] = MIN(val[(x / 7 + 5*(y / 9)) % 16] +
+                                 rapp_test_rand(0, 7), 0xff);
+            }
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(dst_buf, dst_dim, dst_buf, src_dim, w, h,
+                    low, high, work) != RAPP_ERR_OVERLAP ||
+            (*func)(dst_buf, dst_dim, src_buf, src_dim, w, h,
+                    low, high, dst_buf) != RAPP_ERR_OVERLAP ||
+            (*func)(dst_buf, dst_dim, src_buf, src_dim, w, h,
+                    low, high, src_buf) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the edge detector */
+        if (rapp_edge_canny_u8(dst_buf, dst_dim, src_buf, src_dim,
+                               w, h, low, high, work) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function on the smoothed image */
+        if (rapp_filter_gauss_3x3_u8(tmp_buf, tmp_dim, src_buf, src_dim,
+                                     w, h) < 0)
+        {
+            DBG("Got FAIL return value from Gaussian\n");
+            goto Done;
+        }
+        rapp_ref_edge_canny_u8(ref_buf, dst_dim, tmp_buf, tmp_dim,
+                               w, h, low, high);
+
+        /* Compare the results */
+        if (!rapp_test_compare_bin(dst_buf, dst_dim, ref_buf, dst_dim,
+                                   0, w, h))
+        {
+            DBG("Invalid result, thresholds %d %d\n", low, high);
+            DBG("dst=\n");
+            rapp_test_dump_bin(dst_buf, dst_dim, 0, w, h);
+            DBG("ref=\n");
+            rapp_test_dump_bin(ref_buf, dst_dim, 0, w, h);
+            goto Done;
+        }
+    }
+
+    /* Verify that invalid thresholds are rejected */
+    if (rapp_edge_canny_u8(dst_buf, dst_dim, src_buf, src_dim, 1, 1,
+                           -1, 10, work) != RAPP_ERR_PARM_RANGE ||
+        rapp_edge_canny_u8(dst_buf, dst_dim, src_buf, src_dim, 1, 1,
+                           10, 256, work) != RAPP_ERR_PARM_RANGE ||
+        rapp_edge_canny_u8(dst_buf, dst_dim, src_buf, src_dim, 1, 1,
+                           20, 10, work) != RAPP_ERR_PARM_RANGE)
+    {
+        DBG("Invalid thresholds accepted\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(tmp_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+    rapp_free(work);
+
+    return ok;
+}
@@ -0,0 +1,245 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_test_feature.c
+ *  @brief  Correctness tests for feature detection.
+ */
+
+#include <stdlib.h>           /* malloc()      */
+#include <string.h>           /* memcmp()      */
+#include "rapp.h"             /* RAPP API      */
+#include "rapp_ref_feature.h" /* Reference API */
+#include "rapp_test_util.h"   /* Test utils    */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The number of test iterations.
+ */
+#define RAPP_TEST_ITER 64
+
+/**
+ *  Test image maximum width.
+ */
+#define RAPP_TEST_WIDTH 160
+
+/**
+ *  Test image maximum height.
+ */
+#define RAPP_TEST_HEIGHT 100
+
+
+/*
+ * -------------------------------------------------------------
+ *  Type definitions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  A feature detector function.
+ */
+typedef int
+(*rapp_test_feature_func_t)(const uint8_t *src, int src_dim,
+                            int width, int height, int thresh, int nms,
+                            unsigned *pos, int max, void *work);
+
+/**
+ *  A reference feature detector function.
+ */
+typedef int
+(*rapp_test_feature_ref_t)(const uint8_t *src, int src_dim,
+                           int width, int height, int thresh, int nms,
+                           unsigned *pos, int max);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static bool
+rapp_test_feature_driver(rapp_test_feature_func_t func,
+                         rapp_test_feature_ref_t ref,
+                         int rows, bool harris);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+bool
+rapp_test_feature_fast_u8(void)
+{
+    return rapp_test_feature_driver(&rapp_feature_fast_u8,
+                                    &rapp_ref_feature_fast_u8, 3, false);
+}
+
+bool
+rapp_test_feature_harris_u8(void)
+{
+    return rapp_test_feature_driver(&rapp_feature_harris_u8,
+                                    &rapp_ref_feature_harris_u8, 1, true);
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+static bool
+rapp_test_feature_driver(rapp_test_feature_func_t func,
+                         rapp_test_feature_ref_t ref,
+                         int rows, bool harris)
+{
+    int       pad     = rapp_align(rows);
+    int       src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int       size    = src_dim*(RAPP_TEST_HEIGHT + 2*rows);
+    int       len     = 2*RAPP_TEST_WIDTH*RAPP_TEST_HEIGHT;
+    uint8_t  *pad_buf = rapp_malloc(size, 0);
+    uint8_t  *src_buf = &pad_buf[rows*src_dim + pad];
+    unsigned *pos     = malloc(len*sizeof *pos);
+    unsigned *ref_pos = malloc(len*sizeof *ref_pos);
+    int       wsize   = rapp_feature_worksize_u8(RAPP_TEST_WIDTH,
+                                                 RAPP_TEST_HEIGHT);
+    void     *work    = rapp_malloc(wsize, 0);
+    int       k;
+    bool      ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int     w   = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int     h   = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int     nms = k % 2;
+        int     max = k % 8 < 6 ? w*h : rapp_test_rand(1, 16);
+        int     thresh;
+        int     num, ref_num;
+        uint8_t val[16];
+        int     i;
+
+        /* Use a wide range of thresholds for the Harris response */
+        if (harris) {
+            thresh = rapp_test_rand(0, 1 << 2*rapp_test_rand(0, 12));
+        }
+        else {
+            thresh = rapp_test_rand(0, 60);
+        }
+
+        /* Initialize the source buffer with noise or noisy blocks */
+        for (i = 0; i < 16; i++) {
+            val[i] = rapp_test_rand(0, 0xff);
+        }
+        for (i = 0; i < size; i++) {
+            int x = i % src_dim;
+            int y = i / src_dim;
+
+            if (k % 4 == 0) {
+                pad_buf[i] = rapp_test_rand(0, 0xff);
+            }
+            else {
+                pad_buf[i] = MIN(val[(x / 7 + 5*(y / 9)) % 16] +
+                                 rapp_test_rand(0, 7), 0xff);
+            }
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(src_buf, src_dim, w, h, thresh, nms,
+                    pos, max, src_buf) != RAPP_ERR_OVERLAP ||
+            (*func)(src_buf, src_dim, w, h, thresh, nms,
+                    work, max, work) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the feature detector */
+        num = (*func)(src_buf, src_dim, w, h, thresh, nms, pos, max, work);
+        if (num < 0) {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        ref_num = (*ref)(src_buf, src_dim, w, h, thresh, nms,
+                         ref_pos, max);
+
+        /* Compare the results */
+        if (num != ref_num ||
+            memcmp(pos, ref_pos, 2*num*sizeof *pos) != 0)
+        {
+            DBG("Invalid result, threshold %d nms %d max %d\n",
+                thresh, nms, max);
+            DBG("num=%d ref_num=%d\n", num, ref_num);
+            for (i = 0; i < MIN(num, ref_num); i++) {
+                if (pos[2*i] != ref_pos[2*i] ||
+                    pos[2*i + 1] != ref_pos[2*i + 1])
+                {
+                    DBG("corner %d: (%u, %u) != (%u, %u)\n", i,
+                        pos[2*i], pos[2*i + 1],
+                        ref_pos[2*i], ref_pos[2*i + 1]);
+                    break;
+                }
+            }
+            goto Done;
+        }
+    }
+
+    /* Verify that invalid arguments are rejected */
+    if ((*func)(src_buf, src_dim, 1, 1, -1, 0, pos, 1, work) !=
+        RAPP_ERR_PARM_RANGE ||
+        (*func)(src_buf, src_dim, 1, 1, 0, 0, pos, 0, work) !=
+        RAPP_ERR_PARM_RANGE ||
+        (*func)(src_buf, src_dim, 1, 1, 0, 0, NULL, 1, work) !=
+        RAPP_ERR_PARM_NULL ||
+        (!harris &&
+         (*func)(src_buf, src_dim, 1, 1, 256, 0, pos, 1, work) !=
+         RAPP_ERR_PARM_RANGE))
+    {
+        DBG("Invalid arguments accepted\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(work);
+    free(pos);
+    free(ref_pos);
+
+    return ok;
+}
@@ -31,6 +31,7 @@
  */
 
 #include <string.h>          /* memcpy()      */
+#include <limits.h>          /* INT_MAX       */
 #include <math.h>            /* fabs()        */
 #include <assert.h>          /* assert()      */
 #include "rapp.h"            /* RAPP API      */
@@ -77,6 +78,30 @@ rapp_test_prec_driver(int (*func)(), void (*ref)(),
 static bool
 rapp_test_rand_driver(int (*func)(), void (*ref)(), float tol, float bias);
 
+static bool
+rapp_test_s16_driver(int (*func)(), void (*ref)());
+
+static bool
+rapp_test_conv_driver(bool separable);
+
+static void
+rapp_test_kernel(int8_t *kern, int len);
+
+static bool
+rapp_test_gauss_driver(int sigma, int iter, float tol);
+
+static bool
+rapp_test_median_driver(int (*func)(), int rad);
+
+static bool
+rapp_test_u16_driver(int (*func)(), void (*ref)());
+
+static bool
+rapp_test_census_driver(int (*func)(), void (*ref)(), int rad, int size);
+
+static bool
+rapp_test_census_cost_driver(int (*func)(), void (*ref)(), int size);
+
 
 /*
  * -------------------------------------------------------------
@@ -164,6 +189,218 @@ rapp_test_filter_sobel_3x3_magn_u8(void)
                             3, 3, 2, 1.0f, -0.25f);
 }
 
+bool
+rapp_test_filter_sobel_3x3_magn_dir_u8(void)
+{
+    int      pad     = rapp_align(1);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int      dst_dim = rapp_align(RAPP_TEST_WIDTH);
+    int      size    = src_dim*(RAPP_TEST_HEIGHT + 2);
+    uint8_t *pad_buf = rapp_malloc(size, 0);
+    uint8_t *src_buf = &pad_buf[src_dim + pad];
+    uint8_t *mag_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *dir_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *rmg_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *rdr_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int    (*func)() = &rapp_filter_sobel_3x3_magn_dir_u8; /* For overlap */
+    int      k;
+    bool     ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int w    = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h    = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int bins = (k % 2 == 0) ? 4 : 8;
+        int max  = (k % 4 < 2) ? 0xff : 3;
+        int i;
+
+        /* Initialize the source buffer */
+        for (i = 0; i < size; i++) {
+            pad_buf[i] = rapp_test_rand(0, max);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(mag_buf, dst_dim, mag_buf, dst_dim,
+                    src_buf, src_dim, w, h, bins) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the gradient function */
+        if (rapp_filter_sobel_3x3_magn_dir_u8(mag_buf, dst_dim,
+                                              dir_buf, dst_dim,
+                                              src_buf, src_dim,
+                                              w, h, bins) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_filter_sobel_3x3_magn_dir_u8(rmg_buf, dst_dim,
+                                              rdr_buf, dst_dim,
+                                              src_buf, src_dim,
+                                              w, h, bins);
+
+        /* Compare the results */
+        if (!rapp_test_compare_u8(mag_buf, dst_dim, rmg_buf, dst_dim, w, h) ||
+            !rapp_test_compare_u8(dir_buf, dst_dim, rdr_buf, dst_dim, w, h))
+        {
+            DBG("Invalid result, %d bins\n", bins);
+            DBG("mag=\n");
+            rapp_test_dump_u8(mag_buf, dst_dim, w, h);
+            DBG("dir=\n");
+            rapp_test_dump_u8(dir_buf, dst_dim, w, h);
+            DBG("ref dir=\n");
+            rapp_test_dump_u8(rdr_buf, dst_dim, w, h);
+            goto Done;
+        }
+    }
+
+    /* Verify that invalid bin counts are rejected */
+    if (rapp_filter_sobel_3x3_magn_dir_u8(mag_buf, dst_dim, dir_buf, dst_dim,
+                                          src_buf, src_dim, 1, 1,
+                                          2) != RAPP_ERR_PARM_RANGE ||
+        rapp_filter_sobel_3x3_magn_dir_u8(mag_buf, dst_dim, dir_buf, dst_dim,
+                                          src_buf, src_dim, 1, 1,
+                                          16) != RAPP_ERR_PARM_RANGE)
+    {
+        DBG("Invalid bin count accepted\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(mag_buf);
+    rapp_free(dir_buf);
+    rapp_free(rmg_buf);
+    rapp_free(rdr_buf);
+
+    return ok;
+}
+
+bool
+rapp_test_filter_sobel_3x3_grad_u8_s16(void)
+{
+    int      pad     = rapp_align(1);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int      dst_dim = rapp_align(2*RAPP_TEST_WIDTH);
+    int      size    = src_dim*(RAPP_TEST_HEIGHT + 2);
+    uint8_t *pad_buf = rapp_malloc(size, 0);
+    uint8_t *src_buf = &pad_buf[src_dim + pad];
+    int16_t *gx_buf  = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int16_t *gy_buf  = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int16_t *rgx_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int16_t *rgy_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int    (*func)() = &rapp_filter_sobel_3x3_grad_u8_s16; /* For overlap */
+    int      k;
+    bool     ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int w = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int i, x, y;
+
+        /* Initialize the source buffer, with extreme values in some runs */
+        for (i = 0; i < size; i++) {
+            pad_buf[i] = (k % 2 == 0) ? rapp_test_rand(0, 0xff)
+                                      : 0xff*rapp_test_rand(0, 1);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(gx_buf, dst_dim, gx_buf, dst_dim,
+                    src_buf, src_dim, w, h) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the gradient function */
+        if (rapp_filter_sobel_3x3_grad_u8_s16(gx_buf, dst_dim,
+                                              gy_buf, dst_dim,
+                                              src_buf, src_dim, w, h) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_filter_sobel_3x3_grad_u8_s16(rgx_buf, dst_dim,
+                                              rgy_buf, dst_dim,
+                                              src_buf, src_dim, w, h);
+
+        /* Compare the results */
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                int j = y*dst_dim/sizeof(int16_t) + x;
+                if (gx_buf[j] != rgx_buf[j] || gy_buf[j] != rgy_buf[j]) {
+                    DBG("Invalid result at (%d, %d): "
+                        "gx=%d ref=%d gy=%d ref=%d\n", x, y,
+                        gx_buf[j], rgx_buf[j], gy_buf[j], rgy_buf[j]);
+                    goto Done;
+                }
+            }
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(gx_buf);
+    rapp_free(gy_buf);
+    rapp_free(rgx_buf);
+    rapp_free(rgy_buf);
+
+    return ok;
+}
+
+bool
+rapp_test_filter_diff_1x2_horz_u8_s16(void)
+{
+    return rapp_test_s16_driver(&rapp_filter_diff_1x2_horz_u8_s16,
+                                &rapp_ref_filter_diff_1x2_horz_u8_s16);
+}
+
+bool
+rapp_test_filter_diff_2x1_vert_u8_s16(void)
+{
+    return rapp_test_s16_driver(&rapp_filter_diff_2x1_vert_u8_s16,
+                                &rapp_ref_filter_diff_2x1_vert_u8_s16);
+}
+
+bool
+rapp_test_filter_sobel_3x3_horz_u8_s16(void)
+{
+    return rapp_test_s16_driver(&rapp_filter_sobel_3x3_horz_u8_s16,
+                                &rapp_ref_filter_sobel_3x3_horz_u8_s16);
+}
+
+bool
+rapp_test_filter_sobel_3x3_vert_u8_s16(void)
+{
+    return rapp_test_s16_driver(&rapp_filter_sobel_3x3_vert_u8_s16,
+                                &rapp_ref_filter_sobel_3x3_vert_u8_s16);
+}
+
+bool
+rapp_test_filter_laplace_3x3_u8_s16(void)
+{
+    return rapp_test_s16_driver(&rapp_filter_laplace_3x3_u8_s16,
+                                &rapp_ref_filter_laplace_3x3_u8_s16);
+}
+
+bool
+rapp_test_filter_highpass_3x3_u8_s16(void)
+{
+    return rapp_test_s16_driver(&rapp_filter_highpass_3x3_u8_s16,
+                                &rapp_ref_filter_highpass_3x3_u8_s16);
+}
+
 bool
 rapp_test_filter_gauss_3x3_u8(void)
 {
@@ -204,6 +441,259 @@ rapp_test_filter_highpass_3x3_abs_u8(void)
                             3, 3, 2, 0.75f, 0.0f);
 }
 
+bool
+rapp_test_filter_conv_u8(void)
+{
+    return rapp_test_conv_driver(false);
+}
+
+bool
+rapp_test_filter_sep_u8(void)
+{
+    return rapp_test_conv_driver(true);
+}
+
+bool
+rapp_test_filter_gauss_u8(void)
+{
+    int sigma;
+
+    /**
+     *  The tolerances cover the 7-bit kernel quantization and the
+     *  box filter approximation at the sharp edges of the test image.
+     */
+
+    /* Test the tabulated kernels */
+    for (sigma = 16; sigma < 48; sigma++) {
+        if (!rapp_test_gauss_driver(sigma, 4, 4.0f)) {
+            return false;
+        }
+    }
+
+    /* Test the box filter approximation */
+    for (sigma = 48; sigma <= 320; sigma += 17) {
+        if (!rapp_test_gauss_driver(sigma, 4, 7.0f)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool
+rapp_test_filter_median_3x3_u8(void)
+{
+    return rapp_test_median_driver(&rapp_filter_median_3x3_u8, 1);
+}
+
+bool
+rapp_test_filter_median_5x5_u8(void)
+{
+    return rapp_test_median_driver(&rapp_filter_median_5x5_u8, 2);
+}
+
+bool
+rapp_test_filter_rank_u8(void)
+{
+    int      rad     = 12;
+    int      pad     = rapp_align(rad);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int      dst_dim = rapp_align(RAPP_TEST_WIDTH);
+    int      size    = src_dim*(RAPP_TEST_HEIGHT + 2*rad);
+    uint8_t *pad_buf = rapp_malloc(size, 0);
+    uint8_t *src_buf = &pad_buf[rad*src_dim + pad];
+    uint8_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *ref_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    void    *work    = rapp_malloc(rapp_filter_rank_worksize_u8(RAPP_TEST_WIDTH,
+                                                                rad), 0);
+    int    (*rank)() = &rapp_filter_rank_u8; /* Unprototyped for overlap */
+    int      k;
+    bool     ok = false;
+
+    /* Run random tests, the reference is slow for large radii */
+    for (k = 0; k < RAPP_TEST_ITER / 4; k++) {
+        int w   = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h   = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int r   = rapp_test_rand(1, rad);
+        int n   = (2*r + 1)*(2*r + 1);
+        int max = (k % 2 == 0) ? 0xff : 7;
+        int rk, i;
+
+        /* Test the extreme ranks and the median in some iterations */
+        switch (k % 4) {
+            case 0:  rk = 0;                        break;
+            case 1:  rk = n - 1;                    break;
+            case 2:  rk = n / 2;                    break;
+            default: rk = rapp_test_rand(0, n - 1); break;
+        }
+
+        /* Initialize the source buffer */
+        for (i = 0; i < size; i++) {
+            pad_buf[i] = rapp_test_rand(0, max);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*rank)(dst_buf, dst_dim, dst_buf, src_dim, w, h,
+                    r, rk, work) != RAPP_ERR_OVERLAP ||
+            (*rank)(dst_buf, dst_dim, src_buf, src_dim, w, h,
+                    r, rk, dst_buf) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the rank filter function */
+        if (rapp_filter_rank_u8(dst_buf, dst_dim, src_buf, src_dim, w, h,
+                                r, rk, work) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_filter_rank_u8(ref_buf, dst_dim, src_buf, src_dim,
+                                w, h, r, rk);
+
+        /* Compare the results */
+        if (!rapp_test_compare_u8(dst_buf, dst_dim,
+                                  ref_buf, dst_dim, w, h))
+        {
+            DBG("Invalid result, radius %d rank %d\n", r, rk);
+            DBG("dst=\n");
+            rapp_test_dump_u8(dst_buf, dst_dim, w, h);
+            DBG("ref=\n");
+            rapp_test_dump_u8(ref_buf, dst_dim, w, h);
+            goto Done;
+        }
+    }
+
+    /* Verify that out-of-range ranks are rejected */
+    if (rapp_filter_rank_u8(dst_buf, dst_dim, src_buf, src_dim, 1, 1,
+                            1, -1, work) != RAPP_ERR_PARM_RANGE ||
+        rapp_filter_rank_u8(dst_buf, dst_dim, src_buf, src_dim, 1, 1,
+                            1, 9, work) != RAPP_ERR_PARM_RANGE)
+    {
+        DBG("Invalid rank accepted\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+    rapp_free(work);
+
+    return ok;
+}
+
+bool
+rapp_test_filter_gauss_3x3_u16(void)
+{
+    return rapp_test_u16_driver(&rapp_filter_gauss_3x3_u16,
+                                &rapp_ref_filter_gauss_3x3_u16);
+}
+
+bool
+rapp_test_filter_median_3x3_u16(void)
+{
+    return rapp_test_u16_driver(&rapp_filter_median_3x3_u16,
+                                &rapp_ref_filter_median_3x3_u16);
+}
+
+bool
+rapp_test_filter_sobel_3x3_horz_u16(void)
+{
+    return rapp_test_u16_driver(&rapp_filter_sobel_3x3_horz_u16,
+                                &rapp_ref_filter_sobel_3x3_horz_u16);
+}
+
+bool
+rapp_test_filter_sobel_3x3_horz_abs_u16(void)
+{
+    return rapp_test_u16_driver(&rapp_filter_sobel_3x3_horz_abs_u16,
+                                &rapp_ref_filter_sobel_3x3_horz_abs_u16);
+}
+
+bool
+rapp_test_filter_sobel_3x3_vert_u16(void)
+{
+    return rapp_test_u16_driver(&rapp_filter_sobel_3x3_vert_u16,
+                                &rapp_ref_filter_sobel_3x3_vert_u16);
+}
+
+bool
+rapp_test_filter_sobel_3x3_vert_abs_u16(void)
+{
+    return rapp_test_u16_driver(&rapp_filter_sobel_3x3_vert_abs_u16,
+                                &rapp_ref_filter_sobel_3x3_vert_abs_u16);
+}
+
+bool
+rapp_test_filter_laplace_3x3_u16(void)
+{
+    return rapp_test_u16_driver(&rapp_filter_laplace_3x3_u16,
+                                &rapp_ref_filter_laplace_3x3_u16);
+}
+
+bool
+rapp_test_filter_laplace_3x3_abs_u16(void)
+{
+    return rapp_test_u16_driver(&rapp_filter_laplace_3x3_abs_u16,
+                                &rapp_ref_filter_laplace_3x3_abs_u16);
+}
+
+bool
+rapp_test_filter_highpass_3x3_u16(void)
+{
+    return rapp_test_u16_driver(&rapp_filter_highpass_3x3_u16,
+                                &rapp_ref_filter_highpass_3x3_u16);
+}
+
+bool
+rapp_test_filter_highpass_3x3_abs_u16(void)
+{
+    return rapp_test_u16_driver(&rapp_filter_highpass_3x3_abs_u16,
+                                &rapp_ref_filter_highpass_3x3_abs_u16);
+}
+
+bool
+rapp_test_filter_census_3x3_u8(void)
+{
+    return rapp_test_census_driver(&rapp_filter_census_3x3_u8,
+                                   &rapp_ref_filter_census_3x3_u8, 1, 1);
+}
+
+bool
+rapp_test_filter_census_5x5_u8_u32(void)
+{
+    return rapp_test_census_driver(&rapp_filter_census_5x5_u8_u32,
+                                   &rapp_ref_filter_census_5x5_u8_u32, 2, 4);
+}
+
+bool
+rapp_test_filter_lbp_3x3_u8(void)
+{
+    return rapp_test_census_driver(&rapp_filter_lbp_3x3_u8,
+                                   &rapp_ref_filter_lbp_3x3_u8, 1, 1);
+}
+
+bool
+rapp_test_filter_census_cost_u8(void)
+{
+    return rapp_test_census_cost_driver(&rapp_filter_census_cost_u8,
+                                        &rapp_ref_filter_census_cost_u8, 1);
+}
+
+bool
+rapp_test_filter_census_cost_u32_u8(void)
+{
+    return rapp_test_census_cost_driver(&rapp_filter_census_cost_u32_u8,
+                                        &rapp_ref_filter_census_cost_u32_u8,
+                                        4);
+}
+
 
 /*
  * -------------------------------------------------------------
@@ -367,3 +857,603 @@ Done:
 
     return ok;
 }
+
+static bool
+rapp_test_s16_driver(int (*func)(), void (*ref)())
+{
+    int      pad     = rapp_align(1);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int      dst_dim = rapp_align(2*RAPP_TEST_WIDTH);
+    int      size    = src_dim*(RAPP_TEST_HEIGHT + 2);
+    uint8_t *pad_buf = rapp_malloc(size, 0);
+    uint8_t *src_buf = &pad_buf[src_dim + pad];
+    int16_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int16_t *ref_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int      k;
+    bool     ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int w = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int i, x, y;
+
+        /* Initialize the source buffer, with extreme values in some runs */
+        for (i = 0; i < size; i++) {
+            pad_buf[i] = (k % 2 == 0) ? rapp_test_rand(0, 0xff)
+                                      : 0xff*rapp_test_rand(0, 1);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(src_buf, src_dim, src_buf, src_dim, w, h) !=
+            RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the filter function */
+        if ((*func)(dst_buf, dst_dim, src_buf, src_dim, w, h) < 0) {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        (*ref)(ref_buf, dst_dim, src_buf, src_dim, w, h);
+
+        /* Compare the results */
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                int j = y*dst_dim/sizeof(int16_t) + x;
+                if (dst_buf[j] != ref_buf[j]) {
+                    DBG("Invalid result at (%d, %d): %d ref=%d\n",
+                        x, y, dst_buf[j], ref_buf[j]);
+                    goto Done;
+                }
+            }
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+
+    return ok;
+}
+
+static bool
+rapp_test_conv_driver(bool separable)
+{
+    int      rad     = 7;
+    int      pad     = rapp_align(rad);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int      dst_dim = rapp_align(RAPP_TEST_WIDTH);
+    int      size    = src_dim*(RAPP_TEST_HEIGHT + 2*rad);
+    uint8_t *pad_buf = rapp_malloc(size, 0);
+    uint8_t *src_buf = &pad_buf[rad*src_dim + pad];
+    uint8_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *ref_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    void    *work    = rapp_malloc(rapp_filter_sep_worksize_u8(RAPP_TEST_WIDTH),
+                                   0);
+    int    (*conv)() = &rapp_filter_conv_u8; /* Unprototyped for overlap */
+    int    (*sep)()  = &rapp_filter_sep_u8;  /* tests with aliased args  */
+    int8_t   kern[15*15];
+    int8_t   xkern[15];
+    int8_t   ykern[15];
+    int      k;
+    bool     ok = false;
+
+    /* Initialize the source buffer */
+    rapp_test_init(pad_buf, 0, size, 1, true);
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int w  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h  = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int kw = 2*rapp_test_rand(0, rad) + 1;
+        int kh = 2*rapp_test_rand(0, rad) + 1;
+        int xs = rapp_test_rand(0, 8);
+        int ys = rapp_test_rand(0, 8);
+        int ret;
+
+        if (separable) {
+            rapp_test_kernel(xkern, kw);
+            rapp_test_kernel(ykern, kh);
+
+            /* Verify that we get an overlap error for overlapping buffers */
+            if ((*sep)(dst_buf, dst_dim, dst_buf, src_dim, w, h,
+                       xkern, kw, xs, ykern, kh, ys,
+                       work) != RAPP_ERR_OVERLAP ||
+                (*sep)(dst_buf, dst_dim, src_buf, src_dim, w, h,
+                       xkern, kw, xs, ykern, kh, ys,
+                       dst_buf) != RAPP_ERR_OVERLAP)
+            {
+                DBG("Overlap undetected\n");
+                goto Done;
+            }
+
+            ret = rapp_filter_sep_u8(dst_buf, dst_dim, src_buf, src_dim,
+                                     w, h, xkern, kw, xs, ykern, kh, ys,
+                                     work);
+            rapp_ref_filter_sep_u8(ref_buf, dst_dim, src_buf, src_dim, w, h,
+                                   xkern, kw, xs, ykern, kh, ys);
+        }
+        else {
+            rapp_test_kernel(kern, kw*kh);
+
+            /* Verify that we get an overlap error for overlapping buffers */
+            if ((*conv)(dst_buf, dst_dim, dst_buf, src_dim, w, h,
+                        kern, kw, kh, xs) != RAPP_ERR_OVERLAP)
+            {
+                DBG("Overlap undetected\n");
+                goto Done;
+            }
+
+            ret = rapp_filter_conv_u8(dst_buf, dst_dim, src_buf, src_dim,
+                                      w, h, kern, kw, kh, xs);
+            rapp_ref_filter_conv_u8(ref_buf, dst_dim, src_buf, src_dim, w, h,
+                                    kern, kw, kh, xs);
+        }
+
+        if (ret < 0) {
+            DBG("Got FAIL return value %d\n", ret);
+            goto Done;
+        }
+
+        /* Compare the results */
+        if (!rapp_test_compare_u8(dst_buf, dst_dim,
+                                  ref_buf, dst_dim, w, h))
+        {
+            DBG("Invalid result, kernel %dx%d\n", kw, kh);
+            DBG("dst=\n");
+            rapp_test_dump_u8(dst_buf, dst_dim, w, h);
+            DBG("ref=\n");
+            rapp_test_dump_u8(ref_buf, dst_dim, w, h);
+            goto Done;
+        }
+    }
+
+    /* Verify that kernels with too large coefficient sums are rejected */
+    memset(kern, 127, 3);
+    if (rapp_filter_conv_u8(dst_buf, dst_dim, src_buf, src_dim, 1, 1,
+                            kern, 3, 1, 0) != RAPP_ERR_PARM_RANGE ||
+        rapp_filter_sep_u8(dst_buf, dst_dim, src_buf, src_dim, 1, 1,
+                           kern, 3, 0, kern, 1, 0,
+                           work) != RAPP_ERR_PARM_RANGE)
+    {
+        DBG("Invalid kernel accepted\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+    rapp_free(work);
+
+    return ok;
+}
+
+/**
+ *  Create a random kernel that satisfies the coefficient sum limits.
+ */
+static void
+rapp_test_kernel(int8_t *kern, int len)
+{
+    int lim = MAX(256 / len, 1);
+    int pos = 0;
+    int neg = 0;
+    int k;
+
+    for (k = 0; k < len; k++) {
+        int val = rapp_test_rand(-MIN(lim, 128), MIN(lim, 127));
+
+        if (pos + val > 128 || neg - val > 128) {
+            val = 0;
+        }
+        if (val > 0) {
+            pos += val;
+        }
+        else {
+            neg -= val;
+        }
+        kern[k] = val;
+    }
+}
+
+/**
+ *  Test Gaussian smoothing against a truncated floating-point Gaussian.
+ *  The source image is smooth random noise, generated by upsampling
+ *  random values on a coarse grid, to keep the test sensitive to
+ *  misplaced filter responses also for large sigma values.
+ */
+static bool
+rapp_test_gauss_driver(int sigma, int iter, float tol)
+{
+    int      rad     = MAX(rapp_filter_gauss_padding_u8(sigma),
+                           (3*sigma + 15) / 16);
+    int      pad     = rapp_align(rad);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int      dst_dim = rapp_align(RAPP_TEST_WIDTH);
+    int      rows    = RAPP_TEST_HEIGHT + 2*rad;
+    int      size    = rapp_filter_gauss_worksize_u8(RAPP_TEST_WIDTH,
+                                                     RAPP_TEST_HEIGHT, sigma);
+    uint8_t *pad_buf = rapp_malloc(src_dim*rows, 0);
+    uint8_t *src_buf = &pad_buf[rad*src_dim + pad];
+    uint8_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    float   *ref_buf = malloc(RAPP_TEST_WIDTH*RAPP_TEST_HEIGHT*sizeof(float));
+    void    *work    = rapp_malloc(size, 0);
+    int    (*func)() = &rapp_filter_gauss_u8; /* For aliased arguments */
+    int      step    = MAX(sigma / 16, 1);
+    int      k;
+    bool     ok = false;
+
+    for (k = 0; k < iter; k++) {
+        int w = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int x, y;
+
+        /* Initialize the source image with piecewise-constant noise */
+        for (y = 0; y < rows; y++) {
+            for (x = 0; x < src_dim; x++) {
+                pad_buf[y*src_dim + x] = (y / step) % 2 == 0 &&
+                                         (x / step) % 2 == 0 ?
+                                         rapp_test_rand(0, 0xff) :
+                                         pad_buf[(y / step)*step*src_dim +
+                                                 (x / step)*step];
+            }
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(dst_buf, dst_dim, dst_buf, src_dim,
+                    w, h, sigma, work) != RAPP_ERR_OVERLAP ||
+            (*func)(dst_buf, dst_dim, src_buf, src_dim,
+                    w, h, sigma, dst_buf) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the filter function */
+        if (rapp_filter_gauss_u8(dst_buf, dst_dim, src_buf, src_dim,
+                                 w, h, sigma, work) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_filter_gauss_u8(ref_buf, w*sizeof(float),
+                                 src_buf, src_dim, w, h, sigma, rad);
+
+        /* Compare the results */
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                float e = fabs(dst_buf[y*dst_dim + x] - ref_buf[y*w + x]);
+                if (e > tol) {
+                    DBG("sigma=%d x=%d y=%d\n", sigma, x, y);
+                    DBG("Error=%.4f\n", e);
+                    DBG("ref=%.4f\n", ref_buf[y*w + x]);
+                    DBG("dst=%d\n", dst_buf[y*dst_dim + x]);
+                    goto Done;
+                }
+            }
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(dst_buf);
+    rapp_free(work);
+    free(ref_buf);
+
+    return ok;
+}
+
+static bool
+rapp_test_median_driver(int (*func)(), int rad)
+{
+    int      pad     = rapp_align(rad);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int      dst_dim = rapp_align(RAPP_TEST_WIDTH);
+    int      size    = src_dim*(RAPP_TEST_HEIGHT + 2*rad);
+    uint8_t *pad_buf = rapp_malloc(size, 0);
+    uint8_t *src_buf = &pad_buf[rad*src_dim + pad];
+    uint8_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *ref_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int      k;
+    bool     ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int w = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int i;
+
+        /**
+         *  Use few distinct pixel values in some of the iterations,
+         *  to get many equal values in the neighbourhoods.
+         */
+        int max = (k % 3 == 0) ? 1 : (k % 3 == 1) ? 3 : 0xff;
+
+        /* Initialize the source buffer */
+        for (i = 0; i < size; i++) {
+            pad_buf[i] = rapp_test_rand(0, max);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(dst_buf, dst_dim, dst_buf, src_dim,
+                    w, h) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the median filter function */
+        if ((*func)(dst_buf, dst_dim, src_buf, src_dim, w, h) < 0) {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_filter_rank_u8(ref_buf, dst_dim, src_buf, src_dim, w, h,
+                                rad, (2*rad + 1)*(2*rad + 1) / 2);
+
+        /* Compare the results */
+        if (!rapp_test_compare_u8(dst_buf, dst_dim,
+                                  ref_buf, dst_dim, w, h))
+        {
+            DBG("Invalid result\n");
+            DBG("src=\n");
+            rapp_test_dump_u8(&src_buf[-rad*src_dim - rad],
+                              src_dim, w + 2*rad, h + 2*rad);
+            DBG("dst=\n");
+            rapp_test_dump_u8(dst_buf, dst_dim, w, h);
+            DBG("ref=\n");
+            rapp_test_dump_u8(ref_buf, dst_dim, w, h);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+
+    return ok;
+}
+
+static bool
+rapp_test_u16_driver(int (*func)(), void (*ref)())
+{
+    int       pad     = rapp_align(2);
+    int       src_dim = rapp_align(2*RAPP_TEST_WIDTH) + 2*pad;
+    int       dst_dim = rapp_align(2*RAPP_TEST_WIDTH);
+    int       size    = src_dim*(RAPP_TEST_HEIGHT + 2);
+    uint8_t  *pad_buf = rapp_malloc(size, 0);
+    uint16_t *src_buf = (uint16_t *)&pad_buf[src_dim + pad];
+    uint16_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint16_t *ref_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint16_t *buf     = (uint16_t *)pad_buf;
+    int       k;
+    bool      ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int w = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int i, x, y;
+
+        /* Initialize the source buffer, with extreme values in some runs */
+        for (i = 0; i < size / 2; i++) {
+            buf[i] = (k % 2 == 0) ? rapp_test_rand(0, 0xffff)
+                                  : 0xffff*rapp_test_rand(0, 1);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(src_buf, src_dim, src_buf, src_dim, w, h) !=
+            RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the filter function */
+        if ((*func)(dst_buf, dst_dim, src_buf, src_dim, w, h) < 0) {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        (*ref)(ref_buf, dst_dim, src_buf, src_dim, w, h);
+
+        /* Compare the results */
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                int j = y*dst_dim/sizeof(uint16_t) + x;
+                if (dst_buf[j] != ref_buf[j]) {
+                    DBG("Invalid result at (%d, %d): %d ref=%d\n",
+                        x, y, dst_buf[j], ref_buf[j]);
+                    goto Done;
+                }
+            }
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+
+    return ok;
+}
+
+static bool
+rapp_test_census_driver(int (*func)(), void (*ref)(), int rad, int size)
+{
+    int      pad     = rapp_align(rad);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int      dst_dim = rapp_align(size*RAPP_TEST_WIDTH);
+    int      len     = src_dim*(RAPP_TEST_HEIGHT + 2*rad);
+    uint8_t *pad_buf = rapp_malloc(len, 0);
+    uint8_t *src_buf = &pad_buf[rad*src_dim + pad];
+    uint8_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *ref_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int      k;
+    bool     ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int w = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int i;
+
+        /**
+         *  Use few distinct pixel values in some of the iterations,
+         *  to get many neighbours equal to the center pixel.
+         */
+        int max = (k % 3 == 0) ? 1 : (k % 3 == 1) ? 3 : 0xff;
+
+        /* Initialize the source buffer */
+        for (i = 0; i < len; i++) {
+            pad_buf[i] = rapp_test_rand(0, max);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(src_buf, dst_dim, src_buf, src_dim,
+                    w, h) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the transform function */
+        if ((*func)(dst_buf, dst_dim, src_buf, src_dim, w, h) < 0) {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        (*ref)(ref_buf, dst_dim, src_buf, src_dim, w, h);
+
+        /* Compare the results */
+        if (!rapp_test_compare_u8(dst_buf, dst_dim,
+                                  ref_buf, dst_dim, size*w, h))
+        {
+            DBG("Invalid result\n");
+            DBG("src=\n");
+            rapp_test_dump_u8(&src_buf[-rad*src_dim - rad],
+                              src_dim, w + 2*rad, h + 2*rad);
+            DBG("dst=\n");
+            rapp_test_dump_u8(dst_buf, dst_dim, size*w, h);
+            DBG("ref=\n");
+            rapp_test_dump_u8(ref_buf, dst_dim, size*w, h);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+
+    return ok;
+}
+
+static bool
+rapp_test_census_cost_driver(int (*func)(), void (*ref)(), int size)
+{
+    int      maxd    = 40;
+    int      src_dim = rapp_align(size*RAPP_TEST_WIDTH);
+    int      dst_dim = rapp_align(RAPP_TEST_WIDTH);
+    int      len     = src_dim*RAPP_TEST_HEIGHT;
+    int      vol     = dst_dim*RAPP_TEST_HEIGHT*maxd;
+    uint8_t *src1    = rapp_malloc(len, 0);
+    uint8_t *src2    = rapp_malloc(len, 0);
+    uint8_t *dst_buf = rapp_malloc(vol, 0);
+    uint8_t *ref_buf = rapp_malloc(vol, 0);
+    int      k;
+    bool     ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER / 4; k++) {
+        int w = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int d = rapp_test_rand(1, maxd);
+        int i;
+
+        /* Initialize the code buffers */
+        for (i = 0; i < len; i++) {
+            src1[i] = rapp_test_rand(0, 0xff);
+            src2[i] = rapp_test_rand(0, 0xff);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(src1, dst_dim, src1, src_dim, src2, src_dim,
+                    w, h, d) != RAPP_ERR_OVERLAP ||
+            (*func)(dst_buf, dst_dim, src1, src_dim, dst_buf, src_dim,
+                    w, h, d) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Verify that we get an error for no disparities
+         * and for a volume too large to be addressed */
+        if ((*func)(dst_buf, dst_dim, src1, src_dim, src2, src_dim,
+                    w, h, 0) != RAPP_ERR_PARM_RANGE ||
+            (*func)(dst_buf, dst_dim, src1, src_dim, src2, src_dim,
+                    w, h, INT_MAX) != RAPP_ERR_PARM_RANGE)
+        {
+            DBG("Invalid disparities undetected\n");
+            goto Done;
+        }
+
+        /* Call the cost volume function */
+        if ((*func)(dst_buf, dst_dim, src1, src_dim, src2, src_dim,
+                    w, h, d) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        (*ref)(ref_buf, dst_dim, src1, src_dim, src2, src_dim, w, h, d);
+
+        /* Compare the results */
+        if (!rapp_test_compare_u8(dst_buf, dst_dim,
+                                  ref_buf, dst_dim, w, d*h))
+        {
+            DBG("Invalid result\n");
+            DBG("w=%d h=%d disparities=%d\n", w, h, d);
+            DBG("dst=\n");
+            rapp_test_dump_u8(dst_buf, dst_dim, w, d*h);
+            DBG("ref=\n");
+            rapp_test_dump_u8(ref_buf, dst_dim, w, d*h);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(src1);
+    rapp_free(src2);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+
+    return ok;
+}
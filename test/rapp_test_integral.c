@@ -68,7 +68,7 @@
 
 static bool
 rapp_test_integral_driver(int (*test)(), void (*ref)(),
-        bool binary, size_t dst_size);
+        int bits, size_t dst_size);
 
 /*
  * -------------------------------------------------------------
@@ -80,35 +80,42 @@ bool
 rapp_test_integral_bin_u8(void)
 {
     return rapp_test_integral_driver(&rapp_integral_sum_bin_u8,
-            &rapp_ref_integral_sum_bin_u8, true, 1);
+            &rapp_ref_integral_sum_bin_u8, 1, 1);
 }
 
 bool
 rapp_test_integral_bin_u16(void)
 {
     return rapp_test_integral_driver(&rapp_integral_sum_bin_u16,
-            &rapp_ref_integral_sum_bin_u16, true, 2);
+            &rapp_ref_integral_sum_bin_u16, 1, 2);
 }
 
 bool
 rapp_test_integral_bin_u32(void)
 {
     return rapp_test_integral_driver(&rapp_integral_sum_bin_u32,
-            &rapp_ref_integral_sum_bin_u32, true, 4);
+            &rapp_ref_integral_sum_bin_u32, 1, 4);
 }
 
 bool
 rapp_test_integral_u8_u16(void)
 {
     return rapp_test_integral_driver(&rapp_integral_sum_u8_u16,
-            &rapp_ref_integral_sum_u8_u16, false, 2);
+            &rapp_ref_integral_sum_u8_u16, 8, 2);
 }
 
 bool
 rapp_test_integral_u8_u32(void)
 {
     return rapp_test_integral_driver(&rapp_integral_sum_u8_u32,
-            &rapp_ref_integral_sum_u8_u32, false, 4);
+            &rapp_ref_integral_sum_u8_u32, 8, 4);
+}
+
+bool
+rapp_test_integral_u16_u32(void)
+{
+    return rapp_test_integral_driver(&rapp_integral_sum_u16_u32,
+            &rapp_ref_integral_sum_u16_u32, 16, 4);
 }
 
 
@@ -120,7 +127,7 @@ rapp_test_integral_u8_u32(void)
 
 static bool
 rapp_test_integral_driver(int (*test)(), void (*ref)(),
-        bool binary, size_t bytes_per_pixel)
+        int bits, size_t bytes_per_pixel)
 {
     uint8_t *src;
     uint8_t *dst1;
@@ -134,7 +141,7 @@ rapp_test_integral_driver(int (*test)(), void (*ref)(),
     int iter;
 
     /* Calculate buffer sizes */
-    src_width = binary ? (RAPP_TEST_WIDTH + 7) / 8 : RAPP_TEST_WIDTH;
+    src_width = (RAPP_TEST_WIDTH*bits + 7) / 8;
     src_dim = rapp_align(src_width);
 
     /* Pad destination buffer to the left */
@@ -158,7 +165,7 @@ rapp_test_integral_driver(int (*test)(), void (*ref)(),
     for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
         int width = rapp_test_rand(1, RAPP_TEST_WIDTH);
         int height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
-        int len = binary ? (width + 7) / 8 : width;
+        int len = (width*bits + 7) / 8;
         int n_rows_cleared = rapp_test_rand(0, height / 4);
         int c;
 
@@ -174,8 +181,7 @@ rapp_test_integral_driver(int (*test)(), void (*ref)(),
             /* src = before dst, but not long enough */
             || (*test)(dst1, dst_dim,
                        dst1 - (src_dim*(height - 1) +
-                               rapp_align(binary ? (width + 7) / 8 :
-                                          width) - rapp_alignment),
+                               rapp_align(len) - rapp_alignment),
                        src_dim, width, height) != RAPP_ERR_OVERLAP)
         {
             DBG("Overlap undetected\n");
@@ -0,0 +1,258 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_test_match.c
+ *  @brief  Correctness tests for template matching.
+ */
+
+#include <stdlib.h>         /* abs()         */
+#include <string.h>         /* memcpy()      */
+#include "rapp.h"           /* RAPP API      */
+#include "rapp_ref_match.h" /* Reference API */
+#include "rapp_test_util.h" /* Test utils    */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The number of test iterations.
+ */
+#define RAPP_TEST_ITER 96
+
+/**
+ *  Test image maximum width and height.
+ */
+#define RAPP_TEST_SIZE 80
+
+/**
+ *  Template minimum and maximum width and height.
+ */
+#define RAPP_TEST_TPL_MIN 4
+#define RAPP_TEST_TPL_MAX 32
+
+/**
+ *  The maximum number of coarse levels.
+ */
+#define RAPP_TEST_LEVELS 3
+
+/**
+ *  The tolerated NCC error, in units of 1/65536.
+ */
+#define RAPP_TEST_NCC_TOL 256
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static bool
+rapp_test_match_better(int32_t score, int32_t best, int mode);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+bool
+rapp_test_match_template_u8(void)
+{
+    int      dim  = rapp_align(RAPP_TEST_SIZE);
+    int      tdim = rapp_align(RAPP_TEST_TPL_MAX);
+    int      size = rapp_match_template_worksize_u8(RAPP_TEST_SIZE,
+                                                    RAPP_TEST_SIZE,
+                                                    RAPP_TEST_TPL_MAX,
+                                                    RAPP_TEST_TPL_MAX,
+                                                    RAPP_MATCH_NCC,
+                                                    RAPP_TEST_LEVELS);
+    uint8_t *src  = rapp_malloc(dim*RAPP_TEST_SIZE, 0);
+    uint8_t *tpl  = rapp_malloc(tdim*RAPP_TEST_TPL_MAX, 0);
+    void    *work = rapp_malloc(size, 0);
+    bool     ok   = false;
+    int      pos[2];
+    int32_t  score;
+    int      iter;
+
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int     mode   = iter % 3;
+        bool    noise  = iter / 3 % 2 != 0;
+        int     tw     = rapp_test_rand(RAPP_TEST_TPL_MIN, RAPP_TEST_TPL_MAX);
+        int     th     = rapp_test_rand(RAPP_TEST_TPL_MIN, RAPP_TEST_TPL_MAX);
+        int     width  = rapp_test_rand(tw, RAPP_TEST_SIZE);
+        int     height = rapp_test_rand(th, RAPP_TEST_SIZE);
+        int     levels = rapp_test_rand(0, RAPP_TEST_LEVELS);
+        int     step, px, py, x, y;
+        int32_t ref;
+
+        /* Use the largest valid number of levels */
+        while (levels > 0 && MIN(tw, th) >> levels < 4) {
+            levels--;
+        }
+
+        /* Cut the template from an even position in the source */
+        step = 1 << levels;
+        px   = rapp_test_rand(0, (width  - tw) / step)*step;
+        py   = rapp_test_rand(0, (height - th) / step)*step;
+        rapp_test_init(src, dim, width, height, true);
+        rapp_test_init(tpl, tdim, tw, th, true);
+        for (y = 0; y < th; y++) {
+            memcpy(&tpl[y*tdim], &src[(py + y)*dim + px], tw);
+        }
+
+        /* Optionally add noise, so the match is not exact */
+        if (noise) {
+            for (y = 0; y < th; y++) {
+                for (x = 0; x < tw; x++) {
+                    int val = tpl[y*tdim + x] + rapp_test_rand(-16, 16);
+                    tpl[y*tdim + x] = CLAMP(val, 0, 0xff);
+                }
+            }
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if (rapp_match_template_u8(src, dim, width, height, tpl, tdim,
+                                   tw, th, mode, levels, pos, &score,
+                                   &src[dim]) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        if (rapp_match_template_u8(src, dim, width, height, tpl, tdim,
+                                   tw, th, mode, levels, pos,
+                                   &score, work) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* The position must be valid, with the reference score */
+        if (pos[0] < 0 || pos[0] > width  - tw ||
+            pos[1] < 0 || pos[1] > height - th)
+        {
+            DBG("Invalid position (%d,%d), width=%d height=%d "
+                "tw=%d th=%d\n", pos[0], pos[1], width, height, tw, th);
+            goto Done;
+        }
+        ref = rapp_ref_match_score_u8(&src[pos[1]*dim + pos[0]], dim,
+                                      tpl, tdim, tw, th, mode);
+        if (mode == RAPP_MATCH_NCC ? abs(score - ref) > RAPP_TEST_NCC_TOL
+                                   : score != ref)
+        {
+            DBG("Invalid score %d (expected %d), mode=%d levels=%d\n",
+                (int)score, (int)ref, mode, levels);
+            goto Done;
+        }
+
+        /* An exact match must be found, also on the coarse levels */
+        if (!noise &&
+            (pos[0] != px || pos[1] != py ||
+             score != (mode == RAPP_MATCH_NCC ? 65536 : 0)))
+        {
+            DBG("Got (%d,%d) with score %d, expected (%d,%d), "
+                "mode=%d levels=%d\n", pos[0], pos[1], (int)score,
+                px, py, mode, levels);
+            goto Done;
+        }
+
+        /* Without coarse levels no position may be better */
+        if (levels == 0) {
+            for (y = 0; y <= height - th; y++) {
+                for (x = 0; x <= width - tw; x++) {
+                    ref = rapp_ref_match_score_u8(&src[y*dim + x], dim,
+                                                  tpl, tdim, tw, th, mode);
+                    if (rapp_test_match_better(ref, score, mode)) {
+                        DBG("Position (%d,%d) with score %d is better "
+                            "than (%d,%d) with score %d, mode=%d\n",
+                            x, y, (int)ref, pos[0], pos[1], (int)score,
+                            mode);
+                        goto Done;
+                    }
+                }
+            }
+        }
+    }
+
+    /* Verify that invalid parameters are rejected */
+    if (rapp_match_template_u8(src, dim, 16, 16, tpl, tdim, 8, 8,
+                               3, 0, pos, &score, work)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_match_template_u8(src, dim, 16, 16, tpl, tdim, 8, 8,
+                               RAPP_MATCH_SAD, 2, pos, &score, work)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_match_template_u8(src, dim, 16, 16, tpl, tdim, 8, 8,
+                               RAPP_MATCH_SAD, 4, pos, &score, work)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_match_template_u8(src, dim, 16, 7, tpl, tdim, 8, 8,
+                               RAPP_MATCH_SAD, 0, pos, &score, work)
+        != RAPP_ERR_IMG_SIZE ||
+        rapp_match_template_worksize_u8(16, 16, 129, 8, RAPP_MATCH_SAD, 0)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_match_template_worksize_u8(16, 7, 8, 8, RAPP_MATCH_NCC, 0)
+        != RAPP_ERR_IMG_SIZE)
+    {
+        DBG("Invalid parameters accepted\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(src);
+    rapp_free(tpl);
+    rapp_free(work);
+
+    return ok;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Check if a reference score is better than the best score.
+ */
+static bool
+rapp_test_match_better(int32_t score, int32_t best, int mode)
+{
+    if (mode == RAPP_MATCH_NCC) {
+        return score > best + RAPP_TEST_NCC_TOL;
+    }
+
+    return score < best;
+}
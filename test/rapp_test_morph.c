@@ -0,0 +1,222 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_test_morph.c
+ *  @brief  Correctness tests for 8-bit morphology.
+ */
+
+#include "rapp.h"             /* RAPP API      */
+#include "rapp_ref_morph.h"   /* Reference API */
+#include "rapp_test_util.h"   /* Test utils    */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The number of test iterations.
+ */
+#define RAPP_TEST_ITER 32
+
+/**
+ *  Test image maximum width.
+ */
+#define RAPP_TEST_WIDTH 128
+
+/**
+ *  Test image maximum height.
+ */
+#define RAPP_TEST_HEIGHT 96
+
+/**
+ *  Maximum structuring element size.
+ */
+#define RAPP_TEST_RECT 40
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static bool
+rapp_test_morph_driver(int (*func)(), void (*ref)(), int scale);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+bool
+rapp_test_morph_erode_rect_u8(void)
+{
+    return rapp_test_morph_driver(&rapp_morph_erode_rect_u8,
+                                  &rapp_ref_morph_erode_rect_u8, 1);
+}
+
+bool
+rapp_test_morph_dilate_rect_u8(void)
+{
+    return rapp_test_morph_driver(&rapp_morph_dilate_rect_u8,
+                                  &rapp_ref_morph_dilate_rect_u8, 1);
+}
+
+bool
+rapp_test_morph_open_rect_u8(void)
+{
+    return rapp_test_morph_driver(&rapp_morph_open_rect_u8,
+                                  &rapp_ref_morph_open_rect_u8, 2);
+}
+
+bool
+rapp_test_morph_close_rect_u8(void)
+{
+    return rapp_test_morph_driver(&rapp_morph_close_rect_u8,
+                                  &rapp_ref_morph_close_rect_u8, 2);
+}
+
+bool
+rapp_test_morph_tophat_rect_u8(void)
+{
+    return rapp_test_morph_driver(&rapp_morph_tophat_rect_u8,
+                                  &rapp_ref_morph_tophat_rect_u8, 2);
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Check a rectangle operation against the reference for random
+ *  image and structuring element sizes, including the line cases.
+ *  The scale is the padding needed relative to erosion and dilation.
+ */
+static bool
+rapp_test_morph_driver(int (*func)(), void (*ref)(), int scale)
+{
+    int      xpad    = scale*rapp_align(RAPP_TEST_RECT / 2);
+    int      ypad    = scale*(RAPP_TEST_RECT / 2);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*xpad;
+    int      dst_dim = rapp_align(RAPP_TEST_WIDTH);
+    int      size    = src_dim*(RAPP_TEST_HEIGHT + 2*ypad);
+    uint8_t *pad_buf = rapp_malloc(size, 0);
+    uint8_t *src_buf = &pad_buf[ypad*src_dim + xpad];
+    uint8_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *ref_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int      wsize   = rapp_morph_worksize_u8(RAPP_TEST_WIDTH,
+                                              RAPP_TEST_HEIGHT,
+                                              RAPP_TEST_RECT,
+                                              RAPP_TEST_RECT);
+    void    *work    = rapp_malloc(wsize, 0);
+    int      k;
+    bool     ok = false;
+
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int w  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int h  = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int wr = rapp_test_rand(1, RAPP_TEST_RECT);
+        int hr = rapp_test_rand(1, RAPP_TEST_RECT);
+        int i;
+
+        /* Test the horizontal and vertical lines in some iterations */
+        switch (k % 4) {
+            case 0:  wr = 1; break;
+            case 1:  hr = 1; break;
+            default:         break;
+        }
+
+        /* Initialize the source buffer */
+        for (i = 0; i < size; i++) {
+            pad_buf[i] = rapp_test_rand(0, 0xff);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(dst_buf, dst_dim, dst_buf, src_dim, w, h,
+                    wr, hr, work) != RAPP_ERR_OVERLAP ||
+            (*func)(dst_buf, dst_dim, src_buf, src_dim, w, h,
+                    wr, hr, dst_buf) != RAPP_ERR_OVERLAP ||
+            (*func)(dst_buf, dst_dim, src_buf, src_dim, w, h,
+                    wr, hr, src_buf) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the morphology function */
+        if ((*func)(dst_buf, dst_dim, src_buf, src_dim, w, h,
+                    wr, hr, work) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        (*ref)(ref_buf, dst_dim, src_buf, src_dim, w, h, wr, hr);
+
+        /* Compare the results */
+        if (!rapp_test_compare_u8(dst_buf, dst_dim,
+                                  ref_buf, dst_dim, w, h))
+        {
+            DBG("Invalid result, SE %dx%d\n", wr, hr);
+            DBG("dst=\n");
+            rapp_test_dump_u8(dst_buf, dst_dim, w, h);
+            DBG("ref=\n");
+            rapp_test_dump_u8(ref_buf, dst_dim, w, h);
+            goto Done;
+        }
+    }
+
+    /* Verify that empty structuring elements are rejected */
+    if ((*func)(dst_buf, dst_dim, src_buf, src_dim, 1, 1,
+                0, 1, work) != RAPP_ERR_PARM_RANGE ||
+        (*func)(dst_buf, dst_dim, src_buf, src_dim, 1, 1,
+                1, 0, work) != RAPP_ERR_PARM_RANGE)
+    {
+        DBG("Invalid SE size accepted\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(pad_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+    rapp_free(work);
+
+    return ok;
+}
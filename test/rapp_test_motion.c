@@ -0,0 +1,225 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_test_motion.c
+ *  @brief  Correctness tests for motion estimation.
+ */
+
+#include "rapp.h"            /* RAPP API      */
+#include "rapp_ref_motion.h" /* Reference API */
+#include "rapp_test_util.h"  /* Test utils    */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The number of test iterations.
+ */
+#define RAPP_TEST_ITER 64
+
+/**
+ *  The maximum number of blocks in each direction.
+ */
+#define RAPP_TEST_BLOCKS 4
+
+/**
+ *  The maximum block size.
+ */
+#define RAPP_TEST_BLOCK 32
+
+/**
+ *  The maximum number of coarse levels.
+ */
+#define RAPP_TEST_LEVELS 3
+
+/**
+ *  Test image maximum width and height.
+ */
+#define RAPP_TEST_SIZE (RAPP_TEST_BLOCKS*RAPP_TEST_BLOCK + 2)
+
+
+/*
+ * -------------------------------------------------------------
+ *  Global variables
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Image displacements that the diamond search always finds,
+ *  if all blocks can be matched.
+ */
+static const int rapp_test_motion_shift[4][2] = {
+    {0, 0}, {2, 0}, {0, 2}, {1, 1}
+};
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+bool
+rapp_test_motion_blockmatch_u8(void)
+{
+    int       dim  = rapp_align(RAPP_TEST_SIZE);
+    int       size = rapp_motion_blockmatch_worksize_u8(RAPP_TEST_SIZE,
+                                                        RAPP_TEST_SIZE,
+                                                        RAPP_TEST_BLOCK,
+                                                        RAPP_TEST_LEVELS);
+    int       num  = RAPP_TEST_BLOCKS*RAPP_TEST_BLOCKS;
+    uint8_t  *cur  = rapp_malloc(dim*RAPP_TEST_SIZE, 0);
+    uint8_t  *ref  = rapp_malloc(dim*RAPP_TEST_SIZE, 0);
+    void     *work = rapp_malloc(size, 0);
+    int8_t    vec[2*RAPP_TEST_BLOCKS*RAPP_TEST_BLOCKS];
+    uint32_t  cost[RAPP_TEST_BLOCKS*RAPP_TEST_BLOCKS];
+    bool      ok = false;
+    int       iter;
+
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int block  = 4*rapp_test_rand(1, RAPP_TEST_BLOCK / 4);
+        int levels = rapp_test_rand(0, RAPP_TEST_LEVELS);
+        int range  = rapp_test_rand(2, 16);
+        int nx     = rapp_test_rand(1, RAPP_TEST_BLOCKS);
+        int ny     = rapp_test_rand(1, RAPP_TEST_BLOCKS);
+        int width  = nx*block + 2;
+        int height = ny*block + 2;
+        int sx     = rapp_test_motion_shift[iter % 4][0];
+        int sy     = rapp_test_motion_shift[iter % 4][1];
+        int x, y, k;
+
+        /* Use the largest valid number of levels */
+        while (block % (1 << levels) != 0 || (block >> levels) < 4) {
+            levels--;
+        }
+
+        /* The current image is the displaced reference image */
+        rapp_test_init(ref, dim, width, height, true);
+        rapp_test_init(cur, dim, width, height, true);
+        for (y = 0; y < height - sy; y++) {
+            for (x = 0; x < width - sx; x++) {
+                cur[y*dim + x] = ref[(y + sy)*dim + x + sx];
+            }
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if (rapp_motion_blockmatch_u8(vec, cost, cur, dim, ref, dim,
+                                      width, height, block, range, levels,
+                                      &cur[dim]) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        if (rapp_motion_blockmatch_u8(vec, cost, cur, dim, ref, dim,
+                                      width, height, block, range, levels,
+                                      work) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        for (k = 0; k < nx*ny && k < num; k++) {
+            int      bx  = k % nx*block;
+            int      by  = k / nx*block;
+            int      dx  = vec[2*k];
+            int      dy  = vec[2*k + 1];
+            uint32_t sad;
+
+            /* The displaced block must be inside the range and image */
+            if (dx < -range || dx > range || dy < -range || dy > range ||
+                bx + dx < 0 || bx + dx + block > width ||
+                by + dy < 0 || by + dy + block > height)
+            {
+                DBG("Invalid vector (%d,%d) of block %d, width=%d "
+                    "height=%d block=%d range=%d levels=%d\n",
+                    dx, dy, k, width, height, block, range, levels);
+                goto Done;
+            }
+
+            /* The cost must be the SAD at the vector */
+            sad = rapp_ref_motion_sad_u8(&cur[by*dim + bx], dim,
+                                         &ref[(by + dy)*dim + bx + dx],
+                                         dim, block, block);
+            if (cost[k] != sad) {
+                DBG("Invalid cost %u of block %d (expected %u), "
+                    "block=%d levels=%d\n",
+                    (unsigned)cost[k], k, (unsigned)sad, block, levels);
+                goto Done;
+            }
+
+            /* Without coarse levels the displacement is found exactly */
+            if (levels == 0 && (dx != sx || dy != sy || cost[k] != 0)) {
+                DBG("Got vector (%d,%d) of block %d, expected (%d,%d), "
+                    "block=%d\n", dx, dy, k, sx, sy, block);
+                goto Done;
+            }
+        }
+    }
+
+    /* Verify that invalid parameters are rejected */
+    if (rapp_motion_blockmatch_u8(vec, cost, cur, dim, ref, dim,
+                                  16, 16, 3, 4, 0, work)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_motion_blockmatch_u8(vec, cost, cur, dim, ref, dim,
+                                  16, 16, 8, 4, 2, work)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_motion_blockmatch_u8(vec, cost, cur, dim, ref, dim,
+                                  16, 16, 12, 4, 2, work)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_motion_blockmatch_u8(vec, cost, cur, dim, ref, dim,
+                                  16, 16, 8, 0, 0, work)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_motion_blockmatch_u8(vec, cost, cur, dim, ref, dim,
+                                  16, 16, 8, 128, 0, work)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_motion_blockmatch_u8(vec, cost, cur, dim, ref, dim,
+                                  7, 16, 8, 4, 0, work)
+        != RAPP_ERR_IMG_SIZE ||
+        rapp_motion_blockmatch_worksize_u8(16, 16, 8, 2)
+        != RAPP_ERR_PARM_RANGE ||
+        rapp_motion_blockmatch_worksize_u8(16, 7, 8, 0)
+        != RAPP_ERR_IMG_SIZE)
+    {
+        DBG("Invalid parameters accepted\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(cur);
+    rapp_free(ref);
+    rapp_free(work);
+
+    return ok;
+}
@@ -30,6 +30,7 @@
  *  @brief  Correctness tests for pixelwise operations.
  */
 
+#include <stdlib.h>         /* malloc()      */
 #include <string.h>         /* memcpy()      */
 #include "rapp.h"           /* RAPP API      */
 #include "rapp_ref_pixop.h" /* Reference API */
@@ -56,6 +57,11 @@
  */
 #define RAPP_TEST_HEIGHT 128
 
+/**
+ *  The maximum number of CLAHE tiles in each direction.
+ */
+#define RAPP_TEST_TILES  16
+
 
 /*
  * -------------------------------------------------------------
@@ -70,6 +76,11 @@ rapp_test_pixop_driver(int (*test)(), void (*ref)(),
 static bool
 rapp_test_pixop_driver2(int (*test)(), void (*ref)(),
                         int arg_min, int arg_max);
+static bool
+rapp_test_pixop_driver16(int (*test)(), void (*ref)());
+
+static void
+rapp_test_pixop_init_range(uint8_t *buf, int dim, int width, int height);
 
 
 /*
@@ -222,6 +233,223 @@ rapp_test_pixop_norm_u8(void)
                                    0, 0);
 }
 
+bool
+rapp_test_pixop_add_u16(void)
+{
+    return rapp_test_pixop_driver16(&rapp_pixop_add_u16,
+                                    &rapp_ref_pixop_add_u16);
+}
+
+bool
+rapp_test_pixop_sub_u16(void)
+{
+    return rapp_test_pixop_driver16(&rapp_pixop_sub_u16,
+                                    &rapp_ref_pixop_sub_u16);
+}
+
+bool
+rapp_test_pixop_suba_u16(void)
+{
+    return rapp_test_pixop_driver16(&rapp_pixop_suba_u16,
+                                    &rapp_ref_pixop_suba_u16);
+}
+
+bool
+rapp_test_pixop_lut_u16_u8(void)
+{
+    int       dim     = rapp_align(2*RAPP_TEST_WIDTH);
+    uint16_t *src_buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t  *dst_buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t  *ref_buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t  *lut     = malloc(0x10000);
+    int       iter;
+    bool      ok = false;
+    int width, height, shift, src_dim, dst_dim;
+
+    /* Initialize the src buffer and the LUT */
+    rapp_test_init((uint8_t *)src_buf, 0, dim*RAPP_TEST_HEIGHT, 1, true);
+    rapp_test_init(lut, 0, 0x10000, 1, true);
+
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        width   = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        height  = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        shift   = rapp_test_rand(0, 15);
+        src_dim = rapp_test_rand(0, 1) ? (int)rapp_align(2*width) : dim;
+        dst_dim = rapp_test_rand(0, 1) ? (int)rapp_align(width)   : dim;
+
+        /* Verify that we get an error for an invalid shift value */
+        if (rapp_pixop_lut_u16_u8(dst_buf, dst_dim, src_buf, src_dim,
+                                  width, height, lut, 16) !=
+            RAPP_ERR_PARM_RANGE)
+        {
+            DBG("Invalid shift value undetected at iteration %d\n", iter);
+            goto Done;
+        }
+
+        /* Call the pixel operation function */
+        if (rapp_pixop_lut_u16_u8(dst_buf, dst_dim, src_buf, src_dim,
+                                  width, height, lut, shift) < 0)
+        {
+            DBG("Got FAIL return value at iteration %d\n", iter);
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_pixop_lut_u16_u8(ref_buf, dst_dim, src_buf, src_dim,
+                                  width, height, lut, shift);
+
+        /* Compare the result */
+        if (!rapp_test_compare_u8(ref_buf, dst_dim, dst_buf,
+                                  dst_dim, width, height))
+        {
+            DBG("Invalid result at iteration %d\ndst=\n", iter);
+            rapp_test_dump_u8(dst_buf, dst_dim, width, height);
+            DBG("ref=\n");
+            rapp_test_dump_u8(ref_buf, dst_dim, width, height);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    if (!ok) {
+        DBG("src_dim=%d, dst_dim=%d, width=%d, height=%d, shift=%d\n",
+            src_dim, dst_dim, width, height, shift);
+    }
+
+    rapp_free(src_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+    free(lut);
+
+    return ok;
+}
+
+bool
+rapp_test_pixop_equalize_u8(void)
+{
+    int      dim     = rapp_align(RAPP_TEST_WIDTH);
+    uint8_t *dst_buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *ref_buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    int      iter;
+    bool     ok = false;
+    int width, height;
+
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+
+        /* Initialize the buffers with a random value range */
+        rapp_test_pixop_init_range(dst_buf, dim, width, height);
+        memcpy(ref_buf, dst_buf, dim*height);
+
+        /* Call the equalization function */
+        if (rapp_pixop_equalize_u8(dst_buf, dim, width, height) < 0) {
+            DBG("Got FAIL return value at iteration %d\n", iter);
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_pixop_equalize_u8(ref_buf, dim, width, height);
+
+        /* Compare the result */
+        if (!rapp_test_compare_u8(ref_buf, dim, dst_buf,
+                                  dim, width, height))
+        {
+            DBG("Invalid result at iteration %d\ndst=\n", iter);
+            rapp_test_dump_u8(dst_buf, dim, width, height);
+            DBG("ref=\n");
+            rapp_test_dump_u8(ref_buf, dim, width, height);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    if (!ok) {
+        DBG("width=%d, height=%d\n", width, height);
+    }
+
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+
+    return ok;
+}
+
+bool
+rapp_test_pixop_clahe_u8(void)
+{
+    int      dim     = rapp_align(RAPP_TEST_WIDTH);
+    uint8_t *dst_buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *ref_buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    void    *work    = rapp_malloc(rapp_pixop_clahe_worksize_u8
+                                   (RAPP_TEST_WIDTH, RAPP_TEST_TILES), 0);
+    int      iter;
+    bool     ok = false;
+    int width, height, tiles, clip;
+
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        tiles  = rapp_test_rand(1, MIN(MIN(width, height),
+                                       RAPP_TEST_TILES));
+        clip   = rapp_test_rand(16, 4096);
+
+        /* Initialize the buffers with a random value range */
+        rapp_test_pixop_init_range(dst_buf, dim, width, height);
+        memcpy(ref_buf, dst_buf, dim*height);
+
+        /* Verify that we get an error for invalid parameters */
+        if (rapp_pixop_clahe_u8(dst_buf, dim, width, height,
+                                tiles, 15, work) != RAPP_ERR_PARM_RANGE ||
+            rapp_pixop_clahe_u8(dst_buf, dim, width, height,
+                                MAX(width, height) + 1, clip, work) !=
+            RAPP_ERR_PARM_RANGE)
+        {
+            DBG("Invalid parameter undetected at iteration %d\n", iter);
+            goto Done;
+        }
+
+        /* Call the CLAHE function */
+        if (rapp_pixop_clahe_u8(dst_buf, dim, width, height,
+                                tiles, clip, work) < 0)
+        {
+            DBG("Got FAIL return value at iteration %d\n", iter);
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_pixop_clahe_u8(ref_buf, dim, width, height, tiles, clip);
+
+        /* Compare the result */
+        if (!rapp_test_compare_u8(ref_buf, dim, dst_buf,
+                                  dim, width, height))
+        {
+            DBG("Invalid result at iteration %d\ndst=\n", iter);
+            rapp_test_dump_u8(dst_buf, dim, width, height);
+            DBG("ref=\n");
+            rapp_test_dump_u8(ref_buf, dim, width, height);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    if (!ok) {
+        DBG("width=%d, height=%d, tiles=%d, clip=%d\n",
+            width, height, tiles, clip);
+    }
+
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+    rapp_free(work);
+
+    return ok;
+}
+
 
 /*
  * -------------------------------------------------------------
@@ -383,3 +611,83 @@ Done:
 
     return ok;
 }
+
+static bool
+rapp_test_pixop_driver16(int (*test)(), void (*ref)())
+{
+    int       dim     = rapp_align(2*RAPP_TEST_WIDTH);
+    uint16_t *src_buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint16_t *dst_buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint16_t *ref_buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    int       iter;
+    bool      ok = false;
+    int width, height, src_dim, dst_dim;
+
+    /* Initialize the src buffer */
+    rapp_test_init((uint8_t *)src_buf, 0, dim*RAPP_TEST_HEIGHT, 1, true);
+
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        width   = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        height  = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        src_dim = rapp_test_rand(0, 1) ? (int)rapp_align(2*width) : dim;
+        dst_dim = rapp_test_rand(0, 1) ? (int)rapp_align(2*width) : dim;
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*test)(dst_buf, dst_dim, dst_buf, src_dim,
+                    width, height) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected at iteration %d\n", iter);
+            goto Done;
+        }
+
+        /* Initialize the dst and ref buffers */
+        rapp_test_init((uint8_t *)dst_buf, 0, dst_dim*height, 1, true);
+        memcpy(ref_buf, dst_buf, dst_dim*height);
+
+        /* Call the pixel operation function */
+        if ((*test)(dst_buf, dst_dim, src_buf, src_dim, width, height) < 0) {
+            DBG("Got FAIL return value at iteration %d\n", iter);
+            goto Done;
+        }
+
+        /* Call the reference function */
+        (*ref)(ref_buf, dst_dim, src_buf, src_dim, width, height);
+
+        /* Compare the result */
+        if (!rapp_test_compare_u8((uint8_t *)ref_buf, dst_dim,
+                                  (uint8_t *)dst_buf, dst_dim,
+                                  2*width, height))
+        {
+            DBG("Invalid result at iteration %d\n", iter);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    if (!ok) {
+        DBG("src_dim=%d, dst_dim=%d, width=%d, height=%d\n",
+            src_dim, dst_dim, width, height);
+    }
+
+    rapp_free(src_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+
+    return ok;
+}
+
+static void
+rapp_test_pixop_init_range(uint8_t *buf, int dim, int width, int height)
+{
+    int min = rapp_test_rand(0, 0xff);
+    int max = rapp_test_rand(min, 0xff);
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            buf[y*dim + x] = rapp_test_rand(min, max);
+        }
+    }
+}
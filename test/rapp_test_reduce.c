@@ -27,7 +27,7 @@
 
 /**
  *  @file   rapp_test_reduce.c
- *  @brief  Correctness tests for 8-bit 2x reduction.
+ *  @brief  Correctness tests for 8-bit and 16-bit 2x reduction.
  */
 
 #include <string.h>          /* memcpy()       */
@@ -110,6 +110,74 @@ rapp_test_reduce_2x2_u8(void)
                             2, 2, 0.5f);
 }
 
+bool
+rapp_test_reduce_2x2_u16(void)
+{
+    int       src_dim = rapp_align(2*RAPP_TEST_WIDTH);
+    int       dst_dim = rapp_align(RAPP_TEST_WIDTH);
+    uint16_t *src_buf = rapp_malloc(src_dim*RAPP_TEST_HEIGHT, 0);
+    uint16_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT / 2, 0);
+    float    *ref_buf = malloc(RAPP_TEST_WIDTH*RAPP_TEST_HEIGHT*sizeof(float));
+    int     (*func)() = &rapp_reduce_2x2_u16; /* Unprototyped for overlap */
+    int       k;
+    bool      ok = false;
+
+    /* Run random tests */
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int w = rapp_test_rand(2, RAPP_TEST_WIDTH);
+        int h = rapp_test_rand(2, RAPP_TEST_HEIGHT);
+        int i, x, y;
+
+        /* Initialize the source buffer, with extreme values in some runs */
+        for (i = 0; i < src_dim*RAPP_TEST_HEIGHT / 2; i++) {
+            src_buf[i] = (k % 2 == 0) ? rapp_test_rand(0, 0xffff)
+                                      : 0xffff*rapp_test_rand(0, 1);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*func)(src_buf, dst_dim, src_buf, src_dim,
+                    w, h) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_reduce_2x2_u16(ref_buf, w*sizeof(float),
+                                src_buf, src_dim, w, h);
+
+        /* Call the reduction function */
+        if (rapp_reduce_2x2_u16(dst_buf, dst_dim, src_buf, src_dim,
+                                w, h) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Compare the results */
+        for (y = 0; y < h/2; y++) {
+            for (x = 0; x < w/2; x++) {
+                int   j = y*dst_dim/sizeof(uint16_t) + x;
+                float e = fabs(ref_buf[y*w + x] - dst_buf[j]);
+                if (e > 0.5f) {
+                    DBG("Error=%.4f at x=%d, y=%d\n", e, x, y);
+                    DBG("ref=%.4f dst=%d\n", ref_buf[y*w + x], dst_buf[j]);
+                    goto Done;
+                }
+            }
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(src_buf);
+    rapp_free(dst_buf);
+    free(ref_buf);
+
+    return ok;
+}
+
 
 /*
  * -------------------------------------------------------------
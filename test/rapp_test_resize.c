@@ -0,0 +1,165 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_test_resize.c
+ *  @brief  Correctness tests for 8-bit resizing.
+ */
+
+#include "rapp.h"            /* RAPP API       */
+#include "rapp_ref_resize.h" /* Reference API  */
+#include "rapp_test_util.h"  /* Test utilities */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Constants
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The number of test iterations.
+ */
+#define RAPP_TEST_ITER 384
+
+/**
+ *  Test image maximum width and height.
+ */
+#define RAPP_TEST_SIZE 96
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+bool
+rapp_test_resize_u8(void)
+{
+    int      dim   = rapp_align(RAPP_TEST_SIZE);
+    int      size  = rapp_resize_worksize_u8(RAPP_TEST_SIZE, RAPP_TEST_SIZE,
+                                             RAPP_TEST_SIZE, RAPP_TEST_SIZE,
+                                             RAPP_RESIZE_BILINEAR);
+    uint8_t *src   = rapp_malloc(dim*RAPP_TEST_SIZE, 0);
+    uint8_t *dst   = rapp_malloc(dim*RAPP_TEST_SIZE, 0);
+    uint8_t *ref   = rapp_malloc(dim*RAPP_TEST_SIZE, 0);
+    void    *work  = NULL;
+    bool     ok    = false;
+    int      iter;
+
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int mode = iter % 3;
+        int sw   = rapp_test_rand(1, RAPP_TEST_SIZE);
+        int sh   = rapp_test_rand(1, RAPP_TEST_SIZE);
+        int dw   = rapp_test_rand(1, RAPP_TEST_SIZE);
+        int dh   = rapp_test_rand(1, RAPP_TEST_SIZE);
+        int len;
+
+        /* Keep the area mode within the largest downscaling factor */
+        if (mode == RAPP_RESIZE_AREA) {
+            dw = MAX(dw, (sw + 15) / 16);
+            dh = MAX(dh, (sh + 15) / 16);
+        }
+
+        /* Allocate the working buffer */
+        len = rapp_resize_worksize_u8(dw, dh, sw, sh, mode);
+        if (len < 0) {
+            DBG("Got FAIL return value from worksize\n");
+            goto Done;
+        }
+        if (len > size) {
+            rapp_free(work);
+            work = NULL;
+        }
+        if (!work) {
+            size = MAX(len, size);
+            work = rapp_malloc(size, 0);
+        }
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if (rapp_resize_u8(dst, dim, dw, dh, &dst[(dh - 1)*dim], dim, sw, sh,
+                           mode, work) != RAPP_ERR_OVERLAP ||
+            rapp_resize_u8(dst, dim, dw, dh, src, dim, sw, sh,
+                           mode, &dst[(dh - 1)*dim]) != RAPP_ERR_OVERLAP ||
+            rapp_resize_u8(dst, dim, dw, dh, src, dim, sw, sh,
+                           mode, &src[(sh - 1)*dim]) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        /* Resize a random image */
+        rapp_test_init(src, dim, sw, sh, true);
+        if (rapp_resize_u8(dst, dim, dw, dh, src, dim, sw, sh,
+                           mode, work) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_resize_u8(ref, dim, dw, dh, src, dim, sw, sh, mode);
+
+        /* Compare the results */
+        if (!rapp_test_compare_u8(dst, dim, ref, dim, dw, dh)) {
+            DBG("Invalid result, mode %d, %dx%d -> %dx%d\n",
+                mode, sw, sh, dw, dh);
+            DBG("src=\n");
+            rapp_test_dump_u8(src, dim, sw, sh);
+            DBG("dst=\n");
+            rapp_test_dump_u8(dst, dim, dw, dh);
+            DBG("ref=\n");
+            rapp_test_dump_u8(ref, dim, dw, dh);
+            goto Done;
+        }
+    }
+
+    /* Verify that an invalid mode and a too large factor are rejected */
+    if (rapp_resize_u8(dst, dim, 1, 1, src, dim, 1, 1,
+                       -1, work) != RAPP_ERR_PARM_RANGE ||
+        rapp_resize_u8(dst, dim, 1, 1, src, dim, 1, 1,
+                       3, work) != RAPP_ERR_PARM_RANGE ||
+        rapp_resize_u8(dst, dim, 1, 2, src, dim, 17, 2,
+                       RAPP_RESIZE_AREA, work) != RAPP_ERR_IMG_SIZE ||
+        rapp_resize_worksize_u8(2, 1, 2, 17,
+                                RAPP_RESIZE_AREA) != RAPP_ERR_IMG_SIZE)
+    {
+        DBG("Invalid arguments accepted\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(src);
+    rapp_free(dst);
+    rapp_free(ref);
+    rapp_free(work);
+
+    return ok;
+}
@@ -58,6 +58,11 @@
  */
 #define RAPP_TEST_HEIGHT 128
 
+/**
+ *  The maximum number of top-K positions.
+ */
+#define RAPP_TEST_TOPK 16
+
 /**
  *  The result buffer magic number.
  */
@@ -75,6 +80,23 @@ static bool
 rapp_test_stat_driver(int32_t (*test)(), int32_t (*ref)(),
                       int border, bool binary);
 
+static bool
+rapp_test_stat_driver16(int32_t (*test)(), int32_t (*ref)(), int border);
+
+static bool
+rapp_test_stat_hist_driver(bool binned);
+
+static void
+rapp_test_stat_init_u8(uint8_t *buf, int dim,
+                       int width, int height, int iter);
+
+static bool
+rapp_test_stat_diff_driver(int (*test)(), uintmax_t (*ref)());
+
+static void
+rapp_test_stat_init_pair(uint8_t *src1, uint8_t *src2, int dim,
+                         int width, int height, int iter);
+
 
 /*
  * -------------------------------------------------------------
@@ -188,6 +210,442 @@ rapp_test_stat_max_u8(void)
                                  0, false);
 }
 
+bool
+rapp_test_stat_sum_u16(void)
+{
+    assert(sizeof(int) == sizeof(int32_t));
+    return rapp_test_stat_driver16((int32_t (*)())&rapp_stat_sum_u16,
+                                   (int32_t (*)())&rapp_ref_stat_sum_u16,
+                                   0);
+}
+
+bool
+rapp_test_stat_min_u16(void)
+{
+    assert(sizeof(int) == sizeof(int32_t));
+    return rapp_test_stat_driver16((int32_t (*)())&rapp_stat_min_u16,
+                                   (int32_t (*)())&rapp_ref_stat_min_u16,
+                                   0xffff);
+}
+
+bool
+rapp_test_stat_max_u16(void)
+{
+    assert(sizeof(int) == sizeof(int32_t));
+    return rapp_test_stat_driver16((int32_t (*)())&rapp_stat_max_u16,
+                                   (int32_t (*)())&rapp_ref_stat_max_u16,
+                                   0);
+}
+
+bool
+rapp_test_stat_hist_u8(void)
+{
+    return rapp_test_stat_hist_driver(false);
+}
+
+bool
+rapp_test_stat_hist_bins_u8(void)
+{
+    return rapp_test_stat_hist_driver(true);
+}
+
+bool
+rapp_test_stat_mask_u8(void)
+{
+    int       dim     = rapp_align(RAPP_TEST_WIDTH);
+    int       map_dim = rapp_align((RAPP_TEST_WIDTH + 7) / 8);
+    uint8_t  *buf     = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t  *map     = rapp_malloc(map_dim*RAPP_TEST_HEIGHT, 0);
+    bool      ok      = false;
+    int       iter;
+
+    /* Perform tests */
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int       width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int       height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int       run    = rapp_test_rand(1, 512);
+        uintmax_t sum[4] = {0, 0, 0, RAPP_TEST_MAGIC};
+        uint64_t  ref[5];
+        int       t, min, max;
+
+        /* Initialize the image with non-zero padding */
+        rapp_test_init(buf, dim, dim, height, true);
+
+        /* Initialize the mask, with long empty runs or no pixels at all */
+        if (iter % 16 == 0) {
+            memset(map, 0, map_dim*height);
+        }
+        else {
+            rapp_test_init_mask(map, map_dim*height, run);
+            rapp_pad_align_bin(map, map_dim, 0, width, height, 0);
+        }
+
+        /* Call the statistical functions */
+        t   = rapp_stat_sum_mask_u8(buf, dim, map, map_dim, width, height);
+        min = rapp_stat_min_mask_u8(buf, dim, map, map_dim, width, height);
+        max = rapp_stat_max_mask_u8(buf, dim, map, map_dim, width, height);
+        if (t < 0 || min < 0 || max < 0 ||
+            rapp_stat_sum2_mask_u8(buf, dim, map, map_dim,
+                                   width, height, sum) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_stat_mask_u8(buf, dim, map, map_dim, width, height, ref);
+
+        /* Compare the results */
+        if ((uint64_t)t != ref[0] ||
+            sum[0] != ref[0] || sum[1] != ref[1] || sum[2] != ref[2] ||
+            sum[3] != RAPP_TEST_MAGIC ||
+            (uint64_t)min != ref[3] || (uint64_t)max != ref[4])
+        {
+            DBG("Failed; width=%d height=%d run=%d\n", width, height, run);
+            DBG("sum=%d/%ju sum2=%ju count=%ju min=%d max=%d\n",
+                t, sum[0], sum[1], sum[2], min, max);
+            DBG("ref=%ju sum2=%ju count=%ju min=%d max=%d\n",
+                (uintmax_t)ref[0], (uintmax_t)ref[1],
+                (uintmax_t)ref[2], (int)ref[3], (int)ref[4]);
+            goto Done;
+        }
+    }
+
+    /* Check that a missing mask is rejected */
+    if (rapp_stat_sum_mask_u8(buf, dim, NULL, map_dim, 1, 1) >= 0 ||
+        rapp_stat_max_mask_u8(buf, dim, NULL, map_dim, 1, 1) >= 0)
+    {
+        DBG("Missing mask not detected\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    /* Release buffers */
+    rapp_free(buf);
+    rapp_free(map);
+
+    return ok;
+}
+
+
+bool
+rapp_test_stat_minmax_loc_bin(void)
+{
+    int      dim = rapp_align((RAPP_TEST_WIDTH + 7) / 8);
+    uint8_t *buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    bool     ok  = false;
+    int      iter;
+
+    /* Perform tests */
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int      width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int      height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int      fill   = iter % 4;
+        int      minmax[2], ref[2];
+        unsigned pos[4], rpos[4];
+
+        /* Initialize the image with long runs, or all clear or set,
+         * and the padding set to the opposite value */
+        if (fill < 2) {
+            memset(buf, fill ? 0xff : 0, dim*height);
+        }
+        else {
+            rapp_test_init_mask(buf, dim*height, rapp_test_rand(1, 1024));
+        }
+        rapp_pad_align_bin(buf, dim, 0, width, height, fill != 1);
+
+        /* Call the statistical function */
+        if (rapp_stat_minmax_loc_bin(buf, dim, width, height,
+                                     minmax, pos) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_stat_minmax_loc_bin(buf, dim, width, height, ref, rpos);
+
+        /* Compare the results */
+        if (minmax[0] != ref[0] || minmax[1] != ref[1] ||
+            memcmp(pos, rpos, sizeof pos) != 0)
+        {
+            DBG("Failed; width=%d height=%d\n", width, height);
+            DBG("min=%d (%u,%u) max=%d (%u,%u)\n",
+                minmax[0], pos[0], pos[1], minmax[1], pos[2], pos[3]);
+            DBG("ref=%d (%u,%u) max=%d (%u,%u)\n",
+                ref[0], rpos[0], rpos[1], ref[1], rpos[2], rpos[3]);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(buf);
+    return ok;
+}
+
+bool
+rapp_test_stat_minmax_loc_u8(void)
+{
+    int      dim = rapp_align(RAPP_TEST_WIDTH);
+    uint8_t *buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    bool     ok  = false;
+    int      iter;
+
+    /* Perform tests */
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int      width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int      height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int      minmax[2], ref[2];
+        unsigned pos[4], rpos[4];
+
+        /* Initialize the image, with many equal values in every
+         * other iteration, and the padding set to the extreme values */
+        rapp_test_stat_init_u8(buf, dim, width, height, iter);
+        rapp_pad_align_u8(buf, dim, width, height, iter & 4 ? 0xff : 0);
+
+        /* Call the statistical function */
+        if (rapp_stat_minmax_loc_u8(buf, dim, width, height,
+                                    minmax, pos) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_stat_minmax_loc_u8(buf, dim, width, height, ref, rpos);
+
+        /* Compare the results */
+        if (minmax[0] != ref[0] || minmax[1] != ref[1] ||
+            memcmp(pos, rpos, sizeof pos) != 0)
+        {
+            DBG("Failed; width=%d height=%d\n", width, height);
+            DBG("min=%d (%u,%u) max=%d (%u,%u)\n",
+                minmax[0], pos[0], pos[1], minmax[1], pos[2], pos[3]);
+            DBG("ref=%d (%u,%u) max=%d (%u,%u)\n",
+                ref[0], rpos[0], rpos[1], ref[1], rpos[2], rpos[3]);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(buf);
+    return ok;
+}
+
+bool
+rapp_test_stat_max_k_u8(void)
+{
+    int       dim = rapp_align(RAPP_TEST_WIDTH);
+    uint8_t  *buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    unsigned  pos[2*RAPP_TEST_TOPK + 1];
+    unsigned  ref[2*RAPP_TEST_TOPK];
+    bool      ok  = false;
+    int       iter;
+
+    /* Perform tests */
+    for (iter = 0; iter < RAPP_TEST_ITER / 4; iter++) {
+        int width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int height = rapp_test_rand(1, RAPP_TEST_HEIGHT / 2);
+        int k      = rapp_test_rand(1, RAPP_TEST_TOPK);
+        int num, rnum;
+
+        /* Use a small image in some iterations to get fewer than k */
+        if (iter % 16 == 0) {
+            width  = rapp_test_rand(1, 4);
+            height = rapp_test_rand(1, 4);
+        }
+
+        /* Initialize the image, with the padding set to the max value */
+        rapp_test_stat_init_u8(buf, dim, width, height, iter);
+        rapp_pad_align_u8(buf, dim, width, height, 0xff);
+
+        /* Initialize the output, with a guard at the end */
+        memset(pos, 0x5a, sizeof pos);
+
+        /* Call the statistical function */
+        num = rapp_stat_max_k_u8(buf, dim, width, height, pos, k);
+        if (num < 0) {
+            DBG("Got FAIL return value %d\n", num);
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rnum = rapp_ref_stat_max_k_u8(buf, dim, width, height, ref, k);
+
+        /* Compare the results */
+        if (num != rnum || memcmp(pos, ref, 2*num*sizeof *pos) != 0 ||
+            pos[2*k] != 0x5a5a5a5a)
+        {
+            DBG("Failed; width=%d height=%d k=%d num=%d (expected %d)\n",
+                width, height, k, num, rnum);
+            goto Done;
+        }
+    }
+
+    /* Check that an invalid k is rejected */
+    if (rapp_stat_max_k_u8(buf, dim, 1, 1, pos, 0) != RAPP_ERR_PARM_RANGE) {
+        DBG("Invalid k not detected\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(buf);
+    return ok;
+}
+
+bool
+rapp_test_stat_tiles_u8(void)
+{
+    int       dim  = rapp_align(RAPP_TEST_WIDTH);
+    int       size = RAPP_TEST_WIDTH*RAPP_TEST_HEIGHT; /* Max tile count */
+    uint8_t  *buf  = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint32_t *sum  = rapp_malloc(size*sizeof *sum, 0);
+    uint32_t *rsum = rapp_malloc(size*sizeof *rsum, 0);
+    uint8_t  *min  = rapp_malloc(size, 0);
+    uint8_t  *rmin = rapp_malloc(size, 0);
+    uint8_t  *max  = rapp_malloc(size, 0);
+    uint8_t  *rmax = rapp_malloc(size, 0);
+    bool      ok   = false;
+    int       iter;
+
+    /* Perform tests */
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int tile_w = rapp_test_rand(1, 4*rapp_alignment);
+        int tile_h = rapp_test_rand(1, 32);
+        int num    = ((width  + tile_w - 1) / tile_w)*
+                     ((height + tile_h - 1) / tile_h);
+
+        /* Initialize the image, with the padding set to the extreme
+         * values in alternating iterations */
+        rapp_test_stat_init_u8(buf, dim, width, height, iter);
+        rapp_pad_align_u8(buf, dim, width, height, iter & 2 ? 0xff : 0);
+
+        /* Call the statistical function */
+        if (rapp_stat_tiles_u8(buf, dim, width, height,
+                               tile_w, tile_h, sum, min, max) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_stat_tiles_u8(buf, dim, width, height,
+                               tile_w, tile_h, rsum, rmin, rmax);
+
+        /* Compare the results */
+        if (memcmp(sum, rsum, num*sizeof *sum) != 0 ||
+            memcmp(min, rmin, num) != 0 || memcmp(max, rmax, num) != 0)
+        {
+            DBG("Failed; width=%d height=%d tile=%dx%d\n",
+                width, height, tile_w, tile_h);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(buf);
+    rapp_free(sum);
+    rapp_free(rsum);
+    rapp_free(min);
+    rapp_free(rmin);
+    rapp_free(max);
+    rapp_free(rmax);
+    return ok;
+}
+
+bool
+rapp_test_stat_sad_u8(void)
+{
+    return rapp_test_stat_diff_driver(&rapp_stat_sad_u8,
+                                      &rapp_ref_stat_sad_u8);
+}
+
+bool
+rapp_test_stat_ssd_u8(void)
+{
+    return rapp_test_stat_diff_driver(&rapp_stat_ssd_u8,
+                                      &rapp_ref_stat_ssd_u8);
+}
+
+bool
+rapp_test_stat_ssim_u8(void)
+{
+    int      dim  = rapp_align(RAPP_TEST_WIDTH);
+    int      size = rapp_stat_ssim_worksize_u8(RAPP_TEST_WIDTH);
+    uint8_t *src1 = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *src2 = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    void    *work = rapp_malloc(size, 0);
+    bool     ok   = false;
+    int32_t  ssim;
+    int      iter;
+
+    /* Perform tests */
+    for (iter = 0; iter < RAPP_TEST_ITER / 16; iter++) {
+        int     width  = rapp_test_rand(8, RAPP_TEST_WIDTH);
+        int     height = rapp_test_rand(8, RAPP_TEST_HEIGHT / 2);
+        int32_t ref;
+
+        /* Initialize the images, with different padding values */
+        rapp_test_stat_init_pair(src1, src2, dim, width, height, iter);
+        rapp_pad_align_u8(src1, dim, width, height, 0);
+        rapp_pad_align_u8(src2, dim, width, height, 0xff);
+
+        /* Call the statistical function */
+        if (rapp_stat_ssim_u8(src1, dim, src2, dim, width, height,
+                              &ssim, work) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        ref = rapp_ref_stat_ssim_u8(src1, dim, src2, dim, width, height);
+
+        /* Compare the results */
+        if (ssim != ref) {
+            DBG("Failed; width=%d height=%d ssim=%ld (expected %ld)\n",
+                width, height, (long)ssim, (long)ref);
+            goto Done;
+        }
+    }
+
+    /* Check that identical images give exactly one */
+    if (rapp_stat_ssim_u8(src1, dim, src1, dim, 8, 8, &ssim, work) < 0 ||
+        ssim != 0x10000)
+    {
+        DBG("Identical images not detected\n");
+        goto Done;
+    }
+
+    /* Check that an image smaller than the window is rejected */
+    if (rapp_stat_ssim_u8(src1, dim, src2, dim, 7, 8,
+                          &ssim, work) != RAPP_ERR_IMG_SIZE)
+    {
+        DBG("Too small image not detected\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(src1);
+    rapp_free(src2);
+    rapp_free(work);
+    return ok;
+}
+
 
 /*
  * -------------------------------------------------------------
@@ -264,3 +722,220 @@ rapp_test_stat_driver(int32_t (*test)(), int32_t (*ref)(),
 
     return true;
 }
+
+static bool
+rapp_test_stat_driver16(int32_t (*test)(), int32_t (*ref)(), int border)
+{
+    int       dim = rapp_align(2*RAPP_TEST_WIDTH);
+    uint16_t *buf = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    int       iter;
+
+    /* Perform tests */
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int       width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int       height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        uintmax_t tsum   = RAPP_TEST_MAGIC;
+        uint64_t  rsum   = RAPP_TEST_MAGIC;
+        int32_t   t, r;
+        int       x, y;
+
+        /* Initialize the buffer, with the padding set to the border value */
+        rapp_test_init((uint8_t *)buf, dim, 2*width, height, true);
+        for (y = 0; y < height; y++) {
+            for (x = width; x < dim / 2; x++) {
+                buf[y*dim/2 + x] = border;
+            }
+        }
+
+        /* Call the statistical function */
+        t = (*test)(buf, dim, width, height, &tsum);
+        if (t < 0) {
+            DBG("Got FAIL return value %d\n", (int) t);
+            return false;
+        }
+
+        /* Call the reference function */
+        r = (*ref)(buf, dim, width, height, &rsum);
+
+        /* Compare the return values if the sum is unused */
+        if (tsum == RAPP_TEST_MAGIC ? t != r : tsum != rsum) {
+            DBG("Failed; result is %d/%ju (expected %d/%ju)\n",
+                (int) t, tsum, (int) r, (uintmax_t) rsum);
+            return false;
+        }
+    }
+
+    /* Release buffer */
+    rapp_free(buf);
+
+    return true;
+}
+
+static bool
+rapp_test_stat_hist_driver(bool binned)
+{
+    int       dim     = rapp_align(RAPP_TEST_WIDTH);
+    int       map_dim = rapp_align((RAPP_TEST_WIDTH + 7) / 8);
+    uint8_t  *buf     = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t  *map     = rapp_malloc(map_dim*RAPP_TEST_HEIGHT, 0);
+    uint32_t  hist[257];
+    uint32_t  ref[256];
+    bool      ok = false;
+    int       iter;
+
+    /* Perform tests */
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int      width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int      height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int      bins   = binned ? 1 << rapp_test_rand(0, 8) : 256;
+        bool     mask   = rapp_test_rand(0, 1);
+        uint8_t *mptr   = mask ? map : NULL;
+        int      ret;
+
+        /* Initialize the buffers, with non-zero padding */
+        rapp_test_init(buf, dim, dim, height, true);
+        rapp_test_init_mask(map, map_dim*height, 64);
+
+        /* Initialize the histogram, with a guard bin at the end */
+        memset(hist, 0x5a, sizeof hist);
+
+        /* Call the histogram function */
+        if (binned) {
+            ret = rapp_stat_hist_bins_u8(buf, dim, mptr, map_dim,
+                                         width, height, hist, bins);
+        }
+        else {
+            ret = rapp_stat_hist_u8(buf, dim, mptr, map_dim,
+                                    width, height, hist);
+        }
+        if (ret < 0) {
+            DBG("Got FAIL return value %d\n", ret);
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rapp_ref_stat_hist_u8(buf, dim, mptr, map_dim,
+                              width, height, ref, bins);
+
+        /* Compare the results */
+        if (memcmp(hist, ref, bins*sizeof *hist) != 0 ||
+            hist[bins] != 0x5a5a5a5a)
+        {
+            DBG("Failed; width=%d height=%d bins=%d mask=%d\n",
+                width, height, bins, (int)mask);
+            goto Done;
+        }
+    }
+
+    /* Check that an invalid number of bins is rejected */
+    if (binned &&
+        (rapp_stat_hist_bins_u8(buf, dim, NULL, 0, 1, 1, hist, 0)   !=
+         RAPP_ERR_PARM_RANGE ||
+         rapp_stat_hist_bins_u8(buf, dim, NULL, 0, 1, 1, hist, 257) !=
+         RAPP_ERR_PARM_RANGE ||
+         rapp_stat_hist_bins_u8(buf, dim, NULL, 0, 1, 1, hist, 3)   !=
+         RAPP_ERR_PARM_RANGE ||
+         rapp_stat_hist_bins_u8(buf, dim, NULL, 0, 1, 1, hist, 96)  !=
+         RAPP_ERR_PARM_RANGE))
+    {
+        DBG("Invalid number of bins not detected\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    /* Release buffers */
+    rapp_free(buf);
+    rapp_free(map);
+
+    return ok;
+}
+
+/**
+ *  Initialize an 8-bit image with random pixels. In every other
+ *  iteration the pixels only take a few different values, to get
+ *  many equal min and max values.
+ */
+static void
+rapp_test_stat_init_u8(uint8_t *buf, int dim,
+                       int width, int height, int iter)
+{
+    int x, y;
+
+    rapp_test_init(buf, dim, width, height, true);
+    if (iter & 1) {
+        for (y = 0; y < height; y++) {
+            for (x = 0; x < width; x++) {
+                buf[y*dim + x] = 0x40 + (buf[y*dim + x] & 3);
+            }
+        }
+    }
+}
+
+static bool
+rapp_test_stat_diff_driver(int (*test)(), uintmax_t (*ref)())
+{
+    int      dim  = rapp_align(RAPP_TEST_WIDTH);
+    uint8_t *src1 = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *src2 = rapp_malloc(dim*RAPP_TEST_HEIGHT, 0);
+    bool     ok   = false;
+    int      iter;
+
+    /* Perform tests */
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int       width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int       height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        uintmax_t sum, rsum;
+
+        /* Initialize the images, with equal padding */
+        rapp_test_stat_init_pair(src1, src2, dim, width, height, iter);
+        rapp_pad_align_u8(src1, dim, width, height, 0x80);
+        rapp_pad_align_u8(src2, dim, width, height, 0x80);
+
+        /* Call the statistical function */
+        if ((*test)(src1, dim, src2, dim, width, height, &sum) < 0) {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+
+        /* Call the reference function */
+        rsum = (*ref)(src1, dim, src2, dim, width, height);
+
+        /* Compare the results */
+        if (sum != rsum) {
+            DBG("Failed; width=%d height=%d sum=%ju (expected %ju)\n",
+                width, height, sum, rsum);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(src1);
+    rapp_free(src2);
+    return ok;
+}
+
+static void
+rapp_test_stat_init_pair(uint8_t *src1, uint8_t *src2, int dim,
+                         int width, int height, int iter)
+{
+    int x, y;
+
+    /* Use an independent second image in every fourth iteration,
+     * and a noisy copy of the first one otherwise */
+    rapp_test_init(src1, dim, width, height, true);
+    rapp_test_init(src2, dim, width, height, true);
+    if (iter % 4 != 0) {
+        for (y = 0; y < height; y++) {
+            for (x = 0; x < width; x++) {
+                int idx = y*dim + x;
+                int pix = src1[idx] + (src2[idx] & 0x1f) - 0x10;
+                src2[idx] = MIN(MAX(pix, 0), 0xff);
+            }
+        }
+    }
+}
+
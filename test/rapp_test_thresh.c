@@ -33,6 +33,7 @@
 #include <string.h>          /* memcpy()      */
 #include "rapp.h"            /* RAPP API      */
 #include "rapp_ref_thresh.h" /* Reference API */
+#include "rapp_ref_stat.h"   /* Histogram     */
 #include "rapp_test_util.h"  /* Test utils    */
 
 
@@ -57,6 +58,11 @@
  */
 #define RAPP_TEST_HEIGHT 128
 
+/**
+ *  The maximum adaptive thresholding radius.
+ */
+#define RAPP_TEST_RADIUS 127
+
 
 /*
  * -------------------------------------------------------------
@@ -73,6 +79,19 @@ rapp_test_thresh_pixel_driver(int (*test)(), void (*ref)());
 static bool
 rapp_test_thresh_pixel_driver2(int (*test)(), void (*ref)());
 
+static bool
+rapp_test_thresh_driver16(int (*test)(), void (*ref)());
+
+static bool
+rapp_test_thresh_auto_driver(int method);
+
+static bool
+rapp_test_thresh_auto_check(const uint32_t *hist, int method,
+                            int percent, int level);
+
+static bool
+rapp_test_thresh_absdiff_driver(bool hyst);
+
 /*
  * -------------------------------------------------------------
  *  Exported functions
@@ -135,6 +154,133 @@ rapp_test_thresh_ltgt_pixel_u8(void)
                                           &rapp_ref_thresh_ltgt_pixel_u8);
 }
 
+bool
+rapp_test_thresh_gt_u16(void)
+{
+    return rapp_test_thresh_driver16(&rapp_thresh_gt_u16,
+                                     &rapp_ref_thresh_gt_u16);
+}
+
+bool
+rapp_test_thresh_lt_u16(void)
+{
+    return rapp_test_thresh_driver16(&rapp_thresh_lt_u16,
+                                     &rapp_ref_thresh_lt_u16);
+}
+
+bool
+rapp_test_thresh_auto_otsu_u8(void)
+{
+    return rapp_test_thresh_auto_driver(RAPP_THRESH_OTSU);
+}
+
+bool
+rapp_test_thresh_auto_triangle_u8(void)
+{
+    return rapp_test_thresh_auto_driver(RAPP_THRESH_TRIANGLE);
+}
+
+bool
+rapp_test_thresh_auto_percentile_u8(void)
+{
+    return rapp_test_thresh_auto_driver(RAPP_THRESH_PERCENTILE);
+}
+
+bool
+rapp_test_thresh_adaptive_u8(void)
+{
+    int      pad     = rapp_align(RAPP_TEST_RADIUS);
+    int      rows    = RAPP_TEST_HEIGHT + 2*RAPP_TEST_RADIUS;
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + 2*pad;
+    int      dst_dim = rapp_align((RAPP_TEST_WIDTH + 7) / 8);
+    int      ref_dim = rapp_align(RAPP_TEST_WIDTH);
+    uint8_t *src_buf = rapp_malloc(src_dim*rows, 0);
+    uint8_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *ref_buf = rapp_malloc(ref_dim*RAPP_TEST_HEIGHT, 0);
+    int      size    = rapp_thresh_adaptive_worksize_u8(RAPP_TEST_WIDTH,
+                                                        RAPP_TEST_RADIUS);
+    uint8_t *work    = rapp_malloc(size, 0);
+    uint8_t *src     = &src_buf[RAPP_TEST_RADIUS*src_dim + pad];
+    bool     ok      = false;
+    int      iter;
+
+    for (iter = 0; iter < RAPP_TEST_ITER / 16; iter++) {
+        int width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+        int radius = rapp_test_rand(1, iter % 2 ? RAPP_TEST_RADIUS : 8);
+        int offset = rapp_test_rand(-16, 16);
+        int x, y;
+
+        /* Initialize the source buffer with smooth gradients and noise */
+        rapp_test_init(src_buf, 0, src_dim*rows, 1, true);
+        for (y = 0; y < rows; y++) {
+            for (x = 0; x < src_dim; x++) {
+                uint8_t *pix = &src_buf[y*src_dim + x];
+                *pix = (x + 2*y) % 192 + *pix % 64;
+            }
+        }
+
+        if (rapp_thresh_adaptive_u8(dst_buf, dst_dim, src, src_dim,
+                                    width, height, radius, offset,
+                                    work) < 0)
+        {
+            DBG("Got FAIL return value\n");
+            goto Done;
+        }
+        rapp_ref_thresh_adaptive_u8(ref_buf, ref_dim, src, src_dim,
+                                    width, height, radius, offset);
+
+        /**
+         *  The box filter mean may differ by one from the exact
+         *  rounded mean, so skip the pixels close to the level.
+         */
+        for (y = 0; y < height; y++) {
+            for (x = 0; x < width; x++) {
+                int val = src[y*src_dim + x];
+                int lev = ref_buf[y*ref_dim + x];
+                int pix = rapp_pixel_get_bin(dst_buf, dst_dim, 0, x, y);
+
+                if ((val < lev || val > lev + 1) && pix != (val > lev)) {
+                    DBG("Invalid result at (%d,%d), width=%d height=%d "
+                        "radius=%d offset=%d\n",
+                        x, y, width, height, radius, offset);
+                    goto Done;
+                }
+            }
+        }
+    }
+
+    /* Check that an invalid radius is rejected */
+    if (rapp_thresh_adaptive_u8(dst_buf, dst_dim, src, src_dim,
+                                1, 1, 0, 0, work) != RAPP_ERR_PARM_RANGE)
+    {
+        DBG("Invalid radius not detected\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(src_buf);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+    rapp_free(work);
+
+    return ok;
+}
+
+bool
+rapp_test_thresh_absdiff_gt_u8(void)
+{
+    return rapp_test_thresh_absdiff_driver(false);
+}
+
+bool
+rapp_test_thresh_absdiff_hyst_u8(void)
+{
+    return rapp_test_thresh_absdiff_driver(true);
+}
+
 /*
  * -------------------------------------------------------------
  *  Local functions
@@ -546,3 +692,317 @@ Done:
 
     return ok;
 }
+
+static bool
+rapp_test_thresh_driver16(int (*test)(), void (*ref)())
+{
+    /* Special boundary cases to test explicitly */
+    static const int special[] = {-1, 0, 1, 0x7fff, 0x8000,
+                                  0xfffe, 0xffff, 0x10000};
+
+    int       dst_dim = rapp_align(RAPP_TEST_WIDTH);
+    int       src_dim = rapp_align(2*RAPP_TEST_WIDTH) + rapp_alignment;
+    uint8_t  *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint16_t *src_buf = rapp_malloc(src_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t  *ref_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int       k;
+    bool      ok = false;
+    int width, height;
+
+    for (k = 0; k < RAPP_TEST_ITER; k++) {
+        int thresh, x, y;
+
+        width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+
+        /* Verify that we get an overlap error for overlapping buffers */
+        if ((*test)(dst_buf, dst_dim, (uint16_t *)dst_buf, src_dim,
+                    width, height, 0) != RAPP_ERR_OVERLAP)
+        {
+            DBG("Overlap undetected\n");
+            goto Done;
+        }
+
+        if (k < (int)(sizeof special / sizeof special[0])) {
+            /* Test special cases */
+            thresh = special[k];
+        }
+        else {
+            /* Test random cases */
+            thresh = rapp_test_rand(0, 0xffff);
+        }
+
+        /* Initialize the source buffer, with values close to the threshold */
+        for (y = 0; y < height; y++) {
+            for (x = 0; x < src_dim / 2; x++) {
+                int val = rapp_test_rand(0, 1) ? rapp_test_rand(0, 0xffff) :
+                          thresh + rapp_test_rand(-2, 2);
+                src_buf[y*src_dim/2 + x] = val < 0 ? 0 : val & 0xffff;
+            }
+        }
+
+        /* Call RAPP function */
+        if ((*test)(dst_buf, dst_dim, src_buf, src_dim,
+                    width, height, thresh) < 0)
+        {
+            DBG("Got FAIL return value, thresh=%d\n", thresh);
+            goto Done;
+        }
+
+        /* Call reference function */
+        (*ref)(ref_buf, dst_dim, src_buf, src_dim, width, height, thresh);
+
+        /* Check result */
+        if (!rapp_test_compare_bin(dst_buf, dst_dim, ref_buf,
+                                   dst_dim, 0, width, height))
+        {
+            DBG("Invalid result, thresh=%d\n", thresh);
+            DBG("dst=\n");
+            rapp_test_dump_bin(dst_buf, dst_dim, 0, width, height);
+            DBG("ref=\n");
+            rapp_test_dump_bin(ref_buf, dst_dim, 0, width, height);
+            goto Done;
+        }
+    }
+
+    ok = true;
+
+Done:
+    if (!ok) {
+        DBG("width=%d, height=%d\n", width, height);
+    }
+
+    rapp_free(dst_buf);
+    rapp_free(src_buf);
+    rapp_free(ref_buf);
+
+    return ok;
+}
+
+static bool
+rapp_test_thresh_auto_driver(int method)
+{
+    int      height  = 4*RAPP_TEST_HEIGHT;
+    int      dst_dim = rapp_align((RAPP_TEST_WIDTH + 7) / 8);
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH) + rapp_alignment;
+    uint8_t *dst_buf = rapp_malloc(dst_dim*height, 0);
+    uint8_t *src_buf = rapp_malloc(src_dim*height, 0);
+    uint8_t *ref_buf = rapp_malloc(dst_dim*height, 0);
+    uint32_t prev[256] = {0};
+    uint32_t hist[256];
+    uint32_t ref[256];
+    bool     ok = false;
+    int      iter;
+
+    for (iter = 0; iter < RAPP_TEST_ITER / 8; iter++) {
+        int width   = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        int range   = rapp_test_rand(1, 256);
+        int base    = rapp_test_rand(0, 256 - range);
+        int percent = rapp_test_rand(0, 100);
+        int level, k;
+
+        height = rapp_test_rand(1, 4*RAPP_TEST_HEIGHT);
+
+        /* Initialize the source buffer with a random value range */
+        rapp_test_init(src_buf, src_dim, width, height, true);
+        for (k = 0; k < src_dim*height; k++) {
+            src_buf[k] = base + src_buf[k] % range;
+        }
+        rapp_ref_stat_hist_u8(src_buf, src_dim, NULL, 0,
+                              width, height, ref, 256);
+
+        /* Select the level from the histogram of the source image */
+        level = rapp_thresh_auto_u8(dst_buf, dst_dim, src_buf, src_dim,
+                                    width, height, method, percent, NULL);
+        if (!rapp_test_thresh_auto_check(ref, method, percent, level)) {
+            DBG("Invalid level %d\n", level);
+            goto Done;
+        }
+        rapp_ref_thresh_gt_u8(ref_buf, dst_dim, src_buf, src_dim,
+                              width, height, level);
+        if (!rapp_test_compare_bin(dst_buf, dst_dim, ref_buf,
+                                   dst_dim, 0, width, height))
+        {
+            DBG("Invalid result\n");
+            goto Done;
+        }
+
+        /* Select the level from the previous histogram */
+        memcpy(hist, prev, sizeof hist);
+        level = rapp_thresh_auto_u8(dst_buf, dst_dim, src_buf, src_dim,
+                                    width, height, method, percent, hist);
+        if (!rapp_test_thresh_auto_check(iter > 0 ? prev : ref,
+                                         method, percent, level))
+        {
+            DBG("Invalid level %d from the previous histogram\n", level);
+            goto Done;
+        }
+        rapp_ref_thresh_gt_u8(ref_buf, dst_dim, src_buf, src_dim,
+                              width, height, level);
+        if (!rapp_test_compare_bin(dst_buf, dst_dim, ref_buf,
+                                   dst_dim, 0, width, height))
+        {
+            DBG("Invalid result from the previous histogram\n");
+            goto Done;
+        }
+        if (memcmp(hist, ref, sizeof hist) != 0) {
+            DBG("Invalid histogram\n");
+            goto Done;
+        }
+        memcpy(prev, ref, sizeof prev);
+    }
+
+    /* Check that invalid parameters are rejected */
+    if (rapp_thresh_auto_u8(dst_buf, dst_dim, src_buf, src_dim,
+                            1, 1, 3, 0, NULL) != RAPP_ERR_PARM_RANGE ||
+        (method == RAPP_THRESH_PERCENTILE &&
+         rapp_thresh_auto_u8(dst_buf, dst_dim, src_buf, src_dim,
+                             1, 1, method, 101, NULL) != RAPP_ERR_PARM_RANGE))
+    {
+        DBG("Invalid parameters not detected\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    rapp_free(dst_buf);
+    rapp_free(src_buf);
+    rapp_free(ref_buf);
+
+    return ok;
+}
+
+static bool
+rapp_test_thresh_auto_check(const uint32_t *hist, int method,
+                            int percent, int level)
+{
+    double best = -1;
+    int    k;
+
+    if (level < 0 || level > 255) {
+        return false;
+    }
+
+    switch (method) {
+        case RAPP_THRESH_OTSU:
+            /* Allow rounding differences between equal variances */
+            for (k = 0; k < 256; k++) {
+                double var = rapp_ref_thresh_otsu_var(hist, k);
+                best = var > best ? var : best;
+            }
+            if (best < 0) {
+                /* Single-valued histogram gives an empty output */
+                return hist[level] != 0;
+            }
+            return rapp_ref_thresh_otsu_var(hist, level) >=
+                   best*(1 - 1e-9);
+
+        case RAPP_THRESH_TRIANGLE:
+            return level == rapp_ref_thresh_triangle(hist);
+
+        default:
+            return level == rapp_ref_thresh_percentile(hist, percent);
+    }
+}
+
+static bool
+rapp_test_thresh_absdiff_driver(bool hyst)
+{
+    int      src_dim = rapp_align(RAPP_TEST_WIDTH);
+    int      dst_dim = rapp_align((RAPP_TEST_WIDTH + 7) / 8);
+    uint8_t *src1    = rapp_malloc(src_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *src2    = rapp_malloc(src_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *dst_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    uint8_t *ref_buf = rapp_malloc(dst_dim*RAPP_TEST_HEIGHT, 0);
+    int      size    = rapp_thresh_absdiff_hyst_worksize_u8(RAPP_TEST_WIDTH,
+                                                            RAPP_TEST_HEIGHT);
+    uint8_t *work    = rapp_malloc(size, 0);
+    bool     ok      = false;
+    int      iter;
+    int width, height, low, high;
+
+    for (iter = 0; iter < RAPP_TEST_ITER; iter++) {
+        int spread = rapp_test_rand(1, 0x100);
+        int k;
+
+        width  = rapp_test_rand(1, RAPP_TEST_WIDTH);
+        height = rapp_test_rand(1, RAPP_TEST_HEIGHT);
+
+        /* Initialize the second source with a random difference */
+        rapp_test_init(src1, 0, src_dim*height, 1, true);
+        rapp_test_init(src2, 0, src_dim*height, 1, true);
+        for (k = 0; k < src_dim*height; k++) {
+            int val = src1[k] + src2[k] % spread - spread / 2;
+            src2[k] = val < 0 ? 0 : val > 0xff ? 0xff : val;
+        }
+
+        if (hyst) {
+            low  = rapp_test_rand(0, 0xff);
+            high = rapp_test_rand(low, 0xff);
+
+            if (rapp_thresh_absdiff_hyst_u8(dst_buf, dst_dim, src1, src_dim,
+                                            src2, src_dim, width, height,
+                                            low, high, work) < 0)
+            {
+                DBG("Got FAIL return value\n");
+                goto Done;
+            }
+            rapp_ref_thresh_absdiff_hyst_u8(ref_buf, dst_dim, src1, src_dim,
+                                            src2, src_dim, width, height,
+                                            low, high);
+        }
+        else {
+            low  = rapp_test_rand(-2, 0x101);
+            high = low;
+
+            if (rapp_thresh_absdiff_gt_u8(dst_buf, dst_dim, src1, src_dim,
+                                          src2, src_dim, width, height,
+                                          low) < 0)
+            {
+                DBG("Got FAIL return value\n");
+                goto Done;
+            }
+            rapp_ref_thresh_absdiff_gt_u8(ref_buf, dst_dim, src1, src_dim,
+                                          src2, src_dim, width, height,
+                                          low);
+        }
+
+        if (!rapp_test_compare_bin(dst_buf, dst_dim, ref_buf, dst_dim,
+                                   0, width, height))
+        {
+            DBG("Invalid result\n");
+            DBG("dst=\n");
+            rapp_test_dump_bin(dst_buf, dst_dim, 0, width, height);
+            DBG("ref=\n");
+            rapp_test_dump_bin(ref_buf, dst_dim, 0, width, height);
+            goto Done;
+        }
+    }
+
+    /* Check that invalid thresholds are rejected */
+    if (hyst &&
+        rapp_thresh_absdiff_hyst_u8(dst_buf, dst_dim, src1, src_dim,
+                                    src2, src_dim, 1, 1, 2, 1, work) !=
+        RAPP_ERR_PARM_RANGE)
+    {
+        DBG("Invalid thresholds not detected\n");
+        goto Done;
+    }
+
+    ok = true;
+
+Done:
+    if (!ok) {
+        DBG("width=%d height=%d low=%d high=%d\n",
+            width, height, low, high);
+    }
+
+    rapp_free(src1);
+    rapp_free(src2);
+    rapp_free(dst_buf);
+    rapp_free(ref_buf);
+    rapp_free(work);
+
+    return ok;
+}
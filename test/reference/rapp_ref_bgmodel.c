@@ -0,0 +1,107 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_ref_bgmodel.c
+ *  @brief  RAPP background modelling, reference implementation.
+ */
+
+#include <stdlib.h>           /* abs()              */
+#include "rapp.h"             /* RAPP API           */
+#include "rapp_ref_bgmodel.h" /* Background model  */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static int
+rapp_ref_bgmodel_lerpn(int val, int target, unsigned alpha8);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+void
+rapp_ref_bgmodel_update_u8(uint8_t *fg, int fg_dim,
+                           uint8_t *mean, int mean_dim,
+                           uint8_t *dev, int dev_dim,
+                           const uint8_t *src, int src_dim,
+                           int width, int height,
+                           unsigned alpha8, int thresh)
+{
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int pix  = src[y*src_dim + x];
+            int avg  = mean[y*mean_dim + x];
+            int var  = dev ? dev[y*dev_dim + x] : 0;
+            int diff = abs(pix - avg);
+            int prev = rapp_pixel_get_bin(fg, fg_dim, 0, x, y);
+
+            rapp_pixel_set_bin(fg, fg_dim, 0, x, y,
+                               diff > thresh + 2*var);
+
+            if (!prev) {
+                mean[y*mean_dim + x] = rapp_ref_bgmodel_lerpn(avg, pix,
+                                                              alpha8);
+                if (dev) {
+                    dev[y*dev_dim + x] = rapp_ref_bgmodel_lerpn(var, diff,
+                                                                alpha8);
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Move val towards target by alpha8/256 of the difference,
+ *  with the update rounded away from zero.
+ */
+static int
+rapp_ref_bgmodel_lerpn(int val, int target, unsigned alpha8)
+{
+    int upd = (int)alpha8*(target - val);
+
+    if (upd > 0) {
+        return val + (upd + 0xff) / 0x100;
+    }
+    return val - (-upd + 0xff) / 0x100;
+}
@@ -0,0 +1,139 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_ref_edge.c
+ *  @brief  RAPP edge detection, reference implementation.
+ */
+
+#include <stdlib.h>          /* malloc(), free()  */
+#include <string.h>          /* memset()          */
+#include "rapp.h"            /* RAPP API          */
+#include "rapp_ref_filter.h" /* Sobel reference   */
+#include "rapp_ref_edge.h"   /* Edge detection    */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+void
+rapp_ref_edge_canny_u8(uint8_t *dst, int dst_dim,
+                       const uint8_t *src, int src_dim,
+                       int width, int height, int low, int high)
+{
+    /* Neighbour offsets before the pixel for each orientation code */
+    static const int dx[4] = {-1, -1,  0,  1};
+    static const int dy[4] = { 0, -1, -1, -1};
+    int      pdim = width + 2;
+    uint8_t *pad  = malloc(pdim*(height + 2));
+    uint8_t *mag  = malloc(width*height);
+    uint8_t *dir  = malloc(width*height);
+    uint8_t *nms  = malloc(width*height);
+    int     *stack;
+    int      top = 0;
+    int      x, y;
+
+    /* Replicate the smoothed image one pixel outside the border */
+    for (y = -1; y <= height; y++) {
+        int yy = y < 0 ? 0 : y >= height ? height - 1 : y;
+        for (x = -1; x <= width; x++) {
+            int xx = x < 0 ? 0 : x >= width ? width - 1 : x;
+            pad[(y + 1)*pdim + x + 1] = src[yy*src_dim + xx];
+        }
+    }
+
+    /* Compute the gradient magnitude and orientation */
+    rapp_ref_filter_sobel_3x3_magn_dir_u8(mag, width, dir, width,
+                                          &pad[pdim + 1], pdim,
+                                          width, height, 4);
+
+    /* Suppress the non-maximum pixels */
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int k  = dir[y*width + x];
+            int m  = mag[y*width + x];
+            int x1 = x + dx[k], y1 = y + dy[k];
+            int x2 = x - dx[k], y2 = y - dy[k];
+            int m1 = 0, m2 = 0;
+
+            if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height) {
+                m1 = mag[y1*width + x1];
+            }
+            if (x2 >= 0 && x2 < width && y2 >= 0 && y2 < height) {
+                m2 = mag[y2*width + x2];
+            }
+            nms[y*width + x] = m > m1 && m >= m2 ? m : 0;
+        }
+    }
+
+    /* Clear the destination buffer */
+    memset(dst, 0, dst_dim*height);
+
+    /* Push all strong edge pixels */
+    stack = malloc(2*width*height*sizeof *stack);
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            if (nms[y*width + x] > high) {
+                rapp_pixel_set_bin(dst, dst_dim, 0, x, y, 1);
+                stack[top++] = x;
+                stack[top++] = y;
+            }
+        }
+    }
+
+    /* Trace the weak edge pixels connected to them */
+    while (top > 0) {
+        int i, j;
+
+        y = stack[--top];
+        x = stack[--top];
+        for (i = -1; i <= 1; i++) {
+            for (j = -1; j <= 1; j++) {
+                int xx = x + j;
+                int yy = y + i;
+
+                if (xx >= 0 && xx < width && yy >= 0 && yy < height &&
+                    nms[yy*width + xx] > low &&
+                    !rapp_pixel_get_bin(dst, dst_dim, 0, xx, yy))
+                {
+                    rapp_pixel_set_bin(dst, dst_dim, 0, xx, yy, 1);
+                    stack[top++] = xx;
+                    stack[top++] = yy;
+                }
+            }
+        }
+    }
+
+    free(stack);
+    free(nms);
+    free(dir);
+    free(mag);
+    free(pad);
+}
@@ -0,0 +1,255 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_ref_feature.c
+ *  @brief  RAPP feature detection, reference implementation.
+ */
+
+#include <stdlib.h>           /* malloc(), free()  */
+#include "rc_stdbool.h"       /* Portable stdbool  */
+#include "rapp.h"             /* RAPP API          */
+#include "rapp_ref_feature.h" /* Feature detection */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Global variables
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The x, y offsets of the FAST circle pixels, in circular order.
+ */
+static const int rapp_ref_feature_circle[16][2] = {
+    { 0, -3}, { 1, -3}, { 2, -2}, { 3, -1},
+    { 3,  0}, { 3,  1}, { 2,  2}, { 1,  3},
+    { 0,  3}, {-1,  3}, {-2,  2}, {-3,  1},
+    {-3,  0}, {-3, -1}, {-2, -2}, {-1, -3}
+};
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static int
+rapp_ref_feature_fast_score(const uint8_t *src, int src_dim, int thresh);
+
+static int32_t
+rapp_ref_feature_harris_score(const int *gx, const int *gy,
+                              int width, int height, int x, int y);
+
+static int
+rapp_ref_feature_list(const int32_t *score, int width, int height,
+                      int nms, unsigned *pos, int max);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+int
+rapp_ref_feature_fast_u8(const uint8_t *src, int src_dim,
+                         int width, int height, int thresh, int nms,
+                         unsigned *pos, int max)
+{
+    int32_t *score = malloc(width*height*sizeof *score);
+    int      num;
+    int      x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            score[y*width + x] =
+                rapp_ref_feature_fast_score(&src[y*src_dim + x],
+                                            src_dim, thresh);
+        }
+    }
+
+    num = rapp_ref_feature_list(score, width, height, nms, pos, max);
+    free(score);
+
+    return num;
+}
+
+int
+rapp_ref_feature_harris_u8(const uint8_t *src, int src_dim,
+                           int width, int height, int thresh, int nms,
+                           unsigned *pos, int max)
+{
+    int     *gx    = malloc(width*height*sizeof *gx);
+    int     *gy    = malloc(width*height*sizeof *gy);
+    int32_t *score = malloc(width*height*sizeof *score);
+    int      num;
+    int      x, y;
+
+    /* Compute the Sobel gradients */
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            const uint8_t *p = &src[y*src_dim + x];
+            int            d = src_dim;
+
+            gx[y*width + x] = (p[-d + 1] + 2*p[1] + p[d + 1]) -
+                              (p[-d - 1] + 2*p[-1] + p[d - 1]);
+            gy[y*width + x] = (p[d - 1] + 2*p[d] + p[d + 1]) -
+                              (p[-d - 1] + 2*p[-d] + p[-d + 1]);
+        }
+    }
+
+    /* Compute the score */
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int32_t r = rapp_ref_feature_harris_score(gx, gy, width,
+                                                      height, x, y);
+            score[y*width + x] = r > thresh ? r - thresh : 0;
+        }
+    }
+
+    num = rapp_ref_feature_list(score, width, height, nms, pos, max);
+    free(gx);
+    free(gy);
+    free(score);
+
+    return num;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  The FAST score of a pixel, or zero if it is not a corner.
+ */
+static int
+rapp_ref_feature_fast_score(const uint8_t *src, int src_dim, int thresh)
+{
+    int best = 0;
+    int k;
+
+    /* Try all thresholds above the given one */
+    for (k = thresh + 1; k < 0x100; k++) {
+        int brighter = 0;
+        int darker   = 0;
+        int corner   = 0;
+        int i;
+
+        /* Count the contiguous pixels twice around the circle */
+        for (i = 0; i < 32 && !corner; i++) {
+            const int *off = rapp_ref_feature_circle[i % 16];
+            int        pix = src[off[1]*src_dim + off[0]];
+
+            brighter = pix - src[0] >= k ? brighter + 1 : 0;
+            darker   = src[0] - pix >= k ? darker   + 1 : 0;
+            corner   = brighter >= 9 || darker >= 9;
+        }
+
+        if (!corner) {
+            break;
+        }
+        best = k - thresh;
+    }
+
+    return best;
+}
+
+/**
+ *  The Harris response of a pixel.
+ */
+static int32_t
+rapp_ref_feature_harris_score(const int *gx, const int *gy,
+                              int width, int height, int x, int y)
+{
+    int64_t a = 0, b = 0, c = 0;
+    int     i, j;
+
+    for (j = y - 1; j <= y + 1; j++) {
+        for (i = x - 1; i <= x + 1; i++) {
+            if (i >= 0 && i < width && j >= 0 && j < height) {
+                int vx = gx[j*width + i];
+                int vy = gy[j*width + i];
+                a += vx*vx;
+                b += vy*vy;
+                c += vx*vy;
+            }
+        }
+    }
+
+    return (a*b - c*c - 3*(a + b)*(a + b) / 64) / 65536;
+}
+
+/**
+ *  Collect the positions of the corners, with optional
+ *  non-maximum suppression.
+ */
+static int
+rapp_ref_feature_list(const int32_t *score, int width, int height,
+                      int nms, unsigned *pos, int max)
+{
+    int num = 0;
+    int x, y;
+
+    for (y = 0; y < height && num < max; y++) {
+        for (x = 0; x < width && num < max; x++) {
+            int32_t val  = score[y*width + x];
+            bool    keep = val > 0;
+            int     i, j;
+
+            for (j = -1; j <= 1 && keep && nms; j++) {
+                for (i = -1; i <= 1 && keep; i++) {
+                    int nx = x + i;
+                    int ny = y + j;
+                    int nv;
+
+                    if (nx < 0 || nx >= width || ny < 0 || ny >= height ||
+                        (i == 0 && j == 0))
+                    {
+                        continue;
+                    }
+
+                    nv   = score[ny*width + nx];
+                    keep = (j < 0 || (j == 0 && i < 0)) ? val > nv
+                                                        : val >= nv;
+                }
+            }
+
+            if (keep) {
+                pos[2*num]     = x;
+                pos[2*num + 1] = y;
+                num++;
+            }
+        }
+    }
+
+    return num;
+}
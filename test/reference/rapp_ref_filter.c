@@ -30,7 +30,7 @@
  *  @brief  RAPP fixed-filter convolutions, reference implementation
  */
 
-#include <stdlib.h>          /* abs()         */
+#include <stdlib.h>          /* abs(), malloc() */
 #include "rc_stdbool.h" /* Portable stdbool.h */
 #include "rapp_ref_filter.h" /* Reference API */
 
@@ -77,6 +77,34 @@ rapp_ref_filter_driver(float *dst, int dst_dim, const uint8_t *src,
                        int bias, int norm,
                        bool flip, bool absolute, bool magnitude);
 
+static void
+rapp_ref_filter_driver_s16(int16_t *dst, int dst_dim, const uint8_t *src,
+                           int src_dim, int width, int height,
+                           const int *mask, int mask_width, int mask_height,
+                           bool flip);
+
+static void
+rapp_ref_filter_driver_u16(uint16_t *dst, int dst_dim, const uint16_t *src,
+                           int src_dim, int width, int height,
+                           const int *mask, int bias, int shift,
+                           bool flip, bool absolute);
+
+static void
+rapp_ref_filter_sobel_grad(const uint8_t *src, int src_dim,
+                           int *gx, int *gy);
+
+static int
+rapp_ref_filter_scale(int sum, int shift);
+
+static float
+rapp_ref_filter_exp(float x);
+
+static uint32_t
+rapp_ref_filter_census(const uint8_t *src, int src_dim, int radius);
+
+static int
+rapp_ref_filter_bitcount(uint32_t code);
+
 
 /*
  * -------------------------------------------------------------
@@ -184,6 +212,116 @@ rapp_ref_filter_sobel_3x3_magn_u8(float *dst, int dst_dim,
                            false, false, true);
 }
 
+void
+rapp_ref_filter_sobel_3x3_magn_dir_u8(uint8_t *mag, int mag_dim,
+                                      uint8_t *dir, int dir_dim,
+                                      const uint8_t *src, int src_dim,
+                                      int width, int height, int bins)
+{
+    /* Cosines of multiples of 45 degrees */
+    static const double cs[8] = { 1.0,  0.70710678118654752,
+                                  0.0, -0.70710678118654752,
+                                 -1.0, -0.70710678118654752,
+                                  0.0,  0.70710678118654752};
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int    best = 0;
+            double proj = -1.0;
+            int    gx, gy, k;
+
+            rapp_ref_filter_sobel_grad(&src[y*src_dim + x], src_dim,
+                                       &gx, &gy);
+
+            /* Find the direction with the largest projection, y down */
+            for (k = 0; k < 8; k++) {
+                double dot = gx*cs[k] + gy*cs[(k + 6) % 8];
+                if (dot > proj) {
+                    proj = dot;
+                    best = k;
+                }
+            }
+
+            mag[y*mag_dim + x] = (abs(gx) + abs(gy) + 4) / 8;
+            dir[y*dir_dim + x] = best % bins;
+        }
+    }
+}
+
+void
+rapp_ref_filter_sobel_3x3_grad_u8_s16(int16_t *gx, int gx_dim,
+                                      int16_t *gy, int gy_dim,
+                                      const uint8_t *src, int src_dim,
+                                      int width, int height)
+{
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int hval, vval;
+            rapp_ref_filter_sobel_grad(&src[y*src_dim + x], src_dim,
+                                       &hval, &vval);
+            gx[y*gx_dim/sizeof(int16_t) + x] = hval;
+            gy[y*gy_dim/sizeof(int16_t) + x] = vval;
+        }
+    }
+}
+
+void
+rapp_ref_filter_diff_1x2_horz_u8_s16(int16_t *dst, int dst_dim,
+                                     const uint8_t *src, int src_dim,
+                                     int width, int height)
+{
+    rapp_ref_filter_driver_s16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_diff_1x2, 2, 1, false);
+}
+
+void
+rapp_ref_filter_diff_2x1_vert_u8_s16(int16_t *dst, int dst_dim,
+                                     const uint8_t *src, int src_dim,
+                                     int width, int height)
+{
+    rapp_ref_filter_driver_s16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_diff_1x2, 2, 1, true);
+}
+
+void
+rapp_ref_filter_sobel_3x3_horz_u8_s16(int16_t *dst, int dst_dim,
+                                      const uint8_t *src, int src_dim,
+                                      int width, int height)
+{
+    rapp_ref_filter_driver_s16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_sobel_3x3, 3, 3, false);
+}
+
+void
+rapp_ref_filter_sobel_3x3_vert_u8_s16(int16_t *dst, int dst_dim,
+                                      const uint8_t *src, int src_dim,
+                                      int width, int height)
+{
+    rapp_ref_filter_driver_s16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_sobel_3x3, 3, 3, true);
+}
+
+void
+rapp_ref_filter_laplace_3x3_u8_s16(int16_t *dst, int dst_dim,
+                                   const uint8_t *src, int src_dim,
+                                   int width, int height)
+{
+    rapp_ref_filter_driver_s16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_laplace_3x3, 3, 3, false);
+}
+
+void
+rapp_ref_filter_highpass_3x3_u8_s16(int16_t *dst, int dst_dim,
+                                    const uint8_t *src, int src_dim,
+                                    int width, int height)
+{
+    rapp_ref_filter_driver_s16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_highpass_3x3, 3, 3, false);
+}
+
 void
 rapp_ref_filter_gauss_3x3_u8(float *dst, int dst_dim,
                              const uint8_t *src, int src_dim,
@@ -234,6 +372,380 @@ rapp_ref_filter_highpass_3x3_abs_u8(float *dst, int dst_dim,
                            false, true, false);
 }
 
+void
+rapp_ref_filter_conv_u8(uint8_t *dst, int dst_dim,
+                        const uint8_t *src, int src_dim,
+                        int width, int height,
+                        const int8_t *kern, int kern_width, int kern_height,
+                        int shift)
+{
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int sum = 0;
+            int xx, yy;
+
+            for (yy = 0; yy < kern_height; yy++) {
+                for (xx = 0; xx < kern_width; xx++) {
+                    int i = (y + yy - kern_height/2)*src_dim +
+                             x + xx - kern_width/2;
+
+                    sum += src[i]*kern[yy*kern_width + xx];
+                }
+            }
+
+            dst[y*dst_dim + x] = rapp_ref_filter_scale(sum, shift);
+        }
+    }
+}
+
+void
+rapp_ref_filter_sep_u8(uint8_t *dst, int dst_dim,
+                       const uint8_t *src, int src_dim,
+                       int width, int height,
+                       const int8_t *xkern, int xlen, int xshift,
+                       const int8_t *ykern, int ylen, int yshift)
+{
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int sum = 0;
+            int xx, yy;
+
+            for (xx = 0; xx < xlen; xx++) {
+                int vsum = 0;
+
+                for (yy = 0; yy < ylen; yy++) {
+                    int i = (y + yy - ylen/2)*src_dim + x + xx - xlen/2;
+                    vsum += src[i]*ykern[yy];
+                }
+
+                sum += rapp_ref_filter_scale(vsum, yshift)*xkern[xx];
+            }
+
+            dst[y*dst_dim + x] = rapp_ref_filter_scale(sum, xshift);
+        }
+    }
+}
+
+void
+rapp_ref_filter_gauss_u8(float *dst, int dst_dim,
+                         const uint8_t *src, int src_dim,
+                         int width, int height, int sigma, int radius)
+{
+    float  var  = (float)sigma*sigma / 256.0f;
+    int    rows = height + 2*radius;
+    float *kern = malloc((2*radius + 1)*sizeof *kern);
+    float *tmp  = malloc(rows*width*sizeof *tmp);
+    float  norm = 0.0f;
+    int    x, y, k;
+
+    /* Compute the normalized, truncated Gaussian kernel */
+    for (k = -radius; k <= radius; k++) {
+        kern[k + radius] = rapp_ref_filter_exp(-(float)k*k / (2.0f*var));
+        norm += kern[k + radius];
+    }
+    for (k = 0; k <= 2*radius; k++) {
+        kern[k] /= norm;
+    }
+
+    /* Horizontal pass, including the rows in the vertical border */
+    for (y = 0; y < rows; y++) {
+        for (x = 0; x < width; x++) {
+            const uint8_t *row = &src[(y - radius)*src_dim + x];
+            float          sum = 0.0f;
+            for (k = -radius; k <= radius; k++) {
+                sum += kern[k + radius]*row[k];
+            }
+            tmp[y*width + x] = sum;
+        }
+    }
+
+    /* Vertical pass */
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            float sum = 0.0f;
+            for (k = -radius; k <= radius; k++) {
+                sum += kern[k + radius]*tmp[(y + radius + k)*width + x];
+            }
+            dst[y*dst_dim/sizeof(float) + x] = sum;
+        }
+    }
+
+    free(kern);
+    free(tmp);
+}
+
+void
+rapp_ref_filter_rank_u8(uint8_t *dst, int dst_dim,
+                        const uint8_t *src, int src_dim,
+                        int width, int height, int radius, int rank)
+{
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int hist[256] = {0};
+            int val, cnt;
+            int xx, yy;
+
+            /* Compute the histogram of the neighbourhood */
+            for (yy = -radius; yy <= radius; yy++) {
+                for (xx = -radius; xx <= radius; xx++) {
+                    hist[src[(y + yy)*src_dim + x + xx]]++;
+                }
+            }
+
+            /* Find the value of the given rank */
+            val = 0;
+            cnt = hist[0];
+            while (cnt <= rank) {
+                cnt += hist[++val];
+            }
+            dst[y*dst_dim + x] = val;
+        }
+    }
+}
+
+void
+rapp_ref_filter_gauss_3x3_u16(uint16_t *dst, int dst_dim,
+                              const uint16_t *src, int src_dim,
+                              int width, int height)
+{
+    int sdim = src_dim / sizeof(uint16_t);
+    int ddim = dst_dim / sizeof(uint16_t);
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int sum = 0;
+            int xx, yy;
+
+            for (yy = 0; yy < 3; yy++) {
+                for (xx = 0; xx < 3; xx++) {
+                    sum += src[(y + yy - 1)*sdim + x + xx - 1]*
+                           rapp_ref_mask_gauss_3x3[3*yy + xx];
+                }
+            }
+            dst[y*ddim + x] = (sum + 8) >> 4;
+        }
+    }
+}
+
+void
+rapp_ref_filter_median_3x3_u16(uint16_t *dst, int dst_dim,
+                               const uint16_t *src, int src_dim,
+                               int width, int height)
+{
+    int sdim = src_dim / sizeof(uint16_t);
+    int ddim = dst_dim / sizeof(uint16_t);
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int val[9];
+            int i, k, xx, yy;
+
+            /* Insertion sort the neighbourhood */
+            for (i = 0, yy = -1; yy <= 1; yy++) {
+                for (xx = -1; xx <= 1; xx++, i++) {
+                    int v = src[(y + yy)*sdim + x + xx];
+                    for (k = i; k > 0 && val[k - 1] > v; k--) {
+                        val[k] = val[k - 1];
+                    }
+                    val[k] = v;
+                }
+            }
+            dst[y*ddim + x] = val[4];
+        }
+    }
+}
+
+void
+rapp_ref_filter_sobel_3x3_horz_u16(uint16_t *dst, int dst_dim,
+                                   const uint16_t *src, int src_dim,
+                                   int width, int height)
+{
+    rapp_ref_filter_driver_u16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_sobel_3x3, 0x8000, 3,
+                               false, false);
+}
+
+void
+rapp_ref_filter_sobel_3x3_horz_abs_u16(uint16_t *dst, int dst_dim,
+                                       const uint16_t *src, int src_dim,
+                                       int width, int height)
+{
+    rapp_ref_filter_driver_u16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_sobel_3x3, 0, 2,
+                               false, true);
+}
+
+void
+rapp_ref_filter_sobel_3x3_vert_u16(uint16_t *dst, int dst_dim,
+                                   const uint16_t *src, int src_dim,
+                                   int width, int height)
+{
+    rapp_ref_filter_driver_u16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_sobel_3x3, 0x8000, 3,
+                               true, false);
+}
+
+void
+rapp_ref_filter_sobel_3x3_vert_abs_u16(uint16_t *dst, int dst_dim,
+                                       const uint16_t *src, int src_dim,
+                                       int width, int height)
+{
+    rapp_ref_filter_driver_u16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_sobel_3x3, 0, 2,
+                               true, true);
+}
+
+void
+rapp_ref_filter_laplace_3x3_u16(uint16_t *dst, int dst_dim,
+                                const uint16_t *src, int src_dim,
+                                int width, int height)
+{
+    rapp_ref_filter_driver_u16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_laplace_3x3, 0x8000, 3,
+                               false, false);
+}
+
+void
+rapp_ref_filter_laplace_3x3_abs_u16(uint16_t *dst, int dst_dim,
+                                    const uint16_t *src, int src_dim,
+                                    int width, int height)
+{
+    rapp_ref_filter_driver_u16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_laplace_3x3, 0, 2,
+                               false, true);
+}
+
+void
+rapp_ref_filter_highpass_3x3_u16(uint16_t *dst, int dst_dim,
+                                 const uint16_t *src, int src_dim,
+                                 int width, int height)
+{
+    rapp_ref_filter_driver_u16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_highpass_3x3, 0x8000, 4,
+                               false, false);
+}
+
+void
+rapp_ref_filter_highpass_3x3_abs_u16(uint16_t *dst, int dst_dim,
+                                     const uint16_t *src, int src_dim,
+                                     int width, int height)
+{
+    rapp_ref_filter_driver_u16(dst, dst_dim, src, src_dim, width, height,
+                               rapp_ref_mask_highpass_3x3, 0, 3,
+                               false, true);
+}
+
+void
+rapp_ref_filter_census_3x3_u8(uint8_t *dst, int dst_dim,
+                              const uint8_t *src, int src_dim,
+                              int width, int height)
+{
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            dst[y*dst_dim + x] =
+                rapp_ref_filter_census(&src[y*src_dim + x], src_dim, 1);
+        }
+    }
+}
+
+void
+rapp_ref_filter_census_5x5_u8_u32(uint32_t *dst, int dst_dim,
+                                  const uint8_t *src, int src_dim,
+                                  int width, int height)
+{
+    int ddim = dst_dim / sizeof(uint32_t);
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            dst[y*ddim + x] =
+                rapp_ref_filter_census(&src[y*src_dim + x], src_dim, 2);
+        }
+    }
+}
+
+void
+rapp_ref_filter_lbp_3x3_u8(uint8_t *dst, int dst_dim,
+                           const uint8_t *src, int src_dim,
+                           int width, int height)
+{
+    /* Neighbour offsets clockwise from the top-left corner */
+    static const int xoff[8] = {-1, 0, 1, 1, 1, 0, -1, -1};
+    static const int yoff[8] = {-1, -1, -1, 0, 1, 1, 1, 0};
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            const uint8_t *ptr  = &src[y*src_dim + x];
+            int            code = 0;
+            int            k;
+
+            for (k = 0; k < 8; k++) {
+                if (ptr[yoff[k]*src_dim + xoff[k]] >= ptr[0]) {
+                    code |= 1 << k;
+                }
+            }
+            dst[y*dst_dim + x] = code;
+        }
+    }
+}
+
+void
+rapp_ref_filter_census_cost_u8(uint8_t *dst, int dst_dim,
+                               const uint8_t *src1, int src1_dim,
+                               const uint8_t *src2, int src2_dim,
+                               int width, int height, int disparities)
+{
+    int x, y, d;
+
+    for (d = 0; d < disparities; d++) {
+        for (y = 0; y < height; y++) {
+            for (x = 0; x < width; x++) {
+                int cost = 8;
+                if (x >= d) {
+                    cost = rapp_ref_filter_bitcount(src1[y*src1_dim + x] ^
+                                                    src2[y*src2_dim + x - d]);
+                }
+                dst[(d*height + y)*dst_dim + x] = cost;
+            }
+        }
+    }
+}
+
+void
+rapp_ref_filter_census_cost_u32_u8(uint8_t *dst, int dst_dim,
+                                   const uint32_t *src1, int src1_dim,
+                                   const uint32_t *src2, int src2_dim,
+                                   int width, int height, int disparities)
+{
+    int dim1 = src1_dim / sizeof(uint32_t);
+    int dim2 = src2_dim / sizeof(uint32_t);
+    int x, y, d;
+
+    for (d = 0; d < disparities; d++) {
+        for (y = 0; y < height; y++) {
+            for (x = 0; x < width; x++) {
+                int cost = 32;
+                if (x >= d) {
+                    cost = rapp_ref_filter_bitcount(src1[y*dim1 + x] ^
+                                                    src2[y*dim2 + x - d]);
+                }
+                dst[(d*height + y)*dst_dim + x] = cost;
+            }
+        }
+    }
+}
+
 
 /*
  * -------------------------------------------------------------
@@ -293,3 +805,167 @@ rapp_ref_filter_driver(float *dst, int dst_dim, const uint8_t *src,
         }
     }
 }
+
+/**
+ *  Compute the exact, unscaled convolution as signed 16-bit values.
+ */
+static void
+rapp_ref_filter_driver_s16(int16_t *dst, int dst_dim, const uint8_t *src,
+                           int src_dim, int width, int height,
+                           const int *mask, int mask_width, int mask_height,
+                           bool flip)
+{
+    float *row = malloc(width*sizeof *row);
+    int    x, y;
+
+    for (y = 0; y < height; y++) {
+        rapp_ref_filter_driver(row, 0, &src[y*src_dim], src_dim, width, 1,
+                               mask, mask_width, mask_height, 0, 1,
+                               flip, false, false);
+        for (x = 0; x < width; x++) {
+            dst[y*dst_dim/sizeof(int16_t) + x] = (int16_t)row[x];
+        }
+    }
+
+    free(row);
+}
+
+/**
+ *  Compute a 3x3 convolution of 16-bit pixels, scaled down by
+ *  a power of two, biased and rounded with ties rounded down.
+ */
+static void
+rapp_ref_filter_driver_u16(uint16_t *dst, int dst_dim, const uint16_t *src,
+                           int src_dim, int width, int height,
+                           const int *mask, int bias, int shift,
+                           bool flip, bool absolute)
+{
+    int sdim = src_dim / sizeof(uint16_t);
+    int ddim = dst_dim / sizeof(uint16_t);
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int sum = 0;
+            int xx, yy;
+
+            for (yy = 0; yy < 3; yy++) {
+                for (xx = 0; xx < 3; xx++) {
+                    int i = flip ? (y + xx - 1)*sdim + x + yy - 1
+                                 : (y + yy - 1)*sdim + x + xx - 1;
+                    sum += src[i]*mask[(2 - yy)*3 + 2 - xx];
+                }
+            }
+            if (absolute) {
+                sum = abs(sum);
+            }
+
+            /* Round with ties down, as the sum may be negative */
+            sum += (bias << shift) + (1 << (shift - 1)) - 1;
+            dst[y*ddim + x] = sum >> shift;
+        }
+    }
+}
+
+/**
+ *  Compute the unscaled horizontal and vertical Sobel gradients
+ *  at one pixel, as convolutions with the Sobel mask and its transpose.
+ */
+static void
+rapp_ref_filter_sobel_grad(const uint8_t *src, int src_dim,
+                           int *gx, int *gy)
+{
+    int xx, yy;
+
+    *gx = 0;
+    *gy = 0;
+    for (yy = 0; yy < 3; yy++) {
+        for (xx = 0; xx < 3; xx++) {
+            int k = (2 - yy)*3 + 2 - xx;
+            *gx += src[(yy - 1)*src_dim + xx - 1]*rapp_ref_mask_sobel_3x3[k];
+            *gy += src[(xx - 1)*src_dim + yy - 1]*rapp_ref_mask_sobel_3x3[k];
+        }
+    }
+}
+
+/**
+ *  Round, shift and saturate a convolution sum to 8 bits.
+ */
+static int
+rapp_ref_filter_scale(int sum, int shift)
+{
+    int val = (sum + ((1 << shift) >> 1)) / (1 << shift);
+
+    /* Division truncates towards zero - negative values saturate anyway */
+    return val < 0 ? 0 : val > 0xff ? 0xff : val;
+}
+
+/**
+ *  Compute exp(x) for x <= 0 without depending on libm.
+ */
+static float
+rapp_ref_filter_exp(float x)
+{
+    float val  = 1.0f;
+    float term = 1.0f;
+    int   sq   = 0;
+    int   k;
+
+    /* Reduce the argument to [-1/2, 0] */
+    while (x < -0.5f) {
+        x /= 2.0f;
+        sq++;
+    }
+
+    /* Taylor series */
+    for (k = 1; k < 12; k++) {
+        term *= x / k;
+        val  += term;
+    }
+
+    /* Square back */
+    while (sq-- > 0) {
+        val *= val;
+    }
+
+    return val;
+}
+
+/**
+ *  Compute the census code of the neighbourhood centered at src.
+ */
+static uint32_t
+rapp_ref_filter_census(const uint8_t *src, int src_dim, int radius)
+{
+    uint32_t code = 0;
+    int      bit  = 0;
+    int      xx, yy;
+
+    for (yy = -radius; yy <= radius; yy++) {
+        for (xx = -radius; xx <= radius; xx++) {
+            if (xx != 0 || yy != 0) {
+                if (src[yy*src_dim + xx] < src[0]) {
+                    code |= (uint32_t)1 << bit;
+                }
+                bit++;
+            }
+        }
+    }
+
+    return code;
+}
+
+/**
+ *  Count the number of set bits.
+ */
+static int
+rapp_ref_filter_bitcount(uint32_t code)
+{
+    int cnt = 0;
+
+    for (; code; code >>= 1) {
+        cnt += code & 1;
+    }
+
+    return cnt;
+}
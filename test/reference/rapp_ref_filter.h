@@ -96,6 +96,48 @@ rapp_ref_filter_sobel_3x3_magn_u8(float *dst, int dst_dim,
                                   const uint8_t *src, int src_dim,
                                   int width, int height);
 
+void
+rapp_ref_filter_sobel_3x3_magn_dir_u8(uint8_t *mag, int mag_dim,
+                                      uint8_t *dir, int dir_dim,
+                                      const uint8_t *src, int src_dim,
+                                      int width, int height, int bins);
+
+void
+rapp_ref_filter_sobel_3x3_grad_u8_s16(int16_t *gx, int gx_dim,
+                                      int16_t *gy, int gy_dim,
+                                      const uint8_t *src, int src_dim,
+                                      int width, int height);
+
+void
+rapp_ref_filter_diff_1x2_horz_u8_s16(int16_t *dst, int dst_dim,
+                                     const uint8_t *src, int src_dim,
+                                     int width, int height);
+
+void
+rapp_ref_filter_diff_2x1_vert_u8_s16(int16_t *dst, int dst_dim,
+                                     const uint8_t *src, int src_dim,
+                                     int width, int height);
+
+void
+rapp_ref_filter_sobel_3x3_horz_u8_s16(int16_t *dst, int dst_dim,
+                                      const uint8_t *src, int src_dim,
+                                      int width, int height);
+
+void
+rapp_ref_filter_sobel_3x3_vert_u8_s16(int16_t *dst, int dst_dim,
+                                      const uint8_t *src, int src_dim,
+                                      int width, int height);
+
+void
+rapp_ref_filter_laplace_3x3_u8_s16(int16_t *dst, int dst_dim,
+                                   const uint8_t *src, int src_dim,
+                                   int width, int height);
+
+void
+rapp_ref_filter_highpass_3x3_u8_s16(int16_t *dst, int dst_dim,
+                                    const uint8_t *src, int src_dim,
+                                    int width, int height);
+
 void
 rapp_ref_filter_gauss_3x3_u8(float *dst, int dst_dim,
                              const uint8_t *src, int src_dim,
@@ -121,6 +163,107 @@ rapp_ref_filter_highpass_3x3_abs_u8(float *dst, int dst_dim,
                                     const uint8_t *src, int src_dim,
                                     int width, int height);
 
+void
+rapp_ref_filter_conv_u8(uint8_t *dst, int dst_dim,
+                        const uint8_t *src, int src_dim,
+                        int width, int height,
+                        const int8_t *kern, int kern_width, int kern_height,
+                        int shift);
+
+void
+rapp_ref_filter_sep_u8(uint8_t *dst, int dst_dim,
+                       const uint8_t *src, int src_dim,
+                       int width, int height,
+                       const int8_t *xkern, int xlen, int xshift,
+                       const int8_t *ykern, int ylen, int yshift);
+
+void
+rapp_ref_filter_gauss_u8(float *dst, int dst_dim,
+                         const uint8_t *src, int src_dim,
+                         int width, int height, int sigma, int radius);
+
+void
+rapp_ref_filter_rank_u8(uint8_t *dst, int dst_dim,
+                        const uint8_t *src, int src_dim,
+                        int width, int height, int radius, int rank);
+
+void
+rapp_ref_filter_gauss_3x3_u16(uint16_t *dst, int dst_dim,
+                              const uint16_t *src, int src_dim,
+                              int width, int height);
+
+void
+rapp_ref_filter_median_3x3_u16(uint16_t *dst, int dst_dim,
+                               const uint16_t *src, int src_dim,
+                               int width, int height);
+
+void
+rapp_ref_filter_sobel_3x3_horz_u16(uint16_t *dst, int dst_dim,
+                                   const uint16_t *src, int src_dim,
+                                   int width, int height);
+
+void
+rapp_ref_filter_sobel_3x3_horz_abs_u16(uint16_t *dst, int dst_dim,
+                                       const uint16_t *src, int src_dim,
+                                       int width, int height);
+
+void
+rapp_ref_filter_sobel_3x3_vert_u16(uint16_t *dst, int dst_dim,
+                                   const uint16_t *src, int src_dim,
+                                   int width, int height);
+
+void
+rapp_ref_filter_sobel_3x3_vert_abs_u16(uint16_t *dst, int dst_dim,
+                                       const uint16_t *src, int src_dim,
+                                       int width, int height);
+
+void
+rapp_ref_filter_laplace_3x3_u16(uint16_t *dst, int dst_dim,
+                                const uint16_t *src, int src_dim,
+                                int width, int height);
+
+void
+rapp_ref_filter_laplace_3x3_abs_u16(uint16_t *dst, int dst_dim,
+                                    const uint16_t *src, int src_dim,
+                                    int width, int height);
+
+void
+rapp_ref_filter_highpass_3x3_u16(uint16_t *dst, int dst_dim,
+                                 const uint16_t *src, int src_dim,
+                                 int width, int height);
+
+void
+rapp_ref_filter_highpass_3x3_abs_u16(uint16_t *dst, int dst_dim,
+                                     const uint16_t *src, int src_dim,
+                                     int width, int height);
+
+void
+rapp_ref_filter_census_3x3_u8(uint8_t *dst, int dst_dim,
+                              const uint8_t *src, int src_dim,
+                              int width, int height);
+
+void
+rapp_ref_filter_census_5x5_u8_u32(uint32_t *dst, int dst_dim,
+                                  const uint8_t *src, int src_dim,
+                                  int width, int height);
+
+void
+rapp_ref_filter_lbp_3x3_u8(uint8_t *dst, int dst_dim,
+                           const uint8_t *src, int src_dim,
+                           int width, int height);
+
+void
+rapp_ref_filter_census_cost_u8(uint8_t *dst, int dst_dim,
+                               const uint8_t *src1, int src1_dim,
+                               const uint8_t *src2, int src2_dim,
+                               int width, int height, int disparities);
+
+void
+rapp_ref_filter_census_cost_u32_u8(uint8_t *dst, int dst_dim,
+                                   const uint32_t *src1, int src1_dim,
+                                   const uint32_t *src2, int src2_dim,
+                                   int width, int height, int disparities);
+
 #ifdef __cplusplus
 };
 #endif
@@ -161,3 +161,29 @@ rapp_ref_integral_sum_u8_u32(uint32_t *dst, int dst_dim,
         }
     }
 }
+
+void
+rapp_ref_integral_sum_u16_u32(uint32_t *dst, int dst_dim,
+                              const uint16_t *src, int src_dim,
+                              int width, int height)
+{
+    int x, y;
+
+    /* Adjust dimensions to the buffer pixel types */
+    dst_dim = dst_dim / sizeof *dst;
+    src_dim = src_dim / sizeof *src;
+
+    for (y = 0; y < height; y++) {
+        int j1 = y * dst_dim;       /* Dest pixel row */
+        int j2 = (y-1) * dst_dim;   /* Dest index for previous row */
+
+        for (x = 0; x < width; x++) {
+            uint16_t pixel  = src[y * src_dim + x];
+            uint32_t left   = dst[j1 + (x-1)];
+            uint32_t up     = dst[j2 + x];
+            uint32_t upleft = dst[j2 + (x-1)];
+
+            dst[j1 + x] = pixel + left + up - upleft;
+        }
+    }
+}
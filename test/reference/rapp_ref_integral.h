@@ -71,6 +71,11 @@ rapp_ref_integral_sum_u8_u32(uint32_t *dst, int dst_dim,
                              const uint8_t *src, int src_dim,
                              int width, int height);
 
+void
+rapp_ref_integral_sum_u16_u32(uint32_t *dst, int dst_dim,
+                              const uint16_t *src, int src_dim,
+                              int width, int height);
+
 
 #ifdef __cplusplus
 };
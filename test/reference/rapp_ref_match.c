@@ -0,0 +1,119 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_ref_match.c
+ *  @brief  RAPP template matching, reference implementation.
+ */
+
+#include <stdlib.h>         /* abs()             */
+#include "rapp.h"           /* RAPP API          */
+#include "rapp_ref_match.h" /* Template matching */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static double
+rapp_ref_match_sqrt(double val);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+int32_t
+rapp_ref_match_score_u8(const uint8_t *src, int src_dim,
+                        const uint8_t *tpl, int tpl_dim,
+                        int tpl_width, int tpl_height, int mode)
+{
+    double num = (double)tpl_width*tpl_height;
+    double s1  = 0, s2 = 0, t1 = 0, t2 = 0, st = 0;
+    double den;
+    int    sad = 0;
+    int    ssd = 0;
+    int    x, y;
+
+    for (y = 0; y < tpl_height; y++) {
+        for (x = 0; x < tpl_width; x++) {
+            int s = src[y*src_dim + x];
+            int t = tpl[y*tpl_dim + x];
+            sad += abs(s - t);
+            ssd += (s - t)*(s - t);
+            s1  += s;
+            s2  += s*s;
+            t1  += t;
+            t2  += t*t;
+            st  += s*t;
+        }
+    }
+
+    if (mode == RAPP_MATCH_SAD) {
+        return sad;
+    }
+    if (mode == RAPP_MATCH_SSD) {
+        return ssd;
+    }
+
+    den = rapp_ref_match_sqrt((num*s2 - s1*s1)*(num*t2 - t1*t1));
+    if (den == 0) {
+        return 0;
+    }
+
+    return 65536*(num*st - s1*t1) / den;
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Square root with Newton iterations, to avoid linking libm.
+ */
+static double
+rapp_ref_match_sqrt(double val)
+{
+    double res = val;
+    int    k;
+
+    if (val <= 0) {
+        return 0;
+    }
+    for (k = 0; k < 100; k++) {
+        res = (res + val / res) / 2;
+    }
+
+    return res;
+}
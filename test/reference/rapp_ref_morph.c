@@ -0,0 +1,176 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_ref_morph.c
+ *  @brief  RAPP 8-bit morphology, reference implementation.
+ */
+
+#include <stdlib.h>          /* malloc(), free() */
+#include <stdbool.h>         /* bool             */
+#include "rapp_ref_morph.h"  /* 8-bit morphology */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static void
+rapp_ref_morph_rect(uint8_t *dst, int dst_dim,
+                    const uint8_t *src, int src_dim,
+                    int width, int height, int wrect, int hrect,
+                    bool dilate);
+
+static void
+rapp_ref_morph_compound(uint8_t *dst, int dst_dim,
+                        const uint8_t *src, int src_dim,
+                        int width, int height, int wrect, int hrect,
+                        bool open);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+void
+rapp_ref_morph_erode_rect_u8(uint8_t *dst, int dst_dim,
+                             const uint8_t *src, int src_dim,
+                             int width, int height, int wrect, int hrect)
+{
+    rapp_ref_morph_rect(dst, dst_dim, src, src_dim,
+                        width, height, wrect, hrect, false);
+}
+
+void
+rapp_ref_morph_dilate_rect_u8(uint8_t *dst, int dst_dim,
+                              const uint8_t *src, int src_dim,
+                              int width, int height, int wrect, int hrect)
+{
+    rapp_ref_morph_rect(dst, dst_dim, src, src_dim,
+                        width, height, wrect, hrect, true);
+}
+
+void
+rapp_ref_morph_open_rect_u8(uint8_t *dst, int dst_dim,
+                            const uint8_t *src, int src_dim,
+                            int width, int height, int wrect, int hrect)
+{
+    rapp_ref_morph_compound(dst, dst_dim, src, src_dim,
+                            width, height, wrect, hrect, true);
+}
+
+void
+rapp_ref_morph_close_rect_u8(uint8_t *dst, int dst_dim,
+                             const uint8_t *src, int src_dim,
+                             int width, int height, int wrect, int hrect)
+{
+    rapp_ref_morph_compound(dst, dst_dim, src, src_dim,
+                            width, height, wrect, hrect, false);
+}
+
+void
+rapp_ref_morph_tophat_rect_u8(uint8_t *dst, int dst_dim,
+                              const uint8_t *src, int src_dim,
+                              int width, int height, int wrect, int hrect)
+{
+    int x, y;
+
+    rapp_ref_morph_open_rect_u8(dst, dst_dim, src, src_dim,
+                                width, height, wrect, hrect);
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            dst[y*dst_dim + x] = src[y*src_dim + x] - dst[y*dst_dim + x];
+        }
+    }
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the minimum or maximum over the rectangle. The dilation
+ *  uses the reflected rectangle.
+ */
+static void
+rapp_ref_morph_rect(uint8_t *dst, int dst_dim,
+                    const uint8_t *src, int src_dim,
+                    int width, int height, int wrect, int hrect,
+                    bool dilate)
+{
+    int left = dilate ? (wrect - 1) / 2 : wrect / 2;
+    int top  = dilate ? (hrect - 1) / 2 : hrect / 2;
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int val = dilate ? 0 : 0xff;
+            int xx, yy;
+
+            for (yy = 0; yy < hrect; yy++) {
+                for (xx = 0; xx < wrect; xx++) {
+                    int pix = src[(y + yy - top)*src_dim + x + xx - left];
+                    if (dilate ? pix > val : pix < val) {
+                        val = pix;
+                    }
+                }
+            }
+            dst[y*dst_dim + x] = val;
+        }
+    }
+}
+
+/**
+ *  Compute the opening or closing via a temporary image, extended
+ *  with the padding needed by the second operation.
+ */
+static void
+rapp_ref_morph_compound(uint8_t *dst, int dst_dim,
+                        const uint8_t *src, int src_dim,
+                        int width, int height, int wrect, int hrect,
+                        bool open)
+{
+    int      xpad = wrect / 2;
+    int      ypad = hrect / 2;
+    int      dim  = width  + 2*xpad;
+    int      rows = height + 2*ypad;
+    uint8_t *tmp  = malloc(dim*rows);
+
+    rapp_ref_morph_rect(tmp, dim, &src[-ypad*src_dim - xpad], src_dim,
+                        dim, rows, wrect, hrect, !open);
+    rapp_ref_morph_rect(dst, dst_dim, &tmp[ypad*dim + xpad], dim,
+                        width, height, wrect, hrect, open);
+    free(tmp);
+}
@@ -30,8 +30,9 @@
  *  @brief  RAPP pixelwise operations, reference implementation.
  */
 
-#include <stdlib.h>         /* abs()         */
-#include "rapp_ref_pixop.h" /* Reference API */
+#include <stdlib.h>         /* abs(), malloc() */
+#include <string.h>         /* memset()        */
+#include "rapp_ref_pixop.h" /* Reference API   */
 
 /*
  * -------------------------------------------------------------
@@ -61,6 +62,17 @@ rapp_ref_pixop_flip(int val);
 static int
 rapp_ref_pixop_lut(int val, const uint8_t *lut);
 
+static int
+rapp_ref_pixop_clahe_center(int tile, int len, int tiles);
+
+static void
+rapp_ref_pixop_clahe_pos(int *tile, int *alpha, int pos,
+                         int len, int tiles);
+
+static void
+rapp_ref_pixop_clahe_lut(uint8_t *lut, const uint8_t *buf, int dim,
+                         int width, int height, int clip);
+
 static int
 rapp_ref_pixop_abs(int val);
 
@@ -94,6 +106,12 @@ rapp_ref_pixop_lerpi(int v1, int v2, int alpha8);
 static int
 rapp_ref_pixop_norm(int v1, int v2);
 
+static int
+rapp_ref_pixop_add16(int v1, int v2);
+
+static int
+rapp_ref_pixop_sub16(int v1, int v2);
+
 static void
 rapp_ref_pixop_driver(uint8_t *buf, int dim, int width, int height,
                       int (*op)(), intptr_t arg1, int arg2);
@@ -101,6 +119,10 @@ static void
 rapp_ref_pixop_driver2(uint8_t *dst, int dst_dim,
                        const uint8_t *src, int src_dim,
                        int width, int height, int (*op)(), int arg);
+static void
+rapp_ref_pixop_driver16(uint16_t *dst, int dst_dim,
+                        const uint16_t *src, int src_dim,
+                        int width, int height, int (*op)());
 
 /*
  * -------------------------------------------------------------
@@ -266,6 +288,154 @@ rapp_ref_pixop_norm_u8(uint8_t *dst, int dst_dim,
 }
 
 
+/*
+ * -------------------------------------------------------------
+ *  16-bit functions
+ * -------------------------------------------------------------
+ */
+
+void
+rapp_ref_pixop_add_u16(uint16_t *dst, int dst_dim,
+                       const uint16_t *src, int src_dim,
+                       int width, int height)
+{
+    rapp_ref_pixop_driver16(dst, dst_dim, src, src_dim, width, height,
+                            &rapp_ref_pixop_add16);
+}
+
+void
+rapp_ref_pixop_sub_u16(uint16_t *dst, int dst_dim,
+                       const uint16_t *src, int src_dim,
+                       int width, int height)
+{
+    rapp_ref_pixop_driver16(dst, dst_dim, src, src_dim, width, height,
+                            &rapp_ref_pixop_sub16);
+}
+
+void
+rapp_ref_pixop_suba_u16(uint16_t *dst, int dst_dim,
+                        const uint16_t *src, int src_dim,
+                        int width, int height)
+{
+    rapp_ref_pixop_driver16(dst, dst_dim, src, src_dim, width, height,
+                            &rapp_ref_pixop_suba);
+}
+
+void
+rapp_ref_pixop_lut_u16_u8(uint8_t *dst, int dst_dim,
+                          const uint16_t *src, int src_dim,
+                          int width, int height,
+                          const uint8_t *lut, int shift)
+{
+    int y;
+
+    for (y = 0; y < height; y++) {
+        int x;
+        for (x = 0; x < width; x++) {
+            int val = src[y*src_dim/2 + x];
+            dst[y*dst_dim + x] = lut[val >> shift];
+        }
+    }
+}
+
+void
+rapp_ref_pixop_equalize_u8(uint8_t *buf, int dim, int width, int height)
+{
+    unsigned hist[256] = {0};
+    uint8_t  lut[256];
+    unsigned num = width*height;
+    unsigned cdf = 0;
+    unsigned min;
+    int      x, y, k;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            hist[buf[y*dim + x]]++;
+        }
+    }
+
+    for (k = 0; hist[k] == 0; k++) {
+        /* Empty bin */
+    }
+    min = hist[k];
+    if (min == num) {
+        return;
+    }
+
+    for (k = 0; k < 256; k++) {
+        cdf   += hist[k];
+        lut[k] = cdf < min ? 0 :
+                 ((uint64_t)(cdf - min)*0xff + (num - min) / 2) /
+                 (num - min);
+    }
+
+    rapp_ref_pixop_lut_u8(buf, dim, width, height, lut);
+}
+
+void
+rapp_ref_pixop_clahe_u8(uint8_t *buf, int dim, int width, int height,
+                        int tiles, int clip)
+{
+    uint8_t *lut = malloc(tiles*tiles*256);
+    uint8_t *res = malloc(dim*height);
+    int      x, y, i, j;
+
+    /* Compute the lookup table of each tile */
+    for (j = 0; j < tiles; j++) {
+        int y0 = j*height / tiles;
+        int y1 = (j + 1)*height / tiles;
+
+        for (i = 0; i < tiles; i++) {
+            int x0 = i*width / tiles;
+            int x1 = (i + 1)*width / tiles;
+
+            rapp_ref_pixop_clahe_lut(&lut[(j*tiles + i)*256],
+                                     &buf[y0*dim + x0], dim,
+                                     x1 - x0, y1 - y0, clip);
+        }
+    }
+
+    /* Interpolate the tables bilinearly for each pixel */
+    for (y = 0; y < height; y++) {
+        int alpha;
+        int j1;
+
+        rapp_ref_pixop_clahe_pos(&j, &alpha, y, height, tiles);
+        j1 = MIN(j + 1, tiles - 1);
+
+        for (x = 0; x < width; x++) {
+            int     val = buf[y*dim + x];
+            uint8_t v0, v1;
+            int     beta;
+            int     i1;
+
+            rapp_ref_pixop_clahe_pos(&i, &beta, x, width, tiles);
+            i1 = MIN(i + 1, tiles - 1);
+
+            /* Vertical interpolation, as the LERP operation */
+            v0 = lut[(j*tiles + i)*256 + val];
+            v1 = lut[(j*tiles + i1)*256 + val];
+            rapp_ref_pixop_lerp_u8(&v0, 1,
+                                   &lut[(j1*tiles + i)*256 + val], 1,
+                                   1, 1, alpha);
+            rapp_ref_pixop_lerp_u8(&v1, 1,
+                                   &lut[(j1*tiles + i1)*256 + val], 1,
+                                   1, 1, alpha);
+
+            /* Horizontal interpolation */
+            res[y*dim + x] = (v0*(0x100 - beta) + v1*beta + 0x80) >> 8;
+        }
+    }
+
+    for (y = 0; y < height; y++) {
+        memcpy(&buf[y*dim], &res[y*dim], width);
+    }
+
+    free(lut);
+    free(res);
+}
+
+
 /*
  * -------------------------------------------------------------
  *  Local functions
@@ -290,6 +460,75 @@ rapp_ref_pixop_lut(int val, const uint8_t *lut)
     return lut[val];
 }
 
+static int
+rapp_ref_pixop_clahe_center(int tile, int len, int tiles)
+{
+    return (2*tile + 1)*len / (2*tiles);
+}
+
+static void
+rapp_ref_pixop_clahe_pos(int *tile, int *alpha, int pos,
+                         int len, int tiles)
+{
+    int k;
+
+    *tile  = 0;
+    *alpha = 0;
+
+    for (k = 0; k < tiles - 1; k++) {
+        int c0 = rapp_ref_pixop_clahe_center(k,     len, tiles);
+        int c1 = rapp_ref_pixop_clahe_center(k + 1, len, tiles);
+
+        if (pos >= c1) {
+            *tile = k + 1;
+        }
+        else if (pos >= c0) {
+            *tile  = k;
+            *alpha = ((pos - c0) << 8) / (c1 - c0);
+        }
+    }
+}
+
+static void
+rapp_ref_pixop_clahe_lut(uint8_t *lut, const uint8_t *buf, int dim,
+                         int width, int height, int clip)
+{
+    unsigned hist[256] = {0};
+    unsigned num    = width*height;
+    unsigned limit  = (uint64_t)clip*num / (16*256);
+    unsigned excess = 0;
+    unsigned cdf    = 0;
+    int      x, y, k;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            hist[buf[y*dim + x]]++;
+        }
+    }
+
+    if (limit < 1) {
+        limit = 1;
+    }
+    for (k = 0; k < 256; k++) {
+        if (hist[k] > limit) {
+            excess += hist[k] - limit;
+            hist[k] = limit;
+        }
+    }
+
+    for (k = 0; k < 256; k++) {
+        hist[k] += excess / 256;
+    }
+    for (k = 0; k < (int)(excess % 256); k++) {
+        hist[k*256 / (excess % 256)]++;
+    }
+
+    for (k = 0; k < 256; k++) {
+        cdf   += hist[k];
+        lut[k] = ((uint64_t)cdf*0xff + num / 2) / num;
+    }
+}
+
 static int
 rapp_ref_pixop_abs(int val)
 {
@@ -333,6 +572,18 @@ rapp_ref_pixop_suba(int v1, int v2)
     return abs(v1 - v2);
 }
 
+static int
+rapp_ref_pixop_add16(int v1, int v2)
+{
+    return CLAMP(v1 + v2, 0, 0xffff);
+}
+
+static int
+rapp_ref_pixop_sub16(int v1, int v2)
+{
+    return CLAMP(v1 - v2, 0, 0xffff);
+}
+
 static int
 rapp_ref_pixop_lerp(int v1, int v2, int alpha8)
 {
@@ -391,3 +642,21 @@ rapp_ref_pixop_driver2(uint8_t *dst, int dst_dim,
         }
     }
 }
+
+static void
+rapp_ref_pixop_driver16(uint16_t *dst, int dst_dim,
+                        const uint16_t *src, int src_dim,
+                        int width, int height, int (*op)())
+{
+    int y;
+
+    for (y = 0; y < height; y++) {
+        int i = y*src_dim/2;
+        int j = y*dst_dim/2;
+        int x;
+
+        for (x = 0; x < width; x++, i++, j++) {
+            dst[j] = (*op)(dst[j], src[i]);
+        }
+    }
+}
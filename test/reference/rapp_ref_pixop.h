@@ -124,6 +124,34 @@ rapp_ref_pixop_norm_u8(uint8_t *dst, int dst_dim,
                        const uint8_t *src, int src_dim,
                        int width, int height);
 
+void
+rapp_ref_pixop_add_u16(uint16_t *dst, int dst_dim,
+                       const uint16_t *src, int src_dim,
+                       int width, int height);
+
+void
+rapp_ref_pixop_sub_u16(uint16_t *dst, int dst_dim,
+                       const uint16_t *src, int src_dim,
+                       int width, int height);
+
+void
+rapp_ref_pixop_suba_u16(uint16_t *dst, int dst_dim,
+                        const uint16_t *src, int src_dim,
+                        int width, int height);
+
+void
+rapp_ref_pixop_lut_u16_u8(uint8_t *dst, int dst_dim,
+                          const uint16_t *src, int src_dim,
+                          int width, int height,
+                          const uint8_t *lut, int shift);
+
+void
+rapp_ref_pixop_equalize_u8(uint8_t *buf, int dim, int width, int height);
+
+void
+rapp_ref_pixop_clahe_u8(uint8_t *buf, int dim, int width, int height,
+                        int tiles, int clip);
+
 #ifdef __cplusplus
 };
 #endif
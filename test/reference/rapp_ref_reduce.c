@@ -96,3 +96,24 @@ rapp_ref_reduce_2x2_u8(float *dst, int dst_dim,
         }
     }
 }
+
+void
+rapp_ref_reduce_2x2_u16(float *dst, int dst_dim,
+                        const uint16_t *src, int src_dim,
+                        int width, int height)
+{
+    int x, y;
+
+    dst_dim /= sizeof *dst;
+    src_dim /= sizeof *src;
+
+    for (y = 0; y < height; y += 2) {
+        for (x = 0; x < width; x += 2) {
+            int i =  y   *src_dim + x;
+            int j = (y/2)*dst_dim + x/2;
+
+            dst[j] = (src[i          ] + src[i           + 1] +
+                      src[i + src_dim] + src[i + src_dim + 1]) / 4.0f;
+        }
+    }
+}
@@ -60,6 +60,11 @@ rapp_ref_reduce_2x2_u8(float *dst, int dst_dim,
                        const uint8_t *src, int src_dim,
                        int width, int height);
 
+void
+rapp_ref_reduce_2x2_u16(float *dst, int dst_dim,
+                        const uint16_t *src, int src_dim,
+                        int width, int height);
+
 #ifdef __cplusplus
 };
 #endif
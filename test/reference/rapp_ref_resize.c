@@ -0,0 +1,183 @@
+/*  Copyright (C) 2026, Axis Communications AB, LUND, SWEDEN
+ *
+ *  This file is part of RAPP.
+ *
+ *  RAPP is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *  You can use the comments under either the terms of the GNU Lesser General
+ *  Public License version 3 as published by the Free Software Foundation,
+ *  either version 3 of the License or (at your option) any later version, or
+ *  the GNU Free Documentation License version 1.3 or any later version
+ *  published by the Free Software Foundation; with no Invariant Sections, no
+ *  Front-Cover Texts, and no Back-Cover Texts.
+ *  A copy of the license is included in the documentation section entitled
+ *  "GNU Free Documentation License".
+ *
+ *  RAPP is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License and a copy of the GNU Free Documentation License along
+ *  with RAPP. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ *  @file   rapp_ref_resize.c
+ *  @brief  RAPP 8-bit resizing, reference implementation.
+ */
+
+#include <stdlib.h>          /* calloc(), free() */
+#include "rc_stdbool.h"      /* Portable stdbool */
+#include "rapp.h"            /* RAPP API         */
+#include "rapp_ref_resize.h" /* Resizing         */
+
+
+/*
+ * -------------------------------------------------------------
+ *  Macros
+ * -------------------------------------------------------------
+ */
+
+#undef  MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+#undef  MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions fwd declare
+ * -------------------------------------------------------------
+ */
+
+static int*
+rapp_ref_resize_weights(int dst_len, int src_len, int mode);
+
+
+/*
+ * -------------------------------------------------------------
+ *  Exported functions
+ * -------------------------------------------------------------
+ */
+
+void
+rapp_ref_resize_u8(uint8_t *dst, int dst_dim, int dst_width, int dst_height,
+                   const uint8_t *src, int src_dim,
+                   int src_width, int src_height, int mode)
+{
+    int     *xw  = rapp_ref_resize_weights(dst_width,  src_width,  mode);
+    int     *yw  = rapp_ref_resize_weights(dst_height, src_height, mode);
+    bool     vf  = dst_height <= src_height; /* Vertical pass first */
+    int      tw  = vf ? src_width  : dst_width;
+    int      th  = vf ? dst_height : src_height;
+    uint8_t *tmp = malloc(tw*th);
+    int      x, y, k;
+
+    /* The first pass */
+    for (y = 0; y < th; y++) {
+        for (x = 0; x < tw; x++) {
+            int sum = 0x40;
+
+            if (vf) {
+                for (k = 0; k < src_height; k++) {
+                    sum += yw[y*src_height + k]*src[k*src_dim + x];
+                }
+            }
+            else {
+                for (k = 0; k < src_width; k++) {
+                    sum += xw[x*src_width + k]*src[y*src_dim + k];
+                }
+            }
+            tmp[y*tw + x] = sum >> 7;
+        }
+    }
+
+    /* The second pass */
+    for (y = 0; y < dst_height; y++) {
+        for (x = 0; x < dst_width; x++) {
+            int sum = 0x40;
+
+            if (vf) {
+                for (k = 0; k < src_width; k++) {
+                    sum += xw[x*src_width + k]*tmp[y*tw + k];
+                }
+            }
+            else {
+                for (k = 0; k < src_height; k++) {
+                    sum += yw[y*src_height + k]*tmp[k*tw + x];
+                }
+            }
+            dst[y*dst_dim + x] = sum >> 7;
+        }
+    }
+
+    free(xw);
+    free(yw);
+    free(tmp);
+}
+
+
+/*
+ * -------------------------------------------------------------
+ *  Local functions
+ * -------------------------------------------------------------
+ */
+
+/**
+ *  Compute the Q.7 weights of all source pixels for each destination
+ *  pixel in one direction.
+ */
+static int*
+rapp_ref_resize_weights(int dst_len, int src_len, int mode)
+{
+    int *wgt = calloc(dst_len*src_len, sizeof *wgt);
+    int  x, i;
+
+    for (x = 0; x < dst_len; x++) {
+        int *w = &wgt[x*src_len];
+
+        if (mode == RAPP_RESIZE_NEAREST) {
+            /* Pick the pixel that contains the center */
+            w[(2*x + 1)*src_len / (2*dst_len)] = 128;
+        }
+        else if (mode == RAPP_RESIZE_BILINEAR) {
+            /* Interpolate at the mapped center, clamped to the image */
+            int num = (2*x + 1)*src_len - dst_len;
+            int den = 2*dst_len;
+            int pos = 0;
+            int frac = 0;
+
+            if (num > 0) {
+                pos  = num / den;
+                frac = ((num % den)*128 + dst_len) / den;
+            }
+            w[MIN(pos,     src_len - 1)] += 128 - frac;
+            w[MIN(pos + 1, src_len - 1)] += frac;
+        }
+        else {
+            /* Accumulate the covered area of each source pixel */
+            int beg = x*src_len;
+            int end = beg + src_len;
+            int acc = 0;
+            int sum = 0;
+
+            for (i = 0; i < src_len; i++) {
+                int lo = MAX(beg, i*dst_len);
+                int hi = MIN(end, (i + 1)*dst_len);
+
+                if (lo < hi) {
+                    acc += hi - lo;
+                    w[i] = (acc*128 + src_len / 2) / src_len - sum;
+                    sum += w[i];
+                }
+            }
+        }
+    }
+
+    return wgt;
+}
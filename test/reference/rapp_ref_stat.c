@@ -30,7 +30,9 @@
  *  @brief  RAPP statistics, reference implementation.
  */
 
+#include <stdlib.h>          /* abs()      */
 #include <string.h>          /* memset()   */
+#include "rapp.h"            /* RAPP API   */
 #include "rapp_ref_stat.h"   /* Statistics */
 
 
@@ -56,6 +58,10 @@ static void
 rapp_ref_stat_driver(const uint8_t *buf, int dim, int width, int height,
                      uint64_t *sum, void (*accum)(uint64_t*, unsigned));
 
+static void
+rapp_ref_stat_driver16(const uint16_t *buf, int dim, int width, int height,
+                       uint64_t *sum, void (*accum)(uint64_t*, unsigned));
+
 
 /*
  * -------------------------------------------------------------
@@ -150,6 +156,273 @@ rapp_ref_stat_max_u8(const uint8_t *buf, int dim, int width, int height)
     return max;
 }
 
+void
+rapp_ref_stat_sum_u16(const uint16_t *buf, int dim,
+                      int width, int height, uint64_t *sum)
+{
+    uint64_t acc[2] = {0, 0};
+    rapp_ref_stat_driver16(buf, dim, width, height,
+                           acc, &rapp_ref_stat_sum);
+    *sum = acc[0];
+}
+
+int
+rapp_ref_stat_min_u16(const uint16_t *buf, int dim, int width, int height)
+{
+    uint64_t min = 0xffff;
+    rapp_ref_stat_driver16(buf, dim, width, height,
+                           &min, &rapp_ref_stat_min);
+    return min;
+}
+
+int
+rapp_ref_stat_max_u16(const uint16_t *buf, int dim, int width, int height)
+{
+    uint64_t max = 0;
+    rapp_ref_stat_driver16(buf, dim, width, height,
+                           &max, &rapp_ref_stat_max);
+    return max;
+}
+
+void
+rapp_ref_stat_hist_u8(const uint8_t *buf, int dim,
+                      const uint8_t *map, int map_dim,
+                      int width, int height, uint32_t *hist, int bins)
+{
+    int x, y;
+
+    memset(hist, 0, bins*sizeof *hist);
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            if (!map || rapp_pixel_get_bin(map, map_dim, 0, x, y)) {
+                hist[buf[y*dim + x]*bins / 256]++;
+            }
+        }
+    }
+}
+
+void
+rapp_ref_stat_mask_u8(const uint8_t *buf, int dim,
+                      const uint8_t *map, int map_dim,
+                      int width, int height, uint64_t stat[5])
+{
+    int x, y;
+
+    /* Sum, squared sum, count, min and max */
+    stat[0] = 0;
+    stat[1] = 0;
+    stat[2] = 0;
+    stat[3] = 0xff;
+    stat[4] = 0;
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            if (rapp_pixel_get_bin(map, map_dim, 0, x, y)) {
+                unsigned pix = buf[y*dim + x];
+                rapp_ref_stat_sum(stat, pix);
+                rapp_ref_stat_min(&stat[3], pix);
+                rapp_ref_stat_max(&stat[4], pix);
+                stat[2]++;
+            }
+        }
+    }
+}
+
+void
+rapp_ref_stat_minmax_loc_bin(const uint8_t *buf, int dim,
+                             int width, int height,
+                             int minmax[2], unsigned pos[4])
+{
+    int x, y;
+
+    minmax[0] = 1;
+    minmax[1] = 0;
+    memset(pos, 0, 4*sizeof *pos);
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int pix = rapp_pixel_get_bin(buf, dim, 0, x, y);
+            if (pix < minmax[0]) {
+                minmax[0] = pix;
+                pos[0] = x;
+                pos[1] = y;
+            }
+            if (pix > minmax[1]) {
+                minmax[1] = pix;
+                pos[2] = x;
+                pos[3] = y;
+            }
+        }
+    }
+}
+
+void
+rapp_ref_stat_minmax_loc_u8(const uint8_t *buf, int dim,
+                            int width, int height,
+                            int minmax[2], unsigned pos[4])
+{
+    int x, y;
+
+    minmax[0] = 0xff;
+    minmax[1] = 0;
+    memset(pos, 0, 4*sizeof *pos);
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int pix = buf[y*dim + x];
+            if (pix < minmax[0]) {
+                minmax[0] = pix;
+                pos[0] = x;
+                pos[1] = y;
+            }
+            if (pix > minmax[1]) {
+                minmax[1] = pix;
+                pos[2] = x;
+                pos[3] = y;
+            }
+        }
+    }
+}
+
+int
+rapp_ref_stat_max_k_u8(const uint8_t *buf, int dim, int width, int height,
+                       unsigned *pos, int k)
+{
+    int last = 0x100; /* Value of the last pixel found   */
+    int prev = -1;    /* Raster index of the last pixel */
+    int num;
+
+    /* Repeatedly find the next pixel in decreasing value order,
+     * and raster order for equal values */
+    for (num = 0; num < k && num < width*height; num++) {
+        int best = -1;
+        int idx  = -1;
+        int x, y;
+
+        for (y = 0; y < height; y++) {
+            for (x = 0; x < width; x++) {
+                int pix = buf[y*dim + x];
+                int i   = y*width + x;
+                if ((pix < last || (pix == last && i > prev)) &&
+                    pix > best)
+                {
+                    best = pix;
+                    idx  = i;
+                }
+            }
+        }
+
+        pos[2*num]     = idx % width;
+        pos[2*num + 1] = idx / width;
+        last = best;
+        prev = idx;
+    }
+
+    return num;
+}
+
+void
+rapp_ref_stat_tiles_u8(const uint8_t *buf, int dim, int width, int height,
+                       int tile_w, int tile_h, uint32_t *sum,
+                       uint8_t *min, uint8_t *max)
+{
+    int cols = (width  + tile_w - 1) / tile_w;
+    int rows = (height + tile_h - 1) / tile_h;
+    int x, y, k;
+
+    for (k = 0; k < cols*rows; k++) {
+        sum[k] = 0;
+        min[k] = 0xff;
+        max[k] = 0;
+    }
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int pix = buf[y*dim + x];
+            k = (y / tile_h)*cols + x / tile_w;
+            sum[k] += pix;
+            if (pix < min[k]) {
+                min[k] = pix;
+            }
+            if (pix > max[k]) {
+                max[k] = pix;
+            }
+        }
+    }
+}
+
+uintmax_t
+rapp_ref_stat_sad_u8(const uint8_t *src1, int src1_dim,
+                     const uint8_t *src2, int src2_dim,
+                     int width, int height)
+{
+    uintmax_t sum = 0;
+    int       x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            sum += abs(src1[y*src1_dim + x] - src2[y*src2_dim + x]);
+        }
+    }
+
+    return sum;
+}
+
+uintmax_t
+rapp_ref_stat_ssd_u8(const uint8_t *src1, int src1_dim,
+                     const uint8_t *src2, int src2_dim,
+                     int width, int height)
+{
+    uintmax_t sum = 0;
+    int       x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int dif = src1[y*src1_dim + x] - src2[y*src2_dim + x];
+            sum += dif*dif;
+        }
+    }
+
+    return sum;
+}
+
+int32_t
+rapp_ref_stat_ssim_u8(const uint8_t *src1, int src1_dim,
+                      const uint8_t *src2, int src2_dim,
+                      int width, int height)
+{
+    int64_t total = 0;
+    int64_t n     = 64;                /* Pixels in an 8x8 window */
+    int64_t c1    = 65025*n*n;         /* 10000*(0.01*255)^2*n^2  */
+    int64_t c2    = 585225*n*n;        /* 10000*(0.03*255)^2*n^2  */
+    int     x, y, i, j;
+
+    for (y = 0; y + 8 <= height; y++) {
+        for (x = 0; x + 8 <= width; x++) {
+            int64_t s1 = 0, s2 = 0, s11 = 0, s22 = 0, s12 = 0;
+            int64_t num1, den1, num2, den2;
+
+            for (j = y; j < y + 8; j++) {
+                for (i = x; i < x + 8; i++) {
+                    int p1 = src1[j*src1_dim + i];
+                    int p2 = src2[j*src2_dim + i];
+                    s1  += p1;
+                    s2  += p2;
+                    s11 += p1*p1;
+                    s22 += p2*p2;
+                    s12 += p1*p2;
+                }
+            }
+
+            /* The SSIM expanded by 10000*n^2 in both factors */
+            num1 = 20000*s1*s2 + c1;
+            den1 = 10000*(s1*s1 + s2*s2) + c1;
+            num2 = 20000*(n*s12 - s1*s2) + c2;
+            den2 = 10000*(n*(s11 + s22) - s1*s1 - s2*s2) + c2;
+            total += (num1*65536 / den1)*(num2*65536 / den2) / 65536;
+        }
+    }
+
+    return total / ((int64_t)(width - 7)*(height - 7));
+}
+
 
 /*
  * -------------------------------------------------------------
@@ -201,3 +474,16 @@ rapp_ref_stat_driver(const uint8_t *buf, int dim, int width, int height,
         }
     }
 }
+
+static void
+rapp_ref_stat_driver16(const uint16_t *buf, int dim, int width, int height,
+                       uint64_t *sum, void (*accum)(uint64_t*, unsigned))
+{
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            (*accum)(sum, buf[y*dim/2 + x]);
+        }
+    }
+}
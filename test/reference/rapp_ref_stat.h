@@ -72,6 +72,60 @@ rapp_ref_stat_min_u8(const uint8_t *buf, int dim, int width, int height);
 int
 rapp_ref_stat_max_u8(const uint8_t *buf, int dim, int width, int height);
 
+void
+rapp_ref_stat_sum_u16(const uint16_t *buf, int dim,
+                      int width, int height, uint64_t *sum);
+
+int
+rapp_ref_stat_min_u16(const uint16_t *buf, int dim, int width, int height);
+
+int
+rapp_ref_stat_max_u16(const uint16_t *buf, int dim, int width, int height);
+
+void
+rapp_ref_stat_hist_u8(const uint8_t *buf, int dim,
+                      const uint8_t *map, int map_dim,
+                      int width, int height, uint32_t *hist, int bins);
+
+void
+rapp_ref_stat_mask_u8(const uint8_t *buf, int dim,
+                      const uint8_t *map, int map_dim,
+                      int width, int height, uint64_t stat[5]);
+
+void
+rapp_ref_stat_minmax_loc_bin(const uint8_t *buf, int dim,
+                             int width, int height,
+                             int minmax[2], unsigned pos[4]);
+
+void
+rapp_ref_stat_minmax_loc_u8(const uint8_t *buf, int dim,
+                            int width, int height,
+                            int minmax[2], unsigned pos[4]);
+
+int
+rapp_ref_stat_max_k_u8(const uint8_t *buf, int dim, int width, int height,
+                       unsigned *pos, int k);
+
+void
+rapp_ref_stat_tiles_u8(const uint8_t *buf, int dim, int width, int height,
+                       int tile_w, int tile_h, uint32_t *sum,
+                       uint8_t *min, uint8_t *max);
+
+uintmax_t
+rapp_ref_stat_sad_u8(const uint8_t *src1, int src1_dim,
+                     const uint8_t *src2, int src2_dim,
+                     int width, int height);
+
+uintmax_t
+rapp_ref_stat_ssd_u8(const uint8_t *src1, int src1_dim,
+                     const uint8_t *src2, int src2_dim,
+                     int width, int height);
+
+int32_t
+rapp_ref_stat_ssim_u8(const uint8_t *src1, int src1_dim,
+                      const uint8_t *src2, int src2_dim,
+                      int width, int height);
+
 #ifdef __cplusplus
 };
 #endif
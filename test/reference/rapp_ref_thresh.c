@@ -30,6 +30,8 @@
  *  @brief  RAPP thresholding to binary, reference implementation.
  */
 
+#include <stdlib.h>           /* malloc()      */
+#include <string.h>           /* memset()      */
 #include "rapp.h"             /* RAPP API      */
 #include "rapp_ref_thresh.h"  /* Reference API */
 
@@ -66,6 +68,12 @@ rapp_ref_thresh_pixel_driver(uint8_t *dst, int dst_dim,
                              int width, int height,
                              int (*cmp)(int, int, int));
 
+static void
+rapp_ref_thresh_driver16(uint8_t *dst, int dst_dim,
+                         const uint16_t *src, int src_dim,
+                         int width, int height, int thresh,
+                         int (*cmp)(int, int, int));
+
 /*
  * -------------------------------------------------------------
  *  Exported functions
@@ -152,6 +160,214 @@ rapp_ref_thresh_ltgt_pixel_u8(uint8_t *dst, int dst_dim,
                                  width, height, &rapp_ref_thresh_ltgt);
 }
 
+void
+rapp_ref_thresh_gt_u16(uint8_t *dst, int dst_dim,
+                       const uint16_t *src, int src_dim,
+                       int width, int height, int thresh)
+{
+    rapp_ref_thresh_driver16(dst, dst_dim, src, src_dim, width, height,
+                             thresh, &rapp_ref_thresh_gt);
+}
+
+void
+rapp_ref_thresh_lt_u16(uint8_t *dst, int dst_dim,
+                       const uint16_t *src, int src_dim,
+                       int width, int height, int thresh)
+{
+    rapp_ref_thresh_driver16(dst, dst_dim, src, src_dim, width, height,
+                             thresh, &rapp_ref_thresh_lt);
+}
+
+double
+rapp_ref_thresh_otsu_var(const uint32_t *hist, int level)
+{
+    double n0 = 0, n1 = 0;
+    double s0 = 0, s1 = 0;
+    int    k;
+
+    for (k = 0; k < 256; k++) {
+        if (k <= level) {
+            n0 += hist[k];
+            s0 += (double)k*hist[k];
+        }
+        else {
+            n1 += hist[k];
+            s1 += (double)k*hist[k];
+        }
+    }
+    if (n0 == 0 || n1 == 0) {
+        return -1;
+    }
+
+    return n0*n1*(s0/n0 - s1/n1)*(s0/n0 - s1/n1) / ((n0 + n1)*(n0 + n1));
+}
+
+int
+rapp_ref_thresh_triangle(const uint32_t *hist)
+{
+    int64_t best = -1;
+    int     peak = 0, lo = -1, hi = -1, knee, k;
+
+    for (k = 0; k < 256; k++) {
+        if (hist[k]) {
+            lo = lo < 0 ? k : lo;
+            hi = k;
+        }
+        if (hist[k] > hist[peak]) {
+            peak = k;
+        }
+    }
+
+    knee = peak;
+    if (hi - peak >= peak - lo) {
+        /* Right tail, ending at hi */
+        for (k = peak; k < hi; k++) {
+            int64_t d = (int64_t)hist[peak]*(hi - k) -
+                        (int64_t)hist[k]*(hi - peak);
+            if (d > best) {
+                best = d;
+                knee = k;
+            }
+        }
+        return knee;
+    }
+
+    /* Left tail, ending at lo */
+    for (k = peak; k > lo; k--) {
+        int64_t d = (int64_t)hist[peak]*(k - lo) -
+                    (int64_t)hist[k]*(peak - lo);
+        if (d > best) {
+            best = d;
+            knee = k;
+        }
+    }
+    return knee - 1;
+}
+
+void
+rapp_ref_thresh_adaptive_u8(uint8_t *level, int level_dim,
+                            const uint8_t *src, int src_dim,
+                            int width, int height, int radius, int offset)
+{
+    int  rows = height + 2*radius;
+    int  area = (2*radius + 1)*(2*radius + 1);
+    int *hsum = malloc(rows*width*sizeof *hsum);
+    int  x, y, k;
+
+    /* Horizontal sums of all rows, including the vertical border */
+    for (y = 0; y < rows; y++) {
+        const uint8_t *row = &src[(y - radius)*src_dim];
+        for (x = 0; x < width; x++) {
+            int sum = 0;
+            for (k = -radius; k <= radius; k++) {
+                sum += row[x + k];
+            }
+            hsum[y*width + x] = sum;
+        }
+    }
+
+    /* Vertical sums, rounded mean and offset */
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int sum = 0;
+            int val;
+            for (k = 0; k <= 2*radius; k++) {
+                sum += hsum[(y + k)*width + x];
+            }
+            val = (sum + area / 2) / area + offset;
+            level[y*level_dim + x] = val < 0 ? 0 : val > 0xff ? 0xff : val;
+        }
+    }
+
+    free(hsum);
+}
+
+void
+rapp_ref_thresh_absdiff_gt_u8(uint8_t *dst, int dst_dim,
+                              const uint8_t *src1, int src1_dim,
+                              const uint8_t *src2, int src2_dim,
+                              int width, int height, int thresh)
+{
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int diff = abs(src1[y*src1_dim + x] - src2[y*src2_dim + x]);
+            rapp_pixel_set_bin(dst, dst_dim, 0, x, y, diff > thresh);
+        }
+    }
+}
+
+void
+rapp_ref_thresh_absdiff_hyst_u8(uint8_t *dst, int dst_dim,
+                                const uint8_t *src1, int src1_dim,
+                                const uint8_t *src2, int src2_dim,
+                                int width, int height, int low, int high)
+{
+    int *stack = malloc(2*width*height*sizeof *stack);
+    int  top   = 0;
+    int  x, y;
+
+    /* Clear the destination buffer */
+    memset(dst, 0, dst_dim*height);
+
+    /* Push all strong pixels */
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            if (abs(src1[y*src1_dim + x] - src2[y*src2_dim + x]) > high) {
+                rapp_pixel_set_bin(dst, dst_dim, 0, x, y, 1);
+                stack[top++] = x;
+                stack[top++] = y;
+            }
+        }
+    }
+
+    /* Trace the weak pixels connected to them */
+    while (top > 0) {
+        int i, j;
+
+        y = stack[--top];
+        x = stack[--top];
+        for (i = -1; i <= 1; i++) {
+            for (j = -1; j <= 1; j++) {
+                int xx = x + j;
+                int yy = y + i;
+
+                if (xx >= 0 && xx < width && yy >= 0 && yy < height &&
+                    abs(src1[yy*src1_dim + xx] -
+                        src2[yy*src2_dim + xx]) > low &&
+                    !rapp_pixel_get_bin(dst, dst_dim, 0, xx, yy))
+                {
+                    rapp_pixel_set_bin(dst, dst_dim, 0, xx, yy, 1);
+                    stack[top++] = xx;
+                    stack[top++] = yy;
+                }
+            }
+        }
+    }
+
+    free(stack);
+}
+
+int
+rapp_ref_thresh_percentile(const uint32_t *hist, int percent)
+{
+    uint64_t total = 0, cnt = 0;
+    int      k;
+
+    for (k = 0; k < 256; k++) {
+        total += hist[k];
+    }
+    for (k = 0; k < 256; k++) {
+        cnt += hist[k];
+        if (100*cnt >= (uint64_t)percent*total) {
+            return k;
+        }
+    }
+
+    return 255;
+}
+
 /*
  * -------------------------------------------------------------
  *  Local functions
@@ -229,3 +445,21 @@ rapp_ref_thresh_pixel_driver(uint8_t *dst, int dst_dim,
         }
     }
 }
+
+static void
+rapp_ref_thresh_driver16(uint8_t *dst, int dst_dim,
+                         const uint16_t *src, int src_dim,
+                         int width, int height, int thresh,
+                         int (*cmp)(int, int, int))
+{
+    int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            int val = src[y*src_dim/2 + x];
+            int bit = (*cmp)(val, thresh, 0);
+
+            rapp_pixel_set_bin(dst, dst_dim, 0, x, y, bit);
+        }
+    }
+}
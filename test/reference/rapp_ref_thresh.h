@@ -90,6 +90,42 @@ rapp_ref_thresh_ltgt_pixel_u8(uint8_t *dst, int dst_dim,
                               const uint8_t *high, int high_dim,
                               int width, int height);
 
+void
+rapp_ref_thresh_gt_u16(uint8_t *dst, int dst_dim,
+                       const uint16_t *src, int src_dim,
+                       int width, int height, int thresh);
+
+void
+rapp_ref_thresh_lt_u16(uint8_t *dst, int dst_dim,
+                       const uint16_t *src, int src_dim,
+                       int width, int height, int thresh);
+
+double
+rapp_ref_thresh_otsu_var(const uint32_t *hist, int level);
+
+int
+rapp_ref_thresh_triangle(const uint32_t *hist);
+
+int
+rapp_ref_thresh_percentile(const uint32_t *hist, int percent);
+
+void
+rapp_ref_thresh_adaptive_u8(uint8_t *level, int level_dim,
+                            const uint8_t *src, int src_dim,
+                            int width, int height, int radius, int offset);
+
+void
+rapp_ref_thresh_absdiff_gt_u8(uint8_t *dst, int dst_dim,
+                              const uint8_t *src1, int src1_dim,
+                              const uint8_t *src2, int src2_dim,
+                              int width, int height, int thresh);
+
+void
+rapp_ref_thresh_absdiff_hyst_u8(uint8_t *dst, int dst_dim,
+                                const uint8_t *src1, int src1_dim,
+                                const uint8_t *src2, int src2_dim,
+                                int width, int height, int low, int high);
+
 #ifdef __cplusplus
 };
 #endif